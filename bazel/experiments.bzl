@@ -20,12 +20,19 @@ EXPERIMENTS = {
     "dbg": {
     },
     "off": {
+        "authz_test": [
+            "compiled_rbac",
+        ],
         "census_test": [
             "transport_supplies_client_latency",
         ],
         "core_end2end_test": [
+            "coalesce_header_slices",
+            "intern_metadata_values",
             "promise_based_client_call",
             "promise_based_server_call",
+            "ssl_zero_copy_protector",
+            "wakeup_run_queue",
         ],
         "endpoint_test": [
             "tcp_frame_size_tuning",
@@ -42,12 +49,20 @@ EXPERIMENTS = {
             "tcp_frame_size_tuning",
             "tcp_rcv_lowat",
         ],
+        "hpack_test": [
+            "coalesce_header_slices",
+            "intern_metadata_values",
+        ],
         "lame_client_test": [
             "promise_based_client_call",
         ],
+        "promise_test": [
+            "wakeup_run_queue",
+        ],
         "resource_quota_test": [
             "free_large_allocator",
             "memory_pressure_controller",
+            "slice_pool",
             "unconstrained_max_quota_buffer_size",
         ],
     },
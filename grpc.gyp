@@ -372,6 +372,9 @@
         'upb',
       ],
       'sources': [
+        'src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_filter.cc',
+        'src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_service_config_parser.cc',
+        'src/core/ext/filters/adaptive_concurrency/concurrency_limiter.cc',
         'src/core/ext/filters/census/grpc_context.cc',
         'src/core/ext/filters/channel_idle/channel_idle_filter.cc',
         'src/core/ext/filters/channel_idle/idle_filter_state.cc',
@@ -808,6 +811,7 @@
         'src/core/ext/xds/xds_http_stateful_session_filter.cc',
         'src/core/ext/xds/xds_lb_policy_registry.cc',
         'src/core/ext/xds/xds_listener.cc',
+        'src/core/ext/xds/xds_resource_snapshot.cc',
         'src/core/ext/xds/xds_route_config.cc',
         'src/core/ext/xds/xds_routing.cc',
         'src/core/ext/xds/xds_server_config_fetcher.cc',
@@ -815,6 +819,7 @@
         'src/core/lib/address_utils/parse_address.cc',
         'src/core/lib/address_utils/sockaddr_utils.cc',
         'src/core/lib/backoff/backoff.cc',
+        'src/core/lib/channel/call_attribution.cc',
         'src/core/lib/channel/channel_args.cc',
         'src/core/lib/channel/channel_args_preconditioning.cc',
         'src/core/lib/channel/channel_stack.cc',
@@ -964,6 +969,7 @@
         'src/core/lib/json/json_object_loader.cc',
         'src/core/lib/json/json_reader.cc',
         'src/core/lib/json/json_util.cc',
+        'src/core/lib/json/json_view.cc',
         'src/core/lib/json/json_writer.cc',
         'src/core/lib/load_balancing/lb_policy.cc',
         'src/core/lib/load_balancing/lb_policy_registry.cc',
@@ -971,6 +977,7 @@
         'src/core/lib/promise/activity.cc',
         'src/core/lib/promise/sleep.cc',
         'src/core/lib/promise/trace.cc',
+        'src/core/lib/promise/wakeup_run_queue.cc',
         'src/core/lib/resolver/resolver.cc',
         'src/core/lib/resolver/resolver_registry.cc',
         'src/core/lib/resolver/server_address.cc',
@@ -979,9 +986,11 @@
         'src/core/lib/resource_quota/memory_quota.cc',
         'src/core/lib/resource_quota/periodic_update.cc',
         'src/core/lib/resource_quota/resource_quota.cc',
+        'src/core/lib/resource_quota/slice_pool.cc',
         'src/core/lib/resource_quota/thread_quota.cc',
         'src/core/lib/resource_quota/trace.cc',
         'src/core/lib/security/authorization/authorization_policy_provider_vtable.cc',
+        'src/core/lib/security/authorization/compiled_rbac_policy.cc',
         'src/core/lib/security/authorization/evaluate_args.cc',
         'src/core/lib/security/authorization/grpc_authorization_engine.cc',
         'src/core/lib/security/authorization/grpc_server_authz_filter.cc',
@@ -1037,6 +1046,7 @@
         'src/core/lib/security/security_connector/ssl_utils_config.cc',
         'src/core/lib/security/security_connector/tls/tls_security_connector.cc',
         'src/core/lib/security/transport/client_auth_filter.cc',
+        'src/core/lib/security/transport/handshake_offload_pool.cc',
         'src/core/lib/security/transport/secure_endpoint.cc',
         'src/core/lib/security/transport/security_handshaker.cc',
         'src/core/lib/security/transport/server_auth_filter.cc',
@@ -1045,6 +1055,7 @@
         'src/core/lib/service_config/service_config_impl.cc',
         'src/core/lib/service_config/service_config_parser.cc',
         'src/core/lib/slice/b64.cc',
+        'src/core/lib/slice/interned_slice_table.cc',
         'src/core/lib/slice/percent_encoding.cc',
         'src/core/lib/slice/slice.cc',
         'src/core/lib/slice/slice_buffer.cc',
@@ -1114,6 +1125,7 @@
         'src/core/tsi/ssl/session_cache/ssl_session_boringssl.cc',
         'src/core/tsi/ssl/session_cache/ssl_session_cache.cc',
         'src/core/tsi/ssl/session_cache/ssl_session_openssl.cc',
+        'src/core/tsi/ssl/session_cache/ssl_ticket_key_store.cc',
         'src/core/tsi/ssl_transport_security.cc',
         'src/core/tsi/ssl_transport_security_utils.cc',
         'src/core/tsi/transport_security.cc',
@@ -1184,6 +1196,9 @@
         'upb',
       ],
       'sources': [
+        'src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_filter.cc',
+        'src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_service_config_parser.cc',
+        'src/core/ext/filters/adaptive_concurrency/concurrency_limiter.cc',
         'src/core/ext/filters/census/grpc_context.cc',
         'src/core/ext/filters/channel_idle/channel_idle_filter.cc',
         'src/core/ext/filters/channel_idle/idle_filter_state.cc',
@@ -1296,6 +1311,7 @@
         'src/core/lib/address_utils/parse_address.cc',
         'src/core/lib/address_utils/sockaddr_utils.cc',
         'src/core/lib/backoff/backoff.cc',
+        'src/core/lib/channel/call_attribution.cc',
         'src/core/lib/channel/channel_args.cc',
         'src/core/lib/channel/channel_args_preconditioning.cc',
         'src/core/lib/channel/channel_stack.cc',
@@ -1443,12 +1459,14 @@
         'src/core/lib/iomgr/wakeup_fd_posix.cc',
         'src/core/lib/json/json_object_loader.cc',
         'src/core/lib/json/json_reader.cc',
+        'src/core/lib/json/json_view.cc',
         'src/core/lib/json/json_writer.cc',
         'src/core/lib/load_balancing/lb_policy.cc',
         'src/core/lib/load_balancing/lb_policy_registry.cc',
         'src/core/lib/promise/activity.cc',
         'src/core/lib/promise/sleep.cc',
         'src/core/lib/promise/trace.cc',
+        'src/core/lib/promise/wakeup_run_queue.cc',
         'src/core/lib/resolver/resolver.cc',
         'src/core/lib/resolver/resolver_registry.cc',
         'src/core/lib/resolver/server_address.cc',
@@ -1457,6 +1475,7 @@
         'src/core/lib/resource_quota/memory_quota.cc',
         'src/core/lib/resource_quota/periodic_update.cc',
         'src/core/lib/resource_quota/resource_quota.cc',
+        'src/core/lib/resource_quota/slice_pool.cc',
         'src/core/lib/resource_quota/thread_quota.cc',
         'src/core/lib/resource_quota/trace.cc',
         'src/core/lib/security/authorization/authorization_policy_provider_vtable.cc',
@@ -1484,6 +1503,7 @@
         'src/core/lib/security/security_connector/load_system_roots_supported.cc',
         'src/core/lib/security/security_connector/security_connector.cc',
         'src/core/lib/security/transport/client_auth_filter.cc',
+        'src/core/lib/security/transport/handshake_offload_pool.cc',
         'src/core/lib/security/transport/secure_endpoint.cc',
         'src/core/lib/security/transport/security_handshaker.cc',
         'src/core/lib/security/transport/server_auth_filter.cc',
@@ -1492,6 +1512,7 @@
         'src/core/lib/service_config/service_config_impl.cc',
         'src/core/lib/service_config/service_config_parser.cc',
         'src/core/lib/slice/b64.cc',
+        'src/core/lib/slice/interned_slice_table.cc',
         'src/core/lib/slice/percent_encoding.cc',
         'src/core/lib/slice/slice.cc',
         'src/core/lib/slice/slice_buffer.cc',
@@ -1802,6 +1823,7 @@
         'src/core/ext/upb-generated/src/proto/grpc/gcp/transport_security_common.upb.c',
         'src/core/lib/address_utils/parse_address.cc',
         'src/core/lib/address_utils/sockaddr_utils.cc',
+        'src/core/lib/channel/call_attribution.cc',
         'src/core/lib/channel/channel_args.cc',
         'src/core/lib/channel/channel_args_preconditioning.cc',
         'src/core/lib/channel/channel_stack.cc',
@@ -1945,6 +1967,7 @@
         'src/core/lib/iomgr/wakeup_fd_pipe.cc',
         'src/core/lib/iomgr/wakeup_fd_posix.cc',
         'src/core/lib/json/json_reader.cc',
+        'src/core/lib/json/json_view.cc',
         'src/core/lib/json/json_writer.cc',
         'src/core/lib/load_balancing/lb_policy.cc',
         'src/core/lib/load_balancing/lb_policy_registry.cc',
@@ -1959,9 +1982,11 @@
         'src/core/lib/resource_quota/memory_quota.cc',
         'src/core/lib/resource_quota/periodic_update.cc',
         'src/core/lib/resource_quota/resource_quota.cc',
+        'src/core/lib/resource_quota/slice_pool.cc',
         'src/core/lib/resource_quota/thread_quota.cc',
         'src/core/lib/resource_quota/trace.cc',
         'src/core/lib/security/authorization/authorization_policy_provider_vtable.cc',
+        'src/core/lib/security/authorization/compiled_rbac_policy.cc',
         'src/core/lib/security/authorization/evaluate_args.cc',
         'src/core/lib/security/authorization/grpc_authorization_engine.cc',
         'src/core/lib/security/authorization/grpc_authorization_policy_provider.cc',
@@ -1987,6 +2012,7 @@
         'src/core/lib/security/security_connector/load_system_roots_supported.cc',
         'src/core/lib/security/security_connector/security_connector.cc',
         'src/core/lib/security/transport/client_auth_filter.cc',
+        'src/core/lib/security/transport/handshake_offload_pool.cc',
         'src/core/lib/security/transport/secure_endpoint.cc',
         'src/core/lib/security/transport/security_handshaker.cc',
         'src/core/lib/security/transport/server_auth_filter.cc',
@@ -201,6 +201,12 @@ typedef struct {
 #define GRPC_ARG_HTTP2_MAX_FRAME_SIZE "grpc.http2.max_frame_size"
 /** Should BDP probing be performed? */
 #define GRPC_ARG_HTTP2_BDP_PROBE "grpc.http2.bdp_probe"
+/** If non-zero, a client connection is not reported as connected (and the
+    subchannel does not become READY) until the server has acknowledged an
+    HTTP/2 PING sent after its SETTINGS frame, so that the first RPCs on the
+    connection do not pay for a cold path through the network. The PING must
+    complete before the connection deadline. Defaults to 0. */
+#define GRPC_ARG_HTTP2_PING_BEFORE_READY "grpc.http2.ping_before_ready"
 /** (DEPRECATED) Does not have any effect.
     Earlier, this arg configured the minimum time between successive ping frames
     without receiving any data/header frame, Int valued, milliseconds. This put
@@ -268,6 +274,21 @@ typedef struct {
 /** The time between the first and second connection attempts, in ms */
 #define GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS \
   "grpc.initial_reconnect_backoff_ms"
+/** Number of connections a subchannel keeps open to its address. Calls are
+    sent on the connection with the fewest active calls. Int valued,
+    defaults to 1. */
+#define GRPC_ARG_SUBCHANNEL_MIN_CONNECTIONS "grpc.subchannel.min_connections"
+/** Maximum number of connections a subchannel opens to its address. Beyond
+    GRPC_ARG_SUBCHANNEL_MIN_CONNECTIONS, a new connection is opened whenever
+    every existing connection has at least
+    GRPC_ARG_SUBCHANNEL_STREAMS_PER_CONNECTION active calls. Int valued,
+    defaults to the minimum. */
+#define GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS "grpc.subchannel.max_connections"
+/** Number of active calls at which a subchannel connection is considered
+    saturated; see GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS. Int valued, defaults
+    to 100. */
+#define GRPC_ARG_SUBCHANNEL_STREAMS_PER_CONNECTION \
+  "grpc.subchannel.streams_per_connection"
 /** Minimum amount of time between DNS resolutions, in ms */
 #define GRPC_ARG_DNS_MIN_TIME_BETWEEN_RESOLUTIONS_MS \
   "grpc.dns_min_time_between_resolutions_ms"
@@ -286,6 +307,13 @@ typedef struct {
     grpc_ssl_session_cache*). (use grpc_ssl_session_cache_arg_vtable() to fetch
     an appropriate pointer arg vtable) */
 #define GRPC_SSL_SESSION_CACHE_ARG "grpc.ssl_session_cache"
+/** Server-side: if non-zero, session tickets are encrypted with rotating keys
+    shared by all the SSL/TLS servers of the process that set this argument,
+    so that a session established with one server credential can be resumed
+    on another one that verifies clients the same way. Defaults to 0, in
+    which case each server credential uses its own ticket keys. */
+#define GRPC_SSL_SHARE_SESSION_TICKET_KEYS_ARG \
+  "grpc.ssl_share_session_ticket_keys"
 /** If non-zero, it will determine the maximum frame size used by TSI's frame
  *  protector.
  */
@@ -313,6 +341,16 @@ typedef struct {
     values set in the LB policy config will be capped to this value.
     Default is 4096. */
 #define GRPC_ARG_RING_HASH_LB_RING_SIZE_CAP "grpc.lb.ring_hash.ring_size_cap"
+/** If non-zero, the pick_first LB policy connects to all addresses in
+    parallel (rather than one at a time) and selects the first one to become
+    READY, and round_robin does not switch to an updated address list until
+    every new address has finished connecting. Defaults to 0. */
+#define GRPC_ARG_LB_EAGER_CONNECT "grpc.lb.eager_connect"
+/** Number of connected subchannels that the pick_first LB policy keeps warm
+    in addition to the selected one. If the selected subchannel disconnects,
+    pick_first fails over to a READY standby instead of going IDLE. Int
+    valued, defaults to 0. */
+#define GRPC_ARG_LB_STANDBY_SUBCHANNELS "grpc.lb.standby_subchannels"
 /** The grpc_socket_mutator instance that set the socket options. A pointer. */
 #define GRPC_ARG_SOCKET_MUTATOR "grpc.socket_mutator"
 /** The grpc_socket_factory instance to create and bind sockets. A pointer. */
@@ -0,0 +1,196 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_filter.h"
+
+#include <string>
+#include <utility>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
+
+#include <grpc/status.h>
+#include <grpc/support/log.h>
+#include <grpc/support/time.h>
+
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_service_config_parser.h"
+#include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/channel/channel_stack_builder.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/time_precise.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/json/json_args.h"
+#include "src/core/lib/json/json_object_loader.h"
+#include "src/core/lib/promise/map.h"
+#include "src/core/lib/promise/promise.h"
+#include "src/core/lib/surface/channel_init.h"
+#include "src/core/lib/surface/channel_stack_type.h"
+#include "src/core/lib/transport/metadata_batch.h"
+
+namespace grpc_core {
+
+TraceFlag grpc_adaptive_concurrency_filter_trace(false,
+                                                 "adaptive_concurrency");
+
+namespace {
+
+// Statuses that indicate the call was dropped because a server (or something
+// in between) was overloaded.
+bool IsOverloadStatus(grpc_status_code status) {
+  return status == GRPC_STATUS_RESOURCE_EXHAUSTED ||
+         status == GRPC_STATUS_UNAVAILABLE ||
+         status == GRPC_STATUS_DEADLINE_EXCEEDED;
+}
+
+// Holds the slot acquired for one call. If the call completes, its latency
+// is reported to the limiter; if the call promise is destroyed first (the
+// call was cancelled), the slot is released without a sample.
+class CallTracker {
+ public:
+  explicit CallTracker(ConcurrencyLimiter* limiter)
+      : limiter_(limiter), start_(gpr_get_cycle_counter()) {}
+  ~CallTracker() {
+    if (limiter_ != nullptr) limiter_->ReleaseWithoutSample();
+  }
+
+  CallTracker(const CallTracker&) = delete;
+  CallTracker& operator=(const CallTracker&) = delete;
+  CallTracker(CallTracker&& other) noexcept
+      : limiter_(std::exchange(other.limiter_, nullptr)),
+        start_(other.start_) {}
+  CallTracker& operator=(CallTracker&& other) noexcept {
+    std::swap(limiter_, other.limiter_);
+    start_ = other.start_;
+    return *this;
+  }
+
+  void Finish(const ServerMetadata& trailing_metadata) {
+    const double rtt_us = gpr_timespec_to_micros(
+        gpr_cycle_counter_sub(gpr_get_cycle_counter(), start_));
+    const grpc_status_code status =
+        trailing_metadata.get(GrpcStatusMetadata())
+            .value_or(GRPC_STATUS_UNKNOWN);
+    std::exchange(limiter_, nullptr)->Release(rtt_us, IsOverloadStatus(status));
+  }
+
+ private:
+  ConcurrencyLimiter* limiter_;
+  gpr_cycle_counter start_;
+};
+
+}  // namespace
+
+//
+// AdaptiveConcurrencyFilter
+//
+
+ArenaPromise<ServerMetadataHandle> AdaptiveConcurrencyFilter::MakeCallPromise(
+    CallArgs call_args, NextPromiseFactory next_promise_factory) {
+  if (!limiter_->TryAcquire()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_adaptive_concurrency_filter_trace)) {
+      gpr_log(GPR_INFO, "chand=%p: shedding call, %s", this,
+              limiter_->ToString().c_str());
+    }
+    return Immediate(ServerMetadataFromStatus(absl::ResourceExhaustedError(
+        absl::StrCat("Concurrency limit exceeded (limit ", limiter_->limit(),
+                     ")"))));
+  }
+  return Map(next_promise_factory(std::move(call_args)),
+             [tracker = CallTracker(limiter_.get())](
+                 ServerMetadataHandle trailing_metadata) mutable {
+               tracker.Finish(*trailing_metadata);
+               return trailing_metadata;
+             });
+}
+
+//
+// ClientAdaptiveConcurrencyFilter
+//
+
+const grpc_channel_filter ClientAdaptiveConcurrencyFilter::kFilter =
+    MakePromiseBasedFilter<ClientAdaptiveConcurrencyFilter,
+                           FilterEndpoint::kClient>(
+        "client_adaptive_concurrency");
+
+absl::StatusOr<ClientAdaptiveConcurrencyFilter>
+ClientAdaptiveConcurrencyFilter::Create(const ChannelArgs& args,
+                                        ChannelFilter::Args) {
+  auto limiter = args.GetObjectRef<ConcurrencyLimiter>();
+  if (limiter == nullptr) {
+    return absl::InvalidArgumentError(
+        "concurrency limiter missing in client adaptive concurrency filter");
+  }
+  return ClientAdaptiveConcurrencyFilter(std::move(limiter));
+}
+
+//
+// ServerAdaptiveConcurrencyFilter
+//
+
+const grpc_channel_filter ServerAdaptiveConcurrencyFilter::kFilter =
+    MakePromiseBasedFilter<ServerAdaptiveConcurrencyFilter,
+                           FilterEndpoint::kServer>(
+        "server_adaptive_concurrency");
+
+absl::StatusOr<ServerAdaptiveConcurrencyFilter>
+ServerAdaptiveConcurrencyFilter::Create(const ChannelArgs& args,
+                                        ChannelFilter::Args) {
+  auto config = AdaptiveConcurrencyConfigFromChannelArgs(args);
+  if (!config.ok()) return config.status();
+  if (!config->has_value()) {
+    return absl::InvalidArgumentError(
+        "adaptive concurrency config missing from channel args");
+  }
+  // All connections of a server share one limiter; servers configured
+  // identically share it too, which is what an overloaded process wants.
+  return ServerAdaptiveConcurrencyFilter(
+      ConcurrencyLimiterMap::Get()->GetLimiter(
+          absl::StrCat("server:",
+                       *args.GetString(GRPC_ARG_ADAPTIVE_CONCURRENCY_CONFIG)),
+          **config));
+}
+
+absl::StatusOr<absl::optional<ConcurrencyLimiter::Config>>
+AdaptiveConcurrencyConfigFromChannelArgs(const ChannelArgs& args) {
+  absl::optional<absl::string_view> config_string =
+      args.GetString(GRPC_ARG_ADAPTIVE_CONCURRENCY_CONFIG);
+  if (!config_string.has_value()) return absl::nullopt;
+  auto json = Json::Parse(*config_string);
+  if (!json.ok()) return json.status();
+  auto config = LoadFromJson<ConcurrencyLimiter::Config>(*json);
+  if (!config.ok()) return config.status();
+  return std::move(*config);
+}
+
+void RegisterAdaptiveConcurrencyFilter(CoreConfiguration::Builder* builder) {
+  AdaptiveConcurrencyServiceConfigParser::Register(builder);
+  builder->channel_init()->RegisterStage(
+      GRPC_SERVER_CHANNEL, GRPC_CHANNEL_INIT_BUILTIN_PRIORITY,
+      [](ChannelStackBuilder* builder) {
+        auto channel_args = builder->channel_args();
+        if (!channel_args.WantMinimalStack() &&
+            channel_args.Contains(GRPC_ARG_ADAPTIVE_CONCURRENCY_CONFIG)) {
+          builder->PrependFilter(&ServerAdaptiveConcurrencyFilter::kFilter);
+        }
+        return true;
+      });
+}
+
+}  // namespace grpc_core
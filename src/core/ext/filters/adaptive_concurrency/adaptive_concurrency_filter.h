@@ -0,0 +1,97 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_FILTER_H
+#define GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_FILTER_H
+
+#include <grpc/support/port_platform.h>
+
+#include "absl/status/statusor.h"
+#include "absl/types/optional.h"
+
+#include "src/core/ext/filters/adaptive_concurrency/concurrency_limiter.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_fwd.h"
+#include "src/core/lib/channel/promise_based_filter.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/promise/arena_promise.h"
+#include "src/core/lib/transport/transport.h"
+
+// Channel arg (string) holding the adaptive concurrency configuration for a
+// server, as a JSON object of the same shape as the "adaptiveConcurrency"
+// field of the client's service config. Servers have no service config, so
+// this is how the server side filter is enabled.
+#define GRPC_ARG_ADAPTIVE_CONCURRENCY_CONFIG \
+  "grpc.experimental.adaptive_concurrency_config"
+
+namespace grpc_core {
+
+extern TraceFlag grpc_adaptive_concurrency_filter_trace;
+
+// Sheds calls in excess of a concurrency limit that is learned from observed
+// call latency. Rejected calls fail with RESOURCE_EXHAUSTED.
+class AdaptiveConcurrencyFilter : public ChannelFilter {
+ public:
+  ArenaPromise<ServerMetadataHandle> MakeCallPromise(
+      CallArgs call_args, NextPromiseFactory next_promise_factory) override;
+
+  ConcurrencyLimiter* limiter() const { return limiter_.get(); }
+
+ protected:
+  explicit AdaptiveConcurrencyFilter(
+      RefCountedPtr<ConcurrencyLimiter> limiter)
+      : limiter_(std::move(limiter)) {}
+
+ private:
+  RefCountedPtr<ConcurrencyLimiter> limiter_;
+};
+
+// Client side instance. Added to the client channel's dynamic filter stack
+// when the service config contains an "adaptiveConcurrency" field, so it
+// applies to the logical call (before retries) and sheds load before a call
+// is queued for an LB pick or reaches the transport.
+class ClientAdaptiveConcurrencyFilter final : public AdaptiveConcurrencyFilter {
+ public:
+  static const grpc_channel_filter kFilter;
+
+  static absl::StatusOr<ClientAdaptiveConcurrencyFilter> Create(
+      const ChannelArgs& args, ChannelFilter::Args filter_args);
+
+ private:
+  using AdaptiveConcurrencyFilter::AdaptiveConcurrencyFilter;
+};
+
+// Server side instance. Rejects calls as soon as the client initial metadata
+// arrives, before any message is read or deserialized.
+class ServerAdaptiveConcurrencyFilter final : public AdaptiveConcurrencyFilter {
+ public:
+  static const grpc_channel_filter kFilter;
+
+  static absl::StatusOr<ServerAdaptiveConcurrencyFilter> Create(
+      const ChannelArgs& args, ChannelFilter::Args filter_args);
+
+ private:
+  using AdaptiveConcurrencyFilter::AdaptiveConcurrencyFilter;
+};
+
+// Returns the server side limiter config from channel args, or nullopt if
+// adaptive concurrency is not configured.
+absl::StatusOr<absl::optional<ConcurrencyLimiter::Config>>
+AdaptiveConcurrencyConfigFromChannelArgs(const ChannelArgs& args);
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_FILTER_H
@@ -0,0 +1,65 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_service_config_parser.h"
+
+#include "absl/types/optional.h"
+
+#include "src/core/lib/json/json_args.h"
+#include "src/core/lib/json/json_object_loader.h"
+
+namespace grpc_core {
+
+namespace {
+
+struct GlobalConfig {
+  absl::optional<ConcurrencyLimiter::Config> adaptive_concurrency;
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<GlobalConfig>()
+            .OptionalField("adaptiveConcurrency",
+                           &GlobalConfig::adaptive_concurrency)
+            .Finish();
+    return loader;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<ServiceConfigParser::ParsedConfig>
+AdaptiveConcurrencyServiceConfigParser::ParseGlobalParams(
+    const ChannelArgs& /*args*/, const Json& json, ValidationErrors* errors) {
+  auto global_params = LoadFromJson<GlobalConfig>(json, JsonArgs(), errors);
+  if (!global_params.adaptive_concurrency.has_value()) return nullptr;
+  return std::make_unique<AdaptiveConcurrencyParsedConfig>(
+      *global_params.adaptive_concurrency);
+}
+
+void AdaptiveConcurrencyServiceConfigParser::Register(
+    CoreConfiguration::Builder* builder) {
+  builder->service_config_parser()->RegisterParser(
+      std::make_unique<AdaptiveConcurrencyServiceConfigParser>());
+}
+
+size_t AdaptiveConcurrencyServiceConfigParser::ParserIndex() {
+  return CoreConfiguration::Get().service_config_parser().GetParserIndex(
+      parser_name());
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,78 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_SERVICE_CONFIG_PARSER_H
+#define GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_SERVICE_CONFIG_PARSER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <memory>
+
+#include "absl/strings/string_view.h"
+
+#include "src/core/ext/filters/adaptive_concurrency/concurrency_limiter.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/validation_errors.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/service_config/service_config_parser.h"
+
+namespace grpc_core {
+
+// Global service config parameters for the client side adaptive concurrency
+// filter, e.g.:
+//   "adaptiveConcurrency": {
+//     "algorithm": "GRADIENT",
+//     "initialLimit": 20,
+//     "maxLimit": 200
+//   }
+class AdaptiveConcurrencyParsedConfig
+    : public ServiceConfigParser::ParsedConfig {
+ public:
+  explicit AdaptiveConcurrencyParsedConfig(
+      const ConcurrencyLimiter::Config& limiter_config)
+      : limiter_config_(limiter_config) {}
+
+  const ConcurrencyLimiter::Config& limiter_config() const {
+    return limiter_config_;
+  }
+
+ private:
+  ConcurrencyLimiter::Config limiter_config_;
+};
+
+class AdaptiveConcurrencyServiceConfigParser final
+    : public ServiceConfigParser::Parser {
+ public:
+  absl::string_view name() const override { return parser_name(); }
+  // Parses the global params of the adaptive concurrency filter.
+  std::unique_ptr<ServiceConfigParser::ParsedConfig> ParseGlobalParams(
+      const ChannelArgs& args, const Json& json,
+      ValidationErrors* errors) override;
+  // Returns the parser index for AdaptiveConcurrencyServiceConfigParser.
+  static size_t ParserIndex();
+  // Registers AdaptiveConcurrencyServiceConfigParser to ServiceConfigParser.
+  static void Register(CoreConfiguration::Builder* builder);
+
+ private:
+  static absl::string_view parser_name() { return "adaptive_concurrency"; }
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_ADAPTIVE_CONCURRENCY_SERVICE_CONFIG_PARSER_H
@@ -0,0 +1,246 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/filters/adaptive_concurrency/concurrency_limiter.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "absl/strings/str_cat.h"
+#include "absl/types/optional.h"
+
+#include "src/core/lib/gpr/useful.h"
+
+namespace grpc_core {
+
+//
+// ConcurrencyLimiter::Config
+//
+
+const JsonLoaderInterface* ConcurrencyLimiter::Config::JsonLoader(
+    const JsonArgs&) {
+  // Note: "algorithm" requires custom processing, so it's handled in
+  // JsonPostLoad() instead.
+  static const auto* loader =
+      JsonObjectLoader<Config>()
+          .OptionalField("initialLimit", &Config::initial_limit)
+          .OptionalField("minLimit", &Config::min_limit)
+          .OptionalField("maxLimit", &Config::max_limit)
+          .OptionalField("smoothing", &Config::smoothing)
+          .OptionalField("rttTolerance", &Config::rtt_tolerance)
+          .OptionalField("longWindow", &Config::long_window)
+          .OptionalField("backoffRatio", &Config::backoff_ratio)
+          .OptionalField("timeout", &Config::timeout)
+          .OptionalField("minWindow", &Config::min_window)
+          .OptionalField("windowSize", &Config::window_size)
+          .Finish();
+  return loader;
+}
+
+void ConcurrencyLimiter::Config::JsonPostLoad(const Json& json,
+                                              const JsonArgs& args,
+                                              ValidationErrors* errors) {
+  // Parse algorithm.
+  auto algorithm_name = LoadJsonObjectField<std::string>(
+      json.object_value(), args, "algorithm", errors, /*required=*/false);
+  if (algorithm_name.has_value()) {
+    if (*algorithm_name == "GRADIENT") {
+      algorithm = Algorithm::kGradient;
+    } else if (*algorithm_name == "AIMD") {
+      algorithm = Algorithm::kAimd;
+    } else {
+      ValidationErrors::ScopedField field(errors, ".algorithm");
+      errors->AddError("must be one of GRADIENT or AIMD");
+    }
+  }
+  // Validate limits.
+  if (min_limit == 0) {
+    ValidationErrors::ScopedField field(errors, ".minLimit");
+    errors->AddError("must be greater than 0");
+  }
+  if (max_limit < min_limit) {
+    ValidationErrors::ScopedField field(errors, ".maxLimit");
+    errors->AddError("must be greater than or equal to minLimit");
+  }
+  if (initial_limit < min_limit || initial_limit > max_limit) {
+    ValidationErrors::ScopedField field(errors, ".initialLimit");
+    errors->AddError("must be between minLimit and maxLimit");
+  }
+  if (smoothing <= 0 || smoothing > 1) {
+    ValidationErrors::ScopedField field(errors, ".smoothing");
+    errors->AddError("must be in the range (0, 1]");
+  }
+  if (rtt_tolerance < 1) {
+    ValidationErrors::ScopedField field(errors, ".rttTolerance");
+    errors->AddError("must be greater than or equal to 1");
+  }
+  if (long_window == 0) {
+    ValidationErrors::ScopedField field(errors, ".longWindow");
+    errors->AddError("must be greater than 0");
+  }
+  if (backoff_ratio < 0.5 || backoff_ratio >= 1) {
+    ValidationErrors::ScopedField field(errors, ".backoffRatio");
+    errors->AddError("must be in the range [0.5, 1)");
+  }
+  if (window_size == 0) {
+    ValidationErrors::ScopedField field(errors, ".windowSize");
+    errors->AddError("must be greater than 0");
+  }
+}
+
+//
+// ConcurrencyLimiter
+//
+
+ConcurrencyLimiter::ConcurrencyLimiter(const Config& config)
+    : config_(config),
+      limit_(config.initial_limit),
+      window_start_(Timestamp::Now()),
+      estimated_limit_(config.initial_limit) {}
+
+ConcurrencyLimiter::~ConcurrencyLimiter() {
+  if (map_key_.has_value()) {
+    ConcurrencyLimiterMap::Get()->RemoveLimiter(*map_key_, this);
+  }
+}
+
+bool ConcurrencyLimiter::TryAcquire() {
+  uint32_t inflight = inflight_.load(std::memory_order_relaxed);
+  do {
+    if (inflight >= limit_.load(std::memory_order_relaxed)) return false;
+  } while (!inflight_.compare_exchange_weak(inflight, inflight + 1,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_relaxed));
+  return true;
+}
+
+void ConcurrencyLimiter::ReleaseWithoutSample() {
+  inflight_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void ConcurrencyLimiter::Release(double rtt_us, bool dropped) {
+  // Inflight count including this call, used to detect app-limited windows.
+  const uint32_t inflight = inflight_.fetch_sub(1, std::memory_order_acq_rel);
+  MutexLock lock(&mu_);
+  window_rtt_sum_us_ += rtt_us;
+  ++window_samples_;
+  window_max_inflight_ = std::max(window_max_inflight_, inflight);
+  window_dropped_ |= dropped ||
+                     (config_.algorithm == Config::Algorithm::kAimd &&
+                      rtt_us >= config_.timeout.millis() * 1000.0);
+  const Timestamp now = Timestamp::Now();
+  if (window_samples_ < config_.window_size ||
+      now - window_start_ < config_.min_window) {
+    return;
+  }
+  switch (config_.algorithm) {
+    case Config::Algorithm::kGradient:
+      UpdateGradientLimit(window_rtt_sum_us_ / window_samples_,
+                          window_max_inflight_);
+      break;
+    case Config::Algorithm::kAimd:
+      UpdateAimdLimit(window_dropped_, window_max_inflight_);
+      break;
+  }
+  limit_.store(static_cast<uint32_t>(estimated_limit_),
+               std::memory_order_relaxed);
+  window_start_ = now;
+  window_samples_ = 0;
+  window_rtt_sum_us_ = 0;
+  window_max_inflight_ = 0;
+  window_dropped_ = false;
+}
+
+void ConcurrencyLimiter::UpdateGradientLimit(double short_rtt_us,
+                                             uint32_t max_inflight) {
+  if (short_rtt_us <= 0) return;
+  if (long_rtt_us_ == 0) {
+    long_rtt_us_ = short_rtt_us;
+  } else {
+    const double factor = 2.0 / (config_.long_window + 1);
+    long_rtt_us_ = long_rtt_us_ * (1 - factor) + short_rtt_us * factor;
+    // If the long term latency is much higher than the current latency (e.g.
+    // the system recovered from overload), decay it faster so that the limit
+    // can grow again.
+    if (long_rtt_us_ / short_rtt_us > 2) long_rtt_us_ *= 0.95;
+  }
+  // Don't grow the limit while the application isn't using it.
+  if (max_inflight < estimated_limit_ / 2) return;
+  const double gradient = std::max(
+      0.5, std::min(1.0, config_.rtt_tolerance * long_rtt_us_ / short_rtt_us));
+  const double queue_size = std::sqrt(estimated_limit_);
+  const double new_limit = estimated_limit_ * gradient + queue_size;
+  estimated_limit_ = Clamp(estimated_limit_ * (1 - config_.smoothing) +
+                               new_limit * config_.smoothing,
+                           static_cast<double>(config_.min_limit),
+                           static_cast<double>(config_.max_limit));
+}
+
+void ConcurrencyLimiter::UpdateAimdLimit(bool dropped, uint32_t max_inflight) {
+  const uint32_t limit = static_cast<uint32_t>(estimated_limit_);
+  if (dropped) {
+    estimated_limit_ = std::max(
+        config_.min_limit, static_cast<uint32_t>(limit * config_.backoff_ratio));
+  } else if (max_inflight * 2 >= limit) {
+    estimated_limit_ = std::min(config_.max_limit, limit + 1);
+  }
+}
+
+std::string ConcurrencyLimiter::ToString() const {
+  return absl::StrCat("limit=", limit(), " inflight=", inflight());
+}
+
+//
+// ConcurrencyLimiterMap
+//
+
+ConcurrencyLimiterMap* ConcurrencyLimiterMap::Get() {
+  static ConcurrencyLimiterMap* m = new ConcurrencyLimiterMap();
+  return m;
+}
+
+RefCountedPtr<ConcurrencyLimiter> ConcurrencyLimiterMap::GetLimiter(
+    const std::string& key, const ConcurrencyLimiter::Config& config) {
+  MutexLock lock(&mu_);
+  auto range = map_.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (!(it->second->config() == config)) continue;
+    // The limiter may be in the process of being destroyed, in which case
+    // it will remove itself from the map shortly.
+    RefCountedPtr<ConcurrencyLimiter> limiter = it->second->RefIfNonZero();
+    if (limiter != nullptr) return limiter;
+  }
+  auto limiter = MakeRefCounted<ConcurrencyLimiter>(config);
+  limiter->map_key_ = key;
+  map_.emplace(key, limiter.get());
+  return limiter;
+}
+
+void ConcurrencyLimiterMap::RemoveLimiter(const std::string& key,
+                                          ConcurrencyLimiter* limiter) {
+  MutexLock lock(&mu_);
+  auto range = map_.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == limiter) {
+      map_.erase(it);
+      return;
+    }
+  }
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,194 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_CONCURRENCY_LIMITER_H
+#define GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_CONCURRENCY_LIMITER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <string>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/gprpp/validation_errors.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/json/json_args.h"
+#include "src/core/lib/json/json_object_loader.h"
+
+// Channel arg used by the client channel to hand the shared limiter for its
+// target to the client adaptive concurrency filter.
+#define GRPC_ARG_CONCURRENCY_LIMITER "grpc.internal.concurrency_limiter"
+
+namespace grpc_core {
+
+// Learns a concurrency limit from observed call latency, in the style of the
+// Netflix concurrency-limits library.
+//
+// Two algorithms are provided:
+// - GRADIENT (gradient2): compares a short term latency sample against a long
+//   term exponentially smoothed baseline, shrinking the limit as latency
+//   inflates and growing it by a queue allowance while latency is stable.
+// - AIMD: additively increases the limit while the limit is being used and
+//   multiplicatively decreases it on every dropped call or latency above a
+//   timeout.
+//
+// Admission (TryAcquire) is lock free; latency samples are aggregated under a
+// mutex and the limit is recomputed once per sample window.
+class ConcurrencyLimiter : public RefCounted<ConcurrencyLimiter> {
+ public:
+  struct Config {
+    enum class Algorithm { kGradient, kAimd };
+
+    Algorithm algorithm = Algorithm::kGradient;
+    uint32_t initial_limit = 20;
+    uint32_t min_limit = 1;
+    uint32_t max_limit = 1000;
+    // Gradient: weight given to the newly computed limit, in (0, 1].
+    double smoothing = 0.2;
+    // Gradient: how much the short term latency may exceed the long term
+    // latency before the limit is reduced.
+    double rtt_tolerance = 1.5;
+    // Gradient: number of windows the long term latency average spans.
+    uint32_t long_window = 600;
+    // AIMD: multiplier applied to the limit on a drop, in [0.5, 1).
+    double backoff_ratio = 0.9;
+    // AIMD: calls slower than this are treated as drops.
+    Duration timeout = Duration::Seconds(5);
+    // A new limit is computed once a window has been open for at least
+    // min_window and has seen at least window_size samples.
+    Duration min_window = Duration::Seconds(1);
+    uint32_t window_size = 10;
+
+    bool operator==(const Config& other) const {
+      return algorithm == other.algorithm &&
+             initial_limit == other.initial_limit &&
+             min_limit == other.min_limit && max_limit == other.max_limit &&
+             smoothing == other.smoothing &&
+             rtt_tolerance == other.rtt_tolerance &&
+             long_window == other.long_window &&
+             backoff_ratio == other.backoff_ratio &&
+             timeout == other.timeout && min_window == other.min_window &&
+             window_size == other.window_size;
+    }
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
+    void JsonPostLoad(const Json& json, const JsonArgs& args,
+                      ValidationErrors* errors);
+  };
+
+  explicit ConcurrencyLimiter(const Config& config);
+  ~ConcurrencyLimiter() override;
+
+  static absl::string_view ChannelArgName() {
+    return GRPC_ARG_CONCURRENCY_LIMITER;
+  }
+  static int ChannelArgsCompare(const ConcurrencyLimiter* a,
+                                const ConcurrencyLimiter* b) {
+    return QsortCompare(a, b);
+  }
+
+  // Reserves a slot for a new call. Returns false if the limit has been
+  // reached, in which case the call should be shed.
+  bool TryAcquire();
+
+  // Releases a slot acquired by TryAcquire(). \a rtt_us is the observed
+  // latency of the call in microseconds; \a dropped indicates that the call
+  // failed in a way that signals overload (e.g. RESOURCE_EXHAUSTED or a
+  // deadline).
+  void Release(double rtt_us, bool dropped);
+
+  // Releases a slot without contributing a latency sample (e.g. the call was
+  // cancelled locally).
+  void ReleaseWithoutSample();
+
+  const Config& config() const { return config_; }
+  uint32_t limit() const { return limit_.load(std::memory_order_relaxed); }
+  uint32_t inflight() const {
+    return inflight_.load(std::memory_order_relaxed);
+  }
+
+  std::string ToString() const;
+
+ private:
+  friend class ConcurrencyLimiterMap;
+
+  // Compute the next limit at the end of a sample window.
+  void UpdateGradientLimit(double short_rtt_us, uint32_t max_inflight)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void UpdateAimdLimit(bool dropped, uint32_t max_inflight)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  const Config config_;
+  // Key in ConcurrencyLimiterMap, if the limiter was created by the map.
+  absl::optional<std::string> map_key_;
+  std::atomic<uint32_t> limit_;
+  std::atomic<uint32_t> inflight_{0};
+
+  Mutex mu_;
+  // Current sample window.
+  Timestamp window_start_ ABSL_GUARDED_BY(mu_);
+  uint32_t window_samples_ ABSL_GUARDED_BY(mu_) = 0;
+  double window_rtt_sum_us_ ABSL_GUARDED_BY(mu_) = 0;
+  uint32_t window_max_inflight_ ABSL_GUARDED_BY(mu_) = 0;
+  bool window_dropped_ ABSL_GUARDED_BY(mu_) = false;
+  // Exponentially smoothed long term latency, 0 until the first window.
+  double long_rtt_us_ ABSL_GUARDED_BY(mu_) = 0;
+  // Unrounded limit, so that the gradient algorithm can grow the limit by
+  // less than one call per window.
+  double estimated_limit_ ABSL_GUARDED_BY(mu_);
+};
+
+// Global map of limiters, so that every channel to the same target (or
+// every connection accepted by the same server) shares one learned limit,
+// and the limit survives service config updates that leave it unchanged.
+//
+// Limiters are keyed by both the key and their config, so that channels to
+// the same target with different configs each keep their own state.  The
+// map does not own the limiters: an entry is removed when the last channel
+// using it goes away, so the map only holds limiters that are in use.
+class ConcurrencyLimiterMap {
+ public:
+  static ConcurrencyLimiterMap* Get();
+
+  /// Returns the limiter for \a key and \a config, creating a new one if
+  /// there is none.
+  RefCountedPtr<ConcurrencyLimiter> GetLimiter(
+      const std::string& key, const ConcurrencyLimiter::Config& config);
+
+ private:
+  friend class ConcurrencyLimiter;
+
+  // Called when \a limiter is destroyed.
+  void RemoveLimiter(const std::string& key, ConcurrencyLimiter* limiter);
+
+  Mutex mu_;
+  std::multimap<std::string, ConcurrencyLimiter*> map_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_FILTERS_ADAPTIVE_CONCURRENCY_CONCURRENCY_LIMITER_H
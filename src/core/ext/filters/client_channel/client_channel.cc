@@ -44,6 +44,9 @@
 #include <grpc/support/string_util.h>
 #include <grpc/support/time.h>
 
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_filter.h"
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_service_config_parser.h"
+#include "src/core/ext/filters/adaptive_concurrency/concurrency_limiter.h"
 #include "src/core/ext/filters/client_channel/backend_metric.h"
 #include "src/core/ext/filters/client_channel/backup_poller.h"
 #include "src/core/ext/filters/client_channel/client_channel_channelz.h"
@@ -57,6 +60,7 @@
 #include "src/core/ext/filters/client_channel/subchannel.h"
 #include "src/core/ext/filters/client_channel/subchannel_interface_internal.h"
 #include "src/core/ext/filters/deadline/deadline_filter.h"
+#include "src/core/lib/channel/call_attribution.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channel_trace.h"
@@ -1097,7 +1101,10 @@ ChannelArgs ClientChannel::MakeSubchannelArgs(
       // uniqueness.
       .Remove(GRPC_ARG_HEALTH_CHECK_SERVICE_NAME)
       .Remove(GRPC_ARG_INHIBIT_HEALTH_CHECKING)
-      .Remove(GRPC_ARG_CHANNELZ_CHANNEL_NODE);
+      .Remove(GRPC_ARG_CHANNELZ_CHANNEL_NODE)
+      .Remove(GRPC_ARG_LB_EAGER_CONNECT)
+      .Remove(GRPC_ARG_LB_STANDBY_SUBCHANNELS)
+      .Remove(CallAttribution::ChannelArgName());
 }
 
 namespace {
@@ -1443,12 +1450,26 @@ void ClientChannel::UpdateServiceConfigInDataPlaneLocked() {
   }
   ChannelArgs new_args =
       channel_args_.SetObject(this).SetObject(service_config);
-  bool enable_retries =
-      !new_args.WantMinimalStack() &&
-      new_args.GetBool(GRPC_ARG_ENABLE_RETRIES).value_or(true);
+  static constexpr ChannelArgs::Key kEnableRetries(GRPC_ARG_ENABLE_RETRIES);
+  bool enable_retries = !new_args.WantMinimalStack() &&
+                        new_args.GetBool(kEnableRetries).value_or(true);
   // Construct dynamic filter stack.
   std::vector<const grpc_channel_filter*> filters =
       config_selector->GetFilters();
+  // If adaptive concurrency is configured, shed calls above the learned limit
+  // before retries and LB picks. The limiter is shared by all channels to
+  // the same target.
+  if (service_config != nullptr && !new_args.WantMinimalStack()) {
+    const auto* adaptive_concurrency_config =
+        static_cast<const AdaptiveConcurrencyParsedConfig*>(
+            service_config->GetGlobalParsedConfig(
+                AdaptiveConcurrencyServiceConfigParser::ParserIndex()));
+    if (adaptive_concurrency_config != nullptr) {
+      new_args = new_args.SetObject(ConcurrencyLimiterMap::Get()->GetLimiter(
+          uri_to_resolve_, adaptive_concurrency_config->limiter_config()));
+      filters.push_back(&ClientAdaptiveConcurrencyFilter::kFilter);
+    }
+  }
   if (enable_retries) {
     filters.push_back(&kRetryFilterVtable);
   } else {
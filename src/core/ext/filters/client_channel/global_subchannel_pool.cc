@@ -20,6 +20,7 @@
 
 #include "src/core/ext/filters/client_channel/global_subchannel_pool.h"
 
+#include <thread>
 #include <utility>
 
 #include "src/core/ext/filters/client_channel/subchannel.h"
@@ -33,33 +34,70 @@ RefCountedPtr<GlobalSubchannelPool> GlobalSubchannelPool::instance() {
 
 RefCountedPtr<Subchannel> GlobalSubchannelPool::RegisterSubchannel(
     const SubchannelKey& key, RefCountedPtr<Subchannel> constructed) {
-  MutexLock lock(&mu_);
-  auto it = subchannel_map_.find(key);
-  if (it != subchannel_map_.end()) {
+  Shard& shard = ShardForKey(key);
+  MutexLock lock(&shard.mu);
+  const SubchannelMap* map =
+      shard.subchannel_map.load(std::memory_order_relaxed);
+  auto it = map->find(key);
+  if (it != map->end()) {
     RefCountedPtr<Subchannel> existing = it->second->RefIfNonZero();
     if (existing != nullptr) return existing;
   }
-  subchannel_map_[key] = constructed.get();
+  auto* new_map = new SubchannelMap(*map);
+  (*new_map)[key] = constructed.get();
+  PublishLocked(shard, new_map);
   return constructed;
 }
 
 void GlobalSubchannelPool::UnregisterSubchannel(const SubchannelKey& key,
                                                 Subchannel* subchannel) {
-  MutexLock lock(&mu_);
-  auto it = subchannel_map_.find(key);
+  Shard& shard = ShardForKey(key);
+  MutexLock lock(&shard.mu);
+  const SubchannelMap* map =
+      shard.subchannel_map.load(std::memory_order_relaxed);
+  auto it = map->find(key);
   // delete only if key hasn't been re-registered to a different subchannel
   // between strong-unreffing and unregistration of subchannel.
-  if (it != subchannel_map_.end() && it->second == subchannel) {
-    subchannel_map_.erase(it);
-  }
+  if (it == map->end() || it->second != subchannel) return;
+  auto* new_map = new SubchannelMap(*map);
+  new_map->erase(key);
+  // This waits for concurrent lookups, so none of them can still be
+  // dereferencing subchannel once we return.
+  PublishLocked(shard, new_map);
 }
 
 RefCountedPtr<Subchannel> GlobalSubchannelPool::FindSubchannel(
     const SubchannelKey& key) {
-  MutexLock lock(&mu_);
-  auto it = subchannel_map_.find(key);
-  if (it == subchannel_map_.end()) return nullptr;
-  return it->second->RefIfNonZero();
+  Shard& shard = ShardForKey(key);
+  // The increment must be ordered before the snapshot load, and the
+  // writer's snapshot store before its reader count load, so all of these
+  // are sequentially consistent: either the writer sees us or we see the
+  // new snapshot.
+  std::atomic<size_t>& readers = shard.readers[shard.phase.load() % 2];
+  readers.fetch_add(1);
+  const SubchannelMap* map = shard.subchannel_map.load();
+  RefCountedPtr<Subchannel> subchannel;
+  auto it = map->find(key);
+  if (it != map->end()) subchannel = it->second->RefIfNonZero();
+  readers.fetch_sub(1, std::memory_order_release);
+  return subchannel;
+}
+
+void GlobalSubchannelPool::PublishLocked(Shard& shard,
+                                         const SubchannelMap* new_map) {
+  const SubchannelMap* old_map = shard.subchannel_map.exchange(new_map);
+  auto wait_for_readers = [](const std::atomic<size_t>& readers) {
+    while (readers.load() != 0) std::this_thread::yield();
+  };
+  // Readers that loaded the phase before the previous flip may have only
+  // registered after the previous writer stopped waiting for them, and so
+  // may be using old_map.  Wait for those first, then flip the phase so
+  // that new readers stop registering in the counter we wait for next.
+  const size_t phase = shard.phase.load(std::memory_order_relaxed);
+  wait_for_readers(shard.readers[(phase + 1) % 2]);
+  shard.phase.store(phase + 1);
+  wait_for_readers(shard.readers[phase % 2]);
+  delete old_map;
 }
 
 }  // namespace grpc_core
@@ -21,9 +21,12 @@
 
 #include <grpc/support/port_platform.h>
 
-#include <map>
+#include <stddef.h>
+
+#include <atomic>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 
 #include "src/core/ext/filters/client_channel/subchannel_pool_interface.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
@@ -33,6 +36,14 @@ namespace grpc_core {
 
 // The global subchannel pool. It shares subchannels among channels. There
 // should be only one instance of this class.
+//
+// The pool is split into shards selected by the key's precomputed hash.
+// Each shard publishes an immutable snapshot of its map, so FindSubchannel()
+// never takes a lock: it announces itself in a reader counter, looks the key
+// up in the current snapshot and leaves.  Registration and unregistration
+// are serialized per shard; they copy the snapshot, publish the modified
+// copy and wait for the readers that may still see the old snapshot before
+// deleting it.
 class GlobalSubchannelPool final : public SubchannelPoolInterface {
  public:
   // Gets the singleton instance.
@@ -40,22 +51,40 @@ class GlobalSubchannelPool final : public SubchannelPoolInterface {
 
   // Implements interface methods.
   RefCountedPtr<Subchannel> RegisterSubchannel(
-      const SubchannelKey& key, RefCountedPtr<Subchannel> constructed) override
-      ABSL_LOCKS_EXCLUDED(mu_);
+      const SubchannelKey& key, RefCountedPtr<Subchannel> constructed) override;
   void UnregisterSubchannel(const SubchannelKey& key,
-                            Subchannel* subchannel) override
-      ABSL_LOCKS_EXCLUDED(mu_);
-  RefCountedPtr<Subchannel> FindSubchannel(const SubchannelKey& key) override
-      ABSL_LOCKS_EXCLUDED(mu_);
+                            Subchannel* subchannel) override;
+  RefCountedPtr<Subchannel> FindSubchannel(const SubchannelKey& key) override;
 
  private:
+  static constexpr size_t kShards = 32;
+
+  using SubchannelMap = absl::flat_hash_map<SubchannelKey, Subchannel*>;
+
+  struct Shard {
+    // Serializes writers.
+    Mutex mu;
+    // The current snapshot.  Only replaced with mu held.
+    std::atomic<const SubchannelMap*> subchannel_map{new SubchannelMap()};
+    // Readers register in readers[phase % 2].  Writers flip the phase so
+    // that they can wait for older readers while new ones keep arriving.
+    std::atomic<size_t> phase{0};
+    std::atomic<size_t> readers[2]{};
+  };
+
+  // Replaces shard's snapshot with new_map and deletes the old snapshot
+  // once no reader can still be using it.
+  static void PublishLocked(Shard& shard, const SubchannelMap* new_map)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mu);
+
   GlobalSubchannelPool() {}
   ~GlobalSubchannelPool() override {}
 
-  // A map from subchannel key to subchannel.
-  std::map<SubchannelKey, Subchannel*> subchannel_map_ ABSL_GUARDED_BY(mu_);
-  // To protect subchannel_map_.
-  Mutex mu_;
+  Shard& ShardForKey(const SubchannelKey& key) {
+    return shards_[key.hash() % kShards];
+  }
+
+  Shard shards_[kShards];
 };
 
 }  // namespace grpc_core
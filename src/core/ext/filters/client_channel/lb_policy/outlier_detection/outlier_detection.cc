@@ -41,12 +41,16 @@
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/support/log.h>
+#include <grpc/support/time.h>
 
 #include "src/core/ext/filters/client_channel/lb_policy/child_policy_handler.h"
 #include "src/core/lib/address_utils/sockaddr_utils.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted.h"
@@ -75,6 +79,66 @@ using ::grpc_event_engine::experimental::EventEngine;
 constexpr absl::string_view kOutlierDetection =
     "outlier_detection_experimental";
 
+// Lock-free log-linear histogram of call latencies in microseconds.  Each
+// power of two between 1us and ~16s is split into 4 buckets, so a reported
+// percentile is within 10% of the true value.
+class LatencyHistogram {
+ public:
+  void Add(double latency_us) {
+    int bucket = 0;
+    if (latency_us >= 1) {
+      bucket = std::min(kBuckets - 1,
+                        1 + static_cast<int>(std::log2(latency_us) *
+                                             kBucketsPerPowerOfTwo));
+    }
+    buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void Reset() {
+    for (auto& bucket : buckets_) bucket.store(0, std::memory_order_relaxed);
+  }
+
+  uint64_t Count() const {
+    uint64_t count = 0;
+    for (const auto& bucket : buckets_) {
+      count += bucket.load(std::memory_order_relaxed);
+    }
+    return count;
+  }
+
+  // Returns the latency in microseconds below which \a percentile percent
+  // of the recorded calls fall, or 0 if no calls were recorded.
+  double Percentile(uint32_t percentile) const {
+    uint64_t counts[kBuckets];
+    uint64_t total = 0;
+    for (int i = 0; i < kBuckets; ++i) {
+      counts[i] = buckets_[i].load(std::memory_order_relaxed);
+      total += counts[i];
+    }
+    if (total == 0) return 0;
+    const uint64_t target = std::max<uint64_t>(
+        1, static_cast<uint64_t>(std::ceil(total * percentile / 100.0)));
+    uint64_t seen = 0;
+    for (int i = 0; i < kBuckets; ++i) {
+      seen += counts[i];
+      if (seen >= target) {
+        // Report the geometric middle of the bucket.
+        if (i == 0) return 0.5;
+        return std::exp2((i - 0.5) / kBucketsPerPowerOfTwo);
+      }
+    }
+    return std::exp2((kBuckets - 1.5) / kBucketsPerPowerOfTwo);
+  }
+
+ private:
+  static constexpr int kBucketsPerPowerOfTwo = 4;
+  // Bucket 0 holds calls faster than 1us; bucket i > 0 holds latencies in
+  // [2^((i-1)/4), 2^(i/4)) microseconds.
+  static constexpr int kBuckets = 24 * kBucketsPerPowerOfTwo + 1;
+
+  std::atomic<uint64_t> buckets_[kBuckets]{};
+};
+
 // Config for xDS Cluster Impl LB policy.
 class OutlierDetectionLbConfig : public LoadBalancingPolicy::Config {
  public:
@@ -88,7 +152,12 @@ class OutlierDetectionLbConfig : public LoadBalancingPolicy::Config {
 
   bool CountingEnabled() const {
     return outlier_detection_config_.success_rate_ejection.has_value() ||
-           outlier_detection_config_.failure_percentage_ejection.has_value();
+           outlier_detection_config_.failure_percentage_ejection.has_value() ||
+           outlier_detection_config_.latency_ejection.has_value();
+  }
+
+  bool LatencyTrackingEnabled() const {
+    return outlier_detection_config_.latency_ejection.has_value();
   }
 
   const OutlierDetectionConfig& outlier_detection_config() const {
@@ -218,11 +287,13 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
     struct Bucket {
       std::atomic<uint64_t> successes;
       std::atomic<uint64_t> failures;
+      LatencyHistogram latencies;
     };
 
     void RotateBucket() {
       backup_bucket_->successes = 0;
       backup_bucket_->failures = 0;
+      backup_bucket_->latencies.Reset();
       current_bucket_.swap(backup_bucket_);
       active_bucket_.store(current_bucket_.get());
     }
@@ -240,6 +311,15 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
           {success_rate, backup_bucket_->successes + backup_bucket_->failures}};
     }
 
+    // Returns the given percentile of the latency of successful calls, in
+    // microseconds, and the number of calls it was computed from.
+    absl::optional<std::pair<double, uint64_t>> GetLatencyAndVolume(
+        uint32_t percentile) {
+      uint64_t volume = backup_bucket_->latencies.Count();
+      if (volume == 0) return absl::nullopt;
+      return {{backup_bucket_->latencies.Percentile(percentile), volume}};
+    }
+
     void AddSubchannel(SubchannelWrapper* wrapper) {
       subchannels_.insert(wrapper);
     }
@@ -252,6 +332,10 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
 
     void AddFailureCount() { active_bucket_.load()->failures.fetch_add(1); }
 
+    void AddLatency(double latency_us) {
+      active_bucket_.load()->latencies.Add(latency_us);
+    }
+
     absl::optional<Timestamp> ejection_time() const { return ejection_time_; }
 
     void Eject(const Timestamp& time) {
@@ -310,7 +394,8 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
   class Picker : public SubchannelPicker {
    public:
     Picker(OutlierDetectionLb* outlier_detection_lb,
-           RefCountedPtr<SubchannelPicker> picker, bool counting_enabled);
+           RefCountedPtr<SubchannelPicker> picker, bool counting_enabled,
+           bool latency_tracking_enabled);
 
     PickResult Pick(PickArgs args) override;
 
@@ -318,6 +403,7 @@ class OutlierDetectionLb : public LoadBalancingPolicy {
     class SubchannelCallTracker;
     RefCountedPtr<SubchannelPicker> picker_;
     bool counting_enabled_;
+    bool latency_tracking_enabled_;
   };
 
   class Helper : public ChannelControlHelper {
@@ -433,17 +519,21 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker
   SubchannelCallTracker(
       std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
           original_subchannel_call_tracker,
-      RefCountedPtr<SubchannelState> subchannel_state)
+      RefCountedPtr<SubchannelState> subchannel_state,
+      bool latency_tracking_enabled)
       : original_subchannel_call_tracker_(
             std::move(original_subchannel_call_tracker)),
-        subchannel_state_(std::move(subchannel_state)) {}
+        subchannel_state_(std::move(subchannel_state)),
+        latency_tracking_enabled_(latency_tracking_enabled) {}
 
   ~SubchannelCallTracker() override {
     subchannel_state_.reset(DEBUG_LOCATION, "SubchannelCallTracker");
   }
 
   void Start() override {
-    // This tracker does not care about started calls only finished calls.
+    // The recorded latency covers the whole call, including any streaming,
+    // not just the time to the first response.
+    if (latency_tracking_enabled_) start_time_ = gpr_get_cycle_counter();
     // Delegate if needed.
     if (original_subchannel_call_tracker_ != nullptr) {
       original_subchannel_call_tracker_->Start();
@@ -460,6 +550,12 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker
     if (subchannel_state_ != nullptr) {
       if (args.status.ok()) {
         subchannel_state_->AddSuccessCount();
+        // Only successful calls contribute latency samples: failed calls
+        // are often fast and are already covered by the other algorithms.
+        if (start_time_.has_value()) {
+          subchannel_state_->AddLatency(gpr_timespec_to_micros(
+              gpr_cycle_counter_sub(gpr_get_cycle_counter(), *start_time_)));
+        }
       } else {
         subchannel_state_->AddFailureCount();
       }
@@ -470,6 +566,8 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker
   std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>
       original_subchannel_call_tracker_;
   RefCountedPtr<SubchannelState> subchannel_state_;
+  const bool latency_tracking_enabled_;
+  absl::optional<gpr_cycle_counter> start_time_;
 };
 
 //
@@ -478,8 +576,11 @@ class OutlierDetectionLb::Picker::SubchannelCallTracker
 
 OutlierDetectionLb::Picker::Picker(OutlierDetectionLb* outlier_detection_lb,
                                    RefCountedPtr<SubchannelPicker> picker,
-                                   bool counting_enabled)
-    : picker_(std::move(picker)), counting_enabled_(counting_enabled) {
+                                   bool counting_enabled,
+                                   bool latency_tracking_enabled)
+    : picker_(std::move(picker)),
+      counting_enabled_(counting_enabled),
+      latency_tracking_enabled_(latency_tracking_enabled) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
     gpr_log(GPR_INFO,
             "[outlier_detection_lb %p] constructed new picker %p and counting "
@@ -503,12 +604,13 @@ LoadBalancingPolicy::PickResult OutlierDetectionLb::Picker::Pick(
     auto* subchannel_wrapper =
         static_cast<SubchannelWrapper*>(complete_pick->subchannel.get());
     // Inject subchannel call tracker to record call completion as long as
-    // not both success_rate_ejection and failure_percentage_ejection are unset.
+    // at least one of the ejection algorithms is configured.
     if (counting_enabled_) {
       complete_pick->subchannel_call_tracker =
           std::make_unique<SubchannelCallTracker>(
               std::move(complete_pick->subchannel_call_tracker),
-              subchannel_wrapper->subchannel_state());
+              subchannel_wrapper->subchannel_state(),
+              latency_tracking_enabled_);
     }
     complete_pick->subchannel = subchannel_wrapper->wrapped_subchannel();
   }
@@ -669,7 +771,8 @@ absl::Status OutlierDetectionLb::UpdateLocked(UpdateArgs args) {
 void OutlierDetectionLb::MaybeUpdatePickerLocked() {
   if (picker_ != nullptr) {
     auto outlier_detection_picker =
-        MakeRefCounted<Picker>(this, picker_, config_->CountingEnabled());
+        MakeRefCounted<Picker>(this, picker_, config_->CountingEnabled(),
+                               config_->LatencyTrackingEnabled());
     if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
       gpr_log(GPR_INFO,
               "[outlier_detection_lb %p] updating connectivity: state=%s "
@@ -808,6 +911,7 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
   }
   std::map<SubchannelState*, double> success_rate_ejection_candidates;
   std::map<SubchannelState*, double> failure_percentage_ejection_candidates;
+  std::map<SubchannelState*, double> latency_ejection_candidates;
   size_t ejected_host_count = 0;
   double success_rate_sum = 0;
   auto time_now = Timestamp::Now();
@@ -841,15 +945,28 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
         failure_percentage_ejection_candidates[subchannel_state] = success_rate;
       }
     }
+    if (config.latency_ejection.has_value()) {
+      absl::optional<std::pair<double, uint64_t>> host_latency_and_volume =
+          subchannel_state->GetLatencyAndVolume(
+              config.latency_ejection->percentile);
+      if (host_latency_and_volume.has_value() &&
+          host_latency_and_volume->second >=
+              config.latency_ejection->request_volume) {
+        latency_ejection_candidates[subchannel_state] =
+            host_latency_and_volume->first;
+      }
+    }
   }
   if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
     gpr_log(GPR_INFO,
             "[outlier_detection_lb %p] found %" PRIuPTR
-            " success rate candidates and %" PRIuPTR
-            " failure percentage candidates; ejected_host_count=%" PRIuPTR
+            " success rate candidates, %" PRIuPTR
+            " failure percentage candidates and %" PRIuPTR
+            " latency candidates; ejected_host_count=%" PRIuPTR
             "; success_rate_sum=%.3f",
             parent_.get(), success_rate_ejection_candidates.size(),
-            failure_percentage_ejection_candidates.size(), ejected_host_count,
+            failure_percentage_ejection_candidates.size(),
+            latency_ejection_candidates.size(), ejected_host_count,
             success_rate_sum);
   }
   // success rate algorithm
@@ -907,6 +1024,7 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
           }
           candidate.first->Eject(time_now);
           ++ejected_host_count;
+          global_stats().IncrementOutlierSuccessRateEjections();
         }
       }
     }
@@ -954,6 +1072,74 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
           }
           candidate.first->Eject(time_now);
           ++ejected_host_count;
+          global_stats().IncrementOutlierFailurePctEjections();
+        }
+      }
+    }
+  }
+  // latency algorithm
+  if (!latency_ejection_candidates.empty() &&
+      latency_ejection_candidates.size() >=
+          config.latency_ejection->minimum_hosts) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
+      gpr_log(GPR_INFO, "[outlier_detection_lb %p] running latency algorithm",
+              parent_.get());
+    }
+    // calculate ejection threshold: median latency across candidates *
+    // (latency_ejection.threshold_factor / 1000).  The median is used rather
+    // than the mean so that a single very slow host cannot hide itself by
+    // dragging up the baseline.
+    std::vector<double> latencies;
+    latencies.reserve(latency_ejection_candidates.size());
+    for (const auto& p : latency_ejection_candidates) {
+      latencies.push_back(p.second);
+    }
+    auto middle = latencies.begin() + latencies.size() / 2;
+    std::nth_element(latencies.begin(), middle, latencies.end());
+    double median = *middle;
+    if (latencies.size() % 2 == 0) {
+      median = (median + *std::max_element(latencies.begin(), middle)) / 2;
+    }
+    const double ejection_threshold =
+        median * config.latency_ejection->threshold_factor / 1000;
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
+      gpr_log(GPR_INFO,
+              "[outlier_detection_lb %p] median_latency=%.3fus, "
+              "ejection_threshold=%.3fus",
+              parent_.get(), median, ejection_threshold);
+    }
+    for (auto& candidate : latency_ejection_candidates) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
+        gpr_log(GPR_INFO,
+                "[outlier_detection_lb %p] checking candidate %p: "
+                "latency=%.3fus",
+                parent_.get(), candidate.first, candidate.second);
+      }
+      // Skip backends already ejected by one of the other algorithms.
+      if (candidate.first->ejection_time().has_value()) continue;
+      if (candidate.second > ejection_threshold) {
+        uint32_t random_key = absl::Uniform(bit_gen_, 1, 100);
+        double current_percent =
+            100.0 * ejected_host_count / parent_->subchannel_state_map_.size();
+        if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
+          gpr_log(GPR_INFO,
+                  "[outlier_detection_lb %p] random_key=%d "
+                  "ejected_host_count=%" PRIuPTR " current_percent=%.3f",
+                  parent_.get(), random_key, ejected_host_count,
+                  current_percent);
+        }
+        if (random_key < config.latency_ejection->enforcement_percentage &&
+            (ejected_host_count == 0 ||
+             (current_percent < config.max_ejection_percent))) {
+          // Eject and record the timestamp for use when ejecting addresses in
+          // this iteration.
+          if (GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
+            gpr_log(GPR_INFO, "[outlier_detection_lb %p] ejecting candidate",
+                    parent_.get());
+          }
+          candidate.first->Eject(time_now);
+          ++ejected_host_count;
+          global_stats().IncrementOutlierLatencyEjections();
         }
       }
     }
@@ -968,6 +1154,7 @@ void OutlierDetectionLb::EjectionTimer::OnTimerLocked() {
     auto* subchannel_state = state.second.get();
     const bool unejected = subchannel_state->MaybeUneject(
         config.base_ejection_time.millis(), config.max_ejection_time.millis());
+    if (unejected) global_stats().IncrementOutlierUnejections();
     if (unejected && GRPC_TRACE_FLAG_ENABLED(grpc_outlier_detection_lb_trace)) {
       gpr_log(GPR_INFO, "[outlier_detection_lb %p] unejected address %s (%p)",
               parent_.get(), state.first.c_str(), subchannel_state);
@@ -1087,6 +1274,36 @@ void OutlierDetectionConfig::FailurePercentageEjection::JsonPostLoad(
   }
 }
 
+const JsonLoaderInterface* OutlierDetectionConfig::LatencyEjection::JsonLoader(
+    const JsonArgs&) {
+  static const auto* loader =
+      JsonObjectLoader<LatencyEjection>()
+          .OptionalField("percentile", &LatencyEjection::percentile)
+          .OptionalField("thresholdFactor", &LatencyEjection::threshold_factor)
+          .OptionalField("enforcementPercentage",
+                         &LatencyEjection::enforcement_percentage)
+          .OptionalField("minimumHosts", &LatencyEjection::minimum_hosts)
+          .OptionalField("requestVolume", &LatencyEjection::request_volume)
+          .Finish();
+  return loader;
+}
+
+void OutlierDetectionConfig::LatencyEjection::JsonPostLoad(
+    const Json&, const JsonArgs&, ValidationErrors* errors) {
+  if (percentile == 0 || percentile > 100) {
+    ValidationErrors::ScopedField field(errors, ".percentile");
+    errors->AddError("value must be in the range [1, 100]");
+  }
+  if (threshold_factor <= 1000) {
+    ValidationErrors::ScopedField field(errors, ".threshold_factor");
+    errors->AddError("value must be > 1000");
+  }
+  if (enforcement_percentage > 100) {
+    ValidationErrors::ScopedField field(errors, ".enforcement_percentage");
+    errors->AddError("value must be <= 100");
+  }
+}
+
 const JsonLoaderInterface* OutlierDetectionConfig::JsonLoader(const JsonArgs&) {
   static const auto* loader =
       JsonObjectLoader<OutlierDetectionConfig>()
@@ -1101,6 +1318,8 @@ const JsonLoaderInterface* OutlierDetectionConfig::JsonLoader(const JsonArgs&) {
                          &OutlierDetectionConfig::success_rate_ejection)
           .OptionalField("failurePercentageEjection",
                          &OutlierDetectionConfig::failure_percentage_ejection)
+          .OptionalField("latencyEjection",
+                         &OutlierDetectionConfig::latency_ejection)
           .Finish();
   return loader;
 }
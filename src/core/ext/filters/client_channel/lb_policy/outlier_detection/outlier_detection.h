@@ -72,8 +72,38 @@ struct OutlierDetectionConfig {
     static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
     void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors);
   };
+  // Ejects endpoints whose latency is much higher than that of the other
+  // endpoints, even if their calls succeed.  The latency of a call is its
+  // whole duration, from when it starts until its status is received, so
+  // for streaming calls it includes the time spent streaming.  Only
+  // configurable via the service config; xDS has no equivalent field.
+  struct LatencyEjection {
+    // Percentile of each endpoint's successful call latency that is compared.
+    uint32_t percentile = 90;
+    // An endpoint is ejected if its latency percentile exceeds the median of
+    // the latency percentiles of all candidate endpoints by more than
+    // threshold_factor / 1000.
+    uint32_t threshold_factor = 3000;
+    uint32_t enforcement_percentage = 0;
+    uint32_t minimum_hosts = 5;
+    uint32_t request_volume = 100;
+
+    LatencyEjection() {}
+
+    bool operator==(const LatencyEjection& other) const {
+      return percentile == other.percentile &&
+             threshold_factor == other.threshold_factor &&
+             enforcement_percentage == other.enforcement_percentage &&
+             minimum_hosts == other.minimum_hosts &&
+             request_volume == other.request_volume;
+    }
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
+    void JsonPostLoad(const Json&, const JsonArgs&, ValidationErrors* errors);
+  };
   absl::optional<SuccessRateEjection> success_rate_ejection;
   absl::optional<FailurePercentageEjection> failure_percentage_ejection;
+  absl::optional<LatencyEjection> latency_ejection;
 
   bool operator==(const OutlierDetectionConfig& other) const {
     return interval == other.interval &&
@@ -81,7 +111,8 @@ struct OutlierDetectionConfig {
            max_ejection_time == other.max_ejection_time &&
            max_ejection_percent == other.max_ejection_percent &&
            success_rate_ejection == other.success_rate_ejection &&
-           failure_percentage_ejection == other.failure_percentage_ejection;
+           failure_percentage_ejection == other.failure_percentage_ejection &&
+           latency_ejection == other.latency_ejection;
   }
 
   static const JsonLoaderInterface* JsonLoader(const JsonArgs&);
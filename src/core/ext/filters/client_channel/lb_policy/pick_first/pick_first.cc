@@ -85,7 +85,10 @@ class PickFirst : public LoadBalancingPolicy {
             subchannel_list,
         const ServerAddress& address,
         RefCountedPtr<SubchannelInterface> subchannel)
-        : SubchannelData(subchannel_list, address, std::move(subchannel)) {}
+        : SubchannelData(subchannel_list, address, std::move(subchannel)),
+          address_(address) {}
+
+    const ServerAddress& address() const { return address_; }
 
     void ProcessConnectivityChangeLocked(
         absl::optional<grpc_connectivity_state> old_state,
@@ -93,6 +96,9 @@ class PickFirst : public LoadBalancingPolicy {
 
     // Processes the connectivity change to READY for an unselected subchannel.
     void ProcessUnselectedReadyLocked();
+
+   private:
+    const ServerAddress address_;
   };
 
   class PickFirstSubchannelList
@@ -106,7 +112,11 @@ class PickFirst : public LoadBalancingPolicy {
                               ? "PickFirstSubchannelList"
                               : nullptr),
                          std::move(addresses), policy->channel_control_helper(),
-                         args) {
+                         args),
+          eager_connect_(
+              args.GetBool(GRPC_ARG_LB_EAGER_CONNECT).value_or(false)),
+          num_standby_subchannels_(static_cast<size_t>(std::max(
+              0, args.GetInt(GRPC_ARG_LB_STANDBY_SUBCHANNELS).value_or(0)))) {
       // Need to maintain a ref to the LB policy as long as we maintain
       // any references to subchannels, since the subchannels'
       // pollset_sets will include the LB policy's pollset_set.
@@ -129,7 +139,15 @@ class PickFirst : public LoadBalancingPolicy {
     size_t attempting_index() const { return attempting_index_; }
     void set_attempting_index(size_t index) { attempting_index_ = index; }
 
+    // Whether to connect to all subchannels in parallel.
+    bool eager_connect() const { return eager_connect_; }
+    // Number of unselected subchannels to keep connected once a
+    // subchannel has been selected.
+    size_t num_standby_subchannels() const { return num_standby_subchannels_; }
+
    private:
+    const bool eager_connect_;
+    const size_t num_standby_subchannels_;
     bool in_transient_failure_ = false;
     size_t attempting_index_ = 0;
   };
@@ -343,9 +361,25 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
     // TODO(qianchengz): We may want to request re-resolution in
     // ExitIdleLocked().
     p->channel_control_helper()->RequestReresolution();
-    // TODO(roth): We chould check the connectivity states of all the
-    // subchannels here, just in case one of them happens to be READY,
-    // and we could switch to that rather than going IDLE.
+    // If one of the standby subchannels is READY, fail over to it rather
+    // than going IDLE.
+    for (size_t i = 0; i < subchannel_list()->num_subchannels(); ++i) {
+      PickFirstSubchannelData* sd = subchannel_list()->subchannel(i);
+      if (sd == this || sd->subchannel() == nullptr ||
+          sd->connectivity_state() != GRPC_CHANNEL_READY) {
+        continue;
+      }
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
+        gpr_log(GPR_INFO,
+                "Pick First %p failing over to standby subchannel %p", p,
+                sd->subchannel());
+      }
+      // Note that this subchannel may in turn be kept as a standby, in
+      // which case it gets reconnected once it is IDLE.
+      p->selected_ = nullptr;
+      sd->ProcessUnselectedReadyLocked();
+      return;
+    }
     // Enter idle.
     p->idle_ = true;
     p->selected_ = nullptr;
@@ -355,6 +389,13 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
         MakeRefCounted<QueuePicker>(p->Ref(DEBUG_LOCATION, "QueuePicker")));
     return;
   }
+  // Handle updates for standby subchannels in the current list, which
+  // are kept connected while another subchannel is selected.
+  if (p->selected_ != nullptr &&
+      subchannel_list() == p->subchannel_list_.get()) {
+    if (new_state == GRPC_CHANNEL_IDLE) subchannel()->RequestConnection();
+    return;
+  }
   // If we get here, there are two possible cases:
   // 1. We do not currently have a selected subchannel, and the update is
   //    for a subchannel in p->subchannel_list_ that we're trying to
@@ -372,18 +413,30 @@ void PickFirst::PickFirstSubchannelData::ProcessConnectivityChangeLocked(
   }
   // If this is the initial connectivity state notification for this
   // subchannel, check to see if it's the last one we were waiting for,
-  // in which case we start trying to connect to the first subchannel.
+  // in which case we start trying to connect to the first subchannel (or
+  // to all of them, if eager connect is enabled).
   // Otherwise, do nothing, since we'll continue to wait until all of
   // the subchannels report their state.
   if (!old_state.has_value()) {
     if (subchannel_list()->AllSubchannelsSeenInitialState()) {
-      subchannel_list()->subchannel(0)->subchannel()->RequestConnection();
+      const size_t num_to_connect = subchannel_list()->eager_connect()
+                                        ? subchannel_list()->num_subchannels()
+                                        : 1;
+      for (size_t i = 0; i < num_to_connect; ++i) {
+        subchannel_list()->subchannel(i)->subchannel()->RequestConnection();
+      }
     }
     return;
   }
   // Ignore any other updates for subchannels we're not currently trying to
-  // connect to.
-  if (Index() != subchannel_list()->attempting_index()) return;
+  // connect to, except that with eager connect, subchannels that go IDLE
+  // are reconnected right away.
+  if (Index() != subchannel_list()->attempting_index()) {
+    if (subchannel_list()->eager_connect() && new_state == GRPC_CHANNEL_IDLE) {
+      subchannel()->RequestConnection();
+    }
+    return;
+  }
   // Otherwise, process connectivity state.
   switch (new_state) {
     case GRPC_CHANNEL_READY:
@@ -474,6 +527,10 @@ void PickFirst::PickFirstSubchannelData::ProcessUnselectedReadyLocked() {
   //    select in place of the current one.
   GPR_ASSERT(subchannel_list() == p->subchannel_list_.get() ||
              subchannel_list() == p->latest_pending_subchannel_list_.get());
+  // Addresses whose subchannels were still in use (selected or kept as
+  // standbys) in the list being replaced.  Their connections are preferred
+  // as standbys, so that they stay warm across address updates.
+  std::vector<ServerAddress> connected_addresses;
   // Case 2.  Promote p->latest_pending_subchannel_list_ to p->subchannel_list_.
   if (subchannel_list() == p->latest_pending_subchannel_list_.get()) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_pick_first_trace)) {
@@ -483,6 +540,14 @@ void PickFirst::PickFirstSubchannelData::ProcessUnselectedReadyLocked() {
               p, p->latest_pending_subchannel_list_.get(),
               p->subchannel_list_.get());
     }
+    if (p->subchannel_list_ != nullptr) {
+      for (size_t i = 0; i < p->subchannel_list_->num_subchannels(); ++i) {
+        PickFirstSubchannelData* sd = p->subchannel_list_->subchannel(i);
+        if (sd->subchannel() != nullptr) {
+          connected_addresses.push_back(sd->address());
+        }
+      }
+    }
     p->subchannel_list_ = std::move(p->latest_pending_subchannel_list_);
   }
   // Cases 1 and 2.
@@ -493,9 +558,34 @@ void PickFirst::PickFirstSubchannelData::ProcessUnselectedReadyLocked() {
   p->channel_control_helper()->UpdateState(
       GRPC_CHANNEL_READY, absl::Status(),
       MakeRefCounted<Picker>(subchannel()->Ref()));
-  for (size_t i = 0; i < subchannel_list()->num_subchannels(); ++i) {
-    if (i != Index()) {
-      subchannel_list()->subchannel(i)->ShutdownLocked();
+  // Keep up to num_standby_subchannels() of the other subchannels
+  // connected and shut down the rest.  Subchannels that are already
+  // connected, or were kept connected by the previous list, come first;
+  // the remaining slots are filled in address order.
+  const size_t num_subchannels = subchannel_list()->num_subchannels();
+  const size_t max_standby = subchannel_list()->num_standby_subchannels();
+  std::vector<bool> standby(num_subchannels, false);
+  size_t num_standby = 0;
+  for (bool connected_only : {true, false}) {
+    for (size_t i = 0; i < num_subchannels && num_standby < max_standby; ++i) {
+      PickFirstSubchannelData* sd = subchannel_list()->subchannel(i);
+      if (i == Index() || standby[i] || sd->subchannel() == nullptr) continue;
+      if (connected_only && sd->connectivity_state() != GRPC_CHANNEL_READY &&
+          std::find(connected_addresses.begin(), connected_addresses.end(),
+                    sd->address()) == connected_addresses.end()) {
+        continue;
+      }
+      standby[i] = true;
+      ++num_standby;
+    }
+  }
+  for (size_t i = 0; i < num_subchannels; ++i) {
+    if (i == Index()) continue;
+    PickFirstSubchannelData* sd = subchannel_list()->subchannel(i);
+    if (!standby[i]) {
+      sd->ShutdownLocked();
+    } else if (sd->connectivity_state() == GRPC_CHANNEL_IDLE) {
+      sd->subchannel()->RequestConnection();
     }
   }
 }
@@ -31,6 +31,7 @@
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
+#include <grpc/grpc.h>
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/support/log.h>
 
@@ -125,7 +126,9 @@ class RoundRobin : public LoadBalancingPolicy {
                               ? "RoundRobinSubchannelList"
                               : nullptr),
                          std::move(addresses), policy->channel_control_helper(),
-                         args) {
+                         args),
+          eager_connect_(
+              args.GetBool(GRPC_ARG_LB_EAGER_CONNECT).value_or(false)) {
       // Need to maintain a ref to the LB policy as long as we maintain
       // any references to subchannels, since the subchannels'
       // pollset_sets will include the LB policy's pollset_set.
@@ -157,6 +160,10 @@ class RoundRobin : public LoadBalancingPolicy {
                           " num_transient_failure=", num_transient_failure_);
     }
 
+    // If true, this list does not replace a working list until all of its
+    // subchannels have finished connecting.
+    const bool eager_connect_;
+
     size_t num_ready_ = 0;
     size_t num_connecting_ = 0;
     size_t num_transient_failure_ = 0;
@@ -356,13 +363,16 @@ void RoundRobin::RoundRobinSubchannelList::
   // subchannel_list_ in the following cases:
   // - subchannel_list_ has no READY subchannels.
   // - This list has at least one READY subchannel and we have seen the
-  //   initial connectivity state notification for all subchannels.
+  //   initial connectivity state notification for all subchannels (and,
+  //   with eager connect, none of them are still CONNECTING, so that the
+  //   new list goes into use with all of its connections warmed up).
   // - All of the subchannels in this list are in TRANSIENT_FAILURE.
   //   (This may cause the channel to go from READY to TRANSIENT_FAILURE,
   //   but we're doing what the control plane told us to do.)
   if (p->latest_pending_subchannel_list_.get() == this &&
       (p->subchannel_list_->num_ready_ == 0 ||
-       (num_ready_ > 0 && AllSubchannelsSeenInitialState()) ||
+       (num_ready_ > 0 && AllSubchannelsSeenInitialState() &&
+        (!eager_connect_ || num_connecting_ == 0)) ||
        num_transient_failure_ == num_subchannels())) {
     if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_round_robin_trace)) {
       const std::string old_counters_string =
@@ -55,7 +55,9 @@
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
 #include "src/core/lib/gprpp/work_serializer.h"
+#include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/pollset_set.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/json/json_args.h"
@@ -192,6 +194,9 @@ class CdsLb : public LoadBalancingPolicy {
       std::set<std::string>* clusters_added);
   void OnClusterChanged(const std::string& name,
                         XdsClusterResource cluster_data);
+  void ScheduleChildPolicyUpdateLocked(const std::string& name);
+  static void UpdateChildPolicyCallback(void* arg, grpc_error_handle error);
+  void UpdateChildPolicyLocked();
   void OnError(const std::string& name, absl::Status status);
   void OnResourceDoesNotExist(const std::string& name);
 
@@ -223,6 +228,10 @@ class CdsLb : public LoadBalancingPolicy {
   // Child LB policy.
   OrphanablePtr<LoadBalancingPolicy> child_policy_;
 
+  // Set while a child policy update is pending, to the name of the last
+  // cluster whose update triggered it.
+  absl::optional<std::string> pending_child_policy_update_;
+
   // Internal state.
   bool shutting_down_ = false;
 };
@@ -497,6 +506,42 @@ void CdsLb::OnClusterChanged(const std::string& name,
   if (!status.ok()) {
     return OnError(name, status);
   }
+  ScheduleChildPolicyUpdateLocked(name);
+}
+
+void CdsLb::ScheduleChildPolicyUpdateLocked(const std::string& name) {
+  // XdsClient delivers all of the updates from an xDS response in one
+  // batch, so we regenerate the child policy config once the batch has
+  // been delivered instead of once per cluster.  The callback is run via
+  // the ExecCtx, which is flushed after the XdsClient callback returns.
+  const bool already_pending = pending_child_policy_update_.has_value();
+  pending_child_policy_update_ = name;
+  if (already_pending) return;
+  ExecCtx::Run(DEBUG_LOCATION,
+               GRPC_CLOSURE_CREATE(
+                   UpdateChildPolicyCallback,
+                   Ref(DEBUG_LOCATION, "UpdateChildPolicyCallback").release(),
+                   grpc_schedule_on_exec_ctx),
+               absl::OkStatus());
+}
+
+void CdsLb::UpdateChildPolicyCallback(void* arg, grpc_error_handle /*error*/) {
+  auto* cds_lb = static_cast<CdsLb*>(arg);
+  cds_lb->work_serializer()->Run(
+      [cds_lb]() {
+        RefCountedPtr<CdsLb> lb_policy(cds_lb);
+        lb_policy->UpdateChildPolicyLocked();
+        lb_policy.reset(DEBUG_LOCATION, "UpdateChildPolicyCallback");
+      },
+      DEBUG_LOCATION);
+}
+
+void CdsLb::UpdateChildPolicyLocked() {
+  // The update may have been superseded by a resource deletion, or we
+  // may have been shut down in the meantime.
+  if (shutting_down_ || !pending_child_policy_update_.has_value()) return;
+  const std::string name = std::move(*pending_child_policy_update_);
+  pending_child_policy_update_.reset();
   // Scan the map starting from the root cluster to generate the list of
   // discovery mechanisms. If we don't have some of the data we need (i.e., we
   // just started up and not all watchers have returned data yet), then don't
@@ -610,6 +655,7 @@ void CdsLb::OnResourceDoesNotExist(const std::string& name) {
   channel_control_helper()->UpdateState(
       GRPC_CHANNEL_TRANSIENT_FAILURE, status,
       MakeRefCounted<TransientFailurePicker>(status));
+  pending_child_policy_update_.reset();
   MaybeDestroyChildPolicyLocked();
 }
 
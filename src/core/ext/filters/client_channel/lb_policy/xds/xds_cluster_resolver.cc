@@ -59,6 +59,9 @@
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/validation_errors.h"
 #include "src/core/lib/gprpp/work_serializer.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/iomgr/pollset_set.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/json/json_args.h"
@@ -396,6 +399,8 @@ class XdsClusterResolverLb : public LoadBalancingPolicy {
 
   void MaybeDestroyChildPolicyLocked();
 
+  void ScheduleChildPolicyUpdateLocked();
+  static void UpdateChildPolicyCallback(void* arg, grpc_error_handle error);
   absl::Status UpdateChildPolicyLocked();
   OrphanablePtr<LoadBalancingPolicy> CreateChildPolicyLocked(
       const ChannelArgs& args);
@@ -413,6 +418,7 @@ class XdsClusterResolverLb : public LoadBalancingPolicy {
 
   // Internal state.
   bool shutting_down_ = false;
+  bool child_policy_update_pending_ = false;
 
   // Vector of discovery mechansism entries in priority order.
   std::vector<DiscoveryMechanismEntry> discovery_mechanisms_;
@@ -778,10 +784,39 @@ void XdsClusterResolverLb::OnEndpointChanged(size_t index,
   for (DiscoveryMechanismEntry& mechanism : discovery_mechanisms_) {
     if (!mechanism.latest_update.has_value()) return;
   }
-  // Update child policy.
-  // TODO(roth): If the child policy reports an error with the update,
-  // we need to propagate that error back to the resolver somehow.
-  (void)UpdateChildPolicyLocked();
+  ScheduleChildPolicyUpdateLocked();
+}
+
+void XdsClusterResolverLb::ScheduleChildPolicyUpdateLocked() {
+  // XdsClient delivers all of the updates from an xDS response in one
+  // batch, so when several discovery mechanisms change together, we
+  // update the child policy only once, after the batch.
+  if (child_policy_update_pending_) return;
+  child_policy_update_pending_ = true;
+  ExecCtx::Run(DEBUG_LOCATION,
+               GRPC_CLOSURE_CREATE(
+                   UpdateChildPolicyCallback,
+                   Ref(DEBUG_LOCATION, "UpdateChildPolicyCallback").release(),
+                   grpc_schedule_on_exec_ctx),
+               absl::OkStatus());
+}
+
+void XdsClusterResolverLb::UpdateChildPolicyCallback(
+    void* arg, grpc_error_handle /*error*/) {
+  auto* xds_cluster_resolver_lb = static_cast<XdsClusterResolverLb*>(arg);
+  xds_cluster_resolver_lb->work_serializer()->Run(
+      [xds_cluster_resolver_lb]() {
+        RefCountedPtr<XdsClusterResolverLb> lb_policy(xds_cluster_resolver_lb);
+        // Skip if the child policy has been updated in the meantime.
+        if (lb_policy->child_policy_update_pending_) {
+          // TODO(roth): If the child policy reports an error with the
+          // update, we need to propagate that error back to the resolver
+          // somehow.
+          (void)lb_policy->UpdateChildPolicyLocked();
+        }
+        lb_policy.reset(DEBUG_LOCATION, "UpdateChildPolicyCallback");
+      },
+      DEBUG_LOCATION);
 }
 
 void XdsClusterResolverLb::OnError(size_t index, std::string resolution_note) {
@@ -981,6 +1016,7 @@ XdsClusterResolverLb::CreateChildPolicyConfigLocked() {
 }
 
 absl::Status XdsClusterResolverLb::UpdateChildPolicyLocked() {
+  child_policy_update_pending_ = false;
   if (shutting_down_) return absl::OkStatus();
   UpdateArgs update_args;
   update_args.config = CreateChildPolicyConfigLocked();
@@ -614,7 +614,7 @@ class RetryFilter::CallData {
   // Cached data for retrying send ops.
   // send_initial_metadata
   bool seen_send_initial_metadata_ = false;
-  grpc_metadata_batch send_initial_metadata_{arena_};
+  ClientInitialMetadataBatch send_initial_metadata_{arena_};
   // TODO(roth): As part of implementing hedging, we'll probably need to
   // have the LB call set a value in CallAttempt and then propagate it
   // from CallAttempt to the parent call when we commit.  Otherwise, we
@@ -1977,7 +1977,8 @@ void RetryFilter::CallData::CallAttempt::BatchData::
   //
   // If we've already completed one or more attempts, add the
   // grpc-retry-attempts header.
-  call_attempt_->send_initial_metadata_ = calld->send_initial_metadata_.Copy();
+  call_attempt_->send_initial_metadata_ =
+      calld->send_initial_metadata_.CopyAs<grpc_metadata_batch>();
   if (GPR_UNLIKELY(calld->num_attempts_completed_ > 0)) {
     call_attempt_->send_initial_metadata_.Set(GrpcPreviousRpcAttemptsMetadata(),
                                               calld->num_attempts_completed_);
@@ -2336,7 +2337,8 @@ void RetryFilter::CallData::MaybeCacheSendOpsForBatch(PendingBatch* pending) {
     seen_send_initial_metadata_ = true;
     grpc_metadata_batch* send_initial_metadata =
         batch->payload->send_initial_metadata.send_initial_metadata;
-    send_initial_metadata_ = send_initial_metadata->Copy();
+    send_initial_metadata_ =
+        send_initial_metadata->CopyAs<ClientInitialMetadataBatch>();
     peer_string_ = batch->payload->send_initial_metadata.peer_string;
   }
   // Set up cache for send_message ops.
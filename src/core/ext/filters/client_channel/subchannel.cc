@@ -22,6 +22,7 @@
 #include <limits.h>
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <new>
 #include <utility>
@@ -149,6 +150,7 @@ RefCountedPtr<SubchannelCall> SubchannelCall::Create(Args args,
 SubchannelCall::SubchannelCall(Args args, grpc_error_handle* error)
     : connected_subchannel_(std::move(args.connected_subchannel)),
       deadline_(args.deadline) {
+  connected_subchannel_->active_calls_.fetch_add(1, std::memory_order_relaxed);
   grpc_call_stack* callstk = SUBCHANNEL_CALL_TO_CALL_STACK(this);
   const grpc_call_element_args call_args = {
       callstk,              // call_stack
@@ -218,6 +220,7 @@ void SubchannelCall::Destroy(void* arg, grpc_error_handle /*error*/) {
   grpc_closure* after_call_stack_destroy = self->after_call_stack_destroy_;
   RefCountedPtr<ConnectedSubchannel> connected_subchannel =
       std::move(self->connected_subchannel_);
+  connected_subchannel->active_calls_.fetch_sub(1, std::memory_order_relaxed);
   // Destroy the subchannel call.
   self->~SubchannelCall();
   // Destroy the call stack. This should be after destroying the subchannel
@@ -300,8 +303,10 @@ class Subchannel::ConnectedSubchannelStateWatcher
     : public AsyncConnectivityStateWatcherInterface {
  public:
   // Must be instantiated while holding c->mu.
-  explicit ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c)
-      : subchannel_(std::move(c)) {}
+  ConnectedSubchannelStateWatcher(WeakRefCountedPtr<Subchannel> c,
+                                  ConnectedSubchannel* connected_subchannel)
+      : subchannel_(std::move(c)),
+        connected_subchannel_(connected_subchannel) {}
 
   ~ConnectedSubchannelStateWatcher() override {
     subchannel_.reset(DEBUG_LOCATION, "state_watcher");
@@ -314,32 +319,24 @@ class Subchannel::ConnectedSubchannelStateWatcher
     {
       MutexLock lock(&c->mu_);
       // If we're either shutting down or have already seen this connection
-      // failure (i.e., c->connected_subchannel_ is null), do nothing.
+      // failure, do nothing.
       //
       // The transport reports TRANSIENT_FAILURE upon GOAWAY but SHUTDOWN
       // upon connection close.  So if the server gracefully shuts down,
       // we will see TRANSIENT_FAILURE followed by SHUTDOWN, but if not, we
       // will see only SHUTDOWN.  Either way, we react to the first one we
       // see, ignoring anything that happens after that.
-      if (c->connected_subchannel_ == nullptr) return;
+      if (failed_ || c->shutdown_) return;
       if (new_state == GRPC_CHANNEL_TRANSIENT_FAILURE ||
           new_state == GRPC_CHANNEL_SHUTDOWN) {
+        failed_ = true;
         if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
           gpr_log(GPR_INFO,
                   "subchannel %p %s: Connected subchannel %p reports %s: %s", c,
-                  c->key_.ToString().c_str(), c->connected_subchannel_.get(),
+                  c->key_.ToString().c_str(), connected_subchannel_,
                   ConnectivityStateName(new_state), status.ToString().c_str());
         }
-        c->connected_subchannel_.reset();
-        if (c->channelz_node() != nullptr) {
-          c->channelz_node()->SetChildSocket(nullptr);
-        }
-        // Even though we're reporting IDLE instead of TRANSIENT_FAILURE here,
-        // pass along the status from the transport, since it may have
-        // keepalive info attached to it that the channel needs.
-        // TODO(roth): Consider whether there's a cleaner way to do this.
-        c->SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
-        c->backoff_.Reset();
+        c->OnConnectionFailedLocked(connected_subchannel_, status);
       }
     }
     // Drain any connectivity state notifications after releasing the mutex.
@@ -347,6 +344,10 @@ class Subchannel::ConnectedSubchannelStateWatcher
   }
 
   WeakRefCountedPtr<Subchannel> subchannel_;
+  // The connection being watched. Only used for comparison, since the
+  // connection may have been destroyed once failed_ is set.
+  ConnectedSubchannel* connected_subchannel_;
+  bool failed_ = false;
 };
 
 //
@@ -442,12 +443,35 @@ class Subchannel::HealthWatcherMap::HealthWatcher
       watcher_list_.NotifyLocked(state_, status);
       // We're not connected, so stop health checking.
       health_check_client_.reset();
+      connection_health_checks_.clear();
     }
   }
 
+  void AddConnectionLocked(const RefCountedPtr<ConnectedSubchannel>& connection)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(subchannel_->mu_) {
+    if (health_check_client_ == nullptr) return;
+    ConnectionHealthCheck& check = connection_health_checks_[connection.get()];
+    check.watcher = MakeOrphanable<ConnectionHealthWatcher>(subchannel_);
+    check.client = MakeHealthCheckClient(
+        health_check_service_name_, connection, subchannel_->pollset_set_,
+        subchannel_->channelz_node_, check.watcher->RefAsWatcher());
+  }
+
+  void RemoveConnectionLocked(ConnectedSubchannel* connection) {
+    connection_health_checks_.erase(connection);
+  }
+
+  bool IsConnectionHealthyLocked(ConnectedSubchannel* connection) const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(subchannel_->mu_) {
+    auto it = connection_health_checks_.find(connection);
+    return it != connection_health_checks_.end() &&
+           it->second.watcher->state() == GRPC_CHANNEL_READY;
+  }
+
   void Orphan() override {
     watcher_list_.Clear();
     health_check_client_.reset();
+    connection_health_checks_.clear();
     Unref();
   }
 
@@ -467,17 +491,63 @@ class Subchannel::HealthWatcherMap::HealthWatcher
     subchannel_->work_serializer_.DrainQueue();
   }
 
+  // Records the health of one of the subchannel's additional connections,
+  // which only carries calls while it is reported healthy.
+  class ConnectionHealthWatcher
+      : public AsyncConnectivityStateWatcherInterface {
+   public:
+    explicit ConnectionHealthWatcher(WeakRefCountedPtr<Subchannel> c)
+        : subchannel_(std::move(c)) {}
+
+    ~ConnectionHealthWatcher() override {
+      subchannel_.reset(DEBUG_LOCATION, "connection_health_watcher");
+    }
+
+    grpc_connectivity_state state() const
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(subchannel_->mu_) {
+      return state_;
+    }
+
+    // Ref held by the health check client.
+    RefCountedPtr<ConnectivityStateWatcherInterface> RefAsWatcher() {
+      return Ref();
+    }
+
+   private:
+    void OnConnectivityStateChange(grpc_connectivity_state new_state,
+                                   const absl::Status& /*status*/) override {
+      MutexLock lock(&subchannel_->mu_);
+      if (new_state != GRPC_CHANNEL_SHUTDOWN) state_ = new_state;
+    }
+
+    WeakRefCountedPtr<Subchannel> subchannel_;
+    grpc_connectivity_state state_ ABSL_GUARDED_BY(subchannel_->mu_) =
+        GRPC_CHANNEL_CONNECTING;
+  };
+
+  struct ConnectionHealthCheck {
+    OrphanablePtr<ConnectionHealthWatcher> watcher;
+    OrphanablePtr<SubchannelStreamClient> client;
+  };
+
   void StartHealthCheckingLocked()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(subchannel_->mu_) {
     GPR_ASSERT(health_check_client_ == nullptr);
     health_check_client_ = MakeHealthCheckClient(
         health_check_service_name_, subchannel_->connected_subchannel_,
         subchannel_->pollset_set_, subchannel_->channelz_node_, Ref());
+    for (const auto& connection : subchannel_->additional_connections_) {
+      AddConnectionLocked(connection);
+    }
   }
 
   WeakRefCountedPtr<Subchannel> subchannel_;
   std::string health_check_service_name_;
   OrphanablePtr<SubchannelStreamClient> health_check_client_;
+  // Health checks of the additional connections, started together with
+  // health_check_client_.
+  std::map<ConnectedSubchannel*, ConnectionHealthCheck>
+      connection_health_checks_;
   grpc_connectivity_state state_;
   absl::Status status_;
   ConnectivityStateWatcherList watcher_list_;
@@ -542,6 +612,28 @@ Subchannel::HealthWatcherMap::CheckConnectivityStateLocked(
   return health_watcher->state();
 }
 
+void Subchannel::HealthWatcherMap::AddConnectionLocked(
+    const RefCountedPtr<ConnectedSubchannel>& connection) {
+  for (const auto& p : map_) {
+    p.second->AddConnectionLocked(connection);
+  }
+}
+
+void Subchannel::HealthWatcherMap::RemoveConnectionLocked(
+    ConnectedSubchannel* connection) {
+  for (const auto& p : map_) {
+    p.second->RemoveConnectionLocked(connection);
+  }
+}
+
+bool Subchannel::HealthWatcherMap::IsConnectionHealthyLocked(
+    ConnectedSubchannel* connection) const {
+  for (const auto& p : map_) {
+    if (!p.second->IsConnectionHealthyLocked(connection)) return false;
+  }
+  return true;
+}
+
 void Subchannel::HealthWatcherMap::ShutdownLocked() { map_.clear(); }
 
 //
@@ -597,9 +689,22 @@ Subchannel::Subchannel(SubchannelKey key,
       key_(std::move(key)),
       args_(args),
       pollset_set_(grpc_pollset_set_create()),
+      min_connections_(static_cast<size_t>(std::max(
+          1, args_.GetInt(GRPC_ARG_SUBCHANNEL_MIN_CONNECTIONS).value_or(1)))),
+      max_connections_(std::max(
+          min_connections_,
+          static_cast<size_t>(std::max(
+              0, args_.GetInt(GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS)
+                     .value_or(0))))),
+      streams_per_connection_(static_cast<size_t>(std::max(
+          1,
+          args_.GetInt(GRPC_ARG_SUBCHANNEL_STREAMS_PER_CONNECTION)
+              .value_or(100)))),
       connector_(std::move(connector)),
       watcher_list_(this),
       backoff_(ParseArgsForBackoffValues(args_, &min_connect_timeout_)),
+      additional_connection_backoff_(
+          ParseArgsForBackoffValues(args_, &min_connect_timeout_)),
       event_engine_(args_.GetObjectRef<EventEngine>()) {
   // A grpc_init is added here to ensure that grpc_shutdown does not happen
   // until the subchannel is destroyed. Subchannels can persist longer than
@@ -620,8 +725,9 @@ Subchannel::Subchannel(SubchannelKey key,
                              .MapAddress(key_.address(), &args_)
                              .value_or(key_.address());
   // Initialize channelz.
-  const bool channelz_enabled = args_.GetBool(GRPC_ARG_ENABLE_CHANNELZ)
-                                    .value_or(GRPC_ENABLE_CHANNELZ_DEFAULT);
+  static constexpr ChannelArgs::Key kEnableChannelz(GRPC_ARG_ENABLE_CHANNELZ);
+  const bool channelz_enabled =
+      args_.GetBool(kEnableChannelz).value_or(GRPC_ENABLE_CHANNELZ_DEFAULT);
   if (channelz_enabled) {
     const size_t channel_tracer_max_memory = Clamp(
         args_.GetInt(GRPC_ARG_MAX_CHANNEL_TRACE_EVENT_MEMORY_PER_NODE)
@@ -735,6 +841,29 @@ void Subchannel::CancelConnectivityStateWatch(
   work_serializer_.DrainQueue();
 }
 
+RefCountedPtr<ConnectedSubchannel> Subchannel::connected_subchannel() {
+  MutexLock lock(&mu_);
+  if (max_connections_ == 1) return connected_subchannel_;
+  // Use the connection with the fewest active calls, skipping additional
+  // connections that are not (yet) known to be healthy.
+  RefCountedPtr<ConnectedSubchannel> result = connected_subchannel_;
+  if (result == nullptr) return nullptr;
+  for (const auto& connection : additional_connections_) {
+    if (connection->active_calls() < result->active_calls() &&
+        health_watcher_map_.IsConnectionHealthyLocked(connection.get())) {
+      result = connection;
+    }
+  }
+  MaybeStartAdditionalConnectionLocked();
+  return result;
+}
+
+size_t Subchannel::NumConnectionsForTesting() {
+  MutexLock lock(&mu_);
+  return (connected_subchannel_ != nullptr ? 1 : 0) +
+         additional_connections_.size();
+}
+
 void Subchannel::RequestConnection() {
   {
     MutexLock lock(&mu_);
@@ -778,6 +907,8 @@ void Subchannel::Orphan() {
     shutdown_ = true;
     connector_.reset();
     connected_subchannel_.reset();
+    additional_connections_.clear();
+    CancelAdditionalConnectionRetryTimerLocked();
     health_watcher_map_.ShutdownLocked();
   }
   // Drain any connectivity state notifications after releasing the mutex.
@@ -834,6 +965,50 @@ void Subchannel::SetConnectivityStateLocked(grpc_connectivity_state state,
   health_watcher_map_.NotifyLocked(state, status_);
 }
 
+void Subchannel::OnConnectionFailedLocked(ConnectedSubchannel* connection,
+                                          const absl::Status& status) {
+  // If this is one of the additional connections, just drop it.
+  auto it = std::find_if(
+      additional_connections_.begin(), additional_connections_.end(),
+      [connection](const RefCountedPtr<ConnectedSubchannel>& c) {
+        return c.get() == connection;
+      });
+  // Either way, a replacement connection is started right away.
+  if (it != additional_connections_.end()) {
+    health_watcher_map_.RemoveConnectionLocked(connection);
+    additional_connections_.erase(it);
+    MaybeStartAdditionalConnectionLocked();
+    return;
+  }
+  if (connected_subchannel_.get() != connection) return;
+  connected_subchannel_.reset();
+  // If there is an additional connection, switch to it and stay READY.
+  // Health checking is restarted on the new connection.
+  if (!additional_connections_.empty()) {
+    connected_subchannel_ = std::move(additional_connections_.back());
+    additional_connections_.pop_back();
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+      gpr_log(GPR_INFO,
+              "subchannel %p %s: switching to connected subchannel %p", this,
+              key_.ToString().c_str(), connected_subchannel_.get());
+    }
+    health_watcher_map_.NotifyLocked(GRPC_CHANNEL_CONNECTING,
+                                     absl::OkStatus());
+    health_watcher_map_.NotifyLocked(GRPC_CHANNEL_READY, absl::OkStatus());
+    MaybeStartAdditionalConnectionLocked();
+    return;
+  }
+  CancelAdditionalConnectionRetryTimerLocked();
+  additional_connection_backoff_.Reset();
+  if (channelz_node_ != nullptr) channelz_node_->SetChildSocket(nullptr);
+  // Even though we're reporting IDLE instead of TRANSIENT_FAILURE here,
+  // pass along the status from the transport, since it may have
+  // keepalive info attached to it that the channel needs.
+  // TODO(roth): Consider whether there's a cleaner way to do this.
+  SetConnectivityStateLocked(GRPC_CHANNEL_IDLE, status);
+  backoff_.Reset();
+}
+
 void Subchannel::OnRetryTimer() {
   {
     MutexLock lock(&mu_);
@@ -856,6 +1031,12 @@ void Subchannel::StartConnectingLocked() {
   next_attempt_time_ = backoff_.NextAttemptTime();
   // Report CONNECTING.
   SetConnectivityStateLocked(GRPC_CHANNEL_CONNECTING, absl::OkStatus());
+  // If an attempt for an additional connection is still in flight, it
+  // becomes this connection attempt.
+  if (connecting_additional_) {
+    connecting_additional_ = false;
+    return;
+  }
   // Start connection attempt.
   SubchannelConnector::Args args;
   args.address = &address_for_connect_;
@@ -882,6 +1063,39 @@ void Subchannel::OnConnectingFinishedLocked(grpc_error_handle error) {
     connecting_result_.Reset();
     return;
   }
+  if (connecting_additional_) {
+    connecting_additional_ = false;
+    // If the subchannel lost its connection while this attempt was in
+    // flight, and no new connection has been requested since, drop the
+    // result rather than going straight to READY.
+    if (state_ != GRPC_CHANNEL_READY) {
+      connecting_result_.Reset();
+      return;
+    }
+    if (connecting_result_.transport == nullptr || !PublishTransportLocked()) {
+      const Duration time_until_next_attempt =
+          additional_connection_backoff_.NextAttemptTime() - Timestamp::Now();
+      gpr_log(GPR_INFO,
+              "subchannel %p %s: additional connection failed (%s), backing "
+              "off for %" PRId64 " ms",
+              this, key_.ToString().c_str(), StatusToString(error).c_str(),
+              time_until_next_attempt.millis());
+      additional_connection_retry_timer_handle_ = event_engine_->RunAfter(
+          time_until_next_attempt,
+          [self = WeakRef(DEBUG_LOCATION, "AdditionalRetryTimer")]() mutable {
+            ApplicationCallbackExecCtx callback_exec_ctx;
+            ExecCtx exec_ctx;
+            self->OnAdditionalConnectionRetryTimer();
+            // As for the retry timer, release the ref while the ExecCtx is
+            // still active.
+            self.reset();
+          });
+      return;
+    }
+    additional_connection_backoff_.Reset();
+    MaybeStartAdditionalConnectionLocked();
+    return;
+  }
   // If we didn't get a transport or we fail to publish it, report
   // TRANSIENT_FAILURE and start the retry timer.
   // Note that if the connection attempt took longer than the backoff
@@ -941,22 +1155,81 @@ bool Subchannel::PublishTransportLocked() {
   connecting_result_.Reset();
   if (shutdown_) return false;
   // Publish.
-  connected_subchannel_.reset(
-      new ConnectedSubchannel(stk->release(), args_, channelz_node_));
+  auto connection = MakeRefCounted<ConnectedSubchannel>(stk->release(), args_,
+                                                        channelz_node_);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
     gpr_log(GPR_INFO, "subchannel %p %s: new connected subchannel at %p", this,
-            key_.ToString().c_str(), connected_subchannel_.get());
+            key_.ToString().c_str(), connection.get());
   }
+  // Start watching connected subchannel.
+  connection->StartWatch(pollset_set_,
+                         MakeOrphanable<ConnectedSubchannelStateWatcher>(
+                             WeakRef(DEBUG_LOCATION, "state_watcher"),
+                             connection.get()));
+  // If we are already READY, this is an additional connection. Note that
+  // channelz only tracks the socket of the primary connection.
+  if (state_ == GRPC_CHANNEL_READY) {
+    health_watcher_map_.AddConnectionLocked(connection);
+    additional_connections_.push_back(std::move(connection));
+    return true;
+  }
+  connected_subchannel_ = std::move(connection);
   if (channelz_node_ != nullptr) {
     channelz_node_->SetChildSocket(std::move(socket));
   }
-  // Start watching connected subchannel.
-  connected_subchannel_->StartWatch(
-      pollset_set_, MakeOrphanable<ConnectedSubchannelStateWatcher>(
-                        WeakRef(DEBUG_LOCATION, "state_watcher")));
   // Report initial state.
   SetConnectivityStateLocked(GRPC_CHANNEL_READY, absl::Status());
+  MaybeStartAdditionalConnectionLocked();
   return true;
 }
 
+void Subchannel::MaybeStartAdditionalConnectionLocked() {
+  if (shutdown_ || state_ != GRPC_CHANNEL_READY || connecting_additional_ ||
+      additional_connection_retry_timer_handle_.has_value()) {
+    return;
+  }
+  const size_t num_connections = 1 + additional_connections_.size();
+  if (num_connections >= max_connections_) return;
+  if (num_connections >= min_connections_) {
+    // Only grow beyond the minimum if every connection is saturated.
+    if (connected_subchannel_->active_calls() < streams_per_connection_) {
+      return;
+    }
+    for (const auto& connection : additional_connections_) {
+      if (connection->active_calls() < streams_per_connection_) return;
+    }
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_subchannel)) {
+    gpr_log(GPR_INFO,
+            "subchannel %p %s: starting additional connection attempt "
+            "(%" PRIuPTR " connections)",
+            this, key_.ToString().c_str(), num_connections);
+  }
+  connecting_additional_ = true;
+  SubchannelConnector::Args args;
+  args.address = &address_for_connect_;
+  args.interested_parties = pollset_set_;
+  args.deadline = Timestamp::Now() + min_connect_timeout_;
+  args.channel_args = args_;
+  WeakRef(DEBUG_LOCATION, "Connect").release();  // Ref held by callback.
+  connector_->Connect(args, &connecting_result_, &on_connecting_finished_);
+}
+
+void Subchannel::OnAdditionalConnectionRetryTimer() {
+  {
+    MutexLock lock(&mu_);
+    additional_connection_retry_timer_handle_.reset();
+    MaybeStartAdditionalConnectionLocked();
+  }
+  // Drain any connectivity state notifications after releasing the mutex.
+  work_serializer_.DrainQueue();
+}
+
+void Subchannel::CancelAdditionalConnectionRetryTimerLocked() {
+  if (additional_connection_retry_timer_handle_.has_value()) {
+    event_engine_->Cancel(*additional_connection_retry_timer_handle_);
+    additional_connection_retry_timer_handle_.reset();
+  }
+}
+
 }  // namespace grpc_core
@@ -21,10 +21,12 @@
 
 #include <stddef.h>
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/status/status.h"
@@ -86,9 +88,17 @@ class ConnectedSubchannel : public RefCounted<ConnectedSubchannel> {
 
   size_t GetInitialCallSizeEstimate() const;
 
+  // Number of SubchannelCalls currently using this connection.
+  size_t active_calls() const {
+    return active_calls_.load(std::memory_order_relaxed);
+  }
+
  private:
+  friend class SubchannelCall;
+
   grpc_channel_stack* channel_stack_;
   ChannelArgs args_;
+  std::atomic<size_t> active_calls_{0};
   // ref counted pointer to the channelz node in this connected subchannel's
   // owning subchannel.
   RefCountedPtr<channelz::SubchannelNode> channelz_subchannel_;
@@ -231,11 +241,14 @@ class Subchannel : public DualRefCounted<Subchannel> {
       const absl::optional<std::string>& health_check_service_name,
       ConnectivityStateWatcherInterface* watcher) ABSL_LOCKS_EXCLUDED(mu_);
 
+  // Returns the connection to use for a new call: the one with the fewest
+  // active calls, if the subchannel has more than one connection.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel()
-      ABSL_LOCKS_EXCLUDED(mu_) {
-    MutexLock lock(&mu_);
-    return connected_subchannel_;
-  }
+      ABSL_LOCKS_EXCLUDED(mu_);
+
+  // Returns the number of connections currently published: the primary
+  // one, if any, plus the additional ones.
+  size_t NumConnectionsForTesting() ABSL_LOCKS_EXCLUDED(mu_);
 
   // Attempt to connect to the backend.  Has no effect if already connected.
   void RequestConnection() ABSL_LOCKS_EXCLUDED(mu_);
@@ -304,7 +317,8 @@ class Subchannel : public DualRefCounted<Subchannel> {
   // corresponding service name.
   //
   // A health check client is maintained only while the subchannel is in
-  // state READY.
+  // state READY, for the primary connection and for each additional
+  // connection.
   class HealthWatcherMap {
    public:
     void AddWatcherLocked(
@@ -322,6 +336,18 @@ class Subchannel : public DualRefCounted<Subchannel> {
         Subchannel* subchannel, const std::string& health_check_service_name)
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&Subchannel::mu_);
 
+    // Starts and stops health checking an additional connection.
+    void AddConnectionLocked(
+        const RefCountedPtr<ConnectedSubchannel>& connection)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&Subchannel::mu_);
+    void RemoveConnectionLocked(ConnectedSubchannel* connection)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&Subchannel::mu_);
+
+    // Returns true if every health check service name reports the
+    // additional connection as healthy (trivially true with no watchers).
+    bool IsConnectionHealthyLocked(ConnectedSubchannel* connection) const
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&Subchannel::mu_);
+
     void ShutdownLocked();
 
    private:
@@ -337,6 +363,12 @@ class Subchannel : public DualRefCounted<Subchannel> {
                                   const absl::Status& status)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+  // Handles the failure of \a connection, which is either
+  // connected_subchannel_ or one of additional_connections_.
+  void OnConnectionFailedLocked(ConnectedSubchannel* connection,
+                                const absl::Status& status)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
   // Methods for connection.
   void OnRetryTimer() ABSL_LOCKS_EXCLUDED(mu_);
   void OnRetryTimerLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
@@ -346,6 +378,14 @@ class Subchannel : public DualRefCounted<Subchannel> {
   void OnConnectingFinishedLocked(grpc_error_handle error)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
   bool PublishTransportLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  // Starts a connection attempt for an additional connection if the
+  // subchannel has fewer than min_connections_, or if all connections are
+  // saturated and it has fewer than max_connections_.
+  void MaybeStartAdditionalConnectionLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnAdditionalConnectionRetryTimer() ABSL_LOCKS_EXCLUDED(mu_);
+  void CancelAdditionalConnectionRetryTimerLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
   // The subchannel pool this subchannel is in.
   RefCountedPtr<SubchannelPoolInterface> subchannel_pool_;
@@ -362,6 +402,11 @@ class Subchannel : public DualRefCounted<Subchannel> {
   RefCountedPtr<channelz::SubchannelNode> channelz_node_;
   // Minimum connection timeout.
   Duration min_connect_timeout_;
+  // Number of connections to maintain, and to grow to under load.
+  size_t min_connections_;
+  size_t max_connections_;
+  // Active calls at which a connection is considered saturated.
+  size_t streams_per_connection_;
 
   // Connection state.
   OrphanablePtr<SubchannelConnector> connector_;
@@ -391,12 +436,24 @@ class Subchannel : public DualRefCounted<Subchannel> {
 
   // Active connection, or null.
   RefCountedPtr<ConnectedSubchannel> connected_subchannel_ ABSL_GUARDED_BY(mu_);
+  // Connections opened in addition to connected_subchannel_ while the
+  // subchannel is READY. If connected_subchannel_ fails, one of these
+  // takes its place and the subchannel stays READY. Lost connections are
+  // replaced right away, with failed attempts retried with backoff.
+  std::vector<RefCountedPtr<ConnectedSubchannel>> additional_connections_
+      ABSL_GUARDED_BY(mu_);
+  // Whether connector_ is being used for an additional connection.
+  bool connecting_additional_ ABSL_GUARDED_BY(mu_) = false;
 
   // Backoff state.
   BackOff backoff_ ABSL_GUARDED_BY(mu_);
   Timestamp next_attempt_time_ ABSL_GUARDED_BY(mu_);
   grpc_event_engine::experimental::EventEngine::TaskHandle retry_timer_handle_
       ABSL_GUARDED_BY(mu_);
+  // Backoff state for additional connections.
+  BackOff additional_connection_backoff_ ABSL_GUARDED_BY(mu_);
+  absl::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      additional_connection_retry_timer_handle_ ABSL_GUARDED_BY(mu_);
 
   // Keepalive time period (-1 for unset)
   int keepalive_time_ ABSL_GUARDED_BY(mu_) = -1;
@@ -22,6 +22,7 @@
 
 #include <string.h>
 
+#include "absl/hash/hash.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_cat.h"
@@ -40,7 +41,10 @@ TraceFlag grpc_subchannel_pool_trace(false, "subchannel_pool");
 
 SubchannelKey::SubchannelKey(const grpc_resolved_address& address,
                              const ChannelArgs& args)
-    : address_(address), args_(args) {}
+    : address_(address),
+      args_(args),
+      hash_(absl::HashOf(absl::string_view(address.addr, address.len),
+                         args)) {}
 
 bool SubchannelKey::operator<(const SubchannelKey& other) const {
   if (address_.len < other.address_.len) return true;
@@ -51,6 +55,12 @@ bool SubchannelKey::operator<(const SubchannelKey& other) const {
   return args_ < other.args();
 }
 
+bool SubchannelKey::operator==(const SubchannelKey& other) const {
+  return hash_ == other.hash_ && address_.len == other.address_.len &&
+         memcmp(address_.addr, other.address_.addr, address_.len) == 0 &&
+         args_ == other.args_;
+}
+
 std::string SubchannelKey::ToString() const {
   auto addr_uri = grpc_sockaddr_to_uri(&address_);
   return absl::StrCat(
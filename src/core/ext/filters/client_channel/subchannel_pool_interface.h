@@ -21,7 +21,10 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
 #include <string>
+#include <utility>
 
 #include "absl/strings/string_view.h"
 
@@ -49,16 +52,27 @@ class SubchannelKey {
   SubchannelKey& operator=(SubchannelKey&& other) noexcept = default;
 
   bool operator<(const SubchannelKey& other) const;
+  bool operator==(const SubchannelKey& other) const;
 
   const grpc_resolved_address& address() const { return address_; }
   const ChannelArgs& args() const { return args_; }
 
+  // Hash of the address and args, computed once at construction so that
+  // hashed lookups don't walk the args.
+  size_t hash() const { return hash_; }
+
+  template <typename H>
+  friend H AbslHashValue(H h, const SubchannelKey& key) {
+    return H::combine(std::move(h), key.hash_);
+  }
+
   // Human-readable string suitable for logging.
   std::string ToString() const;
 
  private:
   grpc_resolved_address address_;
   ChannelArgs args_;
+  size_t hash_;
 };
 
 // Interface for subchannel pool.
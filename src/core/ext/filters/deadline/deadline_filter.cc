@@ -386,7 +386,9 @@ const grpc_channel_filter grpc_server_deadline_filter = {
 
 bool grpc_deadline_checking_enabled(
     const grpc_core::ChannelArgs& channel_args) {
-  return channel_args.GetBool(GRPC_ARG_ENABLE_DEADLINE_CHECKS)
+  static constexpr grpc_core::ChannelArgs::Key kEnableDeadlineChecks(
+      GRPC_ARG_ENABLE_DEADLINE_CHECKS);
+  return channel_args.GetBool(kEnableDeadlineChecks)
       .value_or(!channel_args.WantMinimalStack());
 }
 
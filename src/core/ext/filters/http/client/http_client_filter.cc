@@ -97,10 +97,14 @@ Slice UserAgentFromArgs(const ChannelArgs& args, const char* transport_name) {
     if (!x.empty()) fields.push_back(std::string(x));
   };
 
-  add(args.GetString(GRPC_ARG_PRIMARY_USER_AGENT_STRING).value_or(""));
+  static constexpr ChannelArgs::Key kPrimaryUserAgent(
+      GRPC_ARG_PRIMARY_USER_AGENT_STRING);
+  static constexpr ChannelArgs::Key kSecondaryUserAgent(
+      GRPC_ARG_SECONDARY_USER_AGENT_STRING);
+  add(args.GetString(kPrimaryUserAgent).value_or(""));
   add(absl::StrFormat("grpc-c/%s (%s; %s)", grpc_version_string(),
                       GPR_PLATFORM_STRING, transport_name));
-  add(args.GetString(GRPC_ARG_SECONDARY_USER_AGENT_STRING).value_or(""));
+  add(args.GetString(kSecondaryUserAgent).value_or(""));
 
   return Slice::FromCopiedString(absl::StrJoin(fields, " "));
 }
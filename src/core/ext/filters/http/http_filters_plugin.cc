@@ -50,12 +50,14 @@ void RegisterHttpFilters(CoreConfiguration::Builder* builder) {
         channel_type, GRPC_CHANNEL_INIT_BUILTIN_PRIORITY,
         [filter](ChannelStackBuilder* builder) {
           if (!is_building_http_like_transport(builder)) return true;
+          static constexpr ChannelArgs::Key kEnableDecompression(
+              GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION);
+          static constexpr ChannelArgs::Key kEnableCompression(
+              GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION);
           auto args = builder->channel_args();
           const bool enable =
-              args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION)
-                  .value_or(true) ||
-              args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION)
-                  .value_or(true);
+              args.GetBool(kEnableDecompression).value_or(true) ||
+              args.GetBool(kEnableCompression).value_or(true);
           if (enable) builder->PrependFilter(filter);
           return true;
         });
@@ -79,6 +79,13 @@ absl::StatusOr<ServerCompressionFilter> ServerCompressionFilter::Create(
   return ServerCompressionFilter(args);
 }
 
+namespace {
+constexpr ChannelArgs::Key kEnableCompression(
+    GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION);
+constexpr ChannelArgs::Key kEnableDecompression(
+    GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION);
+}  // namespace
+
 CompressionFilter::CompressionFilter(const ChannelArgs& args)
     : max_recv_size_(GetMaxRecvSizeFromChannelArgs(args)),
       message_size_service_config_parser_index_(
@@ -88,11 +95,9 @@ CompressionFilter::CompressionFilter(const ChannelArgs& args)
               GRPC_COMPRESS_NONE)),
       enabled_compression_algorithms_(
           CompressionAlgorithmSet::FromChannelArgs(args)),
-      enable_compression_(
-          args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_COMPRESSION).value_or(true)),
+      enable_compression_(args.GetBool(kEnableCompression).value_or(true)),
       enable_decompression_(
-          args.GetBool(GRPC_ARG_ENABLE_PER_MESSAGE_DECOMPRESSION)
-              .value_or(true)) {
+          args.GetBool(kEnableDecompression).value_or(true)) {
   // Make sure the default is enabled.
   if (!enabled_compression_algorithms_.IsSet(default_compression_algorithm_)) {
     const char* name;
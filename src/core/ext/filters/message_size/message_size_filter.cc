@@ -74,8 +74,10 @@ MessageSizeParsedConfig MessageSizeParsedConfig::GetFromChannelArgs(
 
 absl::optional<uint32_t> GetMaxRecvSizeFromChannelArgs(
     const ChannelArgs& args) {
+  static constexpr ChannelArgs::Key kMaxRecvSize(
+      GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH);
   if (args.WantMinimalStack()) return absl::nullopt;
-  int size = args.GetInt(GRPC_ARG_MAX_RECEIVE_MESSAGE_LENGTH)
+  int size = args.GetInt(kMaxRecvSize)
                  .value_or(GRPC_DEFAULT_MAX_RECV_MESSAGE_LENGTH);
   if (size < 0) return absl::nullopt;
   return static_cast<uint32_t>(size);
@@ -83,8 +85,10 @@ absl::optional<uint32_t> GetMaxRecvSizeFromChannelArgs(
 
 absl::optional<uint32_t> GetMaxSendSizeFromChannelArgs(
     const ChannelArgs& args) {
+  static constexpr ChannelArgs::Key kMaxSendSize(
+      GRPC_ARG_MAX_SEND_MESSAGE_LENGTH);
   if (args.WantMinimalStack()) return absl::nullopt;
-  int size = args.GetInt(GRPC_ARG_MAX_SEND_MESSAGE_LENGTH)
+  int size = args.GetInt(kMaxSendSize)
                  .value_or(GRPC_DEFAULT_MAX_SEND_MESSAGE_LENGTH);
   if (size < 0) return absl::nullopt;
   return static_cast<uint32_t>(size);
@@ -112,6 +112,10 @@ void Chttp2Connector::Connect(const Args& args, Result* result,
     notify_ = notify;
     GPR_ASSERT(endpoint_ == nullptr);
     event_engine_ = args_.channel_args.GetObject<EventEngine>();
+    ping_before_ready_ =
+        args_.channel_args.GetBool(GRPC_ARG_HTTP2_PING_BEFORE_READY)
+            .value_or(false);
+    ping_sent_ = false;
   }
   absl::StatusOr<std::string> address = grpc_sockaddr_to_uri(args.address);
   if (!address.ok()) {
@@ -203,6 +207,16 @@ void Chttp2Connector::OnReceiveSettings(void* arg, grpc_error_handle error) {
   {
     MutexLock lock(&self->mu_);
     if (!self->notify_error_.has_value()) {
+      if (error.ok() && self->ping_before_ready_ && !self->ping_sent_) {
+        // Hold off reporting the connection until the server has acked a
+        // PING as well. This callback runs again when the ack arrives, and
+        // the ref it holds is kept until then.
+        self->ping_sent_ = true;
+        grpc_transport_op* op = grpc_make_transport_op(nullptr);
+        op->send_ping.on_ack = &self->on_receive_settings_;
+        grpc_transport_perform_op(self->result_->transport, op);
+        return;
+      }
       grpc_endpoint_delete_from_pollset_set(self->endpoint_,
                                             self->args_.interested_parties);
       if (!error.ok()) {
@@ -231,12 +245,14 @@ void Chttp2Connector::OnTimeout() {
   MutexLock lock(&mu_);
   timer_handle_.reset();
   if (!notify_error_.has_value()) {
-    // The transport did not receive the settings frame in time. Destroy the
-    // transport.
+    // The transport did not receive the settings frame (or the PING ack)
+    // in time. Destroy the transport.
     grpc_endpoint_delete_from_pollset_set(endpoint_, args_.interested_parties);
     result_->Reset();
     MaybeNotify(GRPC_ERROR_CREATE(
-        "connection attempt timed out before receiving SETTINGS frame"));
+        ping_sent_
+            ? "connection attempt timed out before receiving PING ack"
+            : "connection attempt timed out before receiving SETTINGS frame"));
   } else {
     // OnReceiveSettings() was already invoked. Call Notify() again so that
     // notify_ can be invoked.
@@ -56,7 +56,8 @@ class Chttp2Connector : public SubchannelConnector {
   // triggers the other callback to be invoked. 2) When the other callback is
   // invoked, we call MaybeNotify() again to actually invoke the notify_
   // callback. Note that this only happens if the handshake is done and the
-  // connector is waiting on the SETTINGS frame.
+  // connector is waiting on the SETTINGS frame (or, with
+  // GRPC_ARG_HTTP2_PING_BEFORE_READY, on the ack of the PING sent after it).
   void MaybeNotify(grpc_error_handle error);
 
   Mutex mu_;
@@ -75,6 +76,10 @@ class Chttp2Connector : public SubchannelConnector {
   grpc_event_engine::experimental::EventEngine* event_engine_
       ABSL_GUARDED_BY(mu_);
   absl::optional<grpc_error_handle> notify_error_;
+  // Set from GRPC_ARG_HTTP2_PING_BEFORE_READY.
+  bool ping_before_ready_ ABSL_GUARDED_BY(mu_) = false;
+  // Whether the warm-up PING has been sent for the current attempt.
+  bool ping_sent_ ABSL_GUARDED_BY(mu_) = false;
   RefCountedPtr<HandshakeManager> handshake_mgr_;
 };
 
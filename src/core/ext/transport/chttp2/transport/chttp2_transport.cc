@@ -332,7 +332,9 @@ static void read_channel_args(grpc_chttp2_transport* t,
           .GetBool(GRPC_ARG_EXPERIMENTAL_HTTP2_PREFERRED_CRYPTO_FRAME_SIZE)
           .value_or(false);
 
-  if (channel_args.GetBool(GRPC_ARG_ENABLE_CHANNELZ)
+  static constexpr grpc_core::ChannelArgs::Key kEnableChannelz(
+      GRPC_ARG_ENABLE_CHANNELZ);
+  if (channel_args.GetBool(kEnableChannelz)
           .value_or(GRPC_ENABLE_CHANNELZ_DEFAULT)) {
     t->channelz_socket =
         grpc_core::MakeRefCounted<grpc_core::channelz::SocketNode>(
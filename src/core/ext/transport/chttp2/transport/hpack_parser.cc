@@ -49,6 +49,7 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gprpp/status_helper.h"
+#include "src/core/lib/slice/interned_slice_table.h"
 #include "src/core/lib/slice/slice.h"
 #include "src/core/lib/slice/slice_refcount.h"
 #include "src/core/lib/transport/parsed_metadata.h"
@@ -668,6 +669,11 @@ class HPackParser::String {
   // Take the value and leave this empty
   Slice Take();
 
+  // Take the value as a slice from the process-wide interning table
+  Slice TakeInterned() {
+    return InternedSliceTable::Get()->Intern(string_view());
+  }
+
   // Return a reference to the value as a string view
   absl::string_view string_view() const {
     if (auto* p = absl::get_if<Slice>(&value_)) {
@@ -952,11 +958,11 @@ class HPackParser::Parser {
       case 1:
         switch (cur & 0xf) {
           case 0:  // literal key
-            return FinishHeaderOmitFromTable(ParseLiteralKey());
+            return FinishHeaderOmitFromTable(ParseLiteralKey(false));
           case 0xf:  // varint encoded key index
-            return FinishHeaderOmitFromTable(ParseVarIdxKey(0xf));
+            return FinishHeaderOmitFromTable(ParseVarIdxKey(0xf, false));
           default:  // inline encoded key index
-            return FinishHeaderOmitFromTable(ParseIdxKey(cur & 0xf));
+            return FinishHeaderOmitFromTable(ParseIdxKey(cur & 0xf, false));
         }
         // Update max table size.
         // First byte format: 001xxxxx
@@ -983,20 +989,20 @@ class HPackParser::Parser {
       case 4:
         if (cur == 0x40) {
           // literal key
-          return FinishHeaderAndAddToTable(ParseLiteralKey());
+          return FinishHeaderAndAddToTable(ParseLiteralKey(true));
         }
         ABSL_FALLTHROUGH_INTENDED;
       case 5:
       case 6:
         // inline encoded key index
-        return FinishHeaderAndAddToTable(ParseIdxKey(cur & 0x3f));
+        return FinishHeaderAndAddToTable(ParseIdxKey(cur & 0x3f, true));
       case 7:
         if (cur == 0x7f) {
           // varint encoded key index
-          return FinishHeaderAndAddToTable(ParseVarIdxKey(0x3f));
+          return FinishHeaderAndAddToTable(ParseVarIdxKey(0x3f, true));
         } else {
           // inline encoded key index
-          return FinishHeaderAndAddToTable(ParseIdxKey(cur & 0x3f));
+          return FinishHeaderAndAddToTable(ParseIdxKey(cur & 0x3f, true));
         }
         // Indexed Header Field Representation
         // First byte format: 1xxxxxxx
@@ -1094,15 +1100,16 @@ class HPackParser::Parser {
   }
 
   // Parse a string encoded key and a string encoded value
-  absl::optional<HPackTable::Memento> ParseLiteralKey() {
+  absl::optional<HPackTable::Memento> ParseLiteralKey(bool add_to_table) {
     auto key = String::Parse(input_);
     if (!key.has_value()) return {};
-    auto value = ParseValueString(absl::EndsWith(key->string_view(), "-bin"));
+    const bool is_binary = absl::EndsWith(key->string_view(), "-bin");
+    auto value = ParseValueString(is_binary);
     if (GPR_UNLIKELY(!value.has_value())) {
       return {};
     }
     auto key_string = key->string_view();
-    auto value_slice = value->Take();
+    auto value_slice = TakeValue(&*value, add_to_table && !is_binary);
     const auto transport_size = key_string.size() + value_slice.size() +
                                 hpack_constants::kEntryOverhead;
     return grpc_metadata_batch::Parse(
@@ -1113,25 +1120,37 @@ class HPackParser::Parser {
   }
 
   // Parse an index encoded key and a string encoded value
-  absl::optional<HPackTable::Memento> ParseIdxKey(uint32_t index) {
+  absl::optional<HPackTable::Memento> ParseIdxKey(uint32_t index,
+                                                  bool add_to_table) {
     const auto* elem = table_->Lookup(index);
     if (GPR_UNLIKELY(elem == nullptr)) {
       return InvalidHPackIndexError(index,
                                     absl::optional<HPackTable::Memento>());
     }
-    auto value = ParseValueString(elem->is_binary_header());
+    const bool is_binary = elem->is_binary_header();
+    auto value = ParseValueString(is_binary);
     if (GPR_UNLIKELY(!value.has_value())) return {};
     return elem->WithNewValue(
-        value->Take(), [=](absl::string_view error, const Slice& value) {
+        TakeValue(&*value, add_to_table && !is_binary),
+        [=](absl::string_view error, const Slice& value) {
           ReportMetadataParseError(elem->key(), error, value.as_string_view());
         });
   }
 
   // Parse a varint index encoded key and a string encoded value
-  absl::optional<HPackTable::Memento> ParseVarIdxKey(uint32_t offset) {
+  absl::optional<HPackTable::Memento> ParseVarIdxKey(uint32_t offset,
+                                                     bool add_to_table) {
     auto index = input_->ParseVarint(offset);
     if (GPR_UNLIKELY(!index.has_value())) return {};
-    return ParseIdxKey(*index);
+    return ParseIdxKey(*index, add_to_table);
+  }
+
+  // Take a parsed value. Values that will be added to the dynamic table are
+  // likely to repeat (that is why the peer indexed them), so they are
+  // interned when asked for.
+  static Slice TakeValue(String* value, bool intern) {
+    if (intern && IsInternMetadataValuesEnabled()) return value->TakeInterned();
+    return value->Take();
   }
 
   // Parse a string, figuring out if it's binary or not by the key name.
@@ -68,15 +68,21 @@ class XdsApi {
 
     // Called to parse each individual resource in the ADS response.
     // Note that resource_name is non-empty only when the resource was
-    // wrapped in a Resource wrapper proto.
+    // wrapped in a Resource wrapper proto, and resource_version is
+    // non-empty only in delta responses.
     virtual void ParseResource(upb_Arena* arena, size_t idx,
                                absl::string_view type_url,
                                absl::string_view resource_name,
+                               absl::string_view resource_version,
                                absl::string_view serialized_resource) = 0;
 
     // Called when a resource is wrapped in a Resource wrapper proto but
     // we fail to deserialize the wrapper proto.
     virtual void ResourceWrapperParsingFailed(size_t idx) = 0;
+
+    // Called for each resource name listed as removed in a delta ADS
+    // response.
+    virtual void ResourceRemoved(absl::string_view resource_name) = 0;
   };
 
   struct ClusterLoadReport {
@@ -162,6 +168,19 @@ class XdsApi {
   absl::Status ParseAdsResponse(absl::string_view encoded_response,
                                 AdsResponseParserInterface* parser);
 
+  // Creates a delta ADS request.  initial_resource_versions may be
+  // non-empty only on the first request for a type on a stream.
+  std::string CreateDeltaAdsRequest(
+      absl::string_view type_url, absl::string_view nonce,
+      const std::vector<std::string>& resource_names_subscribe,
+      const std::vector<std::string>& resource_names_unsubscribe,
+      const std::map<std::string, std::string>& initial_resource_versions,
+      absl::Status status, bool populate_node);
+
+  // Same as ParseAdsResponse(), for a delta ADS response.
+  absl::Status ParseDeltaAdsResponse(absl::string_view encoded_response,
+                                     AdsResponseParserInterface* parser);
+
   // Creates an initial LRS request.
   std::string CreateLrsInitialRequest();
 
@@ -47,6 +47,8 @@ class XdsBootstrap {
 
     virtual const std::string& server_uri() const = 0;
     virtual bool IgnoreResourceDeletion() const = 0;
+    // Whether to use the incremental (delta) variant of the ADS protocol.
+    virtual bool UseDeltaXds() const = 0;
 
     virtual bool Equals(const XdsServer& other) const = 0;
 
@@ -81,6 +83,10 @@ class XdsBootstrap {
   // If the server exists in the bootstrap config, returns a pointer to
   // the XdsServer instance in the config.  Otherwise, returns null.
   virtual const XdsServer* FindXdsServer(const XdsServer& server) const = 0;
+
+  // Returns the path of the file in which the XdsClient persists its
+  // resource cache, or the empty string if it should not be persisted.
+  virtual const std::string& resource_snapshot_path() const = 0;
 };
 
 }  // namespace grpc_core
@@ -96,6 +96,7 @@ namespace {
 
 constexpr absl::string_view kServerFeatureIgnoreResourceDeletion =
     "ignore_resource_deletion";
+constexpr absl::string_view kServerFeatureDeltaXds = "delta_xds";
 
 }  // namespace
 
@@ -104,6 +105,11 @@ bool GrpcXdsBootstrap::GrpcXdsServer::IgnoreResourceDeletion() const {
              kServerFeatureIgnoreResourceDeletion)) != server_features_.end();
 }
 
+bool GrpcXdsBootstrap::GrpcXdsServer::UseDeltaXds() const {
+  return server_features_.find(std::string(kServerFeatureDeltaXds)) !=
+         server_features_.end();
+}
+
 bool GrpcXdsBootstrap::GrpcXdsServer::Equals(const XdsServer& other) const {
   const auto& o = static_cast<const GrpcXdsServer&>(other);
   return (server_uri_ == o.server_uri_ &&
@@ -162,7 +168,8 @@ void GrpcXdsBootstrap::GrpcXdsServer::JsonPostLoad(const Json& json,
         for (const Json& feature_json : array) {
           if (feature_json.type() == Json::Type::STRING &&
               (feature_json.string_value() ==
-               kServerFeatureIgnoreResourceDeletion)) {
+                   kServerFeatureIgnoreResourceDeletion ||
+               feature_json.string_value() == kServerFeatureDeltaXds)) {
             server_features_.insert(feature_json.string_value());
           }
         }
@@ -246,6 +253,8 @@ const JsonLoaderInterface* GrpcXdsBootstrap::JsonLoader(const JsonArgs&) {
                          &GrpcXdsBootstrap::
                              client_default_listener_resource_name_template_,
                          "federation")
+          .OptionalField("resource_snapshot_path",
+                         &GrpcXdsBootstrap::resource_snapshot_path_)
           .Finish();
   return loader;
 }
@@ -305,6 +314,10 @@ std::string GrpcXdsBootstrap::ToString() const {
         absl::StrFormat("server_listener_resource_name_template=\"%s\",\n",
                         server_listener_resource_name_template_));
   }
+  if (!resource_snapshot_path_.empty()) {
+    parts.push_back(absl::StrFormat("resource_snapshot_path=\"%s\",\n",
+                                    resource_snapshot_path_));
+  }
   parts.push_back("authorities={\n");
   for (const auto& entry : authorities_) {
     parts.push_back(absl::StrFormat("  %s={\n", entry.first));
@@ -79,6 +79,8 @@ class GrpcXdsBootstrap : public XdsBootstrap {
 
     bool IgnoreResourceDeletion() const override;
 
+    bool UseDeltaXds() const override;
+
     bool Equals(const XdsServer& other) const override;
 
     const std::string& channel_creds_type() const {
@@ -140,6 +142,9 @@ class GrpcXdsBootstrap : public XdsBootstrap {
   }
   const Authority* LookupAuthority(const std::string& name) const override;
   const XdsServer* FindXdsServer(const XdsServer& server) const override;
+  const std::string& resource_snapshot_path() const override {
+    return resource_snapshot_path_;
+  }
 
   const std::string& client_default_listener_resource_name_template() const {
     return client_default_listener_resource_name_template_;
@@ -173,6 +178,7 @@ class GrpcXdsBootstrap : public XdsBootstrap {
   std::string client_default_listener_resource_name_template_;
   std::string server_listener_resource_name_template_;
   std::map<std::string, GrpcAuthority> authorities_;
+  std::string resource_snapshot_path_;
   CertificateProviderStore::PluginDefinitionMap certificate_providers_;
   XdsHttpFilterRegistry http_filter_registry_;
   XdsClusterSpecifierPluginRegistry cluster_specifier_plugin_registry_;
@@ -22,8 +22,10 @@
 #include <string.h>
 
 #include <algorithm>
+#include <iterator>
 #include <type_traits>
 
+#include "absl/hash/hash.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_join.h"
@@ -32,6 +34,7 @@
 #include "absl/strings/strip.h"
 #include "absl/types/optional.h"
 #include "upb/arena.h"
+#include "upb/upb.hpp"
 
 #include <grpc/event_engine/event_engine.h>
 #include <grpc/support/log.h>
@@ -39,6 +42,7 @@
 #include "src/core/ext/xds/xds_api.h"
 #include "src/core/ext/xds/xds_bootstrap.h"
 #include "src/core/ext/xds/xds_client_stats.h"
+#include "src/core/ext/xds/xds_resource_snapshot.h"
 #include "src/core/lib/backoff/backoff.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/orphanable.h"
@@ -52,6 +56,7 @@
 #define GRPC_XDS_RECONNECT_MAX_BACKOFF_SECONDS 120
 #define GRPC_XDS_RECONNECT_JITTER 0.2
 #define GRPC_XDS_MIN_CLIENT_LOAD_REPORTING_INTERVAL_MS 1000
+#define GRPC_XDS_RESOURCE_SNAPSHOT_WRITE_DELAY_MS 1000
 
 namespace grpc_core {
 
@@ -130,6 +135,14 @@ class XdsClient::ChannelState::AdsCallState
  private:
   class AdsResponseParser : public XdsApi::AdsResponseParserInterface {
    public:
+    // A changed resource and the watchers to notify of it.
+    struct ResourceUpdate {
+      std::map<ResourceWatcherInterface*,
+               RefCountedPtr<ResourceWatcherInterface>>
+          watchers;
+      std::shared_ptr<const XdsResourceType::ResourceData> resource;
+    };
+
     struct Result {
       const XdsResourceType* type;
       std::string type_url;
@@ -139,6 +152,9 @@ class XdsClient::ChannelState::AdsCallState
       std::map<std::string /*authority*/, std::set<XdsResourceKey>>
           resources_seen;
       bool have_valid_resources = false;
+      // Watchers are notified of all updates together, once the response
+      // has been processed.
+      std::vector<ResourceUpdate> updates;
     };
 
     explicit AdsResponseParser(AdsCallState* ads_call_state)
@@ -149,16 +165,40 @@ class XdsClient::ChannelState::AdsCallState
 
     void ParseResource(upb_Arena* arena, size_t idx, absl::string_view type_url,
                        absl::string_view resource_name,
+                       absl::string_view resource_version,
                        absl::string_view serialized_resource) override
         ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
     void ResourceWrapperParsingFailed(size_t idx) override;
 
+    void ResourceRemoved(absl::string_view resource_name) override
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
     Result TakeResult() { return std::move(result_); }
 
    private:
     XdsClient* xds_client() const { return ads_call_state_->xds_client(); }
 
+    // Cancels the resource-does-not-exist timer for a resource, if needed.
+    void MarkResourceSeen(const XdsResourceName& name)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
+    // Returns the cached state of a resource, or null if we don't have a
+    // subscription for it.
+    ResourceState* LookupResourceState(const XdsResourceName& name)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
+    // Records that the response contains a resource and returns its
+    // cached state, or null if we don't have a subscription for it.
+    ResourceState* RecordResourceSeen(const XdsResourceName& name)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
+    // Returns the name of the resource if it is identical to the one we
+    // have cached.
+    absl::optional<XdsResourceName> FindUnchangedResource(
+        absl::string_view resource_name, absl::string_view serialized_resource)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
     AdsCallState* ads_call_state_;
     const Timestamp update_time_ = Timestamp::Now();
     Result result_;
@@ -221,10 +261,18 @@ class XdsClient::ChannelState::AdsCallState
       // ADS stream restart).  If so, we don't start the timer, because
       // (a) we already have the resource and (b) the server may
       // optimize by not resending the resource that we already have.
+      // The exception is a resource loaded from the resource snapshot,
+      // which the server must confirm, unless we are using delta xDS, in
+      // which case the server has been told which version we have and
+      // will remove the resource if it no longer exists.
       auto& authority_state =
           ads_calld->xds_client()->authority_state_map_[name_.authority];
       ResourceState& state = authority_state.resource_map[type_][name_.key];
-      if (state.resource != nullptr) return;
+      if (state.resource != nullptr &&
+          (!state.from_snapshot ||
+           ads_calld->chand()->server_.UseDeltaXds())) {
+        return;
+      }
       // Start timer.
       ads_calld_ = std::move(ads_calld);
       timer_handle_ = ads_calld_->xds_client()->engine()->RunAfter(
@@ -255,6 +303,13 @@ class XdsClient::ChannelState::AdsCallState
         auto& authority_state =
             ads_calld_->xds_client()->authority_state_map_[name_.authority];
         ResourceState& state = authority_state.resource_map[type_][name_.key];
+        // Drop the resource if it was loaded from the resource snapshot.
+        if (state.from_snapshot) {
+          ads_calld_->xds_client()->UnindexResourceLocked(
+              type_, name_, state.meta.serialized_proto);
+          state.resource.reset();
+          state.from_snapshot = false;
+        }
         state.meta.client_status = XdsApi::ResourceMetadata::DOES_NOT_EXIST;
         ads_calld_->xds_client()->NotifyWatchersOnResourceDoesNotExist(
             state.watchers);
@@ -305,11 +360,21 @@ class XdsClient::ChannelState::AdsCallState
     std::map<std::string /*authority*/,
              std::map<XdsResourceKey, OrphanablePtr<ResourceTimer>>>
         subscribed_resources;
+
+    // For delta xDS, the resource names the server knows we are
+    // subscribed to, and whether we have sent a request for this type.
+    std::set<std::string> delta_subscribed_names;
+    bool delta_request_sent = false;
   };
 
   void SendMessageLocked(const XdsResourceType* type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
 
+  // Constructs a delta ADS request that subscribes to the resources added
+  // and unsubscribes from those removed since the last request for \a type.
+  std::string CreateDeltaAdsRequestLocked(const XdsResourceType* type)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(&XdsClient::mu_);
+
   void OnRequestSent(bool ok);
   void OnRecvMessage(absl::string_view payload);
   void OnStatusReceived(absl::Status status);
@@ -734,9 +799,104 @@ void UpdateResourceMetadataNacked(const std::string& version,
 
 }  // namespace
 
+void XdsClient::ChannelState::AdsCallState::AdsResponseParser::
+    MarkResourceSeen(const XdsResourceName& name) {
+  auto timer_it = ads_call_state_->state_map_.find(result_.type);
+  if (timer_it != ads_call_state_->state_map_.end()) {
+    auto it = timer_it->second.subscribed_resources.find(name.authority);
+    if (it != timer_it->second.subscribed_resources.end()) {
+      auto res_it = it->second.find(name.key);
+      if (res_it != it->second.end()) {
+        res_it->second->MarkSeen();
+      }
+    }
+  }
+}
+
+XdsClient::ResourceState*
+XdsClient::ChannelState::AdsCallState::AdsResponseParser::LookupResourceState(
+    const XdsResourceName& name) {
+  // Lookup the authority in the cache.
+  auto authority_it = xds_client()->authority_state_map_.find(name.authority);
+  if (authority_it == xds_client()->authority_state_map_.end()) {
+    return nullptr;
+  }
+  // Found authority, so look up type.
+  AuthorityState& authority_state = authority_it->second;
+  auto type_it = authority_state.resource_map.find(result_.type);
+  if (type_it == authority_state.resource_map.end()) return nullptr;
+  auto& type_map = type_it->second;
+  // Found type, so look up resource key.
+  auto it = type_map.find(name.key);
+  if (it == type_map.end()) return nullptr;
+  return &it->second;
+}
+
+XdsClient::ResourceState*
+XdsClient::ChannelState::AdsCallState::AdsResponseParser::RecordResourceSeen(
+    const XdsResourceName& name) {
+  // Cancel resource-does-not-exist timer, if needed.
+  MarkResourceSeen(name);
+  ResourceState* resource_state = LookupResourceState(name);
+  if (resource_state == nullptr) return nullptr;
+  // If needed, record that we've seen this resource.
+  if (result_.type->AllResourcesRequiredInSotW()) {
+    result_.resources_seen[name.authority].insert(name.key);
+  }
+  // If we previously ignored the resource's deletion, log that we're
+  // now re-adding it.
+  if (resource_state->ignored_deletion) {
+    gpr_log(GPR_INFO,
+            "[xds_client %p] xds server %s: server returned new version of "
+            "resource for which we previously ignored a deletion: type %s "
+            "name %s",
+            xds_client(),
+            ads_call_state_->chand()->server_.server_uri().c_str(),
+            result_.type_url.c_str(),
+            ConstructFullXdsResourceName(name.authority, result_.type_url,
+                                         name.key)
+                .c_str());
+    resource_state->ignored_deletion = false;
+  }
+  // The server has confirmed a resource loaded from the resource snapshot.
+  if (resource_state->from_snapshot) {
+    resource_state->from_snapshot = false;
+    resource_state->meta.client_status = XdsApi::ResourceMetadata::ACKED;
+    resource_state->meta.update_time = update_time_;
+  }
+  return resource_state;
+}
+
+absl::optional<XdsClient::XdsResourceName>
+XdsClient::ChannelState::AdsCallState::AdsResponseParser::FindUnchangedResource(
+    absl::string_view resource_name, absl::string_view serialized_resource) {
+  absl::optional<XdsResourceName> name;
+  if (!resource_name.empty()) {
+    auto parsed_resource_name =
+        xds_client()->ParseXdsResourceName(resource_name, result_.type);
+    if (!parsed_resource_name.ok()) return absl::nullopt;
+    name = std::move(*parsed_resource_name);
+  } else {
+    // The name is only inside the resource, so look it up by hash.
+    auto& hash_index = xds_client()->resource_hash_index_;
+    auto type_it = hash_index.find(result_.type);
+    if (type_it == hash_index.end()) return absl::nullopt;
+    auto it = type_it->second.find(absl::HashOf(serialized_resource));
+    if (it == type_it->second.end()) return absl::nullopt;
+    name = it->second;
+  }
+  ResourceState* resource_state = LookupResourceState(*name);
+  if (resource_state == nullptr || resource_state->resource == nullptr ||
+      resource_state->meta.serialized_proto != serialized_resource) {
+    return absl::nullopt;
+  }
+  return name;
+}
+
 void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
     upb_Arena* arena, size_t idx, absl::string_view type_url,
-    absl::string_view resource_name, absl::string_view serialized_resource) {
+    absl::string_view resource_name, absl::string_view resource_version,
+    absl::string_view serialized_resource) {
   std::string error_prefix = absl::StrCat(
       "resource index ", idx, ": ",
       resource_name.empty() ? "" : absl::StrCat(resource_name, ": "));
@@ -747,6 +907,35 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
                      "\" (should be \"", result_.type_url, "\")"));
     return;
   }
+  // Delta responses carry a version per resource.
+  const std::string version = resource_version.empty()
+                                  ? result_.version
+                                  : std::string(resource_version);
+  // If the resource is byte-for-byte identical to the one we have cached,
+  // there is no need to decode and validate it again.
+  absl::optional<XdsResourceName> unchanged_resource_name =
+      FindUnchangedResource(resource_name, serialized_resource);
+  if (unchanged_resource_name.has_value()) {
+    ResourceState* resource_state =
+        RecordResourceSeen(*unchanged_resource_name);
+    result_.have_valid_resources = true;
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+      gpr_log(GPR_INFO,
+              "[xds_client %p] %s resource %s unchanged, skipping decode.",
+              xds_client(), result_.type_url.c_str(),
+              ConstructFullXdsResourceName(unchanged_resource_name->authority,
+                                           result_.type_url,
+                                           unchanged_resource_name->key)
+                  .c_str());
+    }
+    // Delta clients report the version of each resource they have when
+    // resubscribing, so track the one the server just sent. SotW metadata
+    // keeps the version of the response that last changed the resource.
+    if (ads_call_state_->chand()->server_.UseDeltaXds()) {
+      resource_state->meta.version = version;
+    }
+    return;
+  }
   // Parse the resource.
   XdsResourceType::DecodeContext context = {
       xds_client(), ads_call_state_->chand()->server_, &grpc_xds_client_trace,
@@ -782,61 +971,18 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
         absl::StrCat(error_prefix, "Cannot parse xDS resource name"));
     return;
   }
-  // Cancel resource-does-not-exist timer, if needed.
-  auto timer_it = ads_call_state_->state_map_.find(result_.type);
-  if (timer_it != ads_call_state_->state_map_.end()) {
-    auto it = timer_it->second.subscribed_resources.find(
-        parsed_resource_name->authority);
-    if (it != timer_it->second.subscribed_resources.end()) {
-      auto res_it = it->second.find(parsed_resource_name->key);
-      if (res_it != it->second.end()) {
-        res_it->second->MarkSeen();
-      }
-    }
-  }
-  // Lookup the authority in the cache.
-  auto authority_it =
-      xds_client()->authority_state_map_.find(parsed_resource_name->authority);
-  if (authority_it == xds_client()->authority_state_map_.end()) {
-    return;  // Skip resource -- we don't have a subscription for it.
-  }
-  // Found authority, so look up type.
-  AuthorityState& authority_state = authority_it->second;
-  auto type_it = authority_state.resource_map.find(result_.type);
-  if (type_it == authority_state.resource_map.end()) {
-    return;  // Skip resource -- we don't have a subscription for it.
-  }
-  auto& type_map = type_it->second;
-  // Found type, so look up resource key.
-  auto it = type_map.find(parsed_resource_name->key);
-  if (it == type_map.end()) {
+  ResourceState* resource_state_ptr = RecordResourceSeen(*parsed_resource_name);
+  if (resource_state_ptr == nullptr) {
     return;  // Skip resource -- we don't have a subscription for it.
   }
-  ResourceState& resource_state = it->second;
-  // If needed, record that we've seen this resource.
-  if (result_.type->AllResourcesRequiredInSotW()) {
-    result_.resources_seen[parsed_resource_name->authority].insert(
-        parsed_resource_name->key);
-  }
-  // If we previously ignored the resource's deletion, log that we're
-  // now re-adding it.
-  if (resource_state.ignored_deletion) {
-    gpr_log(GPR_INFO,
-            "[xds_client %p] xds server %s: server returned new version of "
-            "resource for which we previously ignored a deletion: type %s "
-            "name %s",
-            xds_client(),
-            ads_call_state_->chand()->server_.server_uri().c_str(),
-            std::string(type_url).c_str(), std::string(resource_name).c_str());
-    resource_state.ignored_deletion = false;
-  }
+  ResourceState& resource_state = *resource_state_ptr;
   // Update resource state based on whether the resource is valid.
   if (!decode_status.ok()) {
     xds_client()->NotifyWatchersOnErrorLocked(
         resource_state.watchers,
         absl::UnavailableError(
             absl::StrCat("invalid resource: ", decode_status.ToString())));
-    UpdateResourceMetadataNacked(result_.version, decode_status.ToString(),
+    UpdateResourceMetadataNacked(version, decode_status.ToString(),
                                  update_time_, &resource_state.meta);
     return;
   }
@@ -852,25 +998,30 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::ParseResource(
               xds_client(), result_.type_url.c_str(),
               std::string(resource_name).c_str());
     }
+    // Keep the new serialized form, so that we can skip decoding it if
+    // the server sends it again.
+    xds_client()->UnindexResourceLocked(result_.type, *parsed_resource_name,
+                                        resource_state.meta.serialized_proto);
+    resource_state.meta.serialized_proto = std::string(serialized_resource);
+    xds_client()->IndexResourceLocked(result_.type, *parsed_resource_name,
+                                      serialized_resource);
+    if (ads_call_state_->chand()->server_.UseDeltaXds()) {
+      resource_state.meta.version = version;
+    }
     return;
   }
   // Update the resource state.
+  xds_client()->UnindexResourceLocked(result_.type, *parsed_resource_name,
+                                      resource_state.meta.serialized_proto);
   resource_state.resource = std::move(*decode_result.resource);
   resource_state.meta = CreateResourceMetadataAcked(
-      std::string(serialized_resource), result_.version, update_time_);
-  // Notify watchers.
-  auto& watchers_list = resource_state.watchers;
-  auto* value =
-      result_.type->CopyResource(resource_state.resource.get()).release();
-  xds_client()->work_serializer_.Schedule(
-      [watchers_list, value]()
-          ABSL_EXCLUSIVE_LOCKS_REQUIRED(&xds_client()->work_serializer_) {
-            for (const auto& p : watchers_list) {
-              p.first->OnGenericResourceChanged(value);
-            }
-            delete value;
-          },
-      DEBUG_LOCATION);
+      std::string(serialized_resource), version, update_time_);
+  xds_client()->IndexResourceLocked(result_.type, *parsed_resource_name,
+                                    serialized_resource);
+  // Queue the watcher notification.
+  result_.updates.push_back(
+      {resource_state.watchers,
+       result_.type->CopyResource(resource_state.resource.get())});
 }
 
 void XdsClient::ChannelState::AdsCallState::AdsResponseParser::
@@ -879,6 +1030,40 @@ void XdsClient::ChannelState::AdsCallState::AdsResponseParser::
       "resource index ", idx, ": Can't decode Resource proto wrapper"));
 }
 
+void XdsClient::ChannelState::AdsCallState::AdsResponseParser::
+    ResourceRemoved(absl::string_view resource_name) {
+  auto parsed_resource_name =
+      xds_client()->ParseXdsResourceName(resource_name, result_.type);
+  if (!parsed_resource_name.ok()) {
+    result_.errors.emplace_back(
+        absl::StrCat("removed resource ", resource_name,
+                     ": Cannot parse xDS resource name"));
+    return;
+  }
+  MarkResourceSeen(*parsed_resource_name);
+  ResourceState* resource_state = LookupResourceState(*parsed_resource_name);
+  if (resource_state == nullptr) return;
+  // Unlike an absence from a SotW response, a removal is always explicit,
+  // so it applies even to resources we have not yet received.
+  if (resource_state->resource != nullptr &&
+      ads_call_state_->chand()->server_.IgnoreResourceDeletion()) {
+    if (!resource_state->ignored_deletion) {
+      gpr_log(GPR_ERROR,
+              "[xds_client %p] xds server %s: ignoring deletion for resource "
+              "type %s name %s",
+              xds_client(),
+              ads_call_state_->chand()->server_.server_uri().c_str(),
+              result_.type_url.c_str(), std::string(resource_name).c_str());
+      resource_state->ignored_deletion = true;
+    }
+    return;
+  }
+  resource_state->resource.reset();
+  resource_state->meta.client_status =
+      XdsApi::ResourceMetadata::DOES_NOT_EXIST;
+  xds_client()->NotifyWatchersOnResourceDoesNotExist(resource_state->watchers);
+}
+
 //
 // XdsClient::ChannelState::AdsCallState
 //
@@ -893,8 +1078,11 @@ XdsClient::ChannelState::AdsCallState::AdsCallState(
   GPR_ASSERT(xds_client() != nullptr);
   // Init the ADS call.
   const char* method =
-      "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
-      "StreamAggregatedResources";
+      chand()->server_.UseDeltaXds()
+          ? "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+            "DeltaAggregatedResources"
+          : "/envoy.service.discovery.v3.AggregatedDiscoveryService/"
+            "StreamAggregatedResources";
   call_ = chand()->transport_->CreateStreamingCall(
       method, std::make_unique<StreamEventHandler>(
                   // Passing the initial ref here.  This ref will go away when
@@ -946,9 +1134,13 @@ void XdsClient::ChannelState::AdsCallState::SendMessageLocked(
     return;
   }
   auto& state = state_map_[type];
-  std::string serialized_message = xds_client()->api_.CreateAdsRequest(
-      type->type_url(), chand()->resource_type_version_map_[type], state.nonce,
-      ResourceNamesForRequest(type), state.status, !sent_initial_message_);
+  std::string serialized_message =
+      chand()->server_.UseDeltaXds()
+          ? CreateDeltaAdsRequestLocked(type)
+          : xds_client()->api_.CreateAdsRequest(
+                type->type_url(), chand()->resource_type_version_map_[type],
+                state.nonce, ResourceNamesForRequest(type), state.status,
+                !sent_initial_message_);
   sent_initial_message_ = true;
   if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
     gpr_log(GPR_INFO,
@@ -964,6 +1156,52 @@ void XdsClient::ChannelState::AdsCallState::SendMessageLocked(
   send_message_pending_ = type;
 }
 
+std::string
+XdsClient::ChannelState::AdsCallState::CreateDeltaAdsRequestLocked(
+    const XdsResourceType* type) {
+  auto& state = state_map_[type];
+  std::vector<std::string> resource_names = ResourceNamesForRequest(type);
+  std::set<std::string> subscribed_names(resource_names.begin(),
+                                         resource_names.end());
+  std::vector<std::string> subscribe;
+  std::set_difference(subscribed_names.begin(), subscribed_names.end(),
+                      state.delta_subscribed_names.begin(),
+                      state.delta_subscribed_names.end(),
+                      std::back_inserter(subscribe));
+  std::vector<std::string> unsubscribe;
+  std::set_difference(state.delta_subscribed_names.begin(),
+                      state.delta_subscribed_names.end(),
+                      subscribed_names.begin(), subscribed_names.end(),
+                      std::back_inserter(unsubscribe));
+  // On the first request for this type on the stream, tell the server
+  // which versions of the resources we already have cached, so that it
+  // does not need to resend them.
+  std::map<std::string, std::string> initial_resource_versions;
+  if (!state.delta_request_sent) {
+    for (const auto& a : state.subscribed_resources) {
+      const std::string& authority = a.first;
+      auto& resource_map =
+          xds_client()->authority_state_map_[authority].resource_map[type];
+      for (const auto& p : a.second) {
+        const XdsResourceKey& resource_key = p.first;
+        auto it = resource_map.find(resource_key);
+        if (it == resource_map.end() || it->second.resource == nullptr ||
+            it->second.meta.version.empty()) {
+          continue;
+        }
+        initial_resource_versions[XdsClient::ConstructFullXdsResourceName(
+            authority, type->type_url(), resource_key)] =
+            it->second.meta.version;
+      }
+    }
+  }
+  state.delta_subscribed_names = std::move(subscribed_names);
+  state.delta_request_sent = true;
+  return xds_client()->api_.CreateDeltaAdsRequest(
+      type->type_url(), state.nonce, subscribe, unsubscribe,
+      initial_resource_versions, state.status, !sent_initial_message_);
+}
+
 void XdsClient::ChannelState::AdsCallState::SubscribeLocked(
     const XdsResourceType* type, const XdsResourceName& name, bool delay_send) {
   auto& state = state_map_[type].subscribed_resources[name.authority][name.key];
@@ -1036,7 +1274,10 @@ void XdsClient::ChannelState::AdsCallState::OnRecvMessage(
     if (!IsCurrentCallOnChannel()) return;
     // Parse and validate the response.
     AdsResponseParser parser(this);
-    absl::Status status = xds_client()->api_.ParseAdsResponse(payload, &parser);
+    absl::Status status =
+        chand()->server_.UseDeltaXds()
+            ? xds_client()->api_.ParseDeltaAdsResponse(payload, &parser)
+            : xds_client()->api_.ParseAdsResponse(payload, &parser);
     if (!status.ok()) {
       // Ignore unparsable response.
       gpr_log(GPR_ERROR,
@@ -1048,6 +1289,20 @@ void XdsClient::ChannelState::AdsCallState::OnRecvMessage(
       seen_response_ = true;
       chand()->status_ = absl::OkStatus();
       AdsResponseParser::Result result = parser.TakeResult();
+      // Notify watchers of all of the changed resources in one callback,
+      // so that they can act on the response as a whole.
+      if (!result.updates.empty()) {
+        xds_client()->work_serializer_.Schedule(
+            [updates = std::move(result.updates)]()
+                ABSL_EXCLUSIVE_LOCKS_REQUIRED(&xds_client()->work_serializer_) {
+                  for (const auto& update : updates) {
+                    for (const auto& p : update.watchers) {
+                      p.first->OnGenericResourceChanged(update.resource.get());
+                    }
+                  }
+                },
+            DEBUG_LOCATION);
+      }
       // Update nonce.
       auto& state = state_map_[result.type];
       state.nonce = result.nonce;
@@ -1064,8 +1319,10 @@ void XdsClient::ChannelState::AdsCallState::OnRecvMessage(
                 result.type_url.c_str(), result.version.c_str(),
                 state.nonce.c_str(), state.status.ToString().c_str());
       }
-      // Delete resources not seen in update if needed.
-      if (result.type->AllResourcesRequiredInSotW()) {
+      // Delete resources not seen in update if needed.  Delta responses
+      // list removed resources explicitly instead.
+      if (result.type->AllResourcesRequiredInSotW() &&
+          !chand()->server_.UseDeltaXds()) {
         for (auto& a : xds_client()->authority_state_map_) {
           const std::string& authority = a.first;
           AuthorityState& authority_state = a.second;
@@ -1088,8 +1345,12 @@ void XdsClient::ChannelState::AdsCallState::OnRecvMessage(
               // earlier request that did not yet request the new resource, so
               // its absence from the response does not necessarily indicate
               // that the resource does not exist.  For that case, we rely on
-              // the request timeout instead.
-              if (resource_state.resource == nullptr) continue;
+              // the request timeout instead.  The same applies to resources
+              // loaded from the resource snapshot.
+              if (resource_state.resource == nullptr ||
+                  resource_state.from_snapshot) {
+                continue;
+              }
               if (chand()->server_.IgnoreResourceDeletion()) {
                 if (!resource_state.ignored_deletion) {
                   gpr_log(GPR_ERROR,
@@ -1126,6 +1387,7 @@ void XdsClient::ChannelState::AdsCallState::OnRecvMessage(
       }
       // Send ACK or NACK.
       SendMessageLocked(result.type);
+      xds_client()->MaybeScheduleSnapshotWriteLocked();
     }
   }
   xds_client()->work_serializer_.DrainQueue();
@@ -1489,6 +1751,31 @@ XdsClient::XdsClient(
     gpr_log(GPR_INFO, "[xds_client %p] xDS node ID: %s", this,
             bootstrap_->node()->id().c_str());
   }
+  const std::string& snapshot_path = bootstrap_->resource_snapshot_path();
+  if (!snapshot_path.empty()) {
+    auto snapshot = XdsResourceSnapshot::Load(snapshot_path);
+    if (snapshot.ok()) {
+      const absl::string_view node_id =
+          bootstrap_->node() != nullptr
+              ? absl::string_view(bootstrap_->node()->id())
+              : "";
+      if ((*snapshot)->node_id() == node_id) {
+        snapshot_ = std::move(*snapshot);
+      } else {
+        gpr_log(GPR_INFO,
+                "[xds_client %p] ignoring xDS resource snapshot written for "
+                "node ID \"%s\"",
+                this, std::string((*snapshot)->node_id()).c_str());
+      }
+    } else if (absl::IsNotFound(snapshot.status())) {
+      gpr_log(GPR_INFO, "[xds_client %p] no xDS resource snapshot: %s", this,
+              snapshot.status().ToString().c_str());
+    } else {
+      gpr_log(GPR_ERROR,
+              "[xds_client %p] error loading xDS resource snapshot: %s", this,
+              snapshot.status().ToString().c_str());
+    }
+  }
 }
 
 XdsClient::~XdsClient() {
@@ -1501,17 +1788,39 @@ void XdsClient::Orphan() {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
     gpr_log(GPR_INFO, "[xds_client %p] shutting down xds client", this);
   }
-  MutexLock lock(&mu_);
-  shutting_down_ = true;
-  // Clear cache and any remaining watchers that may not have been cancelled.
-  authority_state_map_.clear();
-  invalid_watchers_.clear();
-  // We may still be sending lingering queued load report data, so don't
-  // just clear the load reporting map, but we do want to clear the refs
-  // we're holding to the ChannelState objects, to make sure that
-  // everything shuts down properly.
-  for (auto& p : xds_load_report_server_map_) {
-    p.second.channel_state.reset(DEBUG_LOCATION, "XdsClient::Orphan()");
+  absl::optional<XdsResourceSnapshot::Builder> snapshot;
+  {
+    MutexLock lock(&mu_);
+    shutting_down_ = true;
+    // If a snapshot write is pending, do it now, before the cache is
+    // cleared.  If the timer has already fired, its callback will see
+    // that we are shutting down and skip the write.
+    if (snapshot_write_handle_.has_value()) {
+      engine_->Cancel(*snapshot_write_handle_);
+      snapshot_write_handle_.reset();
+      snapshot = BuildResourceSnapshotLocked();
+    }
+    // Clear cache and any remaining watchers that may not have been
+    // cancelled.
+    authority_state_map_.clear();
+    invalid_watchers_.clear();
+    snapshot_.reset();
+    // We may still be sending lingering queued load report data, so don't
+    // just clear the load reporting map, but we do want to clear the refs
+    // we're holding to the ChannelState objects, to make sure that
+    // everything shuts down properly.
+    for (auto& p : xds_load_report_server_map_) {
+      p.second.channel_state.reset(DEBUG_LOCATION, "XdsClient::Orphan()");
+    }
+  }
+  // Write the file off of the caller's thread.
+  if (snapshot.has_value()) {
+    engine_->Run([self = WeakRef(DEBUG_LOCATION, "SnapshotWrite"),
+                  snapshot = std::move(*snapshot)]() mutable {
+      ApplicationCallbackExecCtx callback_exec_ctx;
+      ExecCtx exec_ctx;
+      self->WriteResourceSnapshot(std::move(snapshot));
+    });
   }
 }
 
@@ -1573,6 +1882,10 @@ void XdsClient::WatchResource(const XdsResourceType* type,
         authority_state_map_[resource_name->authority];
     ResourceState& resource_state =
         authority_state.resource_map[type][resource_name->key];
+    if (resource_state.watchers.empty() && resource_state.resource == nullptr) {
+      MaybeLoadResourceFromSnapshotLocked(type, *resource_name, *xds_server,
+                                          &resource_state);
+    }
     resource_state.watchers[w] = watcher;
     // If we already have a cached value for the resource, notify the new
     // watcher immediately.
@@ -1684,6 +1997,8 @@ void XdsClient::CancelResourceWatch(const XdsResourceType* type,
     }
     authority_state.channel_state->UnsubscribeLocked(type, *resource_name,
                                                      delay_unsubscription);
+    UnindexResourceLocked(type, *resource_name,
+                          resource_state.meta.serialized_proto);
     type_map.erase(resource_it);
     if (type_map.empty()) {
       authority_state.resource_map.erase(type_it);
@@ -1694,6 +2009,146 @@ void XdsClient::CancelResourceWatch(const XdsResourceType* type,
   }
 }
 
+void XdsClient::IndexResourceLocked(const XdsResourceType* type,
+                                    const XdsResourceName& name,
+                                    absl::string_view serialized_resource) {
+  resource_hash_index_[type].insert_or_assign(
+      absl::HashOf(serialized_resource), name);
+}
+
+void XdsClient::UnindexResourceLocked(const XdsResourceType* type,
+                                      const XdsResourceName& name,
+                                      absl::string_view serialized_resource) {
+  auto type_it = resource_hash_index_.find(type);
+  if (type_it == resource_hash_index_.end()) return;
+  auto& hash_index = type_it->second;
+  auto it = hash_index.find(absl::HashOf(serialized_resource));
+  // The entry may have been taken over by another resource.
+  if (it == hash_index.end() || it->second.authority != name.authority ||
+      it->second.key.id != name.key.id ||
+      it->second.key.query_params != name.key.query_params) {
+    return;
+  }
+  hash_index.erase(it);
+  if (hash_index.empty()) resource_hash_index_.erase(type_it);
+}
+
+void XdsClient::MaybeLoadResourceFromSnapshotLocked(
+    const XdsResourceType* type, const XdsResourceName& name,
+    const XdsBootstrap::XdsServer& server, ResourceState* resource_state) {
+  if (snapshot_ == nullptr) return;
+  const std::string full_name =
+      ConstructFullXdsResourceName(name.authority, type->type_url(), name.key);
+  auto snapshot_resource = snapshot_->Extract(type->type_url(), full_name);
+  if (!snapshot_resource.has_value()) return;
+  upb::Arena arena;
+  XdsResourceType::DecodeContext context = {
+      this, server, &grpc_xds_client_trace, symtab_.ptr(), arena.ptr()};
+  // Only use resources sent by the server the resource is now requested
+  // from.
+  if (snapshot_resource->server_uri != server.server_uri()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+      gpr_log(GPR_INFO,
+              "[xds_client %p] ignoring %s resource %s from xDS server %s in "
+              "xDS resource snapshot",
+              this, std::string(type->type_url()).c_str(), full_name.c_str(),
+              std::string(snapshot_resource->server_uri).c_str());
+    }
+  } else {
+    XdsResourceType::DecodeResult decode_result =
+        type->Decode(context, snapshot_resource->serialized_resource);
+    if (!decode_result.resource.ok() ||
+        (decode_result.name.has_value() && *decode_result.name != full_name)) {
+      gpr_log(GPR_ERROR,
+              "[xds_client %p] ignoring invalid resource in xDS resource "
+              "snapshot: type %s name %s: %s",
+              this, std::string(type->type_url()).c_str(), full_name.c_str(),
+              decode_result.resource.status().ToString().c_str());
+    } else {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+        gpr_log(GPR_INFO,
+                "[xds_client %p] loaded %s resource %s version %s from xDS "
+                "resource snapshot",
+                this, std::string(type->type_url()).c_str(),
+                full_name.c_str(),
+                std::string(snapshot_resource->version).c_str());
+      }
+      resource_state->resource = std::move(*decode_result.resource);
+      resource_state->meta.serialized_proto =
+          std::string(snapshot_resource->serialized_resource);
+      resource_state->meta.version = std::string(snapshot_resource->version);
+      resource_state->from_snapshot = true;
+      IndexResourceLocked(type, name, resource_state->meta.serialized_proto);
+    }
+  }
+  // Release the mapping once there is nothing left to extract.
+  if (snapshot_->empty()) snapshot_.reset();
+}
+
+void XdsClient::MaybeScheduleSnapshotWriteLocked() {
+  if (bootstrap_->resource_snapshot_path().empty() || shutting_down_ ||
+      snapshot_write_handle_.has_value()) {
+    return;
+  }
+  snapshot_write_handle_ = engine_->RunAfter(
+      Duration::Milliseconds(GRPC_XDS_RESOURCE_SNAPSHOT_WRITE_DELAY_MS),
+      [self = WeakRef(DEBUG_LOCATION, "SnapshotWriteTimer")]() {
+        ApplicationCallbackExecCtx callback_exec_ctx;
+        ExecCtx exec_ctx;
+        self->OnSnapshotWriteTimer();
+      });
+}
+
+void XdsClient::OnSnapshotWriteTimer() {
+  absl::optional<XdsResourceSnapshot::Builder> snapshot;
+  {
+    MutexLock lock(&mu_);
+    // Orphan() writes the snapshot itself.
+    if (shutting_down_) return;
+    snapshot_write_handle_.reset();
+    snapshot = BuildResourceSnapshotLocked();
+  }
+  WriteResourceSnapshot(std::move(*snapshot));
+}
+
+XdsResourceSnapshot::Builder XdsClient::BuildResourceSnapshotLocked() {
+  XdsResourceSnapshot::Builder snapshot(
+      bootstrap_->node() != nullptr ? bootstrap_->node()->id() : "");
+  for (const auto& a : authority_state_map_) {
+    const std::string& authority = a.first;
+    // Resources are recorded along with the server that sent them.
+    if (a.second.channel_state == nullptr) continue;
+    const std::string& server_uri =
+        a.second.channel_state->server().server_uri();
+    for (const auto& t : a.second.resource_map) {
+      const XdsResourceType* type = t.first;
+      for (const auto& r : t.second) {
+        const ResourceState& resource_state = r.second;
+        if (resource_state.resource == nullptr) continue;
+        snapshot.Add(type->type_url(),
+                     ConstructFullXdsResourceName(authority, type->type_url(),
+                                                  r.first),
+                     server_uri, resource_state.meta.version,
+                     resource_state.meta.serialized_proto);
+      }
+    }
+  }
+  return snapshot;
+}
+
+void XdsClient::WriteResourceSnapshot(XdsResourceSnapshot::Builder snapshot) {
+  absl::Status status =
+      snapshot.WriteToFile(bootstrap_->resource_snapshot_path());
+  if (!status.ok()) {
+    gpr_log(GPR_ERROR,
+            "[xds_client %p] error writing xDS resource snapshot: %s", this,
+            status.ToString().c_str());
+  } else if (GRPC_TRACE_FLAG_ENABLED(grpc_xds_client_trace)) {
+    gpr_log(GPR_INFO, "[xds_client %p] wrote xDS resource snapshot to %s",
+            this, bootstrap_->resource_snapshot_path().c_str());
+  }
+}
+
 void XdsClient::MaybeRegisterResourceTypeLocked(
     const XdsResourceType* resource_type) {
   auto it = resource_types_.find(resource_type->type_url());
@@ -19,6 +19,8 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
 #include <map>
 #include <memory>
 #include <set>
@@ -27,9 +29,11 @@
 #include <vector>
 
 #include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
 #include "upb/def.hpp"
 
 #include <grpc/event_engine/event_engine.h>
@@ -37,6 +41,7 @@
 #include "src/core/ext/xds/xds_api.h"
 #include "src/core/ext/xds/xds_bootstrap.h"
 #include "src/core/ext/xds/xds_client_stats.h"
+#include "src/core/ext/xds/xds_resource_snapshot.h"
 #include "src/core/ext/xds/xds_resource_type.h"
 #include "src/core/ext/xds/xds_transport.h"
 #include "src/core/lib/debug/trace.h"
@@ -186,6 +191,7 @@ class XdsClient : public DualRefCounted<XdsClient> {
     void Orphan() override;
 
     XdsClient* xds_client() const { return xds_client_.get(); }
+    const XdsBootstrap::XdsServer& server() const { return server_; }
     AdsCallState* ads_calld() const;
     LrsCallState* lrs_calld() const;
 
@@ -241,6 +247,9 @@ class XdsClient : public DualRefCounted<XdsClient> {
     std::unique_ptr<XdsResourceType::ResourceData> resource;
     XdsApi::ResourceMetadata meta;
     bool ignored_deletion = false;
+    // True if the resource was loaded from the resource snapshot and the
+    // xds server has not yet sent it.
+    bool from_snapshot = false;
   };
 
   struct AuthorityState {
@@ -290,6 +299,31 @@ class XdsClient : public DualRefCounted<XdsClient> {
   const XdsResourceType* GetResourceTypeLocked(absl::string_view resource_type)
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
 
+  // Adds a cached resource to, or removes it from, resource_hash_index_.
+  void IndexResourceLocked(const XdsResourceType* type,
+                           const XdsResourceName& name,
+                           absl::string_view serialized_resource)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void UnindexResourceLocked(const XdsResourceType* type,
+                             const XdsResourceName& name,
+                             absl::string_view serialized_resource)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Populates a newly watched resource from the resource snapshot, if it
+  // is there.
+  void MaybeLoadResourceFromSnapshotLocked(
+      const XdsResourceType* type, const XdsResourceName& name,
+      const XdsBootstrap::XdsServer& server, ResourceState* resource_state)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+
+  // Writes the resource cache to the snapshot file, after a delay that
+  // allows writes for consecutive responses to be coalesced.
+  void MaybeScheduleSnapshotWriteLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void OnSnapshotWriteTimer();
+  XdsResourceSnapshot::Builder BuildResourceSnapshotLocked()
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  void WriteResourceSnapshot(XdsResourceSnapshot::Builder builder);
+
   absl::StatusOr<XdsResourceName> ParseXdsResourceName(
       absl::string_view name, const XdsResourceType* type);
   static std::string ConstructFullXdsResourceName(
@@ -327,6 +361,15 @@ class XdsClient : public DualRefCounted<XdsClient> {
   std::map<std::string /*authority*/, AuthorityState> authority_state_map_
       ABSL_GUARDED_BY(mu_);
 
+  // Maps the hash of each cached resource's serialized form to its name,
+  // so that a resource the server resends unchanged can be recognized
+  // without decoding it, even when the response does not carry the name
+  // outside of the resource.  Hits are checked against the cached
+  // serialized form, so stale entries are harmless.
+  std::map<const XdsResourceType*,
+           absl::flat_hash_map<size_t /*hash*/, XdsResourceName>>
+      resource_hash_index_ ABSL_GUARDED_BY(mu_);
+
   // Key is owned by the bootstrap config.
   std::map<const XdsBootstrap::XdsServer*, LoadReportServer>
       xds_load_report_server_map_ ABSL_GUARDED_BY(mu_);
@@ -336,6 +379,13 @@ class XdsClient : public DualRefCounted<XdsClient> {
   std::map<ResourceWatcherInterface*, RefCountedPtr<ResourceWatcherInterface>>
       invalid_watchers_ ABSL_GUARDED_BY(mu_);
 
+  // Resources persisted by a previous XdsClient, possibly in another
+  // process.  Each one is removed when it is first watched, and the
+  // snapshot is released once it is empty.
+  std::unique_ptr<XdsResourceSnapshot> snapshot_ ABSL_GUARDED_BY(mu_);
+  absl::optional<grpc_event_engine::experimental::EventEngine::TaskHandle>
+      snapshot_write_handle_ ABSL_GUARDED_BY(mu_);
+
   bool shutting_down_ ABSL_GUARDED_BY(mu_) = false;
 };
 
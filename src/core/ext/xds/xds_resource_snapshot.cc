@@ -0,0 +1,272 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/ext/xds/xds_resource_snapshot.h"
+
+#include <string.h>
+
+#include "absl/strings/str_cat.h"
+
+#ifndef GPR_WINDOWS
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "src/core/lib/gprpp/strerror.h"
+
+namespace grpc_core {
+
+namespace {
+
+constexpr char kMagic[] = "GRPCXDSS";
+constexpr size_t kMagicSize = sizeof(kMagic) - 1;
+constexpr uint32_t kFormatVersion = 2;
+// Size of the header without the node ID.
+constexpr size_t kHeaderSize = kMagicSize + 3 * sizeof(uint32_t);
+constexpr size_t kRecordFields = 5;
+constexpr size_t kRecordHeaderSize = kRecordFields * sizeof(uint32_t);
+
+void AppendUint32(uint32_t value, std::string* data) {
+  for (int i = 0; i < 4; ++i) {
+    data->push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+uint32_t ReadUint32(const char* data) {
+  const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+  return static_cast<uint32_t>(bytes[0]) |
+         static_cast<uint32_t>(bytes[1]) << 8 |
+         static_cast<uint32_t>(bytes[2]) << 16 |
+         static_cast<uint32_t>(bytes[3]) << 24;
+}
+
+void SetUint32(size_t offset, uint32_t value, std::string* data) {
+  std::string encoded;
+  AppendUint32(value, &encoded);
+  data->replace(offset, encoded.size(), encoded);
+}
+
+size_t Padding(size_t size) { return (4 - size % 4) % 4; }
+
+}  // namespace
+
+//
+// XdsResourceSnapshot::Builder
+//
+
+XdsResourceSnapshot::Builder::Builder(absl::string_view node_id) {
+  data_.append(kMagic, kMagicSize);
+  AppendUint32(kFormatVersion, &data_);
+  AppendUint32(0, &data_);  // Number of records, set when writing.
+  AppendUint32(static_cast<uint32_t>(node_id.size()), &data_);
+  data_.append(node_id.data(), node_id.size());
+  data_.append(Padding(node_id.size()), '\0');
+}
+
+void XdsResourceSnapshot::Builder::Add(absl::string_view type_url,
+                                       absl::string_view name,
+                                       absl::string_view server_uri,
+                                       absl::string_view version,
+                                       absl::string_view serialized_resource) {
+  size_t record_size = 0;
+  for (absl::string_view field :
+       {type_url, name, server_uri, version, serialized_resource}) {
+    AppendUint32(static_cast<uint32_t>(field.size()), &data_);
+    record_size += field.size();
+  }
+  for (absl::string_view field :
+       {type_url, name, server_uri, version, serialized_resource}) {
+    data_.append(field.data(), field.size());
+  }
+  data_.append(Padding(record_size), '\0');
+  ++num_resources_;
+}
+
+absl::Status XdsResourceSnapshot::Builder::WriteToFile(
+    const std::string& path) {
+#ifdef GPR_WINDOWS
+  (void)path;
+  return absl::UnimplementedError(
+      "xDS resource snapshots are not supported on this platform");
+#else
+  SetUint32(kMagicSize + sizeof(uint32_t), num_resources_, &data_);
+  // Write a uniquely named temporary file and rename it, so that processes
+  // that have mapped the previous snapshot are not affected, and so that
+  // concurrent writers never share a temporary file.
+  std::string tmp_path = absl::StrCat(path, ".XXXXXX");
+  int fd = mkstemp(&tmp_path[0]);
+  if (fd < 0) {
+    return absl::UnavailableError(
+        absl::StrCat("cannot create ", tmp_path, ": ", StrError(errno)));
+  }
+  auto fail = [&](absl::string_view operation) {
+    absl::Status status = absl::UnavailableError(absl::StrCat(
+        "cannot ", operation, " ", tmp_path, ": ", StrError(errno)));
+    close(fd);
+    unlink(tmp_path.c_str());
+    return status;
+  };
+  // mkstemp() creates files that only the owner can read.
+  if (fcntl(fd, F_SETFD, FD_CLOEXEC) != 0 || fchmod(fd, 0644) != 0) {
+    return fail("set up");
+  }
+  absl::string_view remaining = data_;
+  while (!remaining.empty()) {
+    ssize_t written = write(fd, remaining.data(), remaining.size());
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      return fail("write");
+    }
+    remaining.remove_prefix(written);
+  }
+  // Make sure the contents are on disk before the rename makes them
+  // visible, so that a crash never leaves a truncated snapshot behind.
+  if (fsync(fd) != 0) return fail("sync");
+  if (close(fd) != 0 || rename(tmp_path.c_str(), path.c_str()) != 0) {
+    absl::Status status = absl::UnavailableError(
+        absl::StrCat("cannot write ", path, ": ", StrError(errno)));
+    unlink(tmp_path.c_str());
+    return status;
+  }
+  return absl::OkStatus();
+#endif
+}
+
+//
+// XdsResourceSnapshot
+//
+
+absl::StatusOr<std::unique_ptr<XdsResourceSnapshot>> XdsResourceSnapshot::Load(
+    const std::string& path) {
+#ifdef GPR_WINDOWS
+  (void)path;
+  return absl::UnimplementedError(
+      "xDS resource snapshots are not supported on this platform");
+#else
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    std::string message =
+        absl::StrCat("cannot open ", path, ": ", StrError(errno));
+    if (errno == ENOENT) return absl::NotFoundError(message);
+    return absl::UnavailableError(message);
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    absl::Status status = absl::UnavailableError(
+        absl::StrCat("cannot stat ", path, ": ", StrError(errno)));
+    close(fd);
+    return status;
+  }
+  // mmap() of an empty file fails with an unhelpful EINVAL.
+  if (st.st_size == 0) {
+    close(fd);
+    return absl::InvalidArgumentError(absl::StrCat(path, ": file is empty"));
+  }
+  if (static_cast<size_t>(st.st_size) < kHeaderSize) {
+    close(fd);
+    return absl::InvalidArgumentError(
+        absl::StrCat(path, ": not an xDS resource snapshot"));
+  }
+  void* mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping remains valid after the file is closed.
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return absl::UnavailableError(
+        absl::StrCat("cannot map ", path, ": ", StrError(errno)));
+  }
+  std::unique_ptr<XdsResourceSnapshot> snapshot(
+      new XdsResourceSnapshot(mapping, st.st_size));
+  absl::Status status = snapshot->Parse();
+  if (!status.ok()) {
+    return absl::InvalidArgumentError(
+        absl::StrCat(path, ": ", status.message()));
+  }
+  return snapshot;
+#endif
+}
+
+XdsResourceSnapshot::~XdsResourceSnapshot() {
+#ifndef GPR_WINDOWS
+  munmap(mapping_, size_);
+#endif
+}
+
+absl::Status XdsResourceSnapshot::Parse() {
+  absl::string_view data(static_cast<const char*>(mapping_), size_);
+  if (data.substr(0, kMagicSize) != absl::string_view(kMagic, kMagicSize)) {
+    return absl::InvalidArgumentError("not an xDS resource snapshot");
+  }
+  const uint32_t format_version = ReadUint32(data.data() + kMagicSize);
+  if (format_version != kFormatVersion) {
+    return absl::InvalidArgumentError(
+        absl::StrCat("unsupported snapshot format version ", format_version));
+  }
+  const uint32_t num_resources =
+      ReadUint32(data.data() + kMagicSize + sizeof(uint32_t));
+  const uint64_t node_id_size =
+      ReadUint32(data.data() + kMagicSize + 2 * sizeof(uint32_t));
+  data.remove_prefix(kHeaderSize);
+  if (data.size() < node_id_size + Padding(node_id_size)) {
+    return absl::InvalidArgumentError("header: truncated");
+  }
+  node_id_ = data.substr(0, node_id_size);
+  data.remove_prefix(node_id_size + Padding(node_id_size));
+  for (uint32_t i = 0; i < num_resources; ++i) {
+    if (data.size() < kRecordHeaderSize) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("record ", i, ": truncated"));
+    }
+    absl::string_view fields[kRecordFields];
+    uint64_t record_size = 0;
+    for (size_t j = 0; j < kRecordFields; ++j) {
+      record_size += ReadUint32(data.data() + j * sizeof(uint32_t));
+    }
+    if (data.size() - kRecordHeaderSize < record_size + Padding(record_size)) {
+      return absl::InvalidArgumentError(
+          absl::StrCat("record ", i, ": truncated"));
+    }
+    size_t offset = kRecordHeaderSize;
+    for (size_t j = 0; j < kRecordFields; ++j) {
+      const size_t size = ReadUint32(data.data() + j * sizeof(uint32_t));
+      fields[j] = data.substr(offset, size);
+      offset += size;
+    }
+    resources_[std::make_pair(fields[0], fields[1])] = {fields[2], fields[3],
+                                                        fields[4]};
+    data.remove_prefix(offset + Padding(record_size));
+  }
+  if (!data.empty()) {
+    return absl::InvalidArgumentError("trailing data after last record");
+  }
+  return absl::OkStatus();
+}
+
+absl::optional<XdsResourceSnapshot::Resource> XdsResourceSnapshot::Extract(
+    absl::string_view type_url, absl::string_view name) {
+  auto it = resources_.find(std::make_pair(type_url, name));
+  if (it == resources_.end()) return absl::nullopt;
+  Resource resource = it->second;
+  resources_.erase(it);
+  return resource;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,120 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_EXT_XDS_XDS_RESOURCE_SNAPSHOT_H
+#define GRPC_SRC_CORE_EXT_XDS_XDS_RESOURCE_SNAPSHOT_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/optional.h"
+
+namespace grpc_core {
+
+// A snapshot of the xDS resources cached by an XdsClient, persisted in a
+// file so that processes can start serving from it before the xDS server
+// has sent them the resources.
+//
+// The file holds a header followed by one record per resource, with all
+// integers stored as little-endian uint32 and the header and every record
+// padded to a multiple of 4 bytes:
+//
+//   header: magic "GRPCXDSS", format version, number of records, size of
+//           the node ID, followed by the node ID
+//   record: sizes of the type URL, name, server URI, version and serialized
+//           resource, followed by those five strings
+//
+// The node ID and server URIs record which control plane sent the
+// resources, so that a client configured differently does not use them.
+//
+// Snapshots are memory-mapped read-only, so that the serialized resources
+// are decoded straight from the page cache, which is shared by all of the
+// processes that load the same file.  Files are replaced atomically, so a
+// snapshot that is being read is never modified.
+class XdsResourceSnapshot {
+ public:
+  struct Resource {
+    // The URI of the xDS server the resource was received from.
+    absl::string_view server_uri;
+    absl::string_view version;
+    absl::string_view serialized_resource;
+  };
+
+  // Serializes a snapshot.
+  class Builder {
+   public:
+    // \a node_id is the node ID the client presented to the xDS servers.
+    explicit Builder(absl::string_view node_id);
+
+    void Add(absl::string_view type_url, absl::string_view name,
+             absl::string_view server_uri, absl::string_view version,
+             absl::string_view serialized_resource);
+
+    // Atomically replaces the file at \a path with the snapshot.
+    absl::Status WriteToFile(const std::string& path);
+
+   private:
+    std::string data_;
+    uint32_t num_resources_ = 0;
+  };
+
+  // Maps the snapshot file at \a path.  Returns NotFound if there is no
+  // such file.
+  static absl::StatusOr<std::unique_ptr<XdsResourceSnapshot>> Load(
+      const std::string& path);
+
+  ~XdsResourceSnapshot();
+
+  XdsResourceSnapshot(const XdsResourceSnapshot&) = delete;
+  XdsResourceSnapshot& operator=(const XdsResourceSnapshot&) = delete;
+
+  // Removes a resource from the snapshot and returns it.  The returned
+  // strings remain valid for the lifetime of the snapshot.
+  absl::optional<Resource> Extract(absl::string_view type_url,
+                                   absl::string_view name);
+
+  bool empty() const { return resources_.empty(); }
+
+  absl::string_view node_id() const { return node_id_; }
+
+ private:
+  XdsResourceSnapshot(void* mapping, size_t size)
+      : mapping_(mapping), size_(size) {}
+
+  absl::Status Parse();
+
+  void* mapping_;
+  size_t size_;
+  absl::string_view node_id_;
+  absl::flat_hash_map<std::pair<absl::string_view /*type_url*/,
+                                absl::string_view /*name*/>,
+                      Resource>
+      resources_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_EXT_XDS_XDS_RESOURCE_SNAPSHOT_H
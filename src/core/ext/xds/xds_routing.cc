@@ -29,8 +29,11 @@
 
 #include "absl/status/status.h"
 #include "absl/status/statusor.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
+#include "re2/re2.h"
+#include "re2/stringpiece.h"
 
 #include <grpc/support/log.h>
 
@@ -137,6 +140,88 @@ absl::optional<size_t> XdsRouting::FindVirtualHostForDomain(
   return target_index;
 }
 
+//
+// XdsRouting::VirtualHostIndex
+//
+
+void XdsRouting::VirtualHostIndex::Trie::Add(absl::string_view key,
+                                             size_t vhost_index) {
+  uint32_t node = 0;
+  for (char c : key) {
+    auto it = nodes_[node].children.find(c);
+    if (it == nodes_[node].children.end()) {
+      nodes_.emplace_back();
+      it = nodes_[node].children.emplace(c, nodes_.size() - 1).first;
+    }
+    node = it->second;
+  }
+  // The first virtual host with the pattern wins.
+  if (!nodes_[node].vhost_index.has_value()) {
+    nodes_[node].vhost_index = vhost_index;
+  }
+}
+
+absl::optional<size_t> XdsRouting::VirtualHostIndex::Trie::FindLongestMatch(
+    absl::string_view domain, bool reverse) const {
+  absl::optional<size_t> vhost_index;
+  uint32_t node = 0;
+  // Asterisk must match at least one char.
+  for (size_t i = 0; i < domain.size(); ++i) {
+    if (nodes_[node].vhost_index.has_value()) {
+      vhost_index = nodes_[node].vhost_index;
+    }
+    char c = reverse ? domain[domain.size() - 1 - i] : domain[i];
+    auto it = nodes_[node].children.find(c);
+    if (it == nodes_[node].children.end()) break;
+    node = it->second;
+  }
+  return vhost_index;
+}
+
+XdsRouting::VirtualHostIndex::VirtualHostIndex(
+    const VirtualHostListIterator& vhost_iterator) {
+  for (size_t i = 0; i < vhost_iterator.Size(); ++i) {
+    for (const std::string& domain_pattern :
+         vhost_iterator.GetDomainsForVirtualHost(i)) {
+      const MatchType match_type = DomainPatternMatchType(domain_pattern);
+      // This should be caught by RouteConfigParse().
+      GPR_ASSERT(match_type != INVALID_MATCH);
+      // Domain matching is case-insensitive.
+      std::string pattern = absl::AsciiStrToLower(domain_pattern);
+      switch (match_type) {
+        case EXACT_MATCH:
+          exact_domains_.emplace(std::move(pattern), i);
+          break;
+        case SUFFIX_MATCH:
+          std::reverse(pattern.begin(), pattern.end());
+          pattern.pop_back();
+          suffix_domains_.Add(pattern, i);
+          break;
+        case PREFIX_MATCH:
+          pattern.pop_back();
+          prefix_domains_.Add(pattern, i);
+          break;
+        default:
+          if (!universe_domain_.has_value()) universe_domain_ = i;
+      }
+    }
+  }
+}
+
+absl::optional<size_t> XdsRouting::VirtualHostIndex::Find(
+    absl::string_view domain) const {
+  // Same search order as FindVirtualHostForDomain().
+  std::string host = absl::AsciiStrToLower(domain);
+  auto it = exact_domains_.find(host);
+  if (it != exact_domains_.end()) return it->second;
+  absl::optional<size_t> vhost_index =
+      suffix_domains_.FindLongestMatch(host, /*reverse=*/true);
+  if (vhost_index.has_value()) return vhost_index;
+  vhost_index = prefix_domains_.FindLongestMatch(host, /*reverse=*/false);
+  if (vhost_index.has_value()) return vhost_index;
+  return universe_domain_;
+}
+
 namespace {
 
 bool HeadersMatch(const std::vector<HeaderMatcher>& header_matchers,
@@ -175,6 +260,137 @@ absl::optional<size_t> XdsRouting::GetRouteForRequest(
   return absl::nullopt;
 }
 
+//
+// XdsRouting::RouteIndex
+//
+
+void XdsRouting::RouteIndex::Trie::Add(absl::string_view key, bool prefix,
+                                       size_t route_index) {
+  uint32_t node = 0;
+  for (char c : key) {
+    auto it = nodes_[node].children.find(c);
+    if (it == nodes_[node].children.end()) {
+      nodes_.emplace_back();
+      it = nodes_[node].children.emplace(c, nodes_.size() - 1).first;
+    }
+    node = it->second;
+  }
+  (prefix ? nodes_[node].prefix_routes : nodes_[node].exact_routes)
+      .push_back(route_index);
+}
+
+void XdsRouting::RouteIndex::Trie::Match(
+    absl::string_view path, bool ignore_case,
+    absl::InlinedVector<size_t, 8>* routes) const {
+  uint32_t node = 0;
+  for (size_t i = 0;; ++i) {
+    const Node& n = nodes_[node];
+    routes->insert(routes->end(), n.prefix_routes.begin(),
+                   n.prefix_routes.end());
+    if (i == path.size()) {
+      routes->insert(routes->end(), n.exact_routes.begin(),
+                     n.exact_routes.end());
+      return;
+    }
+    char c = ignore_case ? absl::ascii_tolower(path[i]) : path[i];
+    auto it = n.children.find(c);
+    if (it == n.children.end()) return;
+    node = it->second;
+  }
+}
+
+XdsRouting::RouteIndex::RouteIndex(
+    const RouteListIterator& route_list_iterator) {
+  if (route_list_iterator.Size() < kMinRoutesToIndex) return;
+  indexed_ = true;
+  auto regexes =
+      std::make_unique<RE2::Set>(RE2::DefaultOptions, RE2::ANCHOR_BOTH);
+  for (size_t i = 0; i < route_list_iterator.Size(); ++i) {
+    const StringMatcher& path_matcher =
+        route_list_iterator.GetMatchersForRoute(i).path_matcher;
+    switch (path_matcher.type()) {
+      case StringMatcher::Type::kExact:
+      case StringMatcher::Type::kPrefix: {
+        const bool prefix = path_matcher.type() == StringMatcher::Type::kPrefix;
+        if (path_matcher.case_sensitive()) {
+          case_sensitive_paths_.Add(path_matcher.string_matcher(), prefix, i);
+        } else {
+          case_insensitive_paths_.Add(
+              absl::AsciiStrToLower(path_matcher.string_matcher()), prefix, i);
+        }
+        break;
+      }
+      case StringMatcher::Type::kSafeRegex:
+        if (regexes->Add(path_matcher.regex_matcher()->pattern(), nullptr) >=
+            0) {
+          regex_routes_.push_back(i);
+        } else {
+          other_routes_.push_back(i);
+        }
+        break;
+      default:
+        other_routes_.push_back(i);
+    }
+  }
+  if (regex_routes_.empty()) return;
+  if (regexes->Compile()) {
+    regexes_ = std::move(regexes);
+  } else {
+    // Fall back to matching the regexes one by one.
+    other_routes_.insert(other_routes_.end(), regex_routes_.begin(),
+                         regex_routes_.end());
+    regex_routes_.clear();
+  }
+}
+
+absl::optional<size_t> XdsRouting::RouteIndex::GetRouteForRequest(
+    const RouteListIterator& route_list_iterator, absl::string_view path,
+    grpc_metadata_batch* initial_metadata) const {
+  if (!indexed_) {
+    return XdsRouting::GetRouteForRequest(route_list_iterator, path,
+                                          initial_metadata);
+  }
+  // Routes whose path matches, in no particular order.
+  absl::InlinedVector<size_t, 8> routes;
+  case_sensitive_paths_.Match(path, /*ignore_case=*/false, &routes);
+  case_insensitive_paths_.Match(path, /*ignore_case=*/true, &routes);
+  if (regexes_ != nullptr) {
+    std::vector<int> matches;
+    RE2::Set::ErrorInfo error_info;
+    if (regexes_->Match(re2::StringPiece(path.data(), path.size()), &matches,
+                        &error_info)) {
+      for (int i : matches) routes.push_back(regex_routes_[i]);
+    } else if (error_info.kind != RE2::Set::kNoError) {
+      // Out of memory for the DFA: match the regexes one by one.
+      for (size_t i : regex_routes_) {
+        if (route_list_iterator.GetMatchersForRoute(i).path_matcher.Match(
+                path)) {
+          routes.push_back(i);
+        }
+      }
+    }
+  }
+  for (size_t i : other_routes_) {
+    if (route_list_iterator.GetMatchersForRoute(i).path_matcher.Match(path)) {
+      routes.push_back(i);
+    }
+  }
+  // The first route that matches wins: check the rest of the matchers in
+  // route order, so that runtime fractions are rolled for the same routes
+  // as when scanning the list.
+  std::sort(routes.begin(), routes.end());
+  for (size_t i : routes) {
+    const XdsRouteConfigResource::Route::Matchers& matchers =
+        route_list_iterator.GetMatchersForRoute(i);
+    if (HeadersMatch(matchers.header_matchers, initial_metadata) &&
+        (!matchers.fraction_per_million.has_value() ||
+         UnderFraction(*matchers.fraction_per_million))) {
+      return i;
+    }
+  }
+  return absl::nullopt;
+}
+
 bool XdsRouting::IsValidDomainPattern(absl::string_view domain_pattern) {
   return DomainPatternMatchType(domain_pattern) != INVALID_MATCH;
 }
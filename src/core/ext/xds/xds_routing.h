@@ -22,14 +22,19 @@
 #include <grpc/support/port_platform.h>
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/inlined_vector.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
+#include "re2/set.h"
 
 #include "src/core/ext/xds/xds_http_filters.h"
 #include "src/core/ext/xds/xds_listener.h"
@@ -71,6 +76,91 @@ class XdsRouting {
       const RouteListIterator& route_list_iterator, absl::string_view path,
       grpc_metadata_batch* initial_metadata);
 
+  // An index of the domain patterns of a virtual host list, built once per
+  // route config. Find() returns the same virtual host as
+  // FindVirtualHostForDomain() without scanning the list: exact domains are
+  // hashed, and wildcard domains are looked up in a trie.
+  class VirtualHostIndex {
+   public:
+    VirtualHostIndex() = default;
+    explicit VirtualHostIndex(const VirtualHostListIterator& vhost_iterator);
+
+    absl::optional<size_t> Find(absl::string_view domain) const;
+
+   private:
+    // Domain patterns with a leading or trailing '*', keyed by the other
+    // characters in the order they are compared against the domain.
+    class Trie {
+     public:
+      void Add(absl::string_view key, size_t vhost_index);
+      // Returns the virtual host of the longest key that matches the start
+      // of \a domain (or its end, if \a reverse), leaving at least one
+      // character for the '*'.
+      absl::optional<size_t> FindLongestMatch(absl::string_view domain,
+                                              bool reverse) const;
+
+     private:
+      struct Node {
+        absl::flat_hash_map<char, uint32_t> children;
+        absl::optional<size_t> vhost_index;
+      };
+      std::vector<Node> nodes_{1};
+    };
+
+    absl::flat_hash_map<std::string, size_t> exact_domains_;
+    Trie suffix_domains_;
+    Trie prefix_domains_;
+    absl::optional<size_t> universe_domain_;
+  };
+
+  // An index of the path matchers of a route list, built once per route
+  // config. GetRouteForRequest() returns the same route as the static
+  // GetRouteForRequest(), but only checks the header matchers and runtime
+  // fraction of the routes whose path matches: exact and prefix path
+  // matchers are looked up in a trie, and regexes are matched with one
+  // RE2::Set. Short lists are still scanned.
+  class RouteIndex {
+   public:
+    RouteIndex() = default;
+    explicit RouteIndex(const RouteListIterator& route_list_iterator);
+
+    // \a route_list_iterator must iterate over the routes the index was
+    // built from.
+    absl::optional<size_t> GetRouteForRequest(
+        const RouteListIterator& route_list_iterator, absl::string_view path,
+        grpc_metadata_batch* initial_metadata) const;
+
+   private:
+    class Trie {
+     public:
+      void Add(absl::string_view key, bool prefix, size_t route_index);
+      // Appends the routes that match \a path to \a routes.
+      void Match(absl::string_view path, bool ignore_case,
+                 absl::InlinedVector<size_t, 8>* routes) const;
+
+     private:
+      struct Node {
+        absl::flat_hash_map<char, uint32_t> children;
+        std::vector<size_t> prefix_routes;
+        std::vector<size_t> exact_routes;
+      };
+      std::vector<Node> nodes_{1};
+    };
+
+    // Shorter lists are scanned, which is faster than using the index.
+    static constexpr size_t kMinRoutesToIndex = 32;
+
+    bool indexed_ = false;
+    Trie case_sensitive_paths_;
+    // Keyed by the lower-case path.
+    Trie case_insensitive_paths_;
+    std::unique_ptr<RE2::Set> regexes_;
+    // Route of each regex of the set.
+    std::vector<size_t> regex_routes_;
+    // Routes whose path matcher is not indexed, checked one by one.
+    std::vector<size_t> other_routes_;
+  };
+
   // Returns true if \a domain_pattern is a valid domain pattern, false
   // otherwise.
   static bool IsValidDomainPattern(absl::string_view domain_pattern);
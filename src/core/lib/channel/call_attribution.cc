@@ -0,0 +1,144 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/channel/call_attribution.h"
+
+#include <string>
+#include <utility>
+
+#include <grpc/support/time.h>
+
+#include "src/core/lib/gpr/alloc.h"
+
+namespace grpc_core {
+
+namespace {
+// Name of the entry methods past kMaxMethods are folded into.
+constexpr absl::string_view kOtherMethods = "<other>";
+}  // namespace
+
+constexpr size_t CallAttribution::kMaxMethods;
+
+thread_local CallAttribution::CallState* CallAttribution::current_call_{
+    nullptr};
+thread_local CallAttribution::FilterScope* CallAttribution::current_filter_{
+    nullptr};
+
+void CallAttribution::FilterScope::Enter(CallState* call, size_t index) {
+  call_ = call;
+  totals_ = call->filters[index];
+  parent_ = current_filter_;
+  // The parent is charged for what it did so far, and restarts when we're
+  // done: nothing we do is counted twice.
+  if (parent_ != nullptr) parent_->Charge();
+  current_filter_ = this;
+  Restart();
+}
+
+void CallAttribution::FilterScope::Leave() {
+  Charge();
+  current_filter_ = parent_;
+  if (parent_ != nullptr) parent_->Restart();
+}
+
+void CallAttribution::FilterScope::Charge() {
+  const size_t used = call_->arena->TotalUsedBytes();
+  totals_->arena_bytes.fetch_add(used - start_bytes_,
+                                 std::memory_order_relaxed);
+  const gpr_timespec elapsed =
+      gpr_cycle_counter_sub(gpr_get_cycle_counter(), start_cycles_);
+  totals_->cpu_nanos.fetch_add(
+      static_cast<uint64_t>(elapsed.tv_sec) * GPR_NS_PER_SEC + elapsed.tv_nsec,
+      std::memory_order_relaxed);
+}
+
+void CallAttribution::FilterScope::Restart() {
+  start_bytes_ = call_->arena->TotalUsedBytes();
+  start_cycles_ = gpr_get_cycle_counter();
+}
+
+std::vector<CallAttribution::FilterTotals*> CallAttribution::FiltersForStack(
+    grpc_channel_stack* stack) {
+  std::vector<FilterTotals*> filters;
+  MutexLock lock(&mu_);
+  for (size_t i = 0; i < stack->count; i++) {
+    filters.push_back(
+        &filters_[grpc_channel_stack_element(stack, i)->filter->name]);
+  }
+  return filters;
+}
+
+CallAttribution::CallState* CallAttribution::StartCall(
+    const std::vector<FilterTotals*>& filters,
+    grpc_channel_stack* channel_stack, grpc_call_stack* call_stack,
+    Arena* arena) {
+  // Call data is laid out with the call stack, not allocated by the filter
+  // at run time: charge it up front.
+  for (size_t i = 0; i < filters.size(); i++) {
+    filters[i]->calls.fetch_add(1, std::memory_order_relaxed);
+    filters[i]->arena_bytes.fetch_add(
+        GPR_ROUND_UP_TO_ALIGNMENT_SIZE(
+            grpc_channel_stack_element(channel_stack, i)
+                ->filter->sizeof_call_data),
+        std::memory_order_relaxed);
+  }
+  return arena->ManagedNew<CallState>(
+      CallState{this, filters.data(), grpc_call_stack_element(call_stack, 0),
+                filters.size(), arena, Slice()});
+}
+
+void CallAttribution::FinishCall(CallState* call) {
+  const size_t arena_bytes = call->arena->TotalUsedBytes();
+  absl::string_view method = call->method.as_string_view();
+  MutexLock lock(&mu_);
+  auto it = methods_.find(std::string(method));
+  if (it == methods_.end()) {
+    if (methods_.size() >= kMaxMethods) method = kOtherMethods;
+    it = methods_.emplace(std::string(method), MethodTotals()).first;
+  }
+  it->second.calls++;
+  it->second.arena_bytes += arena_bytes;
+}
+
+Json CallAttribution::RenderJson() {
+  Json::Array filters;
+  Json::Array methods;
+  MutexLock lock(&mu_);
+  for (const auto& p : filters_) {
+    filters.emplace_back(Json::Object{
+        {"filter", p.first},
+        {"calls",
+         std::to_string(p.second.calls.load(std::memory_order_relaxed))},
+        {"arenaBytes",
+         std::to_string(p.second.arena_bytes.load(std::memory_order_relaxed))},
+        {"cpuNanos",
+         std::to_string(p.second.cpu_nanos.load(std::memory_order_relaxed))},
+    });
+  }
+  for (const auto& p : methods_) {
+    methods.emplace_back(Json::Object{
+        {"method", p.first},
+        {"calls", std::to_string(p.second.calls)},
+        {"arenaBytes", std::to_string(p.second.arena_bytes)},
+    });
+  }
+  return Json::Object{
+      {"filters", std::move(filters)},
+      {"methods", std::move(methods)},
+  };
+}
+
+}  // namespace grpc_core
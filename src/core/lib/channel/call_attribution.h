@@ -0,0 +1,171 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_CHANNEL_CALL_ATTRIBUTION_H
+#define GRPC_SRC_CORE_LIB_CHANNEL_CALL_ATTRIBUTION_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+
+#include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/gpr/time_precise.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/slice/slice.h"
+
+// Channel arg (bool, default false): attribute per-call arena memory and CPU
+// time to the filters of the channel stack, and arena memory to methods.
+// Results are rendered by channelz.
+#define GRPC_ARG_CALL_ATTRIBUTION "grpc.experimental.call_attribution"
+
+namespace grpc_core {
+
+// Aggregated call costs for the channels sharing one instance (a client
+// channel, or all the connections of a server).
+//
+// A filter is charged with the arena bytes allocated and the CPU time spent
+// while one of its call element hooks runs, excluding the filters it calls
+// into, plus the size of its call data. Work done from callbacks (eg. when a
+// transport op completes) is not attributed to anyone, and allocations made
+// concurrently on the same arena by other threads may be misattributed: the
+// figures are meant to find the filters that bloat calls, not for accounting.
+class CallAttribution : public RefCounted<CallAttribution> {
+ public:
+  struct FilterTotals {
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> arena_bytes{0};
+    std::atomic<uint64_t> cpu_nanos{0};
+  };
+
+  // Per-call state, allocated on the call's arena.
+  struct CallState {
+    CallAttribution* attribution;
+    // Totals for each element of the call stack.
+    FilterTotals* const* filters;
+    grpc_call_element* elems;
+    size_t num_elems;
+    Arena* arena;
+    // Set once known: at creation for clients, from the received initial
+    // metadata for servers.
+    Slice method;
+  };
+
+  // Enters the scope of a call: FilterScopes for its elements on this thread
+  // are attributed until the CallScope is destroyed.
+  // Does nothing for a null \a call.
+  class CallScope {
+   public:
+    explicit CallScope(CallState* call) : previous_(current_call_) {
+      if (call != nullptr) current_call_ = call;
+    }
+    ~CallScope() { current_call_ = previous_; }
+
+    CallScope(const CallScope&) = delete;
+    CallScope& operator=(const CallScope&) = delete;
+
+   private:
+    CallState* const previous_;
+  };
+
+  // Attributes the work done until destruction to the filter of \a elem, if
+  // it belongs to the call of the innermost CallScope.
+  class FilterScope {
+   public:
+    explicit FilterScope(const grpc_call_element* elem) {
+      CallState* call = current_call_;
+      if (GPR_LIKELY(call == nullptr)) return;
+      if (elem < call->elems || elem >= call->elems + call->num_elems) return;
+      Enter(call, elem - call->elems);
+    }
+    ~FilterScope() {
+      if (call_ != nullptr) Leave();
+    }
+
+    FilterScope(const FilterScope&) = delete;
+    FilterScope& operator=(const FilterScope&) = delete;
+
+   private:
+    void Enter(CallState* call, size_t index);
+    void Leave();
+    void Charge();
+    void Restart();
+
+    CallState* call_ = nullptr;
+    FilterTotals* totals_;
+    FilterScope* parent_;
+    size_t start_bytes_;
+    gpr_cycle_counter start_cycles_;
+  };
+
+  CallAttribution() = default;
+
+  static absl::string_view ChannelArgName() {
+    return GRPC_ARG_CALL_ATTRIBUTION ".object";
+  }
+  static int ChannelArgsCompare(const CallAttribution* a,
+                                const CallAttribution* b) {
+    return QsortCompare(a, b);
+  }
+
+  // Returns the totals for each filter of \a stack, in order.
+  std::vector<FilterTotals*> FiltersForStack(grpc_channel_stack* stack);
+
+  // Starts attributing a call on \a call_stack, which is about to be
+  // initialized from \a channel_stack, whose totals are \a filters.
+  // \a filters must outlive the call.
+  CallState* StartCall(const std::vector<FilterTotals*>& filters,
+                       grpc_channel_stack* channel_stack,
+                       grpc_call_stack* call_stack, Arena* arena);
+
+  // Records a call's arena usage against its method.
+  void FinishCall(CallState* call);
+
+  Json RenderJson();
+
+ private:
+  struct MethodTotals {
+    uint64_t calls = 0;
+    uint64_t arena_bytes = 0;
+  };
+
+  // Methods past this many are folded into one entry, since servers may see
+  // any path.
+  static constexpr size_t kMaxMethods = 256;
+
+  static thread_local CallState* current_call_;
+  static thread_local FilterScope* current_filter_;
+
+  Mutex mu_;
+  // Keyed by filter name. Nodes are never removed, so pointers to the totals
+  // stay valid.
+  std::map<std::string, FilterTotals> filters_ ABSL_GUARDED_BY(mu_);
+  std::map<std::string, MethodTotals> methods_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_CHANNEL_CALL_ATTRIBUTION_H
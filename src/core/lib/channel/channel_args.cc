@@ -29,6 +29,7 @@
 #include <map>
 #include <vector>
 
+#include "absl/hash/hash.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
@@ -74,12 +75,10 @@ ChannelArgs& ChannelArgs::operator=(const ChannelArgs& other) = default;
 ChannelArgs::ChannelArgs(ChannelArgs&& other) noexcept = default;
 ChannelArgs& ChannelArgs::operator=(ChannelArgs&& other) noexcept = default;
 
-const ChannelArgs::Value* ChannelArgs::Get(absl::string_view name) const {
-  return args_.Lookup(name);
-}
-
-bool ChannelArgs::Contains(absl::string_view name) const {
-  return Get(name) != nullptr;
+const ChannelArgs::Value* ChannelArgs::Get(const Key& key) const {
+  const uint64_t bits = KeyFilterBits(key);
+  if ((key_filter_ & bits) != bits) return nullptr;
+  return args_.Lookup(key.name());
 }
 
 bool ChannelArgs::operator<(const ChannelArgs& other) const {
@@ -87,6 +86,8 @@ bool ChannelArgs::operator<(const ChannelArgs& other) const {
 }
 
 bool ChannelArgs::operator==(const ChannelArgs& other) const {
+  // Identical trees compare equal without a walk (see AVL::operator==).
+  if (hash_ != other.hash_) return false;
   return args_ == other.args_;
 }
 
@@ -95,11 +96,23 @@ bool ChannelArgs::operator!=(const ChannelArgs& other) const {
 }
 
 bool ChannelArgs::WantMinimalStack() const {
-  return GetBool(GRPC_ARG_MINIMAL_STACK).value_or(false);
+  static constexpr Key kMinimalStack(GRPC_ARG_MINIMAL_STACK);
+  return GetBool(kMinimalStack).value_or(false);
 }
 
-ChannelArgs::ChannelArgs(AVL<std::string, Value> args)
-    : args_(std::move(args)) {}
+ChannelArgs::ChannelArgs(AVL<std::string, Value> args, size_t hash,
+                         uint64_t key_filter)
+    : args_(std::move(args)), hash_(hash), key_filter_(key_filter) {}
+
+size_t ChannelArgs::EntryHash(absl::string_view key, const Value& value) {
+  if (const int* i = absl::get_if<int>(&value)) {
+    return absl::HashOf(key, value.index(), *i);
+  }
+  if (const std::string* s = absl::get_if<std::string>(&value)) {
+    return absl::HashOf(key, value.index(), *s);
+  }
+  return absl::HashOf(key, value.index());
+}
 
 ChannelArgs ChannelArgs::Set(grpc_arg arg) const {
   switch (arg.type) {
@@ -155,7 +168,11 @@ ChannelArgs ChannelArgs::Set(absl::string_view name, int value) const {
 }
 
 ChannelArgs ChannelArgs::Set(absl::string_view key, Value value) const {
-  return ChannelArgs(args_.Add(std::string(key), std::move(value)));
+  size_t hash = hash_ + EntryHash(key, value);
+  const Value* old = args_.Lookup(key);
+  if (old != nullptr) hash -= EntryHash(key, *old);
+  return ChannelArgs(args_.Add(std::string(key), std::move(value)), hash,
+                     key_filter_ | KeyFilterBits(Key(key)));
 }
 
 ChannelArgs ChannelArgs::Set(absl::string_view key,
@@ -172,19 +189,28 @@ ChannelArgs ChannelArgs::Set(absl::string_view key, std::string value) const {
 }
 
 ChannelArgs ChannelArgs::Remove(absl::string_view key) const {
-  return ChannelArgs(args_.Remove(key));
+  const Value* old = args_.Lookup(key);
+  if (old == nullptr) return *this;
+  AVL<std::string, Value> args = args_.Remove(key);
+  // Rebuild the filter so that bits only the removed key set are cleared.
+  uint64_t key_filter = 0;
+  args.ForEach([&key_filter](const std::string& k, const Value&) {
+    key_filter |= KeyFilterBits(Key(k));
+  });
+  return ChannelArgs(std::move(args), hash_ - EntryHash(key, *old),
+                     key_filter);
 }
 
-absl::optional<int> ChannelArgs::GetInt(absl::string_view name) const {
-  auto* v = Get(name);
+absl::optional<int> ChannelArgs::GetInt(const Key& key) const {
+  auto* v = Get(key);
   if (v == nullptr) return absl::nullopt;
   if (!absl::holds_alternative<int>(*v)) return absl::nullopt;
   return absl::get<int>(*v);
 }
 
 absl::optional<Duration> ChannelArgs::GetDurationFromIntMillis(
-    absl::string_view name) const {
-  auto ms = GetInt(name);
+    const Key& key) const {
+  auto ms = GetInt(key);
   if (!ms.has_value()) return absl::nullopt;
   if (*ms == INT_MAX) return Duration::Infinity();
   if (*ms == INT_MIN) return Duration::NegativeInfinity();
@@ -192,8 +218,8 @@ absl::optional<Duration> ChannelArgs::GetDurationFromIntMillis(
 }
 
 absl::optional<absl::string_view> ChannelArgs::GetString(
-    absl::string_view name) const {
-  auto* v = Get(name);
+    const Key& key) const {
+  auto* v = Get(key);
   if (v == nullptr) return absl::nullopt;
   if (!absl::holds_alternative<std::string>(*v)) return absl::nullopt;
   return absl::get<std::string>(*v);
@@ -213,13 +239,13 @@ void* ChannelArgs::GetVoidPointer(absl::string_view name) const {
   return absl::get<Pointer>(*v).c_pointer();
 }
 
-absl::optional<bool> ChannelArgs::GetBool(absl::string_view name) const {
-  auto* v = Get(name);
+absl::optional<bool> ChannelArgs::GetBool(const Key& key) const {
+  auto* v = Get(key);
   if (v == nullptr) return absl::nullopt;
   auto* i = absl::get_if<int>(v);
   if (i == nullptr) {
     gpr_log(GPR_ERROR, "%s ignored: it must be an integer",
-            std::string(name).c_str());
+            std::string(key.name()).c_str());
     return absl::nullopt;
   }
   switch (*i) {
@@ -229,7 +255,7 @@ absl::optional<bool> ChannelArgs::GetBool(absl::string_view name) const {
       return true;
     default:
       gpr_log(GPR_ERROR, "%s treated as bool but set to %d (assuming true)",
-              std::string(name).c_str(), *i);
+              std::string(key.name()).c_str(), *i);
       return true;
   }
 }
@@ -252,7 +278,7 @@ std::string ChannelArgs::ToString() const {
 
 ChannelArgs ChannelArgs::UnionWith(ChannelArgs other) const {
   args_.ForEach([&other](const std::string& key, const Value& value) {
-    other.args_ = other.args_.Add(key, value);
+    other = other.Set(key, value);
   });
   return other;
 }
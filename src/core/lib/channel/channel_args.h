@@ -22,6 +22,7 @@
 #include <grpc/support/port_platform.h>
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <algorithm>  // IWYU pragma: keep
 #include <iosfwd>
@@ -283,6 +284,35 @@ class ChannelArgs {
 
   using Value = absl::variant<int, std::string, Pointer>;
 
+  // A channel arg name along with a hash of it, used to skip lookups of args
+  // that are not set. The hash is computed at compile time for constant
+  // names, so hot paths can declare tokens for the names they read:
+  //   constexpr ChannelArgs::Key kMinimalStack(GRPC_ARG_MINIMAL_STACK);
+  class Key {
+   public:
+    constexpr explicit Key(absl::string_view name)
+        : name_(name), hash_(HashName(name)) {}
+
+    constexpr absl::string_view name() const { return name_; }
+    constexpr uint64_t hash() const { return hash_; }
+
+   private:
+    // Mixes the length and the last eight bytes of the name: arg names
+    // mostly share prefixes ("grpc.", "grpc.internal.", ...) and differ at
+    // the end. Only the top bits are used, which the multiply mixes well.
+    static constexpr uint64_t HashName(absl::string_view name) {
+      uint64_t tail = name.size();
+      for (size_t i = name.size() > 8 ? name.size() - 8 : 0; i < name.size();
+           ++i) {
+        tail = (tail << 8) ^ static_cast<uint8_t>(name[i]);
+      }
+      return tail * 0x9e3779b97f4a7c15u;
+    }
+
+    absl::string_view name_;
+    uint64_t hash_;
+  };
+
   struct ChannelArgsDeleter {
     void operator()(const grpc_channel_args* p) const;
   };
@@ -307,7 +337,8 @@ class ChannelArgs {
   // If a key is present in both, the value from this is used.
   GRPC_MUST_USE_RESULT ChannelArgs UnionWith(ChannelArgs other) const;
 
-  const Value* Get(absl::string_view name) const;
+  const Value* Get(const Key& key) const;
+  const Value* Get(absl::string_view name) const { return Get(Key(name)); }
   GRPC_MUST_USE_RESULT ChannelArgs Set(absl::string_view name,
                                        Pointer value) const;
   GRPC_MUST_USE_RESULT ChannelArgs Set(absl::string_view name, int value) const;
@@ -360,15 +391,22 @@ class ChannelArgs {
     return Set(name, std::move(value));
   }
   GRPC_MUST_USE_RESULT ChannelArgs Remove(absl::string_view name) const;
-  bool Contains(absl::string_view name) const;
+  bool Contains(const Key& key) const { return Get(key) != nullptr; }
+  bool Contains(absl::string_view name) const { return Contains(Key(name)); }
 
   template <typename T>
   bool ContainsObject() const {
     return Get(ChannelArgNameTraits<T>::ChannelArgName()) != nullptr;
   }
 
-  absl::optional<int> GetInt(absl::string_view name) const;
-  absl::optional<absl::string_view> GetString(absl::string_view name) const;
+  absl::optional<int> GetInt(const Key& key) const;
+  absl::optional<int> GetInt(absl::string_view name) const {
+    return GetInt(Key(name));
+  }
+  absl::optional<absl::string_view> GetString(const Key& key) const;
+  absl::optional<absl::string_view> GetString(absl::string_view name) const {
+    return GetString(Key(name));
+  }
   absl::optional<std::string> GetOwnedString(absl::string_view name) const;
   void* GetVoidPointer(absl::string_view name) const;
   template <typename T>
@@ -377,9 +415,15 @@ class ChannelArgs {
     return static_cast<typename GetObjectImpl<T>::StoredType>(
         GetVoidPointer(name));
   }
+  absl::optional<Duration> GetDurationFromIntMillis(const Key& key) const;
   absl::optional<Duration> GetDurationFromIntMillis(
-      absl::string_view name) const;
-  absl::optional<bool> GetBool(absl::string_view name) const;
+      absl::string_view name) const {
+    return GetDurationFromIntMillis(Key(name));
+  }
+  absl::optional<bool> GetBool(const Key& key) const;
+  absl::optional<bool> GetBool(absl::string_view name) const {
+    return GetBool(Key(name));
+  }
 
   // Object based get/set.
   // Deal with the common case that we set a pointer to an object under
@@ -420,18 +464,40 @@ class ChannelArgs {
   bool operator<(const ChannelArgs& other) const;
   bool operator==(const ChannelArgs& other) const;
 
+  // Hashes consistently with operator==, see EntryHash().
+  template <typename H>
+  friend H AbslHashValue(H h, const ChannelArgs& args) {
+    return H::combine(std::move(h), args.hash_);
+  }
+
   // Helpers for commonly accessed things
 
   bool WantMinimalStack() const;
   std::string ToString() const;
 
  private:
-  explicit ChannelArgs(AVL<std::string, Value> args);
+  ChannelArgs(AVL<std::string, Value> args, size_t hash, uint64_t key_filter);
 
   GRPC_MUST_USE_RESULT ChannelArgs Set(absl::string_view name,
                                        Value value) const;
 
+  // Hash of a single entry. Pointer values may compare equal through their
+  // vtable without being identical, so only their keys contribute.
+  static size_t EntryHash(absl::string_view key, const Value& value);
+  // Bits set in key_filter_ for a key.
+  static uint64_t KeyFilterBits(const Key& key) {
+    return (uint64_t{1} << (key.hash() >> 58)) |
+           (uint64_t{1} << ((key.hash() >> 52) & 63));
+  }
+
   AVL<std::string, Value> args_;
+  // Sum of EntryHash() over all entries: independent of the shape of args_,
+  // and maintained incrementally as args are set and removed.
+  size_t hash_ = 0;
+  // Bloom filter of the keys in args_ (see KeyFilterBits()). Lookups of
+  // keys whose bits are not all set skip the walk of args_. Remove()
+  // rebuilds it from the remaining keys.
+  uint64_t key_filter_ = 0;
 };
 
 std::ostream& operator<<(std::ostream& out, const ChannelArgs& args);
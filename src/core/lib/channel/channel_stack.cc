@@ -27,6 +27,7 @@
 
 #include <grpc/support/log.h>
 
+#include "src/core/lib/channel/call_attribution.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gpr/alloc.h"
 
@@ -208,6 +209,7 @@ grpc_error_handle grpc_call_stack_init(
         GPR_ROUND_UP_TO_ALIGNMENT_SIZE(call_elems[i].filter->sizeof_call_data);
   }
   for (size_t i = 0; i < count; i++) {
+    grpc_core::CallAttribution::FilterScope attribution_scope(&call_elems[i]);
     grpc_error_handle error =
         call_elems[i].filter->init_call_elem(&call_elems[i], elem_args);
     if (!error.ok()) {
@@ -245,6 +247,7 @@ void grpc_call_stack_destroy(grpc_call_stack* stack,
 
   // destroy per-filter data
   for (i = 0; i < count; i++) {
+    grpc_core::CallAttribution::FilterScope attribution_scope(&elems[i]);
     elems[i].filter->destroy_call_elem(
         &elems[i], final_info,
         i == count - 1 ? then_schedule_closure : nullptr);
@@ -255,6 +258,7 @@ void grpc_call_next_op(grpc_call_element* elem,
                        grpc_transport_stream_op_batch* op) {
   grpc_call_element* next_elem = elem + 1;
   GRPC_CALL_LOG_OP(GPR_INFO, next_elem, op);
+  grpc_core::CallAttribution::FilterScope attribution_scope(next_elem);
   next_elem->filter->start_transport_stream_op_batch(next_elem, op);
 }
 
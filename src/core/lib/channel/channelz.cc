@@ -179,6 +179,7 @@ Json ChannelNode::RenderJson() {
   }
   // Ask CallCountingHelper to populate call count data.
   call_counter_.PopulateCallCounts(&data);
+  PopulateCallAttribution(&data);
   // Construct outer object.
   Json::Object json = {
       {"ref",
@@ -193,6 +194,13 @@ Json ChannelNode::RenderJson() {
   return json;
 }
 
+void ChannelNode::PopulateCallAttribution(Json::Object* json) {
+  MutexLock lock(&call_attribution_mu_);
+  if (call_attribution_ != nullptr) {
+    (*json)["callAttribution"] = call_attribution_->RenderJson();
+  }
+}
+
 void ChannelNode::PopulateChildRefs(Json::Object* json) {
   MutexLock lock(&child_mu_);
   if (!child_subchannels_.empty()) {
@@ -297,6 +305,13 @@ std::string ServerNode::RenderServerSockets(intptr_t start_socket_id,
   return json.Dump();
 }
 
+void ServerNode::PopulateCallAttribution(Json::Object* json) {
+  MutexLock lock(&call_attribution_mu_);
+  if (call_attribution_ != nullptr) {
+    (*json)["callAttribution"] = call_attribution_->RenderJson();
+  }
+}
+
 Json ServerNode::RenderJson() {
   Json::Object data;
   // Fill in the channel trace if applicable.
@@ -306,6 +321,7 @@ Json ServerNode::RenderJson() {
   }
   // Ask CallCountingHelper to populate call count data.
   call_counter_.PopulateCallCounts(&data);
+  PopulateCallAttribution(&data);
   // Construct top-level object.
   Json::Object object = {
       {"ref",
@@ -38,6 +38,7 @@
 #include <grpc/impl/connectivity_state.h>
 #include <grpc/slice.h>
 
+#include "src/core/lib/channel/call_attribution.h"
 #include "src/core/lib/channel/channel_trace.h"
 #include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gpr/useful.h"
@@ -207,6 +208,12 @@ class ChannelNode : public BaseNode {
 
   void SetConnectivityState(grpc_connectivity_state state);
 
+  // Renders \a call_attribution with the channel's call counts.
+  void SetCallAttribution(RefCountedPtr<CallAttribution> call_attribution) {
+    MutexLock lock(&call_attribution_mu_);
+    call_attribution_ = std::move(call_attribution);
+  }
+
   // TODO(roth): take in a RefCountedPtr to the child channel so we can retrieve
   // the human-readable name.
   void AddChildChannel(intptr_t child_uuid);
@@ -222,6 +229,7 @@ class ChannelNode : public BaseNode {
   friend class testing::ChannelNodePeer;
 
   void PopulateChildRefs(Json::Object* json);
+  void PopulateCallAttribution(Json::Object* json);
 
   std::string target_;
   CallCountingHelper call_counter_;
@@ -231,6 +239,10 @@ class ChannelNode : public BaseNode {
   // bits are a grpc_connectivity_state value.
   std::atomic<int> connectivity_state_{0};
 
+  Mutex call_attribution_mu_;
+  RefCountedPtr<CallAttribution> call_attribution_
+      ABSL_GUARDED_BY(call_attribution_mu_);
+
   Mutex child_mu_;  // Guards sets below.
   std::set<intptr_t> child_channels_;
   std::set<intptr_t> child_subchannels_;
@@ -270,9 +282,20 @@ class ServerNode : public BaseNode {
   void RecordCallFailed() { call_counter_.RecordCallFailed(); }
   void RecordCallSucceeded() { call_counter_.RecordCallSucceeded(); }
 
+  // Renders \a call_attribution with the server's call counts.
+  void SetCallAttribution(RefCountedPtr<CallAttribution> call_attribution) {
+    MutexLock lock(&call_attribution_mu_);
+    call_attribution_ = std::move(call_attribution);
+  }
+
  private:
+  void PopulateCallAttribution(Json::Object* json);
+
   CallCountingHelper call_counter_;
   ChannelTrace trace_;
+  Mutex call_attribution_mu_;
+  RefCountedPtr<CallAttribution> call_attribution_
+      ABSL_GUARDED_BY(call_attribution_mu_);
   Mutex child_mu_;  // Guards child maps below.
   std::map<intptr_t, RefCountedPtr<SocketNode>> child_sockets_;
   std::map<intptr_t, RefCountedPtr<ListenSocketNode>> child_listen_sockets_;
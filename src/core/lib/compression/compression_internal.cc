@@ -228,7 +228,9 @@ uint32_t CompressionAlgorithmSet::ToLegacyBitmask() const {
 
 absl::optional<grpc_compression_algorithm>
 DefaultCompressionAlgorithmFromChannelArgs(const ChannelArgs& args) {
-  auto* value = args.Get(GRPC_COMPRESSION_CHANNEL_DEFAULT_ALGORITHM);
+  static constexpr ChannelArgs::Key kDefaultAlgorithm(
+      GRPC_COMPRESSION_CHANNEL_DEFAULT_ALGORITHM);
+  auto* value = args.Get(kDefaultAlgorithm);
   if (value == nullptr) return absl::nullopt;
   if (auto* p = absl::get_if<int>(value)) {
     return static_cast<grpc_compression_algorithm>(*p);
@@ -69,15 +69,20 @@ Histogram_80_10 operator-(const Histogram_80_10& left,
 }
 const absl::string_view
     GlobalStats::counter_name[static_cast<int>(Counter::COUNT)] = {
-        "client_calls_created",    "server_calls_created",
-        "client_channels_created", "client_subchannels_created",
-        "server_channels_created", "insecure_connections_created",
-        "syscall_write",           "syscall_read",
-        "tcp_read_alloc_8k",       "tcp_read_alloc_64k",
-        "http2_settings_writes",   "http2_pings_sent",
-        "http2_writes_begun",      "http2_transport_stalls",
-        "http2_stream_stalls",     "cq_pluck_creates",
-        "cq_next_creates",         "cq_callback_creates",
+        "client_calls_created",           "server_calls_created",
+        "client_channels_created",        "client_subchannels_created",
+        "server_channels_created",        "insecure_connections_created",
+        "syscall_write",                  "syscall_read",
+        "tcp_read_alloc_8k",              "tcp_read_alloc_64k",
+        "http2_settings_writes",          "http2_pings_sent",
+        "http2_writes_begun",             "http2_transport_stalls",
+        "http2_stream_stalls",            "cq_pluck_creates",
+        "cq_next_creates",                "cq_callback_creates",
+        "outlier_success_rate_ejections", "outlier_failure_pct_ejections",
+        "outlier_latency_ejections",      "outlier_unejections",
+        "interned_slice_hits",            "interned_slice_misses",
+        "tls_client_handshakes",          "tls_client_resumed_handshakes",
+        "tls_server_handshakes",          "tls_server_resumed_handshakes",
 };
 const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     Counter::COUNT)] = {
@@ -105,16 +110,36 @@ const absl::string_view GlobalStats::counter_doc[static_cast<int>(
     "usage)",
     "Number of completion queues created for cq_callback (indicates callback "
     "api usage)",
+    "Number of endpoints ejected by outlier detection's success rate algorithm",
+    "Number of endpoints ejected by outlier detection's failure percentage "
+    "algorithm",
+    "Number of endpoints ejected by outlier detection's latency algorithm",
+    "Number of endpoints returned to service after an outlier detection "
+    "ejection",
+    "Number of values found in the metadata interning table",
+    "Number of values added to the metadata interning table",
+    "Number of TLS handshakes completed by clients",
+    "Number of TLS handshakes completed by clients that resumed a session",
+    "Number of TLS handshakes completed by servers",
+    "Number of TLS handshakes completed by servers that resumed a session",
 };
 const absl::string_view GlobalStats::histogram_name[static_cast<int>(
     Histogram::COUNT)] = {
-    "call_initial_size",       "tcp_write_size",      "tcp_write_iov_size",
-    "tcp_read_size",           "tcp_read_offer",      "tcp_read_offer_iov_size",
-    "http2_send_message_size", "http2_metadata_size",
+    "call_initial_size",
+    "call_final_size",
+    "tcp_write_size",
+    "tcp_write_iov_size",
+    "tcp_read_size",
+    "tcp_read_offer",
+    "tcp_read_offer_iov_size",
+    "http2_send_message_size",
+    "http2_metadata_size",
+    "interned_slice_table_size",
 };
 const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     Histogram::COUNT)] = {
     "Initial size of the grpc_call arena created at call start",
+    "Number of bytes used from the grpc_call arena by the end of the call",
     "Number of bytes offered to each syscall_write",
     "Number of byte segments offered to each syscall_write",
     "Number of bytes received by each syscall_read",
@@ -122,6 +147,8 @@ const absl::string_view GlobalStats::histogram_doc[static_cast<int>(
     "Number of byte segments offered to each syscall_read",
     "Size of messages received by HTTP2 transport",
     "Number of bytes consumed by metadata, according to HPACK accounting rules",
+    "Number of bytes used by the metadata interning table, sampled at each "
+    "insertion",
 };
 namespace {
 const int kStatsTable0[27] = {0,    1,     2,     4,     7,     11,   17,
@@ -220,7 +247,17 @@ GlobalStats::GlobalStats()
       http2_stream_stalls{0},
       cq_pluck_creates{0},
       cq_next_creates{0},
-      cq_callback_creates{0} {}
+      cq_callback_creates{0},
+      outlier_success_rate_ejections{0},
+      outlier_failure_pct_ejections{0},
+      outlier_latency_ejections{0},
+      outlier_unejections{0},
+      interned_slice_hits{0},
+      interned_slice_misses{0},
+      tls_client_handshakes{0},
+      tls_client_resumed_handshakes{0},
+      tls_server_handshakes{0},
+      tls_server_resumed_handshakes{0} {}
 HistogramView GlobalStats::histogram(Histogram which) const {
   switch (which) {
     default:
@@ -228,6 +265,9 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kCallInitialSize:
       return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable0, 26,
                            call_initial_size.buckets()};
+    case Histogram::kCallFinalSize:
+      return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable0, 26,
+                           call_final_size.buckets()};
     case Histogram::kTcpWriteSize:
       return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
                            tcp_write_size.buckets()};
@@ -249,6 +289,9 @@ HistogramView GlobalStats::histogram(Histogram which) const {
     case Histogram::kHttp2MetadataSize:
       return HistogramView{&Histogram_65536_26::BucketFor, kStatsTable0, 26,
                            http2_metadata_size.buckets()};
+    case Histogram::kInternedSliceTableSize:
+      return HistogramView{&Histogram_16777216_20::BucketFor, kStatsTable2, 20,
+                           interned_slice_table_size.buckets()};
   }
 }
 std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
@@ -288,7 +331,28 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
         data.cq_next_creates.load(std::memory_order_relaxed);
     result->cq_callback_creates +=
         data.cq_callback_creates.load(std::memory_order_relaxed);
+    result->outlier_success_rate_ejections +=
+        data.outlier_success_rate_ejections.load(std::memory_order_relaxed);
+    result->outlier_failure_pct_ejections +=
+        data.outlier_failure_pct_ejections.load(std::memory_order_relaxed);
+    result->outlier_latency_ejections +=
+        data.outlier_latency_ejections.load(std::memory_order_relaxed);
+    result->outlier_unejections +=
+        data.outlier_unejections.load(std::memory_order_relaxed);
+    result->interned_slice_hits +=
+        data.interned_slice_hits.load(std::memory_order_relaxed);
+    result->interned_slice_misses +=
+        data.interned_slice_misses.load(std::memory_order_relaxed);
+    result->tls_client_handshakes +=
+        data.tls_client_handshakes.load(std::memory_order_relaxed);
+    result->tls_client_resumed_handshakes +=
+        data.tls_client_resumed_handshakes.load(std::memory_order_relaxed);
+    result->tls_server_handshakes +=
+        data.tls_server_handshakes.load(std::memory_order_relaxed);
+    result->tls_server_resumed_handshakes +=
+        data.tls_server_resumed_handshakes.load(std::memory_order_relaxed);
     data.call_initial_size.Collect(&result->call_initial_size);
+    data.call_final_size.Collect(&result->call_final_size);
     data.tcp_write_size.Collect(&result->tcp_write_size);
     data.tcp_write_iov_size.Collect(&result->tcp_write_iov_size);
     data.tcp_read_size.Collect(&result->tcp_read_size);
@@ -296,6 +360,7 @@ std::unique_ptr<GlobalStats> GlobalStatsCollector::Collect() const {
     data.tcp_read_offer_iov_size.Collect(&result->tcp_read_offer_iov_size);
     data.http2_send_message_size.Collect(&result->http2_send_message_size);
     data.http2_metadata_size.Collect(&result->http2_metadata_size);
+    data.interned_slice_table_size.Collect(&result->interned_slice_table_size);
   }
   return result;
 }
@@ -327,7 +392,26 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->cq_pluck_creates = cq_pluck_creates - other.cq_pluck_creates;
   result->cq_next_creates = cq_next_creates - other.cq_next_creates;
   result->cq_callback_creates = cq_callback_creates - other.cq_callback_creates;
+  result->outlier_success_rate_ejections =
+      outlier_success_rate_ejections - other.outlier_success_rate_ejections;
+  result->outlier_failure_pct_ejections =
+      outlier_failure_pct_ejections - other.outlier_failure_pct_ejections;
+  result->outlier_latency_ejections =
+      outlier_latency_ejections - other.outlier_latency_ejections;
+  result->outlier_unejections = outlier_unejections - other.outlier_unejections;
+  result->interned_slice_hits = interned_slice_hits - other.interned_slice_hits;
+  result->interned_slice_misses =
+      interned_slice_misses - other.interned_slice_misses;
+  result->tls_client_handshakes =
+      tls_client_handshakes - other.tls_client_handshakes;
+  result->tls_client_resumed_handshakes =
+      tls_client_resumed_handshakes - other.tls_client_resumed_handshakes;
+  result->tls_server_handshakes =
+      tls_server_handshakes - other.tls_server_handshakes;
+  result->tls_server_resumed_handshakes =
+      tls_server_resumed_handshakes - other.tls_server_resumed_handshakes;
   result->call_initial_size = call_initial_size - other.call_initial_size;
+  result->call_final_size = call_final_size - other.call_final_size;
   result->tcp_write_size = tcp_write_size - other.tcp_write_size;
   result->tcp_write_iov_size = tcp_write_iov_size - other.tcp_write_iov_size;
   result->tcp_read_size = tcp_read_size - other.tcp_read_size;
@@ -337,6 +421,8 @@ std::unique_ptr<GlobalStats> GlobalStats::Diff(const GlobalStats& other) const {
   result->http2_send_message_size =
       http2_send_message_size - other.http2_send_message_size;
   result->http2_metadata_size = http2_metadata_size - other.http2_metadata_size;
+  result->interned_slice_table_size =
+      interned_slice_table_size - other.interned_slice_table_size;
   return result;
 }
 }  // namespace grpc_core
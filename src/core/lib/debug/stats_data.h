@@ -119,10 +119,21 @@ struct GlobalStats {
     kCqPluckCreates,
     kCqNextCreates,
     kCqCallbackCreates,
+    kOutlierSuccessRateEjections,
+    kOutlierFailurePctEjections,
+    kOutlierLatencyEjections,
+    kOutlierUnejections,
+    kInternedSliceHits,
+    kInternedSliceMisses,
+    kTlsClientHandshakes,
+    kTlsClientResumedHandshakes,
+    kTlsServerHandshakes,
+    kTlsServerResumedHandshakes,
     COUNT
   };
   enum class Histogram {
     kCallInitialSize,
+    kCallFinalSize,
     kTcpWriteSize,
     kTcpWriteIovSize,
     kTcpReadSize,
@@ -130,6 +141,7 @@ struct GlobalStats {
     kTcpReadOfferIovSize,
     kHttp2SendMessageSize,
     kHttp2MetadataSize,
+    kInternedSliceTableSize,
     COUNT
   };
   GlobalStats();
@@ -159,10 +171,21 @@ struct GlobalStats {
       uint64_t cq_pluck_creates;
       uint64_t cq_next_creates;
       uint64_t cq_callback_creates;
+      uint64_t outlier_success_rate_ejections;
+      uint64_t outlier_failure_pct_ejections;
+      uint64_t outlier_latency_ejections;
+      uint64_t outlier_unejections;
+      uint64_t interned_slice_hits;
+      uint64_t interned_slice_misses;
+      uint64_t tls_client_handshakes;
+      uint64_t tls_client_resumed_handshakes;
+      uint64_t tls_server_handshakes;
+      uint64_t tls_server_resumed_handshakes;
     };
     uint64_t counters[static_cast<int>(Counter::COUNT)];
   };
   Histogram_65536_26 call_initial_size;
+  Histogram_65536_26 call_final_size;
   Histogram_16777216_20 tcp_write_size;
   Histogram_80_10 tcp_write_iov_size;
   Histogram_16777216_20 tcp_read_size;
@@ -170,6 +193,7 @@ struct GlobalStats {
   Histogram_80_10 tcp_read_offer_iov_size;
   Histogram_16777216_20 http2_send_message_size;
   Histogram_65536_26 http2_metadata_size;
+  Histogram_16777216_20 interned_slice_table_size;
   HistogramView histogram(Histogram which) const;
   std::unique_ptr<GlobalStats> Diff(const GlobalStats& other) const;
 };
@@ -240,9 +264,52 @@ class GlobalStatsCollector {
     data_.this_cpu().cq_callback_creates.fetch_add(1,
                                                    std::memory_order_relaxed);
   }
+  void IncrementOutlierSuccessRateEjections() {
+    data_.this_cpu().outlier_success_rate_ejections.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementOutlierFailurePctEjections() {
+    data_.this_cpu().outlier_failure_pct_ejections.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementOutlierLatencyEjections() {
+    data_.this_cpu().outlier_latency_ejections.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementOutlierUnejections() {
+    data_.this_cpu().outlier_unejections.fetch_add(1,
+                                                   std::memory_order_relaxed);
+  }
+  void IncrementInternedSliceHits() {
+    data_.this_cpu().interned_slice_hits.fetch_add(1,
+                                                   std::memory_order_relaxed);
+  }
+  void IncrementInternedSliceMisses() {
+    data_.this_cpu().interned_slice_misses.fetch_add(1,
+                                                     std::memory_order_relaxed);
+  }
+  void IncrementTlsClientHandshakes() {
+    data_.this_cpu().tls_client_handshakes.fetch_add(1,
+                                                     std::memory_order_relaxed);
+  }
+  void IncrementTlsClientResumedHandshakes() {
+    data_.this_cpu().tls_client_resumed_handshakes.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+  void IncrementTlsServerHandshakes() {
+    data_.this_cpu().tls_server_handshakes.fetch_add(1,
+                                                     std::memory_order_relaxed);
+  }
+  void IncrementTlsServerResumedHandshakes() {
+    data_.this_cpu().tls_server_resumed_handshakes.fetch_add(
+        1, std::memory_order_relaxed);
+  }
   void IncrementCallInitialSize(int value) {
     data_.this_cpu().call_initial_size.Increment(value);
   }
+  void IncrementCallFinalSize(int value) {
+    data_.this_cpu().call_final_size.Increment(value);
+  }
   void IncrementTcpWriteSize(int value) {
     data_.this_cpu().tcp_write_size.Increment(value);
   }
@@ -264,6 +331,9 @@ class GlobalStatsCollector {
   void IncrementHttp2MetadataSize(int value) {
     data_.this_cpu().http2_metadata_size.Increment(value);
   }
+  void IncrementInternedSliceTableSize(int value) {
+    data_.this_cpu().interned_slice_table_size.Increment(value);
+  }
 
  private:
   struct Data {
@@ -285,7 +355,18 @@ class GlobalStatsCollector {
     std::atomic<uint64_t> cq_pluck_creates{0};
     std::atomic<uint64_t> cq_next_creates{0};
     std::atomic<uint64_t> cq_callback_creates{0};
+    std::atomic<uint64_t> outlier_success_rate_ejections{0};
+    std::atomic<uint64_t> outlier_failure_pct_ejections{0};
+    std::atomic<uint64_t> outlier_latency_ejections{0};
+    std::atomic<uint64_t> outlier_unejections{0};
+    std::atomic<uint64_t> interned_slice_hits{0};
+    std::atomic<uint64_t> interned_slice_misses{0};
+    std::atomic<uint64_t> tls_client_handshakes{0};
+    std::atomic<uint64_t> tls_client_resumed_handshakes{0};
+    std::atomic<uint64_t> tls_server_handshakes{0};
+    std::atomic<uint64_t> tls_server_resumed_handshakes{0};
     HistogramCollector_65536_26 call_initial_size;
+    HistogramCollector_65536_26 call_final_size;
     HistogramCollector_16777216_20 tcp_write_size;
     HistogramCollector_80_10 tcp_write_iov_size;
     HistogramCollector_16777216_20 tcp_read_size;
@@ -293,6 +374,7 @@ class GlobalStatsCollector {
     HistogramCollector_80_10 tcp_read_offer_iov_size;
     HistogramCollector_16777216_20 http2_send_message_size;
     HistogramCollector_65536_26 http2_metadata_size;
+    HistogramCollector_16777216_20 interned_slice_table_size;
   };
   PerCpu<Data> data_;
 };
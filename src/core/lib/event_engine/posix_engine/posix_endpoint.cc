@@ -52,6 +52,7 @@
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/resource_quota/resource_quota.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
 
 #ifdef GRPC_POSIX_SOCKET_TCP
 #ifdef GRPC_LINUX_ERRQUEUE
@@ -229,20 +230,14 @@ msg_iovlen_type TcpZerocopySendRecord::PopulateIovs(size_t* unwind_slice_idx,
                                                     size_t* unwind_byte_idx,
                                                     size_t* sending_length,
                                                     iovec* iov) {
-  msg_iovlen_type iov_size;
   *unwind_slice_idx = out_offset_.slice_idx;
   *unwind_byte_idx = out_offset_.byte_idx;
-  for (iov_size = 0;
-       out_offset_.slice_idx != buf_.Count() && iov_size != MAX_WRITE_IOVEC;
-       iov_size++) {
-    MutableSlice& slice = internal::SliceCast<MutableSlice>(
-        buf_.MutableSliceAt(out_offset_.slice_idx));
-    iov[iov_size].iov_base = slice.begin();
-    iov[iov_size].iov_len = slice.length() - out_offset_.byte_idx;
-    *sending_length += iov[iov_size].iov_len;
-    ++(out_offset_.slice_idx);
-    out_offset_.byte_idx = 0;
-  }
+  msg_iovlen_type iov_size = static_cast<msg_iovlen_type>(
+      grpc_core::SliceBufferToIoVecs(buf_.c_slice_buffer(),
+                                     &out_offset_.slice_idx,
+                                     out_offset_.byte_idx, iov,
+                                     MAX_WRITE_IOVEC, sending_length));
+  out_offset_.byte_idx = 0;
   GPR_DEBUG_ASSERT(iov_size > 0);
   return iov_size;
 }
@@ -536,13 +531,13 @@ void PosixEndpointImpl::MaybeMakeReadSlices() {
       while (extra_wanted > 0) {
         extra_wanted -= kBigAlloc;
         incoming_buffer_->AppendIndexed(
-            Slice(memory_owner_.MakeSlice(kBigAlloc)));
+            Slice(memory_owner_.MakePooledSlice(kBigAlloc)));
       }
     } else {
       while (extra_wanted > 0) {
         extra_wanted -= kSmallAlloc;
         incoming_buffer_->AppendIndexed(
-            Slice(memory_owner_.MakeSlice(kSmallAlloc)));
+            Slice(memory_owner_.MakePooledSlice(kSmallAlloc)));
       }
     }
     MaybePostReclaimer();
@@ -1000,18 +995,10 @@ bool PosixEndpointImpl::TcpFlush(absl::Status& status) {
     sending_length = 0;
     unwind_slice_idx = outgoing_slice_idx;
     unwind_byte_idx = outgoing_byte_idx_;
-    for (iov_size = 0; outgoing_slice_idx != outgoing_buffer_->Count() &&
-                       iov_size != MAX_WRITE_IOVEC;
-         iov_size++) {
-      MutableSlice& slice = internal::SliceCast<MutableSlice>(
-          outgoing_buffer_->MutableSliceAt(outgoing_slice_idx));
-      iov[iov_size].iov_base = slice.begin() + outgoing_byte_idx_;
-      iov[iov_size].iov_len = slice.length() - outgoing_byte_idx_;
-
-      sending_length += iov[iov_size].iov_len;
-      outgoing_slice_idx++;
-      outgoing_byte_idx_ = 0;
-    }
+    iov_size = static_cast<msg_iovlen_type>(grpc_core::SliceBufferToIoVecs(
+        outgoing_buffer_->c_slice_buffer(), &outgoing_slice_idx,
+        outgoing_byte_idx_, iov, MAX_WRITE_IOVEC, &sending_length));
+    outgoing_byte_idx_ = 0;
     GPR_ASSERT(iov_size > 0);
 
     msg.msg_name = nullptr;
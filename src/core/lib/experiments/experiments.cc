@@ -57,6 +57,29 @@ const char* const description_transport_supplies_client_latency =
     "opencensus";
 const char* const description_event_engine_listener =
     "Use EventEngine listeners instead of iomgr's grpc_tcp_server";
+const char* const description_slice_pool =
+    "If set, slices made by a MemoryOwner (e.g. endpoint read buffers) use "
+    "pooled size class storage owned by the memory quota instead of malloc.";
+const char* const description_wakeup_run_queue =
+    "If set, activity wakeups requested while a scheduled activity wakeup runs "
+    "are run on the same thread straight after it, rather than each going "
+    "through the wakeup scheduler.";
+const char* const description_coalesce_header_slices =
+    "If set, small metadata keys and values are copied into the HPACK "
+    "encoder's output, so a header block is written from a few slices rather "
+    "than one or two per header.";
+const char* const description_intern_metadata_values =
+    "If set, HPACK parsers intern the values of headers they add to their "
+    "dynamic table in a process-wide table, so repeated values share one "
+    "allocation across calls and connections.";
+const char* const description_ssl_zero_copy_protector =
+    "If set, SSL handshaker results offer a zero-copy grpc protector, which "
+    "seals and unseals TLS records directly over slice buffers instead of "
+    "going through the secure endpoint's staging buffers.";
+const char* const description_compiled_rbac =
+    "If set, RBAC authorization engines evaluate a compiled form of their "
+    "policies, which shares predicates between rules and matches paths and "
+    "headers against all rules at once.";
 }  // namespace
 
 namespace grpc_core {
@@ -79,6 +102,12 @@ const ExperimentMetadata g_experiment_metadata[] = {
     {"transport_supplies_client_latency",
      description_transport_supplies_client_latency, false},
     {"event_engine_listener", description_event_engine_listener, false},
+    {"slice_pool", description_slice_pool, false},
+    {"wakeup_run_queue", description_wakeup_run_queue, false},
+    {"coalesce_header_slices", description_coalesce_header_slices, false},
+    {"intern_metadata_values", description_intern_metadata_values, false},
+    {"ssl_zero_copy_protector", description_ssl_zero_copy_protector, false},
+    {"compiled_rbac", description_compiled_rbac, false},
 };
 
 }  // namespace grpc_core
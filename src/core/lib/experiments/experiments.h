@@ -74,6 +74,12 @@ inline bool IsFreeLargeAllocatorEnabled() { return false; }
 inline bool IsPromiseBasedServerCallEnabled() { return false; }
 inline bool IsTransportSuppliesClientLatencyEnabled() { return false; }
 inline bool IsEventEngineListenerEnabled() { return false; }
+inline bool IsSlicePoolEnabled() { return false; }
+inline bool IsWakeupRunQueueEnabled() { return false; }
+inline bool IsCoalesceHeaderSlicesEnabled() { return false; }
+inline bool IsInternMetadataValuesEnabled() { return false; }
+inline bool IsSslZeroCopyProtectorEnabled() { return false; }
+inline bool IsCompiledRbacEnabled() { return false; }
 #else
 #define GRPC_EXPERIMENT_IS_INCLUDED_TCP_FRAME_SIZE_TUNING
 inline bool IsTcpFrameSizeTuningEnabled() { return IsExperimentEnabled(0); }
@@ -111,8 +117,20 @@ inline bool IsTransportSuppliesClientLatencyEnabled() {
 }
 #define GRPC_EXPERIMENT_IS_INCLUDED_EVENT_ENGINE_LISTENER
 inline bool IsEventEngineListenerEnabled() { return IsExperimentEnabled(13); }
+#define GRPC_EXPERIMENT_IS_INCLUDED_SLICE_POOL
+inline bool IsSlicePoolEnabled() { return IsExperimentEnabled(14); }
+#define GRPC_EXPERIMENT_IS_INCLUDED_WAKEUP_RUN_QUEUE
+inline bool IsWakeupRunQueueEnabled() { return IsExperimentEnabled(15); }
+#define GRPC_EXPERIMENT_IS_INCLUDED_COALESCE_HEADER_SLICES
+inline bool IsCoalesceHeaderSlicesEnabled() { return IsExperimentEnabled(16); }
+#define GRPC_EXPERIMENT_IS_INCLUDED_INTERN_METADATA_VALUES
+inline bool IsInternMetadataValuesEnabled() { return IsExperimentEnabled(17); }
+#define GRPC_EXPERIMENT_IS_INCLUDED_SSL_ZERO_COPY_PROTECTOR
+inline bool IsSslZeroCopyProtectorEnabled() { return IsExperimentEnabled(18); }
+#define GRPC_EXPERIMENT_IS_INCLUDED_COMPILED_RBAC
+inline bool IsCompiledRbacEnabled() { return IsExperimentEnabled(19); }
 
-constexpr const size_t kNumExperiments = 14;
+constexpr const size_t kNumExperiments = 20;
 extern const ExperimentMetadata g_experiment_metadata[kNumExperiments];
 
 #endif
@@ -55,6 +55,11 @@
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
 #define GRPC_LINUX_ERRQUEUE 1
 #endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
+// TLS 1.3 and AES-256-GCM support in kTLS were added in 5.1. Whether the
+// running kernel has the "tls" module is only known at run time.
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 1, 0)
+#define GRPC_LINUX_KTLS 1
+#endif  // LINUX_VERSION_CODE >= KERNEL_VERSION(5, 1, 0)
 #endif  // LINUX_VERSION_CODE
 #define GRPC_LINUX_MULTIPOLL_WITH_EPOLL 1
 #define GRPC_POSIX_FORK 1
@@ -68,6 +68,7 @@
 #include "src/core/lib/resource_quota/api.h"
 #include "src/core/lib/resource_quota/memory_quota.h"
 #include "src/core/lib/resource_quota/trace.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 
@@ -1065,15 +1066,16 @@ static void maybe_make_read_slices(grpc_tcp* tcp)
         (low_memory_pressure ? kSmallAlloc * 3 / 2 : kBigAlloc)) {
       while (extra_wanted > 0) {
         extra_wanted -= kBigAlloc;
-        grpc_slice_buffer_add_indexed(tcp->incoming_buffer,
-                                      tcp->memory_owner.MakeSlice(kBigAlloc));
+        grpc_slice_buffer_add_indexed(
+            tcp->incoming_buffer, tcp->memory_owner.MakePooledSlice(kBigAlloc));
         grpc_core::global_stats().IncrementTcpReadAlloc64k();
       }
     } else {
       while (extra_wanted > 0) {
         extra_wanted -= kSmallAlloc;
-        grpc_slice_buffer_add_indexed(tcp->incoming_buffer,
-                                      tcp->memory_owner.MakeSlice(kSmallAlloc));
+        grpc_slice_buffer_add_indexed(
+            tcp->incoming_buffer,
+            tcp->memory_owner.MakePooledSlice(kSmallAlloc));
         grpc_core::global_stats().IncrementTcpReadAlloc8k();
       }
     }
@@ -1503,22 +1505,13 @@ msg_iovlen_type TcpZerocopySendRecord::PopulateIovs(size_t* unwind_slice_idx,
                                                     size_t* unwind_byte_idx,
                                                     size_t* sending_length,
                                                     iovec* iov) {
-  msg_iovlen_type iov_size;
   *unwind_slice_idx = out_offset_.slice_idx;
   *unwind_byte_idx = out_offset_.byte_idx;
-  for (iov_size = 0;
-       out_offset_.slice_idx != buf_.count && iov_size != MAX_WRITE_IOVEC;
-       iov_size++) {
-    iov[iov_size].iov_base =
-        GRPC_SLICE_START_PTR(buf_.slices[out_offset_.slice_idx]) +
-        out_offset_.byte_idx;
-    iov[iov_size].iov_len =
-        GRPC_SLICE_LENGTH(buf_.slices[out_offset_.slice_idx]) -
-        out_offset_.byte_idx;
-    *sending_length += iov[iov_size].iov_len;
-    ++(out_offset_.slice_idx);
-    out_offset_.byte_idx = 0;
-  }
+  msg_iovlen_type iov_size = static_cast<msg_iovlen_type>(
+      grpc_core::SliceBufferToIoVecs(&buf_, &out_offset_.slice_idx,
+                                     out_offset_.byte_idx, iov,
+                                     MAX_WRITE_IOVEC, sending_length));
+  out_offset_.byte_idx = 0;
   GPR_DEBUG_ASSERT(iov_size > 0);
   return iov_size;
 }
@@ -1657,20 +1650,10 @@ static bool tcp_flush(grpc_tcp* tcp, grpc_error_handle* error) {
     sending_length = 0;
     unwind_slice_idx = outgoing_slice_idx;
     unwind_byte_idx = tcp->outgoing_byte_idx;
-    for (iov_size = 0; outgoing_slice_idx != tcp->outgoing_buffer->count &&
-                       iov_size != MAX_WRITE_IOVEC;
-         iov_size++) {
-      iov[iov_size].iov_base =
-          GRPC_SLICE_START_PTR(
-              tcp->outgoing_buffer->slices[outgoing_slice_idx]) +
-          tcp->outgoing_byte_idx;
-      iov[iov_size].iov_len =
-          GRPC_SLICE_LENGTH(tcp->outgoing_buffer->slices[outgoing_slice_idx]) -
-          tcp->outgoing_byte_idx;
-      sending_length += iov[iov_size].iov_len;
-      outgoing_slice_idx++;
-      tcp->outgoing_byte_idx = 0;
-    }
+    iov_size = static_cast<msg_iovlen_type>(grpc_core::SliceBufferToIoVecs(
+        tcp->outgoing_buffer, &outgoing_slice_idx, tcp->outgoing_byte_idx, iov,
+        MAX_WRITE_IOVEC, &sending_length));
+    tcp->outgoing_byte_idx = 0;
     GPR_ASSERT(iov_size > 0);
 
     msg.msg_name = nullptr;
@@ -16,6 +16,7 @@
 
 #include "src/core/lib/json/json_object_loader.h"
 
+#include <string>
 #include <utility>
 
 #include "absl/strings/ascii.h"
@@ -25,8 +26,84 @@
 namespace grpc_core {
 namespace json_detail {
 
+namespace {
+
+// These let the loaders below be written once for both Json and JsonView.
+
+const std::string& MemberKey(const Json::Object::value_type& member) {
+  return member.first;
+}
+const Json& MemberValue(const Json::Object::value_type& member) {
+  return member.second;
+}
+std::string MemberKey(const JsonView::Member& member) {
+  return std::string(member.key);
+}
+const JsonView& MemberValue(const JsonView::Member& member) {
+  return member.value;
+}
+
+const Json* FindMember(const Json& json, const char* name) {
+  auto it = json.object_value().find(name);
+  if (it == json.object_value().end()) return nullptr;
+  return &it->second;
+}
+const JsonView* FindMember(const JsonView& json, const char* name) {
+  return json.Find(name);
+}
+
+Json::Object CopyObject(const Json& json) { return json.object_value(); }
+Json::Object CopyObject(const JsonView& json) {
+  return std::move(*json.ToJson().mutable_object());
+}
+
+Json::Array CopyArray(const Json& json) { return json.array_value(); }
+Json::Array CopyArray(const JsonView& json) {
+  return std::move(*json.ToJson().mutable_array());
+}
+
+template <typename JsonType>
+bool LoadObjectImpl(const JsonType& json, const JsonArgs& args,
+                    const Element* elements, size_t num_elements, void* dst,
+                    ValidationErrors* errors) {
+  if (json.type() != Json::Type::OBJECT) {
+    errors->AddError("is not an object");
+    return false;
+  }
+  for (size_t i = 0; i < num_elements; ++i) {
+    const Element& element = elements[i];
+    if (element.enable_key != nullptr && !args.IsEnabled(element.enable_key)) {
+      continue;
+    }
+    ValidationErrors::ScopedField field(errors,
+                                        absl::StrCat(".", element.name));
+    const JsonType* field_json = FindMember(json, element.name);
+    if (field_json == nullptr) {
+      if (element.optional) continue;
+      errors->AddError("field not present");
+      continue;
+    }
+    char* field_dst = static_cast<char*>(dst) + element.member_offset;
+    element.loader->LoadInto(*field_json, args, field_dst, errors);
+  }
+  return true;
+}
+
+}  // namespace
+
 void LoadScalar::LoadInto(const Json& json, const JsonArgs& /*args*/, void* dst,
                           ValidationErrors* errors) const {
+  LoadJson(json, dst, errors);
+}
+
+void LoadScalar::LoadInto(const JsonView& json, const JsonArgs& /*args*/,
+                          void* dst, ValidationErrors* errors) const {
+  LoadJson(json, dst, errors);
+}
+
+template <typename JsonType>
+void LoadScalar::LoadJson(const JsonType& json, void* dst,
+                          ValidationErrors* errors) const {
   // We accept either STRING or NUMBER for numeric values, as per
   // https://developers.google.com/protocol-buffers/docs/proto3#json.
   if (json.type() != Json::Type::STRING &&
@@ -40,14 +117,14 @@ void LoadScalar::LoadInto(const Json& json, const JsonArgs& /*args*/, void* dst,
 
 bool LoadString::IsNumber() const { return false; }
 
-void LoadString::LoadInto(const std::string& value, void* dst,
+void LoadString::LoadInto(absl::string_view value, void* dst,
                           ValidationErrors*) const {
-  *static_cast<std::string*>(dst) = value;
+  *static_cast<std::string*>(dst) = std::string(value);
 }
 
 bool LoadDuration::IsNumber() const { return false; }
 
-void LoadDuration::LoadInto(const std::string& value, void* dst,
+void LoadDuration::LoadInto(absl::string_view value, void* dst,
                             ValidationErrors* errors) const {
   absl::string_view buf(value);
   if (!absl::ConsumeSuffix(&buf, "s")) {
@@ -91,6 +168,17 @@ bool LoadNumber::IsNumber() const { return true; }
 
 void LoadBool::LoadInto(const Json& json, const JsonArgs&, void* dst,
                         ValidationErrors* errors) const {
+  LoadJson(json, dst, errors);
+}
+
+void LoadBool::LoadInto(const JsonView& json, const JsonArgs&, void* dst,
+                        ValidationErrors* errors) const {
+  LoadJson(json, dst, errors);
+}
+
+template <typename JsonType>
+void LoadBool::LoadJson(const JsonType& json, void* dst,
+                        ValidationErrors* errors) const {
   if (json.type() == Json::Type::JSON_TRUE) {
     *static_cast<bool*>(dst) = true;
   } else if (json.type() == Json::Type::JSON_FALSE) {
@@ -103,25 +191,60 @@ void LoadBool::LoadInto(const Json& json, const JsonArgs&, void* dst,
 void LoadUnprocessedJsonObject::LoadInto(const Json& json, const JsonArgs&,
                                          void* dst,
                                          ValidationErrors* errors) const {
+  LoadJson(json, dst, errors);
+}
+
+void LoadUnprocessedJsonObject::LoadInto(const JsonView& json,
+                                         const JsonArgs&, void* dst,
+                                         ValidationErrors* errors) const {
+  LoadJson(json, dst, errors);
+}
+
+template <typename JsonType>
+void LoadUnprocessedJsonObject::LoadJson(const JsonType& json, void* dst,
+                                         ValidationErrors* errors) const {
   if (json.type() != Json::Type::OBJECT) {
     errors->AddError("is not an object");
     return;
   }
-  *static_cast<Json::Object*>(dst) = json.object_value();
+  *static_cast<Json::Object*>(dst) = CopyObject(json);
 }
 
 void LoadUnprocessedJsonArray::LoadInto(const Json& json, const JsonArgs&,
                                         void* dst,
                                         ValidationErrors* errors) const {
+  LoadJson(json, dst, errors);
+}
+
+void LoadUnprocessedJsonArray::LoadInto(const JsonView& json, const JsonArgs&,
+                                        void* dst,
+                                        ValidationErrors* errors) const {
+  LoadJson(json, dst, errors);
+}
+
+template <typename JsonType>
+void LoadUnprocessedJsonArray::LoadJson(const JsonType& json, void* dst,
+                                        ValidationErrors* errors) const {
   if (json.type() != Json::Type::ARRAY) {
     errors->AddError("is not an array");
     return;
   }
-  *static_cast<Json::Array*>(dst) = json.array_value();
+  *static_cast<Json::Array*>(dst) = CopyArray(json);
 }
 
 void LoadVector::LoadInto(const Json& json, const JsonArgs& args, void* dst,
                           ValidationErrors* errors) const {
+  LoadJson(json, args, dst, errors);
+}
+
+void LoadVector::LoadInto(const JsonView& json, const JsonArgs& args,
+                          void* dst, ValidationErrors* errors) const {
+  LoadJson(json, args, dst, errors);
+}
+
+template <typename JsonType>
+void LoadVector::LoadJson(const JsonType& json, const JsonArgs& args,
+                          void* dst, ValidationErrors* errors) const {
   if (json.type() != Json::Type::ARRAY) {
     errors->AddError("is not an array");
     return;
@@ -138,6 +261,19 @@ void LoadVector::LoadInto(const Json& json, const JsonArgs& args, void* dst,
 void AutoLoader<std::vector<bool>>::LoadInto(const Json& json,
                                              const JsonArgs& args, void* dst,
                                              ValidationErrors* errors) const {
+  LoadJson(json, args, dst, errors);
+}
+
+void AutoLoader<std::vector<bool>>::LoadInto(const JsonView& json,
+                                             const JsonArgs& args, void* dst,
+                                             ValidationErrors* errors) const {
+  LoadJson(json, args, dst, errors);
+}
+
+template <typename JsonType>
+void AutoLoader<std::vector<bool>>::LoadJson(const JsonType& json,
+                                             const JsonArgs& args, void* dst,
+                                             ValidationErrors* errors) const {
   if (json.type() != Json::Type::ARRAY) {
     errors->AddError("is not an array");
     return;
@@ -155,21 +291,44 @@ void AutoLoader<std::vector<bool>>::LoadInto(const Json& json,
 
 void LoadMap::LoadInto(const Json& json, const JsonArgs& args, void* dst,
                        ValidationErrors* errors) const {
+  LoadJson(json, args, dst, errors);
+}
+
+void LoadMap::LoadInto(const JsonView& json, const JsonArgs& args, void* dst,
+                       ValidationErrors* errors) const {
+  LoadJson(json, args, dst, errors);
+}
+
+template <typename JsonType>
+void LoadMap::LoadJson(const JsonType& json, const JsonArgs& args, void* dst,
+                       ValidationErrors* errors) const {
   if (json.type() != Json::Type::OBJECT) {
     errors->AddError("is not an object");
     return;
   }
   const LoaderInterface* element_loader = ElementLoader();
-  for (const auto& pair : json.object_value()) {
+  for (const auto& member : json.object_value()) {
+    const auto& key = MemberKey(member);
     ValidationErrors::ScopedField field(errors,
-                                        absl::StrCat("[\"", pair.first, "\"]"));
-    void* element = Insert(pair.first, dst);
-    element_loader->LoadInto(pair.second, args, element, errors);
+                                        absl::StrCat("[\"", key, "\"]"));
+    void* element = Insert(key, dst);
+    element_loader->LoadInto(MemberValue(member), args, element, errors);
   }
 }
 
 void LoadOptional::LoadInto(const Json& json, const JsonArgs& args, void* dst,
                             ValidationErrors* errors) const {
+  LoadJson(json, args, dst, errors);
+}
+
+void LoadOptional::LoadInto(const JsonView& json, const JsonArgs& args,
+                            void* dst, ValidationErrors* errors) const {
+  LoadJson(json, args, dst, errors);
+}
+
+template <typename JsonType>
+void LoadOptional::LoadJson(const JsonType& json, const JsonArgs& args,
+                            void* dst, ValidationErrors* errors) const {
   if (json.type() == Json::Type::JSON_NULL) return;
   void* element = Emplace(dst);
   size_t starting_error_size = errors->size();
@@ -179,27 +338,13 @@ void LoadOptional::LoadInto(const Json& json, const JsonArgs& args, void* dst,
 
 bool LoadObject(const Json& json, const JsonArgs& args, const Element* elements,
                 size_t num_elements, void* dst, ValidationErrors* errors) {
-  if (json.type() != Json::Type::OBJECT) {
-    errors->AddError("is not an object");
-    return false;
-  }
-  for (size_t i = 0; i < num_elements; ++i) {
-    const Element& element = elements[i];
-    if (element.enable_key != nullptr && !args.IsEnabled(element.enable_key)) {
-      continue;
-    }
-    ValidationErrors::ScopedField field(errors,
-                                        absl::StrCat(".", element.name));
-    const auto& it = json.object_value().find(element.name);
-    if (it == json.object_value().end()) {
-      if (element.optional) continue;
-      errors->AddError("field not present");
-      continue;
-    }
-    char* field_dst = static_cast<char*>(dst) + element.member_offset;
-    element.loader->LoadInto(it->second, args, field_dst, errors);
-  }
-  return true;
+  return LoadObjectImpl(json, args, elements, num_elements, dst, errors);
+}
+
+bool LoadObject(const JsonView& json, const JsonArgs& args,
+                const Element* elements, size_t num_elements, void* dst,
+                ValidationErrors* errors) {
+  return LoadObjectImpl(json, args, elements, num_elements, dst, errors);
 }
 
 const Json* GetJsonObjectField(const Json::Object& json,
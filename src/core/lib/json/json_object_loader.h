@@ -38,6 +38,7 @@
 #include "src/core/lib/gprpp/validation_errors.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/json/json_args.h"
+#include "src/core/lib/json/json_view.h"
 
 // Provides a means to load JSON objects into C++ objects, with the aim of
 // minimizing object code size.
@@ -70,6 +71,8 @@
 //   };
 // Now we can load Foo objects from JSON:
 //   absl::StatusOr<Foo> foo = LoadFromJson<Foo>(json);
+// json may be either a Json or a JsonView.  When loading from a JsonView,
+// JsonPostLoad() is given a Json copy of the object it was loaded from.
 namespace grpc_core {
 
 namespace json_detail {
@@ -81,6 +84,8 @@ class LoaderInterface {
   // If errors occur, add them to errors.
   virtual void LoadInto(const Json& json, const JsonArgs& args, void* dst,
                         ValidationErrors* errors) const = 0;
+  virtual void LoadInto(const JsonView& json, const JsonArgs& args, void* dst,
+                        ValidationErrors* errors) const = 0;
 
  protected:
   ~LoaderInterface() = default;
@@ -91,17 +96,23 @@ class LoadScalar : public LoaderInterface {
  public:
   void LoadInto(const Json& json, const JsonArgs& args, void* dst,
                 ValidationErrors* errors) const override;
+  void LoadInto(const JsonView& json, const JsonArgs& args, void* dst,
+                ValidationErrors* errors) const override;
 
  protected:
   ~LoadScalar() = default;
 
  private:
+  template <typename JsonType>
+  void LoadJson(const JsonType& json, void* dst,
+                ValidationErrors* errors) const;
+
   // true if we're loading a number, false if we're loading a string.
   // We use a virtual function to store this decision in a vtable instead of
   // needing an instance variable.
   virtual bool IsNumber() const = 0;
 
-  virtual void LoadInto(const std::string& json, void* dst,
+  virtual void LoadInto(absl::string_view value, void* dst,
                         ValidationErrors* errors) const = 0;
 };
 
@@ -112,7 +123,7 @@ class LoadString : public LoadScalar {
 
  private:
   bool IsNumber() const override;
-  void LoadInto(const std::string& value, void* dst,
+  void LoadInto(absl::string_view value, void* dst,
                 ValidationErrors* errors) const override;
 };
 
@@ -123,7 +134,7 @@ class LoadDuration : public LoadScalar {
 
  private:
   bool IsNumber() const override;
-  void LoadInto(const std::string& value, void* dst,
+  void LoadInto(absl::string_view value, void* dst,
                 ValidationErrors* errors) const override;
 };
 
@@ -143,7 +154,7 @@ class TypedLoadSignedNumber : public LoadNumber {
   ~TypedLoadSignedNumber() = default;
 
  private:
-  void LoadInto(const std::string& value, void* dst,
+  void LoadInto(absl::string_view value, void* dst,
                 ValidationErrors* errors) const override {
     if (!absl::SimpleAtoi(value, static_cast<T*>(dst))) {
       errors->AddError("failed to parse number");
@@ -158,7 +169,7 @@ class TypedLoadUnsignedNumber : public LoadNumber {
   ~TypedLoadUnsignedNumber() = default;
 
  private:
-  void LoadInto(const std::string& value, void* dst,
+  void LoadInto(absl::string_view value, void* dst,
                 ValidationErrors* errors) const override {
     if (!absl::SimpleAtoi(value, static_cast<T*>(dst))) {
       errors->AddError("failed to parse non-negative number");
@@ -172,7 +183,7 @@ class LoadFloat : public LoadNumber {
   ~LoadFloat() = default;
 
  private:
-  void LoadInto(const std::string& value, void* dst,
+  void LoadInto(absl::string_view value, void* dst,
                 ValidationErrors* errors) const override {
     if (!absl::SimpleAtof(value, static_cast<float*>(dst))) {
       errors->AddError("failed to parse floating-point number");
@@ -186,7 +197,7 @@ class LoadDouble : public LoadNumber {
   ~LoadDouble() = default;
 
  private:
-  void LoadInto(const std::string& value, void* dst,
+  void LoadInto(absl::string_view value, void* dst,
                 ValidationErrors* errors) const override {
     if (!absl::SimpleAtod(value, static_cast<double*>(dst))) {
       errors->AddError("failed to parse floating-point number");
@@ -199,9 +210,16 @@ class LoadBool : public LoaderInterface {
  public:
   void LoadInto(const Json& json, const JsonArgs& /*args*/, void* dst,
                 ValidationErrors* errors) const override;
+  void LoadInto(const JsonView& json, const JsonArgs& /*args*/, void* dst,
+                ValidationErrors* errors) const override;
 
  protected:
   ~LoadBool() = default;
+
+ private:
+  template <typename JsonType>
+  void LoadJson(const JsonType& json, void* dst,
+                ValidationErrors* errors) const;
 };
 
 // Loads an unprocessed JSON object value.
@@ -209,9 +227,16 @@ class LoadUnprocessedJsonObject : public LoaderInterface {
  public:
   void LoadInto(const Json& json, const JsonArgs& /*args*/, void* dst,
                 ValidationErrors* errors) const override;
+  void LoadInto(const JsonView& json, const JsonArgs& /*args*/, void* dst,
+                ValidationErrors* errors) const override;
 
  protected:
   ~LoadUnprocessedJsonObject() = default;
+
+ private:
+  template <typename JsonType>
+  void LoadJson(const JsonType& json, void* dst,
+                ValidationErrors* errors) const;
 };
 
 // Loads an unprocessed JSON array value.
@@ -219,9 +244,16 @@ class LoadUnprocessedJsonArray : public LoaderInterface {
  public:
   void LoadInto(const Json& json, const JsonArgs& /*args*/, void* dst,
                 ValidationErrors* errors) const override;
+  void LoadInto(const JsonView& json, const JsonArgs& /*args*/, void* dst,
+                ValidationErrors* errors) const override;
 
  protected:
   ~LoadUnprocessedJsonArray() = default;
+
+ private:
+  template <typename JsonType>
+  void LoadJson(const JsonType& json, void* dst,
+                ValidationErrors* errors) const;
 };
 
 // Load a vector of some type.
@@ -229,11 +261,17 @@ class LoadVector : public LoaderInterface {
  public:
   void LoadInto(const Json& json, const JsonArgs& args, void* dst,
                 ValidationErrors* errors) const override;
+  void LoadInto(const JsonView& json, const JsonArgs& args, void* dst,
+                ValidationErrors* errors) const override;
 
  protected:
   ~LoadVector() = default;
 
  private:
+  template <typename JsonType>
+  void LoadJson(const JsonType& json, const JsonArgs& args, void* dst,
+                ValidationErrors* errors) const;
+
   virtual void* EmplaceBack(void* dst) const = 0;
   virtual const LoaderInterface* ElementLoader() const = 0;
 };
@@ -243,11 +281,17 @@ class LoadMap : public LoaderInterface {
  public:
   void LoadInto(const Json& json, const JsonArgs& args, void* dst,
                 ValidationErrors* errors) const override;
+  void LoadInto(const JsonView& json, const JsonArgs& args, void* dst,
+                ValidationErrors* errors) const override;
 
  protected:
   ~LoadMap() = default;
 
  private:
+  template <typename JsonType>
+  void LoadJson(const JsonType& json, const JsonArgs& args, void* dst,
+                ValidationErrors* errors) const;
+
   virtual void* Insert(const std::string& name, void* dst) const = 0;
   virtual const LoaderInterface* ElementLoader() const = 0;
 };
@@ -257,11 +301,17 @@ class LoadOptional : public LoaderInterface {
  public:
   void LoadInto(const Json& json, const JsonArgs& args, void* dst,
                 ValidationErrors* errors) const override;
+  void LoadInto(const JsonView& json, const JsonArgs& args, void* dst,
+                ValidationErrors* errors) const override;
 
  protected:
   ~LoadOptional() = default;
 
  private:
+  template <typename JsonType>
+  void LoadJson(const JsonType& json, const JsonArgs& args, void* dst,
+                ValidationErrors* errors) const;
+
   virtual void* Emplace(void* dst) const = 0;
   virtual void Reset(void* dst) const = 0;
   virtual const LoaderInterface* ElementLoader() const = 0;
@@ -282,6 +332,10 @@ class AutoLoader final : public LoaderInterface {
                 ValidationErrors* errors) const override {
     T::JsonLoader(args)->LoadInto(json, args, dst, errors);
   }
+  void LoadInto(const JsonView& json, const JsonArgs& args, void* dst,
+                ValidationErrors* errors) const override {
+    T::JsonLoader(args)->LoadInto(json, args, dst, errors);
+  }
 
  private:
   ~AutoLoader() = default;
@@ -368,9 +422,15 @@ class AutoLoader<std::vector<bool>> final : public LoaderInterface {
  public:
   void LoadInto(const Json& json, const JsonArgs& args, void* dst,
                 ValidationErrors* errors) const override;
+  void LoadInto(const JsonView& json, const JsonArgs& args, void* dst,
+                ValidationErrors* errors) const override;
 
  private:
   ~AutoLoader() = default;
+
+  template <typename JsonType>
+  void LoadJson(const JsonType& json, const JsonArgs& args, void* dst,
+                ValidationErrors* errors) const;
 };
 
 // Specializations of AutoLoader for maps.
@@ -488,6 +548,9 @@ class Vec<T, 0> {
 // Returns false if the JSON object was not of type Json::Type::OBJECT.
 bool LoadObject(const Json& json, const JsonArgs& args, const Element* elements,
                 size_t num_elements, void* dst, ValidationErrors* errors);
+bool LoadObject(const JsonView& json, const JsonArgs& args,
+                const Element* elements, size_t num_elements, void* dst,
+                ValidationErrors* errors);
 
 // Adaptor type - takes a compile time computed list of elements and
 // implements LoaderInterface by calling LoadObject.
@@ -501,6 +564,10 @@ class FinishedJsonObjectLoader final : public LoaderInterface {
                 ValidationErrors* errors) const override {
     LoadObject(json, args, elements_.data(), elements_.size(), dst, errors);
   }
+  void LoadInto(const JsonView& json, const JsonArgs& args, void* dst,
+                ValidationErrors* errors) const override {
+    LoadObject(json, args, elements_.data(), elements_.size(), dst, errors);
+  }
 
  private:
   GPR_NO_UNIQUE_ADDRESS Vec<Element, kElemCount> elements_;
@@ -523,6 +590,13 @@ class FinishedJsonObjectLoader<T, kElemCount,
       static_cast<T*>(dst)->JsonPostLoad(json, args, errors);
     }
   }
+  void LoadInto(const JsonView& json, const JsonArgs& args, void* dst,
+                ValidationErrors* errors) const override {
+    if (LoadObject(json, args, elements_.data(), elements_.size(), dst,
+                   errors)) {
+      static_cast<T*>(dst)->JsonPostLoad(json.ToJson(), args, errors);
+    }
+  }
 
  private:
   GPR_NO_UNIQUE_ADDRESS Vec<Element, kElemCount> elements_;
@@ -593,6 +667,17 @@ absl::StatusOr<T> LoadFromJson(
   return std::move(result);
 }
 
+template <typename T>
+absl::StatusOr<T> LoadFromJson(
+    const JsonView& json, const JsonArgs& args = JsonArgs(),
+    absl::string_view error_prefix = "errors validating JSON") {
+  ValidationErrors errors;
+  T result{};
+  json_detail::LoaderForType<T>()->LoadInto(json, args, &result, &errors);
+  if (!errors.ok()) return errors.status(error_prefix);
+  return std::move(result);
+}
+
 template <typename T>
 absl::StatusOr<RefCountedPtr<T>> LoadRefCountedFromJson(
     const Json& json, const JsonArgs& args = JsonArgs(),
@@ -604,6 +689,17 @@ absl::StatusOr<RefCountedPtr<T>> LoadRefCountedFromJson(
   return std::move(result);
 }
 
+template <typename T>
+absl::StatusOr<RefCountedPtr<T>> LoadRefCountedFromJson(
+    const JsonView& json, const JsonArgs& args = JsonArgs(),
+    absl::string_view error_prefix = "errors validating JSON") {
+  ValidationErrors errors;
+  auto result = MakeRefCounted<T>();
+  json_detail::LoaderForType<T>()->LoadInto(json, args, result.get(), &errors);
+  if (!errors.ok()) return errors.status(error_prefix);
+  return std::move(result);
+}
+
 template <typename T>
 T LoadFromJson(const Json& json, const JsonArgs& args,
                ValidationErrors* errors) {
@@ -612,6 +708,14 @@ T LoadFromJson(const Json& json, const JsonArgs& args,
   return result;
 }
 
+template <typename T>
+T LoadFromJson(const JsonView& json, const JsonArgs& args,
+               ValidationErrors* errors) {
+  T result{};
+  json_detail::LoaderForType<T>()->LoadInto(json, args, &result, errors);
+  return result;
+}
+
 template <typename T>
 absl::optional<T> LoadJsonObjectField(const Json::Object& json,
                                       const JsonArgs& args,
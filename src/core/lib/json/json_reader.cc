@@ -18,10 +18,12 @@
 
 #include <inttypes.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <algorithm>
 #include <initializer_list>
 #include <map>
+#include <new>
 #include <string>
 #include <utility>
 #include <vector>
@@ -37,6 +39,8 @@
 #include <grpc/support/log.h>
 
 #include "src/core/lib/json/json.h"
+#include "src/core/lib/json/json_view.h"
+#include "src/core/lib/resource_quota/arena.h"
 
 #define GRPC_JSON_MAX_DEPTH 255
 #define GRPC_JSON_MAX_ERRORS 16
@@ -45,9 +49,41 @@ namespace grpc_core {
 
 namespace {
 
+// A strict ECMA-404 parser.  Builder derives from JsonReader<Builder> and
+// builds the values it reads into a tree, by providing
+//   void StartContainer(Json::Type type);
+//   void EndContainer();
+//   void SetKey();
+//   void SetString();
+//   bool SetNumber();
+//   void SetTrue();
+//   void SetFalse();
+//   void SetNull();
+//   void Finish();  // Called once the whole input has been read.
+// which take keys, strings and numbers from CurrentString().
+template <typename Builder>
 class JsonReader {
- public:
-  static absl::StatusOr<Json> Parse(absl::string_view input);
+ protected:
+  explicit JsonReader(absl::string_view input)
+      : original_input_(reinterpret_cast<const uint8_t*>(input.data())),
+        input_(original_input_),
+        remaining_input_(input.size()) {}
+
+  // Reads the whole input, returning any errors found.
+  absl::Status Read();
+
+  size_t CurrentIndex() const { return input_ - original_input_ - 1; }
+
+  // The key, string or number that was just read.  Unless it had escapes,
+  // this points into the input instead of being copied.
+  absl::string_view CurrentString() const {
+    if (string_escaped_) return string_;
+    return absl::string_view(reinterpret_cast<const char*>(string_start_),
+                             string_size_);
+  }
+  bool CurrentStringIsInInput() const { return !string_escaped_; }
+
+  void AddDuplicateKeyError(absl::string_view key, size_t index);
 
  private:
   enum class Status {
@@ -93,29 +129,22 @@ class JsonReader {
   //
   static constexpr uint32_t GRPC_JSON_READ_CHAR_EOF = 0x7ffffff0;
 
-  explicit JsonReader(absl::string_view input)
-      : original_input_(reinterpret_cast<const uint8_t*>(input.data())),
-        input_(original_input_),
-        remaining_input_(input.size()) {}
+  Builder* builder() { return static_cast<Builder*>(this); }
 
   Status Run();
   uint32_t ReadChar();
+  size_t PlainStringPrefixLength() const;
   bool IsComplete();
 
-  size_t CurrentIndex() const { return input_ - original_input_ - 1; }
+  void AddError(std::string error);
 
+  void BeginString(const uint8_t* start);
+  void EscapeString();
   GRPC_MUST_USE_RESULT bool StringAddChar(uint32_t c);
   GRPC_MUST_USE_RESULT bool StringAddUtf32(uint32_t c);
 
-  Json* CreateAndLinkValue();
-  bool StartContainer(Json::Type type);
-  void EndContainer();
-  void SetKey();
-  void SetString();
-  bool SetNumber();
-  void SetTrue();
-  void SetFalse();
-  void SetNull();
+  bool PushContainer(Json::Type type);
+  void PopContainer();
 
   const uint8_t* original_input_;
   const uint8_t* input_;
@@ -128,17 +157,24 @@ class JsonReader {
   uint16_t unicode_high_surrogate_ = 0;
   std::vector<std::string> errors_;
   bool truncated_errors_ = false;
+  bool exceeded_max_depth_ = false;
   uint8_t utf8_bytes_remaining_ = 0;
   uint8_t utf8_first_byte_ = 0;
 
-  Json root_value_;
-  std::vector<Json*> stack_;
+  // The types of the containers being read, innermost last.
+  std::vector<Json::Type> stack_;
 
-  std::string key_;
+  // The current string starts at string_start_ in the input and runs for
+  // string_size_ bytes, until it has an escape.  From then on it is built
+  // in string_.
+  const uint8_t* string_start_ = nullptr;
+  size_t string_size_ = 0;
+  bool string_escaped_ = false;
   std::string string_;
 };
 
-bool JsonReader::StringAddChar(uint32_t c) {
+template <typename Builder>
+bool JsonReader<Builder>::StringAddChar(uint32_t c) {
   if (utf8_bytes_remaining_ == 0) {
     if ((c & 0x80) == 0) {
       utf8_bytes_remaining_ = 0;
@@ -189,11 +225,16 @@ bool JsonReader::StringAddChar(uint32_t c) {
     abort();
   }
 
-  string_.push_back(static_cast<uint8_t>(c));
+  if (string_escaped_) {
+    string_.push_back(static_cast<uint8_t>(c));
+  } else {
+    ++string_size_;
+  }
   return true;
 }
 
-bool JsonReader::StringAddUtf32(uint32_t c) {
+template <typename Builder>
+bool JsonReader<Builder>::StringAddUtf32(uint32_t c) {
   if (c <= 0x7f) {
     return StringAddChar(c);
   } else if (c <= 0x7ff) {
@@ -217,7 +258,8 @@ bool JsonReader::StringAddUtf32(uint32_t c) {
   }
 }
 
-uint32_t JsonReader::ReadChar() {
+template <typename Builder>
+uint32_t JsonReader<Builder>::ReadChar() {
   if (remaining_input_ == 0) return GRPC_JSON_READ_CHAR_EOF;
   const uint32_t r = *input_++;
   --remaining_input_;
@@ -228,91 +270,90 @@ uint32_t JsonReader::ReadChar() {
   return r;
 }
 
-Json* JsonReader::CreateAndLinkValue() {
-  Json* value;
-  if (stack_.empty()) {
-    value = &root_value_;
-  } else {
-    Json* parent = stack_.back();
-    if (parent->type() == Json::Type::OBJECT) {
-      if (parent->object_value().find(key_) != parent->object_value().end()) {
-        if (errors_.size() == GRPC_JSON_MAX_ERRORS) {
-          truncated_errors_ = true;
-        } else {
-          errors_.push_back(absl::StrFormat(
-              "duplicate key \"%s\" at index %" PRIuPTR, key_, CurrentIndex()));
-        }
-      }
-      value = &(*parent->mutable_object())[std::move(key_)];
-    } else {
-      GPR_ASSERT(parent->type() == Json::Type::ARRAY);
-      parent->mutable_array()->emplace_back();
-      value = &parent->mutable_array()->back();
-    }
+// Returns how many of the next input bytes can be appended to a string
+// as-is: printable ASCII other than '"' and '\\'. Anything else needs the
+// state machine (escapes, UTF-8 validation, errors). Strings make up most
+// of large configs, so this scans a word at a time.
+template <typename Builder>
+size_t JsonReader<Builder>::PlainStringPrefixLength() const {
+  constexpr uint64_t kOnes = 0x0101010101010101u;
+  constexpr uint64_t kHighBits = 0x8080808080808080u;
+  size_t n = 0;
+  for (; n + sizeof(uint64_t) <= remaining_input_; n += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, input_ + n, sizeof(word));
+    const uint64_t quote = word ^ (kOnes * '"');
+    const uint64_t backslash = word ^ (kOnes * '\\');
+    // Sets the high bit of some byte iff the word has a zero byte in quote
+    // or backslash (i.e. a '"' or '\\'), a byte below 0x20 or a non-ASCII
+    // byte.
+    const uint64_t special = ((quote - kOnes) & ~quote) |
+                             ((backslash - kOnes) & ~backslash) |
+                             ((word - kOnes * 0x20) & ~word) | word;
+    if ((special & kHighBits) != 0) break;
   }
-  return value;
+  while (n < remaining_input_) {
+    const uint8_t c = input_[n];
+    if (c < 0x20 || c >= 0x80 || c == '"' || c == '\\') break;
+    ++n;
+  }
+  return n;
 }
 
-bool JsonReader::StartContainer(Json::Type type) {
-  if (stack_.size() == GRPC_JSON_MAX_DEPTH) {
-    if (errors_.size() == GRPC_JSON_MAX_ERRORS) {
-      truncated_errors_ = true;
-    } else {
-      errors_.push_back(
-          absl::StrFormat("exceeded max stack depth (%d) at index %" PRIuPTR,
-                          GRPC_JSON_MAX_DEPTH, CurrentIndex()));
-    }
-    return false;
-  }
-  Json* value = CreateAndLinkValue();
-  if (type == Json::Type::OBJECT) {
-    *value = Json::Object();
+template <typename Builder>
+void JsonReader<Builder>::AddError(std::string error) {
+  if (errors_.size() == GRPC_JSON_MAX_ERRORS) {
+    truncated_errors_ = true;
   } else {
-    GPR_ASSERT(type == Json::Type::ARRAY);
-    *value = Json::Array();
+    errors_.push_back(std::move(error));
   }
-  stack_.push_back(value);
-  return true;
 }
 
-void JsonReader::EndContainer() {
-  GPR_ASSERT(!stack_.empty());
-  stack_.pop_back();
+template <typename Builder>
+void JsonReader<Builder>::AddDuplicateKeyError(absl::string_view key,
+                                               size_t index) {
+  AddError(absl::StrFormat("duplicate key \"%s\" at index %" PRIuPTR, key,
+                           index));
 }
 
-void JsonReader::SetKey() {
-  key_ = std::move(string_);
+template <typename Builder>
+void JsonReader<Builder>::BeginString(const uint8_t* start) {
+  string_start_ = start;
+  string_size_ = 0;
+  string_escaped_ = false;
   string_.clear();
 }
 
-void JsonReader::SetString() {
-  Json* value = CreateAndLinkValue();
-  *value = std::move(string_);
-  string_.clear();
+// Called at a backslash: the escaped character differs from the input, so
+// the string has to be built from here on.
+template <typename Builder>
+void JsonReader<Builder>::EscapeString() {
+  if (string_escaped_) return;
+  string_.assign(reinterpret_cast<const char*>(string_start_), string_size_);
+  string_escaped_ = true;
 }
 
-bool JsonReader::SetNumber() {
-  Json* value = CreateAndLinkValue();
-  *value = Json(string_, /*is_number=*/true);
-  string_.clear();
+template <typename Builder>
+bool JsonReader<Builder>::PushContainer(Json::Type type) {
+  if (stack_.size() == GRPC_JSON_MAX_DEPTH) {
+    // Reported by Read(), after any duplicate keys the builder finds.
+    exceeded_max_depth_ = true;
+    return false;
+  }
+  builder()->StartContainer(type);
+  stack_.push_back(type);
   return true;
 }
 
-void JsonReader::SetTrue() {
-  Json* value = CreateAndLinkValue();
-  *value = true;
-  string_.clear();
-}
-
-void JsonReader::SetFalse() {
-  Json* value = CreateAndLinkValue();
-  *value = false;
-  string_.clear();
+template <typename Builder>
+void JsonReader<Builder>::PopContainer() {
+  GPR_ASSERT(!stack_.empty());
+  builder()->EndContainer();
+  stack_.pop_back();
 }
 
-void JsonReader::SetNull() { CreateAndLinkValue(); }
-
-bool JsonReader::IsComplete() {
+template <typename Builder>
+bool JsonReader<Builder>::IsComplete() {
   return (stack_.empty() && (state_ == State::GRPC_JSON_STATE_END ||
                              state_ == State::GRPC_JSON_STATE_VALUE_END));
 }
@@ -324,11 +365,26 @@ bool JsonReader::IsComplete() {
 //    . GRPC_JSON_INTERNAL_ERROR if the parser somehow ended into an invalid
 //      internal state.
 //
-JsonReader::Status JsonReader::Run() {
+template <typename Builder>
+typename JsonReader<Builder>::Status JsonReader<Builder>::Run() {
   uint32_t c;
 
   // This state-machine is a strict implementation of ECMA-404
   while (true) {
+    if ((state_ == State::GRPC_JSON_STATE_OBJECT_KEY_STRING ||
+         state_ == State::GRPC_JSON_STATE_VALUE_STRING) &&
+        unicode_high_surrogate_ == 0 && utf8_bytes_remaining_ == 0) {
+      // Copy plain runs of the string in one go; the state machine below
+      // sees the character that ends the run.
+      const size_t n = PlainStringPrefixLength();
+      if (string_escaped_) {
+        string_.append(reinterpret_cast<const char*>(input_), n);
+      } else {
+        string_size_ += n;
+      }
+      input_ += n;
+      remaining_input_ -= n;
+    }
     c = ReadChar();
     switch (c) {
       // Let's process the error case first.
@@ -338,7 +394,7 @@ JsonReader::Status JsonReader::Run() {
           case State::GRPC_JSON_STATE_VALUE_NUMBER_WITH_DECIMAL:
           case State::GRPC_JSON_STATE_VALUE_NUMBER_ZERO:
           case State::GRPC_JSON_STATE_VALUE_NUMBER_EPM:
-            if (!SetNumber()) return Status::GRPC_JSON_PARSE_ERROR;
+            if (!builder()->SetNumber()) return Status::GRPC_JSON_PARSE_ERROR;
             state_ = State::GRPC_JSON_STATE_VALUE_END;
             break;
 
@@ -376,7 +432,7 @@ JsonReader::Status JsonReader::Run() {
           case State::GRPC_JSON_STATE_VALUE_NUMBER_WITH_DECIMAL:
           case State::GRPC_JSON_STATE_VALUE_NUMBER_ZERO:
           case State::GRPC_JSON_STATE_VALUE_NUMBER_EPM:
-            if (!SetNumber()) return Status::GRPC_JSON_PARSE_ERROR;
+            if (!builder()->SetNumber()) return Status::GRPC_JSON_PARSE_ERROR;
             state_ = State::GRPC_JSON_STATE_VALUE_END;
             break;
 
@@ -404,13 +460,12 @@ JsonReader::Status JsonReader::Run() {
           case State::GRPC_JSON_STATE_VALUE_NUMBER_EPM:
             if (stack_.empty()) {
               return Status::GRPC_JSON_PARSE_ERROR;
-            } else if (c == '}' &&
-                       stack_.back()->type() != Json::Type::OBJECT) {
+            } else if (c == '}' && stack_.back() != Json::Type::OBJECT) {
               return Status::GRPC_JSON_PARSE_ERROR;
-            } else if (c == ']' && stack_.back()->type() != Json::Type::ARRAY) {
+            } else if (c == ']' && stack_.back() != Json::Type::ARRAY) {
               return Status::GRPC_JSON_PARSE_ERROR;
             }
-            if (!SetNumber()) return Status::GRPC_JSON_PARSE_ERROR;
+            if (!builder()->SetNumber()) return Status::GRPC_JSON_PARSE_ERROR;
             state_ = State::GRPC_JSON_STATE_VALUE_END;
             ABSL_FALLTHROUGH_INTENDED;
 
@@ -421,11 +476,10 @@ JsonReader::Status JsonReader::Run() {
               if (state_ != State::GRPC_JSON_STATE_VALUE_END) {
                 return Status::GRPC_JSON_PARSE_ERROR;
               }
-              if (!stack_.empty() &&
-                  stack_.back()->type() == Json::Type::OBJECT) {
+              if (!stack_.empty() && stack_.back() == Json::Type::OBJECT) {
                 state_ = State::GRPC_JSON_STATE_OBJECT_KEY_BEGIN;
               } else if (!stack_.empty() &&
-                         stack_.back()->type() == Json::Type::ARRAY) {
+                         stack_.back() == Json::Type::ARRAY) {
                 state_ = State::GRPC_JSON_STATE_VALUE_BEGIN;
               } else {
                 return Status::GRPC_JSON_PARSE_ERROR;
@@ -434,7 +488,7 @@ JsonReader::Status JsonReader::Run() {
               if (stack_.empty()) {
                 return Status::GRPC_JSON_PARSE_ERROR;
               }
-              if (c == '}' && stack_.back()->type() != Json::Type::OBJECT) {
+              if (c == '}' && stack_.back() != Json::Type::OBJECT) {
                 return Status::GRPC_JSON_PARSE_ERROR;
               }
               if (c == '}' &&
@@ -442,7 +496,7 @@ JsonReader::Status JsonReader::Run() {
                   !container_just_begun_) {
                 return Status::GRPC_JSON_PARSE_ERROR;
               }
-              if (c == ']' && stack_.back()->type() != Json::Type::ARRAY) {
+              if (c == ']' && stack_.back() != Json::Type::ARRAY) {
                 return Status::GRPC_JSON_PARSE_ERROR;
               }
               if (c == ']' && state_ == State::GRPC_JSON_STATE_VALUE_BEGIN &&
@@ -450,7 +504,7 @@ JsonReader::Status JsonReader::Run() {
                 return Status::GRPC_JSON_PARSE_ERROR;
               }
               state_ = State::GRPC_JSON_STATE_VALUE_END;
-              EndContainer();
+              PopContainer();
               if (stack_.empty()) {
                 state_ = State::GRPC_JSON_STATE_END;
               }
@@ -466,11 +520,13 @@ JsonReader::Status JsonReader::Run() {
       case '\\':
         switch (state_) {
           case State::GRPC_JSON_STATE_OBJECT_KEY_STRING:
+            EscapeString();
             escaped_string_was_key_ = true;
             state_ = State::GRPC_JSON_STATE_STRING_ESCAPE;
             break;
 
           case State::GRPC_JSON_STATE_VALUE_STRING:
+            EscapeString();
             escaped_string_was_key_ = false;
             state_ = State::GRPC_JSON_STATE_STRING_ESCAPE;
             break;
@@ -498,6 +554,7 @@ JsonReader::Status JsonReader::Run() {
         switch (state_) {
           case State::GRPC_JSON_STATE_OBJECT_KEY_BEGIN:
             if (c != '"') return Status::GRPC_JSON_PARSE_ERROR;
+            BeginString(input_);
             state_ = State::GRPC_JSON_STATE_OBJECT_KEY_STRING;
             break;
 
@@ -512,7 +569,7 @@ JsonReader::Status JsonReader::Run() {
               if (utf8_bytes_remaining_ != 0) {
                 return Status::GRPC_JSON_PARSE_ERROR;
               }
-              SetKey();
+              builder()->SetKey();
             } else {
               if (c < 32) return Status::GRPC_JSON_PARSE_ERROR;
               if (!StringAddChar(c)) return Status::GRPC_JSON_PARSE_ERROR;
@@ -530,7 +587,7 @@ JsonReader::Status JsonReader::Run() {
               if (utf8_bytes_remaining_ != 0) {
                 return Status::GRPC_JSON_PARSE_ERROR;
               }
-              SetString();
+              builder()->SetString();
             } else {
               if (c < 32) return Status::GRPC_JSON_PARSE_ERROR;
               if (!StringAddChar(c)) return Status::GRPC_JSON_PARSE_ERROR;
@@ -557,10 +614,12 @@ JsonReader::Status JsonReader::Run() {
                 break;
 
               case '"':
+                BeginString(input_);
                 state_ = State::GRPC_JSON_STATE_VALUE_STRING;
                 break;
 
               case '0':
+                BeginString(input_ - 1);
                 if (!StringAddChar(c)) return Status::GRPC_JSON_PARSE_ERROR;
                 state_ = State::GRPC_JSON_STATE_VALUE_NUMBER_ZERO;
                 break;
@@ -575,13 +634,14 @@ JsonReader::Status JsonReader::Run() {
               case '8':
               case '9':
               case '-':
+                BeginString(input_ - 1);
                 if (!StringAddChar(c)) return Status::GRPC_JSON_PARSE_ERROR;
                 state_ = State::GRPC_JSON_STATE_VALUE_NUMBER;
                 break;
 
               case '{':
                 container_just_begun_ = true;
-                if (!StartContainer(Json::Type::OBJECT)) {
+                if (!PushContainer(Json::Type::OBJECT)) {
                   return Status::GRPC_JSON_PARSE_ERROR;
                 }
                 state_ = State::GRPC_JSON_STATE_OBJECT_KEY_BEGIN;
@@ -589,7 +649,7 @@ JsonReader::Status JsonReader::Run() {
 
               case '[':
                 container_just_begun_ = true;
-                if (!StartContainer(Json::Type::ARRAY)) {
+                if (!PushContainer(Json::Type::ARRAY)) {
                   return Status::GRPC_JSON_PARSE_ERROR;
                 }
                 break;
@@ -834,7 +894,7 @@ JsonReader::Status JsonReader::Run() {
 
           case State::GRPC_JSON_STATE_VALUE_TRUE_E:
             if (c != 'e') return Status::GRPC_JSON_PARSE_ERROR;
-            SetTrue();
+            builder()->SetTrue();
             state_ = State::GRPC_JSON_STATE_VALUE_END;
             break;
 
@@ -855,7 +915,7 @@ JsonReader::Status JsonReader::Run() {
 
           case State::GRPC_JSON_STATE_VALUE_FALSE_E:
             if (c != 'e') return Status::GRPC_JSON_PARSE_ERROR;
-            SetFalse();
+            builder()->SetFalse();
             state_ = State::GRPC_JSON_STATE_VALUE_END;
             break;
 
@@ -871,7 +931,7 @@ JsonReader::Status JsonReader::Run() {
 
           case State::GRPC_JSON_STATE_VALUE_NULL_L2:
             if (c != 'l') return Status::GRPC_JSON_PARSE_ERROR;
-            SetNull();
+            builder()->SetNull();
             state_ = State::GRPC_JSON_STATE_VALUE_END;
             break;
 
@@ -899,32 +959,282 @@ JsonReader::Status JsonReader::Run() {
   GPR_UNREACHABLE_CODE(return Status::GRPC_JSON_INTERNAL_ERROR);
 }
 
-absl::StatusOr<Json> JsonReader::Parse(absl::string_view input) {
-  JsonReader reader(input);
-  Status status = reader.Run();
-  if (reader.truncated_errors_) {
-    reader.errors_.push_back(
+template <typename Builder>
+absl::Status JsonReader<Builder>::Read() {
+  Status status = Run();
+  builder()->Finish();
+  if (exceeded_max_depth_) {
+    AddError(absl::StrFormat("exceeded max stack depth (%d) at index %" PRIuPTR,
+                             GRPC_JSON_MAX_DEPTH, CurrentIndex()));
+  }
+  if (truncated_errors_) {
+    errors_.push_back(
         "too many errors encountered during JSON parsing -- fix reported "
         "errors and try again to see additional errors");
   }
   if (status == Status::GRPC_JSON_INTERNAL_ERROR) {
-    reader.errors_.push_back(absl::StrCat(
-        "internal error in JSON parser at index ", reader.CurrentIndex()));
+    errors_.push_back(absl::StrCat("internal error in JSON parser at index ",
+                                   CurrentIndex()));
   } else if (status == Status::GRPC_JSON_PARSE_ERROR) {
-    reader.errors_.push_back(
-        absl::StrCat("JSON parse error at index ", reader.CurrentIndex()));
+    errors_.push_back(
+        absl::StrCat("JSON parse error at index ", CurrentIndex()));
   }
-  if (!reader.errors_.empty()) {
+  if (!errors_.empty()) {
     return absl::InvalidArgumentError(absl::StrCat(
-        "JSON parsing failed: [", absl::StrJoin(reader.errors_, "; "), "]"));
+        "JSON parsing failed: [", absl::StrJoin(errors_, "; "), "]"));
+  }
+  return absl::OkStatus();
+}
+
+// Builds a Json.
+class JsonBuilder : public JsonReader<JsonBuilder> {
+ public:
+  static absl::StatusOr<Json> Parse(absl::string_view input);
+
+ private:
+  friend class JsonReader<JsonBuilder>;
+
+  explicit JsonBuilder(absl::string_view input) : JsonReader(input) {}
+
+  Json* CreateAndLinkValue();
+  void StartContainer(Json::Type type);
+  void EndContainer();
+  void SetKey();
+  void SetString();
+  bool SetNumber();
+  void SetTrue();
+  void SetFalse();
+  void SetNull();
+  void Finish() {}
+
+  Json root_value_;
+  std::vector<Json*> containers_;
+  std::string key_;
+};
+
+Json* JsonBuilder::CreateAndLinkValue() {
+  Json* value;
+  if (containers_.empty()) {
+    value = &root_value_;
+  } else {
+    Json* parent = containers_.back();
+    if (parent->type() == Json::Type::OBJECT) {
+      Json::Object* object = parent->mutable_object();
+      auto it = object->lower_bound(key_);
+      if (it != object->end() && it->first == key_) {
+        AddDuplicateKeyError(key_, CurrentIndex());
+        value = &it->second;
+      } else {
+        value = &object->emplace_hint(it, std::move(key_), Json())->second;
+      }
+    } else {
+      GPR_ASSERT(parent->type() == Json::Type::ARRAY);
+      parent->mutable_array()->emplace_back();
+      value = &parent->mutable_array()->back();
+    }
+  }
+  return value;
+}
+
+void JsonBuilder::StartContainer(Json::Type type) {
+  Json* value = CreateAndLinkValue();
+  if (type == Json::Type::OBJECT) {
+    *value = Json::Object();
+  } else {
+    GPR_ASSERT(type == Json::Type::ARRAY);
+    *value = Json::Array();
   }
-  return std::move(reader.root_value_);
+  containers_.push_back(value);
+}
+
+void JsonBuilder::EndContainer() {
+  GPR_ASSERT(!containers_.empty());
+  containers_.pop_back();
+}
+
+void JsonBuilder::SetKey() { key_ = std::string(CurrentString()); }
+
+void JsonBuilder::SetString() {
+  Json* value = CreateAndLinkValue();
+  *value = std::string(CurrentString());
+}
+
+bool JsonBuilder::SetNumber() {
+  Json* value = CreateAndLinkValue();
+  *value = Json(std::string(CurrentString()), /*is_number=*/true);
+  return true;
+}
+
+void JsonBuilder::SetTrue() {
+  Json* value = CreateAndLinkValue();
+  *value = true;
+}
+
+void JsonBuilder::SetFalse() {
+  Json* value = CreateAndLinkValue();
+  *value = false;
+}
+
+void JsonBuilder::SetNull() { CreateAndLinkValue(); }
+
+absl::StatusOr<Json> JsonBuilder::Parse(absl::string_view input) {
+  JsonBuilder builder(input);
+  absl::Status status = builder.Read();
+  if (!status.ok()) return status;
+  return std::move(builder.root_value_);
 }
 
 }  // namespace
 
+// Builds JsonViews in an arena.  The values of each open container are
+// collected in pending_ and copied into an arena array of the right size
+// when the container ends, which is also when object members are sorted
+// and checked for duplicate keys.
+class JsonView::Builder : public JsonReader<JsonView::Builder> {
+ public:
+  static absl::StatusOr<const JsonView*> Parse(absl::string_view input,
+                                               Arena* arena);
+
+ private:
+  friend class JsonReader<Builder>;
+
+  struct PendingValue {
+    // Only set for object members.
+    absl::string_view key;
+    JsonView value;
+    // Where the value was read, for duplicate key errors.
+    size_t index;
+  };
+
+  Builder(absl::string_view input, Arena* arena)
+      : JsonReader(input), arena_(arena) {}
+
+  // Returns CurrentString(), copied into the arena unless it points into
+  // the input.
+  absl::string_view PersistentString();
+  void AddValue(Json::Type type, absl::string_view string = {});
+  void SortMembers(PendingValue* begin, PendingValue* end);
+
+  void StartContainer(Json::Type type);
+  void EndContainer();
+  void SetKey() { key_ = PersistentString(); }
+  void SetString() { AddValue(Json::Type::STRING, PersistentString()); }
+  bool SetNumber() {
+    AddValue(Json::Type::NUMBER, PersistentString());
+    return true;
+  }
+  void SetTrue() { AddValue(Json::Type::JSON_TRUE); }
+  void SetFalse() { AddValue(Json::Type::JSON_FALSE); }
+  void SetNull() { AddValue(Json::Type::JSON_NULL); }
+  void Finish();
+
+  Arena* const arena_;
+  std::vector<PendingValue> pending_;
+  // Where the values of each open container start in pending_.
+  std::vector<size_t> container_starts_;
+  absl::string_view key_;
+  // The index and key of each value that repeats a key of its object.
+  std::vector<std::pair<size_t, absl::string_view>> duplicate_keys_;
+};
+
+absl::string_view JsonView::Builder::PersistentString() {
+  absl::string_view string = CurrentString();
+  if (CurrentStringIsInInput() || string.empty()) return string;
+  char* copy = static_cast<char*>(arena_->Alloc(string.size()));
+  memcpy(copy, string.data(), string.size());
+  return absl::string_view(copy, string.size());
+}
+
+void JsonView::Builder::AddValue(Json::Type type, absl::string_view string) {
+  PendingValue pending;
+  pending.key = key_;
+  pending.value.type_ = type;
+  pending.value.size_ = string.size();
+  pending.value.data_ = string.data();
+  pending.index = CurrentIndex();
+  pending_.push_back(pending);
+}
+
+void JsonView::Builder::SortMembers(PendingValue* begin, PendingValue* end) {
+  // Ties are broken by index so that duplicates are reported in the
+  // same way as by Json::Parse().
+  std::sort(begin, end, [](const PendingValue& a, const PendingValue& b) {
+    const int c = a.key.compare(b.key);
+    return c < 0 || (c == 0 && a.index < b.index);
+  });
+  for (PendingValue* it = begin; it != end && it + 1 != end; ++it) {
+    if (it->key == (it + 1)->key) {
+      duplicate_keys_.emplace_back((it + 1)->index, (it + 1)->key);
+    }
+  }
+}
+
+void JsonView::Builder::StartContainer(Json::Type type) {
+  AddValue(type);
+  container_starts_.push_back(pending_.size());
+}
+
+void JsonView::Builder::EndContainer() {
+  GPR_ASSERT(!container_starts_.empty());
+  const size_t start = container_starts_.back();
+  container_starts_.pop_back();
+  JsonView& container = pending_[start - 1].value;
+  PendingValue* begin = pending_.data() + start;
+  const size_t size = pending_.size() - start;
+  container.size_ = size;
+  if (size == 0) return;
+  if (container.type_ == Json::Type::OBJECT) {
+    SortMembers(begin, begin + size);
+    Member* members =
+        static_cast<Member*>(arena_->Alloc(size * sizeof(Member)));
+    for (size_t i = 0; i < size; ++i) {
+      new (&members[i]) Member{begin[i].key, begin[i].value};
+    }
+    container.data_ = members;
+  } else {
+    JsonView* elements =
+        static_cast<JsonView*>(arena_->Alloc(size * sizeof(JsonView)));
+    for (size_t i = 0; i < size; ++i) {
+      new (&elements[i]) JsonView(begin[i].value);
+    }
+    container.data_ = elements;
+  }
+  pending_.resize(start);
+}
+
+void JsonView::Builder::Finish() {
+  // Json::Parse() reports a duplicate key as soon as its value is read, so
+  // check the objects that were still open when reading stopped too.
+  for (size_t i = 0; i < container_starts_.size(); ++i) {
+    const size_t start = container_starts_[i];
+    if (pending_[start - 1].value.type_ != Json::Type::OBJECT) continue;
+    const size_t end = i + 1 < container_starts_.size()
+                           ? container_starts_[i + 1]
+                           : pending_.size();
+    SortMembers(pending_.data() + start, pending_.data() + end);
+  }
+  std::sort(duplicate_keys_.begin(), duplicate_keys_.end());
+  for (const auto& duplicate : duplicate_keys_) {
+    AddDuplicateKeyError(duplicate.second, duplicate.first);
+  }
+}
+
+absl::StatusOr<const JsonView*> JsonView::Builder::Parse(
+    absl::string_view input, Arena* arena) {
+  Builder builder(input, arena);
+  absl::Status status = builder.Read();
+  if (!status.ok()) return status;
+  GPR_ASSERT(builder.pending_.size() == 1);
+  return arena->New<JsonView>(builder.pending_[0].value);
+}
+
 absl::StatusOr<Json> Json::Parse(absl::string_view json_str) {
-  return JsonReader::Parse(json_str);
+  return JsonBuilder::Parse(json_str);
+}
+
+absl::StatusOr<const JsonView*> JsonView::Parse(absl::string_view json_str,
+                                                Arena* arena) {
+  return Builder::Parse(json_str, arena);
 }
 
 }  // namespace grpc_core
@@ -0,0 +1,60 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/json/json_view.h"
+
+#include <string>
+
+#include <grpc/support/log.h>
+
+namespace grpc_core {
+
+Json JsonView::ToJson() const {
+  switch (type_) {
+    case Type::JSON_NULL:
+      return Json();
+    case Type::JSON_TRUE:
+      return true;
+    case Type::JSON_FALSE:
+      return false;
+    case Type::NUMBER:
+      return Json(std::string(string_value()), /*is_number=*/true);
+    case Type::STRING:
+      return std::string(string_value());
+    case Type::OBJECT: {
+      Json::Object object;
+      // Members are already sorted, so each one goes at the end.
+      for (const Member& member : object_value()) {
+        object.emplace_hint(object.end(), std::string(member.key),
+                            member.value.ToJson());
+      }
+      return object;
+    }
+    case Type::ARRAY: {
+      Json::Array array;
+      array.reserve(size_);
+      for (const JsonView& element : array_value()) {
+        array.push_back(element.ToJson());
+      }
+      return array;
+    }
+  }
+  GPR_UNREACHABLE_CODE(return Json());
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,114 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef GRPC_SRC_CORE_LIB_JSON_JSON_VIEW_H
+#define GRPC_SRC_CORE_LIB_JSON_JSON_VIEW_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <algorithm>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/resource_quota/arena.h"
+
+namespace grpc_core {
+
+// A read-only JSON value that is parsed into an arena instead of being
+// built out of std::string, std::map and std::vector like Json.
+// Strings and numbers point into the parsed text unless they contained
+// escapes, so parsing allocates no more than a few arena blocks for the
+// whole document.  This makes it much cheaper than Json for large
+// documents that are only loaded into C++ objects, which
+// LoadFromJson() can do directly from a JsonView.
+//
+// A JsonView (and everything reachable from it) is valid for as long
+// as both the parsed text and the arena are.
+class JsonView {
+ public:
+  using Type = Json::Type;
+
+  // A member of an object.
+  struct Member;
+
+  // Parses json_str, with the same syntax and errors as Json::Parse().
+  static absl::StatusOr<const JsonView*> Parse(absl::string_view json_str,
+                                               Arena* arena);
+
+  JsonView() = default;
+
+  Type type() const { return type_; }
+
+  // The text of a STRING or NUMBER value.
+  absl::string_view string_value() const {
+    return absl::string_view(static_cast<const char*>(data_), size_);
+  }
+
+  // The members of an OBJECT value, sorted by key.
+  absl::Span<const Member> object_value() const;
+
+  // The elements of an ARRAY value.
+  absl::Span<const JsonView> array_value() const {
+    return absl::Span<const JsonView>(static_cast<const JsonView*>(data_),
+                                      size_);
+  }
+
+  // Returns the value of the member of an OBJECT value named key, or
+  // nullptr if there is none.
+  const JsonView* Find(absl::string_view key) const;
+
+  // Copies the value into a Json, for code that needs one.
+  Json ToJson() const;
+
+ private:
+  class Builder;
+
+  Type type_ = Type::JSON_NULL;
+  size_t size_ = 0;
+  // The characters of a STRING or NUMBER, the Members of an OBJECT or
+  // the elements of an ARRAY.
+  const void* data_ = nullptr;
+};
+
+struct JsonView::Member {
+  absl::string_view key;
+  JsonView value;
+};
+
+inline absl::Span<const JsonView::Member> JsonView::object_value() const {
+  return absl::Span<const Member>(static_cast<const Member*>(data_), size_);
+}
+
+inline const JsonView* JsonView::Find(absl::string_view key) const {
+  if (type_ != Type::OBJECT) return nullptr;
+  auto members = object_value();
+  auto it = std::lower_bound(
+      members.begin(), members.end(), key,
+      [](const Member& member, absl::string_view key) {
+        return member.key < key;
+      });
+  if (it == members.end() || it->key != key) return nullptr;
+  return &it->value;
+}
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_JSON_JSON_VIEW_H
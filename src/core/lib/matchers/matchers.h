@@ -134,6 +134,15 @@ class HeaderMatcher {
   // Valid for kSafeRegex.
   RE2* regex_matcher() const { return matcher_.regex_matcher(); }
 
+  // Valid for kRange.
+  int64_t range_start() const { return range_start_; }
+  int64_t range_end() const { return range_end_; }
+
+  // Valid for kPresent.
+  bool present_match() const { return present_match_; }
+
+  bool invert_match() const { return invert_match_; }
+
   bool Match(const absl::optional<absl::string_view>& value) const;
 
   std::string ToString() const;
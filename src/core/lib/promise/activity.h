@@ -136,8 +136,10 @@ class AtomicWaker {
   void Wakeup() { Take()->Wakeup(); }
 
   // Return true if there is a not-unwakeable wakeable present.
+  // Sequentially consistent, so that callers can pair it with a fence on the
+  // side that arms the waker.
   bool Armed() const noexcept {
-    return wakeable_.load(std::memory_order_relaxed) !=
+    return wakeable_.load(std::memory_order_seq_cst) !=
            promise_detail::unwakeable();
   }
 
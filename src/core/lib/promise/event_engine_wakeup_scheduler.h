@@ -23,11 +23,15 @@
 #include <grpc/event_engine/event_engine.h>
 
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/promise/wakeup_run_queue.h"
 
 namespace grpc_core {
 
 // A callback scheduler for activities that works by scheduling callbacks on the
 // exec ctx.
+// Wakeups requested while running a scheduled wakeup are run on the same
+// thread straight after it (see WakeupRunQueue), rather than each being
+// handed to the EventEngine separately.
 class EventEngineWakeupScheduler {
  public:
   explicit EventEngineWakeupScheduler(
@@ -37,16 +41,29 @@ class EventEngineWakeupScheduler {
 
   template <typename ActivityType>
   class BoundScheduler
-      : public grpc_event_engine::experimental::EventEngine::Closure {
+      : public grpc_event_engine::experimental::EventEngine::Closure,
+        private WakeupRunQueue::Node {
    protected:
     explicit BoundScheduler(EventEngineWakeupScheduler scheduler)
-        : event_engine_(std::move(scheduler.event_engine_)) {}
+        : WakeupRunQueue::Node(
+              [](WakeupRunQueue::Node* node) {
+                static_cast<ActivityType*>(static_cast<BoundScheduler*>(node))
+                    ->RunScheduledWakeup();
+              },
+              [](WakeupRunQueue::Node* node) {
+                static_cast<BoundScheduler*>(node)->ScheduleWakeup();
+              }),
+          event_engine_(std::move(scheduler.event_engine_)) {}
     BoundScheduler(const BoundScheduler&) = delete;
     BoundScheduler& operator=(const BoundScheduler&) = delete;
-    void ScheduleWakeup() { event_engine_->Run(this); }
+    void ScheduleWakeup() {
+      if (WakeupRunQueue::Push(RunQueueKind(), this)) return;
+      event_engine_->Run(this);
+    }
     void Run() final {
       ApplicationCallbackExecCtx app_exec_ctx;
       ExecCtx exec_ctx;
+      WakeupRunQueue run_queue(RunQueueKind());
       static_cast<ActivityType*>(this)->RunScheduledWakeup();
     }
 
@@ -55,6 +72,11 @@ class EventEngineWakeupScheduler {
   };
 
  private:
+  static const void* RunQueueKind() {
+    static const char kind = 0;
+    return &kind;
+  }
+
   std::shared_ptr<grpc_event_engine::experimental::EventEngine> event_engine_;
 };
 
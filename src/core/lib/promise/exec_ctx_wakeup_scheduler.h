@@ -23,23 +23,37 @@
 #include "src/core/lib/iomgr/closure.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/promise/wakeup_run_queue.h"
 
 namespace grpc_core {
 
 // A callback scheduler for activities that works by scheduling callbacks on the
 // exec ctx.
+// Wakeups requested while running a scheduled wakeup are run on the same
+// thread straight after it (see WakeupRunQueue), rather than each being
+// scheduled as its own closure.
 class ExecCtxWakeupScheduler {
  public:
   template <typename ActivityType>
-  class BoundScheduler {
+  class BoundScheduler : private WakeupRunQueue::Node {
    protected:
-    explicit BoundScheduler(ExecCtxWakeupScheduler) {}
+    explicit BoundScheduler(ExecCtxWakeupScheduler)
+        : WakeupRunQueue::Node(
+              [](WakeupRunQueue::Node* node) {
+                static_cast<ActivityType*>(static_cast<BoundScheduler*>(node))
+                    ->RunScheduledWakeup();
+              },
+              [](WakeupRunQueue::Node* node) {
+                static_cast<BoundScheduler*>(node)->ScheduleWakeup();
+              }) {}
     BoundScheduler(const BoundScheduler&) = delete;
     BoundScheduler& operator=(const BoundScheduler&) = delete;
     void ScheduleWakeup() {
+      if (WakeupRunQueue::Push(RunQueueKind(), this)) return;
       GRPC_CLOSURE_INIT(
           &closure_,
           [](void* arg, grpc_error_handle) {
+            WakeupRunQueue run_queue(RunQueueKind());
             static_cast<ActivityType*>(arg)->RunScheduledWakeup();
           },
           static_cast<ActivityType*>(this), nullptr);
@@ -49,6 +63,12 @@ class ExecCtxWakeupScheduler {
    private:
     grpc_closure closure_;
   };
+
+ private:
+  static const void* RunQueueKind() {
+    static const char kind = 0;
+    return &kind;
+  }
 };
 
 }  // namespace grpc_core
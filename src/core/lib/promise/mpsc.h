@@ -18,8 +18,12 @@
 #include <grpc/support/port_platform.h>
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -27,6 +31,7 @@
 
 #include <grpc/support/log.h>
 
+#include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -106,13 +111,166 @@ class Center : public RefCounted<Center<T>> {
   WaitSet send_wakers_ ABSL_GUARDED_BY(mu_);
 };
 
+// Lock-free variant of Center, for pipes with many concurrent senders.
+// Items are kept in a ring whose size is max_queued rounded up to a power of
+// two (so that is the real bound on queued items); senders claim a slot with
+// a compare-and-swap, and the receiver takes every filled slot in order.
+// Senders only take a lock when the ring is full, to register for a wakeup.
+template <typename T>
+class LockFreeCenter : public RefCounted<LockFreeCenter<T>> {
+ public:
+  explicit LockFreeCenter(size_t max_queued)
+      : mask_(RingSize(max_queued) - 1), slots_(new Slot[mask_ + 1]) {
+    for (size_t i = 0; i <= mask_; i++) {
+      slots_[i].seq.store(2 * i, std::memory_order_relaxed);
+    }
+  }
+
+  ~LockFreeCenter() {
+    std::vector<T> leftovers;
+    Drain(leftovers);
+  }
+
+  // Same contract as Center::PollReceiveBatch.
+  bool PollReceiveBatch(std::vector<T>& dest) {
+    if (!HasItem()) {
+      // Only the receiver arms this waker, so if it is armed it's ours from
+      // an earlier poll and there's no need to replace it.
+      if (!receive_waker_.Armed()) {
+        receive_waker_.Set(Activity::current()->MakeNonOwningWaker());
+      }
+      // Senders only wake us if they see the waker armed. Any sender that
+      // claims a slot after this fence will; one that claimed a slot before
+      // it may not have, but then we see its claim in enqueue_pos_.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (!HasItem()) {
+        if (enqueue_pos_.load(std::memory_order_seq_cst) == dequeue_pos_) {
+          return false;
+        }
+        // A sender is still publishing the next item: poll again for it.
+        Activity::current()->ForceImmediateRepoll();
+        return false;
+      }
+    }
+    dest.clear();
+    Drain(dest);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (send_waiters_.load(std::memory_order_relaxed)) {
+      ReleasableMutexLock lock(&mu_);
+      auto wakeups = send_wakers_.TakeWakeupSet();
+      send_waiters_.store(false, std::memory_order_relaxed);
+      lock.Release();
+      wakeups.Wakeup();
+    }
+    return true;
+  }
+
+  // Same contract as Center::PollSend.
+  Poll<bool> PollSend(T& t) {
+    if (receiver_closed_.load(std::memory_order_relaxed)) {
+      return Poll<bool>(false);
+    }
+    if (TryPush(t)) return Poll<bool>(true);
+    {
+      MutexLock lock(&mu_);
+      send_wakers_.AddPending(Activity::current()->MakeNonOwningWaker());
+      send_waiters_.store(true, std::memory_order_relaxed);
+    }
+    // The receiver may have emptied the ring before it could see us waiting:
+    // try again.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (TryPush(t)) return Poll<bool>(true);
+    return Pending{};
+  }
+
+  // Mark that the receiver is closed.
+  void ReceiverClosed() {
+    receiver_closed_.store(true, std::memory_order_relaxed);
+  }
+
+ private:
+  struct Slot {
+    // Twice the position this slot will be written at next while empty, and
+    // one more than twice the position it was written at while full.
+    std::atomic<size_t> seq;
+    ManualConstructor<T> value;
+  };
+
+  static size_t RingSize(size_t max_queued) {
+    size_t size = 1;
+    while (size < max_queued) size *= 2;
+    return size;
+  }
+
+  bool TryPush(T& t) {
+    size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = slots_[pos & mask_];
+      const intptr_t diff =
+          static_cast<intptr_t>(slot.seq.load(std::memory_order_acquire)) -
+          static_cast<intptr_t>(2 * pos);
+      if (diff < 0) return false;  // Full.
+      if (diff > 0) {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+        continue;
+      }
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_seq_cst,
+                                             std::memory_order_relaxed)) {
+        slot.value.Init(std::move(t));
+        slot.seq.store(2 * pos + 1, std::memory_order_release);
+        // Only pay for taking the waker when the receiver is waiting.
+        if (receive_waker_.Armed()) receive_waker_.Wakeup();
+        return true;
+      }
+    }
+  }
+
+  bool HasItem() const {
+    return slots_[dequeue_pos_ & mask_].seq.load(std::memory_order_acquire) ==
+           2 * dequeue_pos_ + 1;
+  }
+
+  void Drain(std::vector<T>& dest) {
+    while (HasItem()) {
+      Slot& slot = slots_[dequeue_pos_ & mask_];
+      dest.push_back(std::move(*slot.value));
+      slot.value.Destroy();
+      slot.seq.store(2 * (dequeue_pos_ + mask_ + 1),
+                     std::memory_order_release);
+      ++dequeue_pos_;
+    }
+  }
+
+  const size_t mask_;
+  const std::unique_ptr<Slot[]> slots_;
+  // Keep the senders' hot word off the receiver's cacheline. Each is padded
+  // to a full line rather than aligned: this object is heap allocated, and
+  // operator new does not honor over-alignment before C++17.
+  union {
+    char enqueue_padding_[GPR_CACHELINE_SIZE];
+    std::atomic<size_t> enqueue_pos_{0};
+  };
+  // Only touched by the receiver.
+  union {
+    char dequeue_padding_[GPR_CACHELINE_SIZE];
+    size_t dequeue_pos_ = 0;
+  };
+  AtomicWaker receive_waker_;
+  std::atomic<bool> receiver_closed_{false};
+  // Set while send_wakers_ may be non-empty.
+  std::atomic<bool> send_waiters_{false};
+  Mutex mu_;
+  WaitSet send_wakers_ ABSL_GUARDED_BY(mu_);
+};
+
 }  // namespace mpscpipe_detail
 
-template <typename T>
+template <typename T, typename Center>
 class MpscReceiver;
 
 // Send half of an mpsc pipe.
-template <typename T>
+template <typename T, typename Center = mpscpipe_detail::Center<T>>
 class MpscSender {
  public:
   MpscSender(const MpscSender&) = delete;
@@ -128,14 +286,14 @@ class MpscSender {
   }
 
  private:
-  friend class MpscReceiver<T>;
-  explicit MpscSender(RefCountedPtr<mpscpipe_detail::Center<T>> center)
+  friend class MpscReceiver<T, Center>;
+  explicit MpscSender(RefCountedPtr<Center> center)
       : center_(std::move(center)) {}
-  RefCountedPtr<mpscpipe_detail::Center<T>> center_;
+  RefCountedPtr<Center> center_;
 };
 
 // Receive half of an mpsc pipe.
-template <typename T>
+template <typename T, typename Center = mpscpipe_detail::Center<T>>
 class MpscReceiver {
  public:
   // max_buffer_hint is the maximum number of elements we'd like to buffer.
@@ -145,7 +303,7 @@ class MpscReceiver {
   // so the total outstanding is equal to max_buffer_hint (unless it's 1 in
   // which case instantaneosly we may have two elements buffered).
   explicit MpscReceiver(size_t max_buffer_hint)
-      : center_(MakeRefCounted<mpscpipe_detail::Center<T>>(
+      : center_(MakeRefCounted<Center>(
             std::max(static_cast<size_t>(1), max_buffer_hint / 2))) {}
   ~MpscReceiver() {
     if (center_ != nullptr) center_->ReceiverClosed();
@@ -165,7 +323,9 @@ class MpscReceiver {
   }
 
   // Construct a new sender for this receiver.
-  MpscSender<T> MakeSender() { return MpscSender<T>(center_); }
+  MpscSender<T, Center> MakeSender() {
+    return MpscSender<T, Center>(center_);
+  }
 
   // Return a promise that will resolve to the next item (and remove said item).
   auto Next() {
@@ -181,6 +341,24 @@ class MpscReceiver {
     };
   }
 
+  // Return a promise that will resolve to all pending items (and remove said
+  // items), in the order they were sent - never to an empty vector.
+  auto NextBatch() {
+    return [this]() -> Poll<std::vector<T>> {
+      std::vector<T> batch;
+      if (buffer_it_ != buffer_.end()) {
+        batch.assign(std::make_move_iterator(buffer_it_),
+                     std::make_move_iterator(buffer_.end()));
+        buffer_it_ = buffer_.end();
+        return Poll<std::vector<T>>(std::move(batch));
+      }
+      if (center_->PollReceiveBatch(batch)) {
+        return Poll<std::vector<T>>(std::move(batch));
+      }
+      return Pending{};
+    };
+  }
+
  private:
   // Received items. We move out of here one by one, but don't resize the
   // vector. Instead, when we run out of items, we poll the center for more -
@@ -189,9 +367,16 @@ class MpscReceiver {
   // free.
   std::vector<T> buffer_;
   typename std::vector<T>::iterator buffer_it_ = buffer_.end();
-  RefCountedPtr<mpscpipe_detail::Center<T>> center_;
+  RefCountedPtr<Center> center_;
 };
 
+// An mpsc pipe whose center is lock-free while there is space to send.
+template <typename T>
+using LockFreeMpscReceiver =
+    MpscReceiver<T, mpscpipe_detail::LockFreeCenter<T>>;
+template <typename T>
+using LockFreeMpscSender = MpscSender<T, mpscpipe_detail::LockFreeCenter<T>>;
+
 }  // namespace grpc_core
 
 #endif  // GRPC_SRC_CORE_LIB_PROMISE_MPSC_H
@@ -0,0 +1,68 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/promise/wakeup_run_queue.h"
+
+#include "src/core/lib/experiments/experiments.h"
+
+namespace grpc_core {
+
+constexpr size_t WakeupRunQueue::kMaxWakeupsPerPass;
+
+thread_local WakeupRunQueue* WakeupRunQueue::current_{nullptr};
+
+WakeupRunQueue::WakeupRunQueue(const void* kind)
+    : kind_(kind), outermost_(current_ == nullptr) {
+  if (outermost_) current_ = this;
+}
+
+WakeupRunQueue::~WakeupRunQueue() {
+  if (!outermost_) return;
+  // Wakeups run here may queue more; keep going for a bounded number.
+  for (size_t i = 0; head_ != nullptr && i < kMaxWakeupsPerPass; ++i) {
+    Node* node = PopFront();
+    node->run_(node);
+  }
+  // With the queue closed, anything left goes through its scheduler.
+  current_ = nullptr;
+  while (head_ != nullptr) {
+    Node* node = PopFront();
+    node->schedule_(node);
+  }
+}
+
+bool WakeupRunQueue::Push(const void* kind, Node* node) {
+  WakeupRunQueue* queue = current_;
+  if (queue == nullptr || queue->kind_ != kind) return false;
+  if (!IsWakeupRunQueueEnabled()) return false;
+  if (queue->tail_ == nullptr) {
+    queue->head_ = node;
+  } else {
+    queue->tail_->next_ = node;
+  }
+  queue->tail_ = node;
+  return true;
+}
+
+WakeupRunQueue::Node* WakeupRunQueue::PopFront() {
+  Node* node = head_;
+  head_ = node->next_;
+  if (head_ == nullptr) tail_ = nullptr;
+  node->next_ = nullptr;
+  return node;
+}
+
+}  // namespace grpc_core
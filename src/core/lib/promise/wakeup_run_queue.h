@@ -0,0 +1,82 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_PROMISE_WAKEUP_RUN_QUEUE_H
+#define GRPC_SRC_CORE_LIB_PROMISE_WAKEUP_RUN_QUEUE_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+namespace grpc_core {
+
+// Per-thread queue of activity wakeups.
+// A wakeup scheduler constructs a WakeupRunQueue around running a scheduled
+// wakeup. Activities woken up meanwhile on the same thread (typically by the
+// activity that is running) are queued here instead of each taking its own
+// trip through the scheduler, and are run in order once the outermost
+// WakeupRunQueue on the thread goes out of scope.
+// Wakeups are only queued for schedulers of the same kind as the one that
+// constructed the outermost WakeupRunQueue, so they run in the environment
+// that kind of scheduler provides.
+// At most kMaxWakeupsPerPass queued wakeups are run; any left after that are
+// handed back to their schedulers, so that activities waking each other
+// cannot keep one thread busy indefinitely.
+class WakeupRunQueue {
+ public:
+  static constexpr size_t kMaxWakeupsPerPass = 16;
+
+  // Intrusive queue entry: wakeup schedulers embed one per bound activity.
+  // The activity layer guarantees at most one wakeup is scheduled per
+  // activity at a time, so a node is queued at most once.
+  // \a run runs the wakeup, \a schedule schedules it without the queue.
+  class Node {
+   public:
+    Node(void (*run)(Node*), void (*schedule)(Node*))
+        : run_(run), schedule_(schedule) {}
+
+   private:
+    friend class WakeupRunQueue;
+    void (*const run_)(Node*);
+    void (*const schedule_)(Node*);
+    Node* next_ = nullptr;
+  };
+
+  // \a kind identifies the kind of scheduler, by the address of some
+  // object unique to it.
+  explicit WakeupRunQueue(const void* kind);
+  ~WakeupRunQueue();
+
+  WakeupRunQueue(const WakeupRunQueue&) = delete;
+  WakeupRunQueue& operator=(const WakeupRunQueue&) = delete;
+
+  // If this thread is running a wakeup for a scheduler of \a kind, queues
+  // \a node to be run after it and returns true. Otherwise returns false,
+  // and the caller should schedule the wakeup itself.
+  static bool Push(const void* kind, Node* node);
+
+ private:
+  Node* PopFront();
+
+  static thread_local WakeupRunQueue* current_;
+
+  const void* const kind_;
+  const bool outermost_;
+  Node* head_ = nullptr;
+  Node* tail_ = nullptr;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_PROMISE_WAKEUP_RUN_QUEUE_H
@@ -132,6 +132,10 @@ class Arena {
 
   // Destroy an arena, returning the total number of bytes allocated.
   size_t Destroy();
+  // Return the total number of bytes allocated so far.
+  size_t TotalUsedBytes() const {
+    return total_used_.load(std::memory_order_relaxed);
+  }
   // Allocate \a size bytes from the arena.
   void* Alloc(size_t size) {
     static constexpr size_t base_size =
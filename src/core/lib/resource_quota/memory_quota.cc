@@ -17,9 +17,11 @@
 #include "src/core/lib/resource_quota/memory_quota.h"
 
 #include <inttypes.h>
+#include <stdlib.h>
 
 #include <algorithm>
 #include <atomic>
+#include <new>
 #include <tuple>
 
 #include "absl/status/status.h"
@@ -28,6 +30,7 @@
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/mpscq.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/promise/detail/basic_seq.h"
 #include "src/core/lib/promise/exec_ctx_wakeup_scheduler.h"
 #include "src/core/lib/promise/loop.h"
@@ -35,6 +38,7 @@
 #include "src/core/lib/promise/race.h"
 #include "src/core/lib/promise/seq.h"
 #include "src/core/lib/resource_quota/trace.h"
+#include "src/core/lib/slice/slice_refcount.h"
 
 namespace grpc_core {
 
@@ -291,6 +295,55 @@ void GrpcMemoryAllocatorImpl::Replenish() {
   free_bytes_.fetch_add(amount, std::memory_order_acq_rel);
 }
 
+// Reference count for a slice made by MakePooledSlice(). Lives in the header
+// of the pooled block, and hands the block back to the quota's slice pool
+// when the slice is destroyed.
+class GrpcMemoryAllocatorImpl::PooledSliceRefCount
+    : public grpc_slice_refcount {
+ public:
+  PooledSliceRefCount(std::shared_ptr<GrpcMemoryAllocatorImpl> allocator,
+                      size_t size_class)
+      : grpc_slice_refcount(Destroy),
+        allocator_(std::move(allocator)),
+        size_class_(size_class) {}
+
+ private:
+  static void Destroy(grpc_slice_refcount* p) {
+    auto* rc = static_cast<PooledSliceRefCount*>(p);
+    std::shared_ptr<GrpcMemoryAllocatorImpl> allocator =
+        std::move(rc->allocator_);
+    const size_t size_class = rc->size_class_;
+    rc->~PooledSliceRefCount();
+    allocator->Release(SlicePool::BlockSize(size_class));
+    allocator->memory_quota_->FreeSliceBlock(rc, size_class);
+  }
+
+  std::shared_ptr<GrpcMemoryAllocatorImpl> allocator_;
+  const size_t size_class_;
+};
+
+grpc_slice GrpcMemoryAllocatorImpl::MakePooledSlice(MemoryRequest request) {
+  static_assert(sizeof(PooledSliceRefCount) <= SlicePool::kHeaderSize,
+                "slice refcount must fit in a slice pool block header");
+  GPR_DEBUG_ASSERT(request.max() <= SlicePool::kMaxPayloadSize);
+  const size_t size = Reserve(request);
+  const size_t size_class = SlicePool::SizeClassFor(size);
+  // Charge the whole block, including the header and the unused tail of the
+  // payload.
+  Reserve(MemoryRequest(SlicePool::BlockSize(size_class) - size));
+  void* p = memory_quota_->AllocSliceBlock(size_class);
+  auto* rc = new (p)
+      PooledSliceRefCount(std::static_pointer_cast<GrpcMemoryAllocatorImpl>(
+                              shared_from_this()),
+                          size_class);
+  grpc_slice slice;
+  slice.refcount = rc;
+  slice.data.refcounted.bytes =
+      static_cast<uint8_t*>(p) + SlicePool::kHeaderSize;
+  slice.data.refcounted.length = size;
+  return slice;
+}
+
 //
 // BasicMemoryQuota
 //
@@ -328,6 +381,12 @@ void BasicMemoryQuota::Start() {
         if (self->free_bytes_.load(std::memory_order_acquire) > 0) {
           return Pending{};
         }
+        // Bytes parked in cpu caches are free too: make sure we really are in
+        // overcommit before reclaiming anything.
+        self->DrainCpuCaches();
+        if (self->free_bytes_.load(std::memory_order_acquire) > 0) {
+          return Pending{};
+        }
         return 0;
       },
       [self]() {
@@ -379,7 +438,12 @@ void BasicMemoryQuota::Start() {
                    });
 }
 
-void BasicMemoryQuota::Stop() { reclaimer_activity_.reset(); }
+void BasicMemoryQuota::Stop() {
+  reclaimer_activity_.reset();
+  MutexLock lock(&slice_pool_mu_);
+  stopped_ = true;
+  slice_pool_reclaimer_.reset();
+}
 
 void BasicMemoryQuota::SetSize(size_t new_size) {
   size_t old_size = quota_size_.exchange(new_size, std::memory_order_relaxed);
@@ -387,7 +451,9 @@ void BasicMemoryQuota::SetSize(size_t new_size) {
     // We're growing the quota.
     Return(new_size - old_size);
   } else {
-    // We're shrinking the quota.
+    // We're shrinking the quota. Hand back cached bytes first, so the new
+    // limit is checked against exact values.
+    DrainCpuCaches();
     Take(/*allocator=*/nullptr, old_size - new_size);
   }
 }
@@ -396,11 +462,28 @@ void BasicMemoryQuota::Take(GrpcMemoryAllocatorImpl* allocator, size_t amount) {
   // If there's a request for nothing, then do nothing!
   if (amount == 0) return;
   GPR_DEBUG_ASSERT(amount <= std::numeric_limits<intptr_t>::max());
-  // Grab memory from the quota.
-  auto prior = free_bytes_.fetch_sub(amount, std::memory_order_acq_rel);
-  // If we push into overcommit, awake the reclaimer.
-  if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
-    if (reclaimer_activity_ != nullptr) reclaimer_activity_->ForceWakeup();
+  // Small takes are usually served by this cpu's cache, leaving free_bytes_
+  // alone.
+  if (!TakeFromCpuCache(amount)) {
+    // Grab memory from the quota, along with a refill for this cpu's cache if
+    // we're far enough from the limit.
+    const intptr_t refill = CpuCacheRefillAmount(amount);
+    auto prior =
+        free_bytes_.fetch_sub(amount + refill, std::memory_order_acq_rel);
+    if (refill != 0) {
+      if (prior - static_cast<intptr_t>(amount) - refill >= CpuCacheFloor()) {
+        cpu_caches_.this_cpu().bytes.fetch_add(refill,
+                                               std::memory_order_relaxed);
+      } else {
+        // Raced towards the limit: switch back to exact accounting.
+        free_bytes_.fetch_add(refill, std::memory_order_relaxed);
+        DrainCpuCaches();
+      }
+    }
+    // If we push into overcommit, awake the reclaimer.
+    if (prior >= 0 && prior < static_cast<intptr_t>(amount)) {
+      if (reclaimer_activity_ != nullptr) reclaimer_activity_->ForceWakeup();
+    }
   }
 
   if (IsFreeLargeAllocatorEnabled()) {
@@ -442,9 +525,108 @@ void BasicMemoryQuota::FinishReclamation(uint64_t token, Waker waker) {
 }
 
 void BasicMemoryQuota::Return(size_t amount) {
+  if (amount <= static_cast<size_t>(kMaxCpuCacheBytes) &&
+      ExecCtx::Get() != nullptr &&
+      free_bytes_.load(std::memory_order_relaxed) >= CpuCacheFloor()) {
+    std::atomic<intptr_t>& cache = cpu_caches_.this_cpu().bytes;
+    const intptr_t n = static_cast<intptr_t>(amount);
+    intptr_t cached = cache.fetch_add(n, std::memory_order_relaxed) + n;
+    // Keep the cache bounded: spill down to half its capacity.
+    while (cached > kMaxCpuCacheBytes) {
+      if (cache.compare_exchange_weak(cached, kMaxCpuCacheBytes / 2,
+                                      std::memory_order_relaxed)) {
+        free_bytes_.fetch_add(cached - kMaxCpuCacheBytes / 2,
+                              std::memory_order_relaxed);
+        return;
+      }
+    }
+    return;
+  }
   free_bytes_.fetch_add(amount, std::memory_order_relaxed);
 }
 
+bool BasicMemoryQuota::TakeFromCpuCache(size_t amount) {
+  if (amount > static_cast<size_t>(kMaxCpuCacheBytes) ||
+      ExecCtx::Get() == nullptr) {
+    return false;
+  }
+  std::atomic<intptr_t>& cache = cpu_caches_.this_cpu().bytes;
+  intptr_t cached = cache.load(std::memory_order_relaxed);
+  while (cached >= static_cast<intptr_t>(amount)) {
+    if (cache.compare_exchange_weak(cached,
+                                    cached - static_cast<intptr_t>(amount),
+                                    std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+intptr_t BasicMemoryQuota::CpuCacheRefillAmount(size_t amount) {
+  if (amount > static_cast<size_t>(kMaxCpuCacheBytes) ||
+      ExecCtx::Get() == nullptr ||
+      free_bytes_.load(std::memory_order_relaxed) < CpuCacheFloor()) {
+    return 0;
+  }
+  return kCpuCacheRefillBytes;
+}
+
+void BasicMemoryQuota::DrainCpuCaches() {
+  for (CpuCache& cache : cpu_caches_) {
+    intptr_t cached = cache.bytes.exchange(0, std::memory_order_relaxed);
+    if (cached != 0) free_bytes_.fetch_add(cached, std::memory_order_relaxed);
+  }
+}
+
+void* BasicMemoryQuota::AllocSliceBlock(size_t size_class) {
+  void* block = slice_pool_.Pop(size_class);
+  if (block == nullptr) return malloc(SlicePool::BlockSize(size_class));
+  // The block is in use again, and charged to its new owner.
+  Return(SlicePool::BlockSize(size_class));
+  return block;
+}
+
+void BasicMemoryQuota::FreeSliceBlock(void* block, size_t size_class) {
+  const size_t size = SlicePool::BlockSize(size_class);
+  // Only keep free blocks around while the quota is no more than half used.
+  if (free_bytes_.load(std::memory_order_relaxed) <
+          static_cast<intptr_t>(
+              quota_size_.load(std::memory_order_relaxed) / 2) ||
+      !slice_pool_.Push(block, size_class)) {
+    free(block);
+    return;
+  }
+  Take(/*allocator=*/nullptr, size);
+  MaybePostSlicePoolReclaimer();
+}
+
+void BasicMemoryQuota::MaybePostSlicePoolReclaimer() {
+  if (slice_pool_reclaimer_posted_.load(std::memory_order_relaxed) ||
+      slice_pool_reclaimer_posted_.exchange(true, std::memory_order_relaxed)) {
+    return;
+  }
+  MutexLock lock(&slice_pool_mu_);
+  if (stopped_) return;
+  auto reclaimer = [self = std::weak_ptr<BasicMemoryQuota>(
+                         shared_from_this())](
+                        absl::optional<ReclamationSweep> sweep) {
+    if (!sweep.has_value()) return;
+    auto memory_quota = self.lock();
+    if (memory_quota == nullptr) return;
+    memory_quota->slice_pool_reclaimer_posted_.store(false,
+                                                     std::memory_order_relaxed);
+    const size_t freed = memory_quota->slice_pool_.Trim();
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_resource_quota_trace)) {
+      gpr_log(GPR_INFO, "RQ: %s trimmed %zu bytes from the slice pool",
+              memory_quota->name_.c_str(), freed);
+    }
+    memory_quota->Return(freed);
+  };
+  slice_pool_reclaimer_ =
+      reclaimers_[static_cast<size_t>(ReclamationPass::kBenign)].Insert(
+          std::move(reclaimer));
+}
+
 void BasicMemoryQuota::AddNewAllocator(GrpcMemoryAllocatorImpl* allocator) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_resource_quota_trace)) {
     gpr_log(GPR_INFO, "Adding allocator %p", allocator);
@@ -680,6 +862,17 @@ double PressureTracker::AddSampleAndGetControlValue(double sample) {
 
 }  // namespace memory_quota_detail
 
+//
+// MemoryOwner
+//
+
+grpc_slice MemoryOwner::MakePooledSlice(MemoryRequest request) {
+  if (!IsSlicePoolEnabled() || request.max() > SlicePool::kMaxPayloadSize) {
+    return MemoryAllocator::MakeSlice(request);
+  }
+  return impl()->MakePooledSlice(request);
+}
+
 //
 // MemoryQuota
 //
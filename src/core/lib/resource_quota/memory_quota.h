@@ -19,6 +19,7 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cstddef>
@@ -35,18 +36,21 @@
 
 #include <grpc/event_engine/memory_allocator.h>
 #include <grpc/event_engine/memory_request.h>
+#include <grpc/slice.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/debug/trace.h"
 #include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/per_cpu.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/time.h"
 #include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/poll.h"
 #include "src/core/lib/resource_quota/periodic_update.h"
+#include "src/core/lib/resource_quota/slice_pool.h"
 #include "src/core/lib/resource_quota/trace.h"
 
 namespace grpc_core {
@@ -327,10 +331,26 @@ class BasicMemoryQuota final
   PressureInfo GetPressureInfo();
   // Get a reclamation queue
   ReclaimerQueue* reclaimer_queue(size_t i) { return &reclaimers_[i]; }
+  // Allocate a block of slice storage of some SlicePool size class, reusing
+  // a pooled block if there is one.
+  void* AllocSliceBlock(size_t size_class);
+  // Free a block from AllocSliceBlock(). The block is kept in the pool (and
+  // stays charged to this quota) unless the pool is full or the quota is
+  // under pressure.
+  void FreeSliceBlock(void* block, size_t size_class);
 
   // The name of this quota
   absl::string_view name() const { return name_; }
 
+  // Free bytes accounted in free_bytes_, and free bytes parked in cpu caches.
+  // Their sum is the true amount of free memory.
+  intptr_t FreeBytesForTesting() const { return free_bytes_.load(); }
+  intptr_t CpuCachedBytesForTesting() const {
+    intptr_t cached = 0;
+    for (const CpuCache& cache : cpu_caches_) cached += cache.bytes.load();
+    return cached;
+  }
+
  private:
   friend class ReclamationSweep;
   class WaitForSweepPromise;
@@ -351,19 +371,55 @@ class BasicMemoryQuota final
     std::array<Shard, 16> shards;
   };
 
+  // Bytes already taken from free_bytes_ on behalf of one cpu, and available
+  // to satisfy small Take() calls on that cpu without touching free_bytes_.
+  // Padded so that caches of different cpus don't share a cache line.
+  struct CpuCache {
+    std::atomic<intptr_t> bytes{0};
+    uint8_t padding[GPR_CACHELINE_SIZE - sizeof(std::atomic<intptr_t>)];
+  };
+
   static constexpr intptr_t kInitialSize = std::numeric_limits<intptr_t>::max();
+  // Largest amount a single cpu cache may hold; Take() and Return() calls
+  // bigger than this always go to free_bytes_ directly.
+  static constexpr intptr_t kMaxCpuCacheBytes = 256 * 1024;
+  // Extra amount taken from free_bytes_ when a cpu cache runs dry.
+  static constexpr intptr_t kCpuCacheRefillBytes = 64 * 1024;
 
   // Move allocator from big bucket to small bucket.
   void MaybeMoveAllocatorBigToSmall(GrpcMemoryAllocatorImpl* allocator);
   // Move allocator from small bucket to big bucket.
   void MaybeMoveAllocatorSmallToBig(GrpcMemoryAllocatorImpl* allocator);
 
+  // Try to satisfy a Take() from the current cpu's cache.
+  bool TakeFromCpuCache(size_t amount);
+  // Amount by which a Take() of \a amount may additionally refill the current
+  // cpu's cache, or 0 if caching is not possible right now.
+  intptr_t CpuCacheRefillAmount(size_t amount);
+  // Below this many free bytes, cpu caches are drained and all accounting
+  // goes through free_bytes_, so that the reclaimer and pressure tracking see
+  // exact values near the limit.
+  intptr_t CpuCacheFloor() const {
+    return std::max(2 * cpu_cache_slack_,
+                    static_cast<intptr_t>(
+                        quota_size_.load(std::memory_order_relaxed) / 2));
+  }
+  // Return all cached bytes to free_bytes_.
+  void DrainCpuCaches();
+  // Make sure a benign reclaimer that empties the slice pool is queued.
+  void MaybePostSlicePoolReclaimer();
+
   // The amount of memory that's free in this quota.
   // We use intptr_t as a reasonable proxy for ssize_t that's portable.
   // We allow arbitrary overcommit and so this must allow negative values.
   std::atomic<intptr_t> free_bytes_{kInitialSize};
   // The total number of bytes in this quota.
   std::atomic<size_t> quota_size_{kInitialSize};
+  // Per-cpu batches of free bytes. The true free amount is free_bytes_ plus
+  // everything cached here, which is at most cpu_cache_slack_.
+  PerCpu<CpuCache> cpu_caches_;
+  const intptr_t cpu_cache_slack_ =
+      (cpu_caches_.end() - cpu_caches_.begin()) * kMaxCpuCacheBytes;
 
   // Reclaimer queues.
   ReclaimerQueue reclaimers_[kNumReclamationPasses];
@@ -383,6 +439,14 @@ class BasicMemoryQuota final
   std::atomic<uint64_t> reclamation_counter_{0};
   // Memory pressure smoothing
   memory_quota_detail::PressureTracker pressure_tracker_;
+  // Free slice storage, charged to this quota until it is reused or trimmed
+  // by a benign reclamation pass.
+  SlicePool slice_pool_;
+  std::atomic<bool> slice_pool_reclaimer_posted_{false};
+  Mutex slice_pool_mu_;
+  bool stopped_ ABSL_GUARDED_BY(slice_pool_mu_) = false;
+  OrphanablePtr<ReclaimerQueue::Handle> slice_pool_reclaimer_
+      ABSL_GUARDED_BY(slice_pool_mu_);
   // The name of this quota - used for debugging/tracing/etc..
   std::string name_;
 };
@@ -445,6 +509,11 @@ class GrpcMemoryAllocatorImpl final : public EventEngineMemoryAllocatorImpl {
     return memory_quota_->GetPressureInfo();
   }
 
+  // Allocate a slice whose storage comes from the quota's slice pool and is
+  // charged to this allocator. request.max() must not exceed
+  // SlicePool::kMaxPayloadSize.
+  grpc_slice MakePooledSlice(MemoryRequest request);
+
   // Name of this allocator
   absl::string_view name() const { return name_; }
 
@@ -457,6 +526,8 @@ class GrpcMemoryAllocatorImpl final : public EventEngineMemoryAllocatorImpl {
   }
 
  private:
+  class PooledSliceRefCount;
+
   static constexpr size_t kMaxQuotaBufferSize = 1024 * 1024;
 
   // Primitive reservation function.
@@ -537,6 +608,10 @@ class MemoryOwner final : public MemoryAllocator {
   // Is this object valid (ie has not been moved out of or reset)
   bool is_valid() const { return impl() != nullptr; }
 
+  // Allocate a slice, like MakeSlice(). With the slice_pool experiment its
+  // storage is pooled by the underlying quota.
+  grpc_slice MakePooledSlice(MemoryRequest request);
+
  private:
   const GrpcMemoryAllocatorImpl* impl() const {
     return static_cast<const GrpcMemoryAllocatorImpl*>(get_internal_impl_ptr());
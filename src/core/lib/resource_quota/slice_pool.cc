@@ -0,0 +1,150 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/resource_quota/slice_pool.h"
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <new>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+namespace grpc_core {
+
+namespace {
+// Roughly how many bytes of each size class may be kept free per cpu, and in
+// the central pool.
+constexpr size_t kMaxCpuCacheBytes = 128 * 1024;
+constexpr size_t kMaxCentralBytes = 2 * 1024 * 1024;
+}  // namespace
+
+constexpr size_t SlicePool::kHeaderSize;
+constexpr size_t SlicePool::kMinPayloadSize;
+constexpr size_t SlicePool::kNumSizeClasses;
+constexpr size_t SlicePool::kMaxPayloadSize;
+
+size_t SlicePool::SizeClassFor(size_t size) {
+  if (size > kMaxPayloadSize) return kNumSizeClasses;
+  size_t size_class = 0;
+  while (PayloadSize(size_class) < size) ++size_class;
+  return size_class;
+}
+
+size_t SlicePool::MaxCpuCacheBlocks(size_t size_class) {
+  return std::max<size_t>(2, kMaxCpuCacheBytes / PayloadSize(size_class));
+}
+
+size_t SlicePool::MaxCentralBlocks(size_t size_class) {
+  return std::max<size_t>(4, kMaxCentralBytes / PayloadSize(size_class));
+}
+
+void* SlicePool::Pop(size_t size_class) {
+  if (ExecCtx::Get() == nullptr) {
+    MutexLock lock(&central_mu_);
+    FreeList& central = central_[size_class];
+    FreeBlock* block = central.head;
+    if (block == nullptr) return nullptr;
+    central.head = block->next;
+    --central.count;
+    return block;
+  }
+  CpuCache& cache = cpu_caches_.this_cpu();
+  MutexLock lock(&cache.mu);
+  FreeList& list = cache.lists[size_class];
+  if (list.head == nullptr) {
+    // Refill half of this cpu's cache from the central pool.
+    MutexLock central_lock(&central_mu_);
+    FreeList& central = central_[size_class];
+    const size_t n =
+        std::min(central.count, MaxCpuCacheBlocks(size_class) / 2);
+    if (n == 0) return nullptr;
+    FreeBlock* last = central.head;
+    for (size_t i = 1; i < n; ++i) last = last->next;
+    list.head = central.head;
+    list.count = n;
+    central.head = last->next;
+    central.count -= n;
+    last->next = nullptr;
+  }
+  FreeBlock* block = list.head;
+  list.head = block->next;
+  --list.count;
+  return block;
+}
+
+bool SlicePool::Push(void* p, size_t size_class) {
+  FreeBlock* block = new (p) FreeBlock{nullptr};
+  if (ExecCtx::Get() == nullptr) {
+    MutexLock lock(&central_mu_);
+    FreeList& central = central_[size_class];
+    if (central.count >= MaxCentralBlocks(size_class)) return false;
+    block->next = central.head;
+    central.head = block;
+    ++central.count;
+    return true;
+  }
+  CpuCache& cache = cpu_caches_.this_cpu();
+  MutexLock lock(&cache.mu);
+  FreeList& list = cache.lists[size_class];
+  if (list.count >= MaxCpuCacheBlocks(size_class)) {
+    // Make room by moving half of this cpu's cache to the central pool.
+    const size_t n = list.count / 2;
+    MutexLock central_lock(&central_mu_);
+    FreeList& central = central_[size_class];
+    if (central.count + n > MaxCentralBlocks(size_class)) return false;
+    FreeBlock* last = list.head;
+    for (size_t i = 1; i < n; ++i) last = last->next;
+    FreeBlock* first = list.head;
+    list.head = last->next;
+    list.count -= n;
+    last->next = central.head;
+    central.head = first;
+    central.count += n;
+  }
+  block->next = list.head;
+  list.head = block;
+  ++list.count;
+  return true;
+}
+
+size_t SlicePool::Trim() {
+  size_t freed = 0;
+  for (CpuCache& cache : cpu_caches_) {
+    MutexLock lock(&cache.mu);
+    for (size_t i = 0; i < kNumSizeClasses; ++i) {
+      freed += FreeAll(&cache.lists[i], i);
+    }
+  }
+  MutexLock lock(&central_mu_);
+  for (size_t i = 0; i < kNumSizeClasses; ++i) {
+    freed += FreeAll(&central_[i], i);
+  }
+  return freed;
+}
+
+size_t SlicePool::FreeAll(FreeList* list, size_t size_class) {
+  const size_t freed = list->count * BlockSize(size_class);
+  while (list->head != nullptr) {
+    FreeBlock* block = list->head;
+    list->head = block->next;
+    free(block);
+  }
+  list->count = 0;
+  return freed;
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,103 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_SLICE_POOL_H
+#define GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_SLICE_POOL_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include "absl/base/thread_annotations.h"
+
+#include "src/core/lib/gprpp/per_cpu.h"
+#include "src/core/lib/gprpp/sync.h"
+
+namespace grpc_core {
+
+// Pool of free blocks of memory for slice storage, so that buffers of
+// similar sizes (read buffers, frames, ...) don't round trip through malloc.
+//
+// Blocks come in size classes: each block has kHeaderSize bytes for
+// bookkeeping (e.g. a slice refcount) followed by a power of two sized
+// payload. Blocks are allocated with malloc() and must be returned with the
+// same size class they were allocated for.
+//
+// Free blocks are kept in a small per-cpu cache first, and move in batches to
+// and from a central pool shared by all cpus. Both are bounded; Push()
+// refuses blocks once they are full. Accounting the pooled memory against a
+// quota is up to the owner (see BasicMemoryQuota).
+class SlicePool {
+ public:
+  static constexpr size_t kHeaderSize = 64;
+  static constexpr size_t kMinPayloadSize = 256;
+  // Payloads of 256 bytes up to 64KiB.
+  static constexpr size_t kNumSizeClasses = 9;
+  static constexpr size_t kMaxPayloadSize = kMinPayloadSize
+                                            << (kNumSizeClasses - 1);
+
+  SlicePool() = default;
+  ~SlicePool() { Trim(); }
+
+  SlicePool(const SlicePool&) = delete;
+  SlicePool& operator=(const SlicePool&) = delete;
+
+  // Returns the smallest size class with a payload of at least \a size
+  // bytes, or kNumSizeClasses if \a size is larger than kMaxPayloadSize.
+  static size_t SizeClassFor(size_t size);
+  static size_t PayloadSize(size_t size_class) {
+    return kMinPayloadSize << size_class;
+  }
+  static size_t BlockSize(size_t size_class) {
+    return kHeaderSize + PayloadSize(size_class);
+  }
+
+  // Takes a free block of \a size_class from the pool, or returns nullptr if
+  // there is none.
+  void* Pop(size_t size_class);
+  // Puts a free block of \a size_class into the pool. Returns false if the
+  // pool is full, in which case the caller keeps ownership of the block.
+  bool Push(void* block, size_t size_class);
+  // Frees every pooled block. Returns the number of bytes freed.
+  size_t Trim();
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+  struct FreeList {
+    FreeBlock* head = nullptr;
+    size_t count = 0;
+  };
+  struct CpuCache {
+    Mutex mu;
+    FreeList lists[kNumSizeClasses] ABSL_GUARDED_BY(mu);
+  };
+
+  // Bounds on the number of free blocks of a size class kept per cpu and
+  // centrally.
+  static size_t MaxCpuCacheBlocks(size_t size_class);
+  static size_t MaxCentralBlocks(size_t size_class);
+
+  // Frees all blocks of \a list, returning the number of bytes freed.
+  static size_t FreeAll(FreeList* list, size_t size_class);
+
+  PerCpu<CpuCache> cpu_caches_;
+  Mutex central_mu_;
+  FreeList central_[kNumSizeClasses] ABSL_GUARDED_BY(central_mu_);
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_RESOURCE_QUOTA_SLICE_POOL_H
@@ -0,0 +1,543 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/security/authorization/compiled_rbac_policy.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "absl/strings/ascii.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+#include "absl/types/optional.h"
+#include "re2/re2.h"
+#include "re2/stringpiece.h"
+
+#include <grpc/support/log.h>
+
+namespace grpc_core {
+
+constexpr uint32_t CompiledRbacPolicy::kFalseNode;
+constexpr uint32_t CompiledRbacPolicy::kTrueNode;
+constexpr uint32_t CompiledRbacPolicy::kPathField;
+
+namespace {
+
+enum Value : uint8_t { kUnknown = 0, kFalse, kTrue };
+
+// Unambiguous description of a string matcher, for sharing predicates.
+std::string StringMatcherKey(const StringMatcher& matcher) {
+  if (matcher.type() == StringMatcher::Type::kSafeRegex) {
+    return absl::StrCat("r", matcher.regex_matcher()->pattern());
+  }
+  return absl::StrCat(static_cast<int>(matcher.type()),
+                      matcher.case_sensitive() ? "s" : "i",
+                      matcher.string_matcher());
+}
+
+}  // namespace
+
+//
+// CompiledRbacPolicy::EvalState
+//
+
+// Values of the nodes and predicates computed for one call so far. All the
+// predicates of a field are computed at once.
+class CompiledRbacPolicy::EvalState {
+ public:
+  EvalState(const EvaluateArgs& args, size_t num_nodes, size_t num_predicates)
+      : args_(args),
+        values_(num_nodes + num_predicates, kUnknown),
+        num_nodes_(num_nodes) {}
+
+  const EvaluateArgs& args() const { return args_; }
+  uint8_t& node(uint32_t index) { return values_[index]; }
+  uint8_t& predicate(uint32_t index) { return values_[num_nodes_ + index]; }
+
+ private:
+  const EvaluateArgs& args_;
+  std::vector<uint8_t> values_;
+  const size_t num_nodes_;
+};
+
+//
+// CompiledRbacPolicy::Trie
+//
+
+void CompiledRbacPolicy::Trie::Add(absl::string_view key, bool prefix,
+                                   uint32_t predicate) {
+  uint32_t node = 0;
+  for (char c : key) {
+    auto it = nodes_[node].children.find(c);
+    if (it != nodes_[node].children.end()) {
+      node = it->second;
+      continue;
+    }
+    uint32_t child = nodes_.size();
+    nodes_[node].children.emplace(c, child);
+    nodes_.emplace_back();
+    node = child;
+  }
+  (prefix ? nodes_[node].prefix_predicates : nodes_[node].exact_predicates)
+      .push_back(predicate);
+}
+
+template <typename OnMatch>
+void CompiledRbacPolicy::Trie::Match(absl::string_view value, bool ignore_case,
+                                     OnMatch on_match) const {
+  uint32_t node = 0;
+  for (size_t i = 0;; i++) {
+    const Node& n = nodes_[node];
+    for (uint32_t predicate : n.prefix_predicates) on_match(predicate);
+    if (i == value.size()) {
+      for (uint32_t predicate : n.exact_predicates) on_match(predicate);
+      return;
+    }
+    char c = ignore_case ? absl::ascii_tolower(value[i]) : value[i];
+    auto it = n.children.find(c);
+    if (it == n.children.end()) return;
+    node = it->second;
+  }
+}
+
+//
+// CompiledRbacPolicy
+//
+
+CompiledRbacPolicy::CompiledRbacPolicy(const Rbac& rbac) {
+  AddNode(Node::Type::kFalse, 0, 0, "f");
+  AddNode(Node::Type::kTrue, 0, 0, "t");
+  fields_.emplace_back();  // kPathField
+  for (const auto& p : rbac.policies) {
+    uint32_t permissions = CompilePermission(p.second.permissions);
+    uint32_t principals = CompilePrincipal(p.second.principals);
+    policies_.push_back(
+        {p.first, MakeAndOr(Node::Type::kAnd, {permissions, principals})});
+  }
+  // Now that all regexes are known, build one set per field. Should that
+  // fail, they are matched one by one.
+  for (Field& field : fields_) {
+    std::vector<uint32_t> regex_predicates;
+    for (uint32_t predicate : field.predicates) {
+      if (predicates_[predicate].type == Predicate::Type::kRegexSet) {
+        regex_predicates.push_back(predicate);
+      }
+    }
+    if (regex_predicates.empty()) continue;
+    auto regexes =
+        std::make_unique<RE2::Set>(RE2::DefaultOptions, RE2::ANCHOR_BOTH);
+    bool ok = true;
+    for (uint32_t predicate : regex_predicates) {
+      if (regexes->Add(
+              predicates_[predicate].string_matcher.regex_matcher()->pattern(),
+              nullptr) < 0) {
+        ok = false;
+        break;
+      }
+    }
+    if (ok && regexes->Compile()) {
+      field.regexes = std::move(regexes);
+      field.regex_predicates = std::move(regex_predicates);
+    } else {
+      for (uint32_t predicate : regex_predicates) {
+        predicates_[predicate].type = Predicate::Type::kStringMatcher;
+      }
+    }
+  }
+  node_ids_.clear();
+  predicate_ids_.clear();
+  header_field_ids_.clear();
+}
+
+uint32_t CompiledRbacPolicy::CompilePermission(
+    const Rbac::Permission& permission) {
+  switch (permission.type) {
+    case Rbac::Permission::RuleType::kAnd:
+    case Rbac::Permission::RuleType::kOr: {
+      std::vector<uint32_t> operands;
+      operands.reserve(permission.permissions.size());
+      for (const auto& rule : permission.permissions) {
+        operands.push_back(CompilePermission(*rule));
+      }
+      return MakeAndOr(permission.type == Rbac::Permission::RuleType::kAnd
+                           ? Node::Type::kAnd
+                           : Node::Type::kOr,
+                       operands);
+    }
+    case Rbac::Permission::RuleType::kNot:
+      return MakeNot(CompilePermission(*permission.permissions[0]));
+    case Rbac::Permission::RuleType::kAny:
+      return kTrueNode;
+    case Rbac::Permission::RuleType::kHeader:
+      return AddPredicateNode(AddHeaderPredicate(permission.header_matcher));
+    case Rbac::Permission::RuleType::kPath:
+      return AddPredicateNode(AddPathPredicate(permission.string_matcher));
+    case Rbac::Permission::RuleType::kDestIp:
+      return AddPredicateNode(AddMatcherPredicate(
+          absl::StrCat("dest_ip:", permission.ip.prefix_len, "/",
+                       permission.ip.address_prefix),
+          std::make_unique<IpAuthorizationMatcher>(
+              IpAuthorizationMatcher::Type::kDestIp,
+              Rbac::CidrRange(permission.ip.address_prefix,
+                              permission.ip.prefix_len))));
+    case Rbac::Permission::RuleType::kDestPort:
+      return AddPredicateNode(AddMatcherPredicate(
+          absl::StrCat("dest_port:", permission.port),
+          std::make_unique<PortAuthorizationMatcher>(permission.port)));
+    case Rbac::Permission::RuleType::kMetadata:
+      return permission.invert ? kTrueNode : kFalseNode;
+    case Rbac::Permission::RuleType::kReqServerName:
+      // Currently only matched against an empty string, as done by
+      // ReqServerNameAuthorizationMatcher.
+      return permission.string_matcher.Match("") ? kTrueNode : kFalseNode;
+  }
+  return kFalseNode;
+}
+
+uint32_t CompiledRbacPolicy::CompilePrincipal(
+    const Rbac::Principal& principal) {
+  switch (principal.type) {
+    case Rbac::Principal::RuleType::kAnd:
+    case Rbac::Principal::RuleType::kOr: {
+      std::vector<uint32_t> operands;
+      operands.reserve(principal.principals.size());
+      for (const auto& id : principal.principals) {
+        operands.push_back(CompilePrincipal(*id));
+      }
+      return MakeAndOr(principal.type == Rbac::Principal::RuleType::kAnd
+                           ? Node::Type::kAnd
+                           : Node::Type::kOr,
+                       operands);
+    }
+    case Rbac::Principal::RuleType::kNot:
+      return MakeNot(CompilePrincipal(*principal.principals[0]));
+    case Rbac::Principal::RuleType::kAny:
+      return kTrueNode;
+    case Rbac::Principal::RuleType::kPrincipalName:
+      return AddPredicateNode(AddMatcherPredicate(
+          absl::StrCat("authenticated:",
+                       principal.string_matcher.has_value()
+                           ? StringMatcherKey(*principal.string_matcher)
+                           : "*"),
+          std::make_unique<AuthenticatedAuthorizationMatcher>(
+              principal.string_matcher)));
+    case Rbac::Principal::RuleType::kSourceIp:
+    case Rbac::Principal::RuleType::kDirectRemoteIp:
+    case Rbac::Principal::RuleType::kRemoteIp:
+      // All of these are matched against the peer address.
+      return AddPredicateNode(AddMatcherPredicate(
+          absl::StrCat("peer_ip:", principal.ip.prefix_len, "/",
+                       principal.ip.address_prefix),
+          std::make_unique<IpAuthorizationMatcher>(
+              IpAuthorizationMatcher::Type::kSourceIp,
+              Rbac::CidrRange(principal.ip.address_prefix,
+                              principal.ip.prefix_len))));
+    case Rbac::Principal::RuleType::kHeader:
+      return AddPredicateNode(AddHeaderPredicate(principal.header_matcher));
+    case Rbac::Principal::RuleType::kPath:
+      return AddPredicateNode(AddPathPredicate(*principal.string_matcher));
+    case Rbac::Principal::RuleType::kMetadata:
+      return principal.invert ? kTrueNode : kFalseNode;
+  }
+  return kFalseNode;
+}
+
+uint32_t CompiledRbacPolicy::AddPathPredicate(const StringMatcher& matcher) {
+  return AddFieldPredicate(kPathField, matcher, /*invert=*/false,
+                           absl::StrCat("path:", StringMatcherKey(matcher)));
+}
+
+uint32_t CompiledRbacPolicy::AddHeaderPredicate(const HeaderMatcher& matcher) {
+  auto it = header_field_ids_.find(matcher.name());
+  if (it == header_field_ids_.end()) {
+    it = header_field_ids_.emplace(matcher.name(), fields_.size()).first;
+    fields_.emplace_back();
+    fields_.back().header_name = matcher.name();
+  }
+  const uint32_t field = it->second;
+  // The name is last so that keys can't be ambiguous.
+  switch (matcher.type()) {
+    case HeaderMatcher::Type::kRange:
+    case HeaderMatcher::Type::kPresent: {
+      std::string key = absl::StrCat(
+          "header:", static_cast<int>(matcher.type()), ":",
+          matcher.invert_match(), ":",
+          matcher.type() == HeaderMatcher::Type::kRange
+              ? absl::StrCat(matcher.range_start(), ",", matcher.range_end())
+              : absl::StrCat(matcher.present_match()),
+          ":", matcher.name());
+      auto p = predicate_ids_.find(key);
+      if (p != predicate_ids_.end()) return p->second;
+      const uint32_t predicate = predicates_.size();
+      predicates_.emplace_back();
+      predicates_.back().type = Predicate::Type::kHeaderMatcher;
+      predicates_.back().field = field;
+      predicates_.back().header_matcher = matcher;
+      fields_[field].predicates.push_back(predicate);
+      predicate_ids_.emplace(std::move(key), predicate);
+      return predicate;
+    }
+    default: {
+      // Header matchers are always case sensitive.
+      absl::StatusOr<StringMatcher> string_matcher = StringMatcher::Create(
+          static_cast<StringMatcher::Type>(matcher.type()),
+          matcher.type() == HeaderMatcher::Type::kSafeRegex
+              ? matcher.regex_matcher()->pattern()
+              : matcher.string_matcher());
+      GPR_ASSERT(string_matcher.ok());
+      std::string key = absl::StrCat("header:", matcher.invert_match(), ":",
+                                     matcher.name().size(), ":",
+                                     matcher.name(),
+                                     StringMatcherKey(*string_matcher));
+      return AddFieldPredicate(field, *string_matcher, matcher.invert_match(),
+                               std::move(key));
+    }
+  }
+}
+
+uint32_t CompiledRbacPolicy::AddFieldPredicate(uint32_t field,
+                                               const StringMatcher& matcher,
+                                               bool invert, std::string key) {
+  auto it = predicate_ids_.find(key);
+  if (it != predicate_ids_.end()) return it->second;
+  const uint32_t predicate = predicates_.size();
+  predicates_.emplace_back();
+  Predicate& p = predicates_.back();
+  p.field = field;
+  p.invert = invert;
+  p.string_matcher = matcher;
+  switch (matcher.type()) {
+    case StringMatcher::Type::kExact:
+    case StringMatcher::Type::kPrefix: {
+      p.type = Predicate::Type::kTrie;
+      const bool prefix = matcher.type() == StringMatcher::Type::kPrefix;
+      if (matcher.case_sensitive()) {
+        fields_[field].trie.Add(matcher.string_matcher(), prefix, predicate);
+      } else {
+        fields_[field].trie_ignore_case.Add(
+            absl::AsciiStrToLower(matcher.string_matcher()), prefix,
+            predicate);
+      }
+      break;
+    }
+    case StringMatcher::Type::kSafeRegex:
+      p.type = Predicate::Type::kRegexSet;
+      break;
+    default:
+      p.type = Predicate::Type::kStringMatcher;
+      break;
+  }
+  fields_[field].predicates.push_back(predicate);
+  predicate_ids_.emplace(std::move(key), predicate);
+  return predicate;
+}
+
+uint32_t CompiledRbacPolicy::AddMatcherPredicate(
+    std::string key, std::unique_ptr<AuthorizationMatcher> matcher) {
+  auto it = predicate_ids_.find(key);
+  if (it != predicate_ids_.end()) return it->second;
+  const uint32_t predicate = predicates_.size();
+  predicates_.emplace_back();
+  predicates_.back().type = Predicate::Type::kMatcher;
+  predicates_.back().matcher = std::move(matcher);
+  predicate_ids_.emplace(std::move(key), predicate);
+  return predicate;
+}
+
+uint32_t CompiledRbacPolicy::AddPredicateNode(uint32_t predicate) {
+  return AddNode(Node::Type::kPredicate, predicate, 0,
+                 absl::StrCat("p", predicate));
+}
+
+uint32_t CompiledRbacPolicy::MakeNot(uint32_t node) {
+  switch (nodes_[node].type) {
+    case Node::Type::kFalse:
+      return kTrueNode;
+    case Node::Type::kTrue:
+      return kFalseNode;
+    case Node::Type::kNot:
+      return nodes_[node].begin;
+    default:
+      return AddNode(Node::Type::kNot, node, 0, absl::StrCat("n", node));
+  }
+}
+
+uint32_t CompiledRbacPolicy::MakeAndOr(Node::Type type,
+                                       const std::vector<uint32_t>& operands) {
+  // An operand that decides the result on its own, and one that is ignored.
+  const uint32_t absorbing = type == Node::Type::kAnd ? kFalseNode : kTrueNode;
+  const uint32_t neutral = type == Node::Type::kAnd ? kTrueNode : kFalseNode;
+  std::vector<uint32_t> flat;
+  auto add = [&](uint32_t operand) {
+    if (std::find(flat.begin(), flat.end(), operand) == flat.end()) {
+      flat.push_back(operand);
+    }
+  };
+  for (uint32_t operand : operands) {
+    if (operand == absorbing) return absorbing;
+    if (operand == neutral) continue;
+    const Node& node = nodes_[operand];
+    if (node.type == type) {
+      for (uint32_t i = node.begin; i < node.end; i++) add(children_[i]);
+    } else {
+      add(operand);
+    }
+  }
+  if (flat.empty()) return neutral;
+  if (flat.size() == 1) return flat[0];
+  std::string key = absl::StrCat(type == Node::Type::kAnd ? "a" : "o",
+                                 absl::StrJoin(flat, ","));
+  auto it = node_ids_.find(key);
+  if (it != node_ids_.end()) return it->second;
+  const uint32_t begin = children_.size();
+  children_.insert(children_.end(), flat.begin(), flat.end());
+  return AddNode(type, begin, children_.size(), key);
+}
+
+uint32_t CompiledRbacPolicy::AddNode(Node::Type type, uint32_t begin,
+                                     uint32_t end, const std::string& key) {
+  auto it = node_ids_.find(key);
+  if (it != node_ids_.end()) return it->second;
+  const uint32_t node = nodes_.size();
+  Node n;
+  n.type = type;
+  n.begin = begin;
+  n.end = end;
+  nodes_.push_back(n);
+  node_ids_.emplace(key, node);
+  return node;
+}
+
+const std::string* CompiledRbacPolicy::FindMatchingPolicy(
+    const EvaluateArgs& args) const {
+  EvalState state(args, nodes_.size(), predicates_.size());
+  for (const Policy& policy : policies_) {
+    if (EvaluateNode(policy.node, &state)) return &policy.name;
+  }
+  return nullptr;
+}
+
+bool CompiledRbacPolicy::EvaluateNode(uint32_t node, EvalState* state) const {
+  uint8_t& value = state->node(node);
+  if (value != kUnknown) return value == kTrue;
+  const Node& n = nodes_[node];
+  bool result = false;
+  switch (n.type) {
+    case Node::Type::kFalse:
+      result = false;
+      break;
+    case Node::Type::kTrue:
+      result = true;
+      break;
+    case Node::Type::kPredicate:
+      result = EvaluatePredicate(n.begin, state);
+      break;
+    case Node::Type::kNot:
+      result = !EvaluateNode(n.begin, state);
+      break;
+    case Node::Type::kAnd:
+      result = true;
+      for (uint32_t i = n.begin; i < n.end; i++) {
+        if (!EvaluateNode(children_[i], state)) {
+          result = false;
+          break;
+        }
+      }
+      break;
+    case Node::Type::kOr:
+      result = false;
+      for (uint32_t i = n.begin; i < n.end; i++) {
+        if (EvaluateNode(children_[i], state)) {
+          result = true;
+          break;
+        }
+      }
+      break;
+  }
+  value = result ? kTrue : kFalse;
+  return result;
+}
+
+bool CompiledRbacPolicy::EvaluatePredicate(uint32_t predicate,
+                                           EvalState* state) const {
+  uint8_t value = state->predicate(predicate);
+  if (value == kUnknown) {
+    const Predicate& p = predicates_[predicate];
+    if (p.type == Predicate::Type::kMatcher) {
+      value = p.matcher->Matches(state->args()) ? kTrue : kFalse;
+      state->predicate(predicate) = value;
+    } else {
+      EvaluateField(p.field, state);
+      value = state->predicate(predicate);
+    }
+  }
+  return value == kTrue;
+}
+
+void CompiledRbacPolicy::EvaluateField(uint32_t field,
+                                       EvalState* state) const {
+  const Field& f = fields_[field];
+  std::string concatenated_value;
+  absl::optional<absl::string_view> value;
+  if (field == kPathField) {
+    // An empty path matches nothing.
+    absl::string_view path = state->args().GetPath();
+    if (!path.empty()) value = path;
+  } else {
+    value = state->args().GetHeaderValue(f.header_name, &concatenated_value);
+  }
+  for (uint32_t predicate : f.predicates) {
+    state->predicate(predicate) = kFalse;
+  }
+  if (value.has_value()) {
+    auto on_match = [state](uint32_t predicate) {
+      state->predicate(predicate) = kTrue;
+    };
+    f.trie.Match(*value, /*ignore_case=*/false, on_match);
+    f.trie_ignore_case.Match(*value, /*ignore_case=*/true, on_match);
+    if (f.regexes != nullptr) {
+      std::vector<int> matches;
+      RE2::Set::ErrorInfo error_info;
+      if (f.regexes->Match(re2::StringPiece(value->data(), value->size()),
+                           &matches, &error_info)) {
+        for (int i : matches) on_match(f.regex_predicates[i]);
+      } else if (error_info.kind != RE2::Set::kNoError) {
+        // Out of memory for the DFA: match the regexes one by one.
+        for (uint32_t predicate : f.regex_predicates) {
+          if (predicates_[predicate].string_matcher.Match(*value)) {
+            on_match(predicate);
+          }
+        }
+      }
+    }
+  }
+  for (uint32_t predicate : f.predicates) {
+    const Predicate& p = predicates_[predicate];
+    uint8_t& result = state->predicate(predicate);
+    if (p.type == Predicate::Type::kHeaderMatcher) {
+      result = p.header_matcher.Match(value) ? kTrue : kFalse;
+      continue;
+    }
+    // String matches fail on absent values, inverted or not.
+    if (!value.has_value()) continue;
+    if (p.type == Predicate::Type::kStringMatcher) {
+      result = p.string_matcher.Match(*value) ? kTrue : kFalse;
+    }
+    if (p.invert) result = result == kTrue ? kFalse : kTrue;
+  }
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,161 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_SECURITY_AUTHORIZATION_COMPILED_RBAC_POLICY_H
+#define GRPC_SRC_CORE_LIB_SECURITY_AUTHORIZATION_COMPILED_RBAC_POLICY_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "re2/set.h"
+
+#include "src/core/lib/matchers/matchers.h"
+#include "src/core/lib/security/authorization/evaluate_args.h"
+#include "src/core/lib/security/authorization/matchers.h"
+#include "src/core/lib/security/authorization/rbac_policy.h"
+
+namespace grpc_core {
+
+// The policies of an RBAC config, compiled into one decision program.
+//
+// The permission and principal trees of all policies are flattened into a
+// DAG in which identical predicates and subtrees are shared, so each is
+// evaluated at most once per call. Predicates on the path and on headers are
+// grouped per field and evaluated together the first time one of them is
+// needed: exact and prefix matchers by walking a trie, regexes with one
+// RE2::Set. Other predicates reuse the AuthorizationMatchers.
+//
+// Makes the same decisions as evaluating a PolicyAuthorizationMatcher for
+// each policy, in order.
+class CompiledRbacPolicy {
+ public:
+  explicit CompiledRbacPolicy(const Rbac& rbac);
+
+  size_t num_policies() const { return policies_.size(); }
+
+  // Returns the name of the first policy (in name order) that matches
+  // \a args, or nullptr if none does.
+  const std::string* FindMatchingPolicy(const EvaluateArgs& args) const;
+
+ private:
+  class EvalState;
+
+  // Exact and prefix string matchers for one field.
+  class Trie {
+   public:
+    void Add(absl::string_view key, bool prefix, uint32_t predicate);
+    // Calls on_match with each predicate that matches \a value.
+    template <typename OnMatch>
+    void Match(absl::string_view value, bool ignore_case,
+               OnMatch on_match) const;
+
+   private:
+    struct Node {
+      absl::flat_hash_map<char, uint32_t> children;
+      std::vector<uint32_t> prefix_predicates;
+      std::vector<uint32_t> exact_predicates;
+    };
+    std::vector<Node> nodes_{1};
+  };
+
+  // The path, or a header, and the predicates evaluated against it.
+  struct Field {
+    // Empty for the path.
+    std::string header_name;
+    Trie trie;
+    Trie trie_ignore_case;
+    std::unique_ptr<RE2::Set> regexes;
+    // Predicate of each regex of the set.
+    std::vector<uint32_t> regex_predicates;
+    std::vector<uint32_t> predicates;
+  };
+
+  struct Predicate {
+    enum class Type {
+      // Evaluated with the predicates of its field.
+      kTrie,
+      kRegexSet,
+      kStringMatcher,
+      kHeaderMatcher,
+      // Evaluated on its own.
+      kMatcher,
+    };
+    Type type;
+    uint32_t field = 0;
+    // A header string match, which also fails if the header is absent.
+    bool invert = false;
+    StringMatcher string_matcher;
+    HeaderMatcher header_matcher;
+    std::unique_ptr<AuthorizationMatcher> matcher;
+  };
+
+  struct Node {
+    enum class Type { kFalse, kTrue, kPredicate, kNot, kAnd, kOr };
+    Type type;
+    // The predicate for kPredicate, the operand for kNot, and the range of
+    // operands in children_ for kAnd and kOr.
+    uint32_t begin = 0;
+    uint32_t end = 0;
+  };
+
+  struct Policy {
+    std::string name;
+    uint32_t node;
+  };
+
+  static constexpr uint32_t kFalseNode = 0;
+  static constexpr uint32_t kTrueNode = 1;
+  static constexpr uint32_t kPathField = 0;
+
+  uint32_t CompilePermission(const Rbac::Permission& permission);
+  uint32_t CompilePrincipal(const Rbac::Principal& principal);
+  uint32_t AddPathPredicate(const StringMatcher& matcher);
+  uint32_t AddHeaderPredicate(const HeaderMatcher& matcher);
+  uint32_t AddFieldPredicate(uint32_t field, const StringMatcher& matcher,
+                             bool invert, std::string key);
+  uint32_t AddMatcherPredicate(std::string key,
+                               std::unique_ptr<AuthorizationMatcher> matcher);
+  uint32_t AddPredicateNode(uint32_t predicate);
+  uint32_t MakeNot(uint32_t node);
+  uint32_t MakeAndOr(Node::Type type, const std::vector<uint32_t>& operands);
+  uint32_t AddNode(Node::Type type, uint32_t begin, uint32_t end,
+                   const std::string& key);
+
+  bool EvaluateNode(uint32_t node, EvalState* state) const;
+  bool EvaluatePredicate(uint32_t predicate, EvalState* state) const;
+  void EvaluateField(uint32_t field, EvalState* state) const;
+
+  std::vector<Policy> policies_;
+  std::vector<Node> nodes_;
+  std::vector<uint32_t> children_;
+  std::vector<Predicate> predicates_;
+  std::vector<Field> fields_;
+  // Used while compiling only, to share identical nodes, predicates and
+  // fields.
+  absl::flat_hash_map<std::string, uint32_t> node_ids_;
+  absl::flat_hash_map<std::string, uint32_t> predicate_ids_;
+  absl::flat_hash_map<std::string, uint32_t> header_field_ids_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SECURITY_AUTHORIZATION_COMPILED_RBAC_POLICY_H
@@ -20,10 +20,16 @@
 #include <map>
 #include <utility>
 
+#include "src/core/lib/experiments/experiments.h"
+
 namespace grpc_core {
 
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
     : action_(policy.action) {
+  if (IsCompiledRbacEnabled()) {
+    compiled_ = std::make_unique<CompiledRbacPolicy>(policy);
+    return;
+  }
   for (auto& sub_policy : policy.policies) {
     Policy policy;
     policy.name = sub_policy.first;
@@ -35,12 +41,15 @@ GrpcAuthorizationEngine::GrpcAuthorizationEngine(Rbac policy)
 
 GrpcAuthorizationEngine::GrpcAuthorizationEngine(
     GrpcAuthorizationEngine&& other) noexcept
-    : action_(other.action_), policies_(std::move(other.policies_)) {}
+    : action_(other.action_),
+      policies_(std::move(other.policies_)),
+      compiled_(std::move(other.compiled_)) {}
 
 GrpcAuthorizationEngine& GrpcAuthorizationEngine::operator=(
     GrpcAuthorizationEngine&& other) noexcept {
   action_ = other.action_;
   policies_ = std::move(other.policies_);
+  compiled_ = std::move(other.compiled_);
   return *this;
 }
 
@@ -48,6 +57,13 @@ AuthorizationEngine::Decision GrpcAuthorizationEngine::Evaluate(
     const EvaluateArgs& args) const {
   Decision decision;
   bool matches = false;
+  if (compiled_ != nullptr) {
+    const std::string* name = compiled_->FindMatchingPolicy(args);
+    if (name != nullptr) {
+      matches = true;
+      decision.matching_policy_name = *name;
+    }
+  }
   for (const auto& policy : policies_) {
     if (policy.matcher->Matches(args)) {
       matches = true;
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "src/core/lib/security/authorization/authorization_engine.h"
+#include "src/core/lib/security/authorization/compiled_rbac_policy.h"
 #include "src/core/lib/security/authorization/evaluate_args.h"
 #include "src/core/lib/security/authorization/matchers.h"
 #include "src/core/lib/security/authorization/rbac_policy.h"
@@ -49,7 +50,9 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
   Rbac::Action action() const { return action_; }
 
   // Required only for testing purpose.
-  size_t num_policies() const { return policies_.size(); }
+  size_t num_policies() const {
+    return compiled_ != nullptr ? compiled_->num_policies() : policies_.size();
+  }
 
   // Evaluates incoming request against RBAC policy and makes a decision to
   // whether allow/deny this request.
@@ -62,6 +65,8 @@ class GrpcAuthorizationEngine : public AuthorizationEngine {
   };
   Rbac::Action action_;
   std::vector<Policy> policies_;
+  // Used instead of policies_ when the compiled_rbac experiment is enabled.
+  std::unique_ptr<CompiledRbacPolicy> compiled_;
 };
 
 }  // namespace grpc_core
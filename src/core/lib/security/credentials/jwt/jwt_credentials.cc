@@ -27,18 +27,21 @@
 #include <string>
 #include <utility>
 
+#include "absl/hash/hash.h"
 #include "absl/status/status.h"
 #include "absl/strings/str_cat.h"
 
+#include <grpc/event_engine/event_engine.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
-#include <grpc/support/sync.h>
 
 #include "src/core/lib/debug/trace.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/json/json.h"
+#include "src/core/lib/promise/poll.h"
 #include "src/core/lib/promise/promise.h"
 #include "src/core/lib/security/credentials/call_creds_util.h"
 #include "src/core/lib/surface/api_trace.h"
@@ -47,10 +50,114 @@
 
 using grpc_core::Json;
 
+constexpr size_t grpc_service_account_jwt_access_credentials::kCacheShards;
+constexpr size_t
+    grpc_service_account_jwt_access_credentials::kMaxCacheEntriesPerShard;
+
 grpc_service_account_jwt_access_credentials::
     ~grpc_service_account_jwt_access_credentials() {
   grpc_auth_json_key_destruct(&key_);
-  gpr_mu_destroy(&cache_mu_);
+}
+
+grpc_service_account_jwt_access_credentials::CacheShard&
+grpc_service_account_jwt_access_credentials::ShardForAudience(
+    const std::string& audience) {
+  return cache_[absl::HashOf(audience) % kCacheShards];
+}
+
+absl::optional<grpc_core::Slice>
+grpc_service_account_jwt_access_credentials::SignAndCacheJwt(
+    const std::string& audience) {
+  // Sign outside of the shard lock: this is the expensive part, and must not
+  // hold up calls to other services.
+  char* jwt =
+      grpc_jwt_encode_and_sign(&key_, audience.c_str(), jwt_lifetime_, nullptr);
+  if (jwt == nullptr) return absl::nullopt;
+  grpc_core::Slice jwt_value =
+      grpc_core::Slice::FromCopiedString(absl::StrCat("Bearer ", jwt));
+  gpr_free(jwt);
+  gpr_timespec jwt_expiration =
+      gpr_time_add(gpr_now(GPR_CLOCK_REALTIME), jwt_lifetime_);
+  CacheShard& shard = ShardForAudience(audience);
+  grpc_core::MutexLock lock(&shard.mu);
+  auto it = shard.entries.find(audience);
+  if (it == shard.entries.end() &&
+      shard.entries.size() >= kMaxCacheEntriesPerShard) {
+    // Make room by evicting the entry that expires first.
+    auto oldest = shard.entries.end();
+    for (auto e = shard.entries.begin(); e != shard.entries.end(); ++e) {
+      if (e->second.refreshing) continue;
+      if (oldest == shard.entries.end() ||
+          gpr_time_cmp(e->second.jwt_expiration,
+                       oldest->second.jwt_expiration) < 0) {
+        oldest = e;
+      }
+    }
+    // Every entry is being refreshed: don't cache this one.
+    if (oldest == shard.entries.end()) return jwt_value;
+    shard.entries.erase(oldest);
+  }
+  CacheEntry& entry = shard.entries[audience];
+  entry.jwt_value = jwt_value.Ref();
+  entry.jwt_expiration = jwt_expiration;
+  entry.refreshing = false;
+  return jwt_value;
+}
+
+absl::optional<grpc_core::Slice>
+grpc_service_account_jwt_access_credentials::SignJwtForWaiters(
+    const std::string& audience) {
+  absl::optional<grpc_core::Slice> jwt_value = SignAndCacheJwt(audience);
+  std::vector<grpc_core::RefCountedPtr<PendingRequest>> waiters;
+  {
+    CacheShard& shard = ShardForAudience(audience);
+    grpc_core::MutexLock lock(&shard.mu);
+    auto it = shard.signing.find(audience);
+    GPR_ASSERT(it != shard.signing.end());
+    waiters = std::move(it->second);
+    shard.signing.erase(it);
+  }
+  for (auto& waiter : waiters) {
+    if (jwt_value.has_value()) {
+      waiter->md->Append(
+          GRPC_AUTHORIZATION_METADATA_KEY, jwt_value->Ref(),
+          [](absl::string_view, const grpc_core::Slice&) { abort(); });
+      waiter->result = std::move(waiter->md);
+    } else {
+      waiter->result = absl::UnauthenticatedError("Could not generate JWT.");
+    }
+    waiter->done.store(true, std::memory_order_release);
+    waiter->waker.Wakeup();
+  }
+  return jwt_value;
+}
+
+void grpc_service_account_jwt_access_credentials::RefreshJwtInBackground(
+    std::string audience) {
+  grpc_event_engine::experimental::GetDefaultEventEngine()->Run(
+      [self = Ref(), audience = std::move(audience)]() {
+        auto* creds =
+            static_cast<grpc_service_account_jwt_access_credentials*>(
+                self.get());
+        if (!creds->SignAndCacheJwt(audience).has_value()) {
+          // Leave the current JWT in place: the next call past the refresh
+          // threshold will try again.
+          CacheShard& shard = creds->ShardForAudience(audience);
+          grpc_core::MutexLock lock(&shard.mu);
+          auto it = shard.entries.find(audience);
+          if (it != shard.entries.end()) it->second.refreshing = false;
+        }
+      });
+}
+
+absl::optional<gpr_timespec>
+grpc_service_account_jwt_access_credentials::CachedJwtExpirationForTesting(
+    const std::string& audience) {
+  CacheShard& shard = ShardForAudience(audience);
+  grpc_core::MutexLock lock(&shard.mu);
+  auto it = shard.entries.find(audience);
+  if (it == shard.entries.end()) return absl::nullopt;
+  return it->second.jwt_expiration;
 }
 
 grpc_core::ArenaPromise<absl::StatusOr<grpc_core::ClientMetadataHandle>>
@@ -69,32 +176,53 @@ grpc_service_account_jwt_access_credentials::GetRequestMetadata(
   }
   // See if we can return a cached jwt.
   absl::optional<grpc_core::Slice> jwt_value;
+  bool refresh = false;
+  bool sign = false;
+  grpc_core::RefCountedPtr<PendingRequest> pending_request;
   {
-    gpr_mu_lock(&cache_mu_);
-    if (cached_.has_value() && cached_->service_url == *uri &&
-        (gpr_time_cmp(
-             gpr_time_sub(cached_->jwt_expiration, gpr_now(GPR_CLOCK_REALTIME)),
-             refresh_threshold) > 0)) {
-      jwt_value = cached_->jwt_value.Ref();
+    CacheShard& shard = ShardForAudience(*uri);
+    grpc_core::MutexLock lock(&shard.mu);
+    auto it = shard.entries.find(*uri);
+    if (it != shard.entries.end()) {
+      CacheEntry& entry = it->second;
+      gpr_timespec time_left =
+          gpr_time_sub(entry.jwt_expiration, gpr_now(GPR_CLOCK_REALTIME));
+      if (gpr_time_cmp(time_left, refresh_threshold) > 0) {
+        jwt_value = entry.jwt_value.Ref();
+        if (!entry.refreshing && gpr_time_cmp(time_left, refresh_ahead_) <= 0) {
+          entry.refreshing = true;
+          refresh = true;
+        }
+      }
     }
-    gpr_mu_unlock(&cache_mu_);
-  }
-
-  if (!jwt_value.has_value()) {
-    char* jwt = nullptr;
-    // Generate a new jwt.
-    gpr_mu_lock(&cache_mu_);
-    cached_.reset();
-    jwt = grpc_jwt_encode_and_sign(&key_, uri->c_str(), jwt_lifetime_, nullptr);
-    if (jwt != nullptr) {
-      std::string md_value = absl::StrCat("Bearer ", jwt);
-      gpr_free(jwt);
-      jwt_value = grpc_core::Slice::FromCopiedString(md_value);
-      cached_ = {jwt_value->Ref(), std::move(*uri),
-                 gpr_time_add(gpr_now(GPR_CLOCK_REALTIME), jwt_lifetime_)};
+    if (!jwt_value.has_value()) {
+      // Nothing usable cached: this call has to wait for a new jwt. Only the
+      // first call for the audience signs it.
+      auto signing = shard.signing.find(*uri);
+      if (signing == shard.signing.end()) {
+        shard.signing[*uri];
+        sign = true;
+      } else {
+        pending_request = grpc_core::MakeRefCounted<PendingRequest>();
+        pending_request->waker =
+            grpc_core::Activity::current()->MakeNonOwningWaker();
+        pending_request->md = std::move(initial_metadata);
+        signing->second.push_back(pending_request);
+      }
     }
-    gpr_mu_unlock(&cache_mu_);
   }
+  if (refresh) RefreshJwtInBackground(*uri);
+  if (pending_request != nullptr) {
+    return [pending_request]()
+               -> grpc_core::Poll<
+                   absl::StatusOr<grpc_core::ClientMetadataHandle>> {
+      if (!pending_request->done.load(std::memory_order_acquire)) {
+        return grpc_core::Pending{};
+      }
+      return std::move(pending_request->result);
+    };
+  }
+  if (sign) jwt_value = SignJwtForWaiters(*uri);
 
   if (!jwt_value.has_value()) {
     return grpc_core::Immediate(
@@ -119,7 +247,11 @@ grpc_service_account_jwt_access_credentials::
     token_lifetime = grpc_max_auth_token_lifetime();
   }
   jwt_lifetime_ = token_lifetime;
-  gpr_mu_init(&cache_mu_);
+  // Start refreshing a quarter of the lifetime before the jwt stops being
+  // served.
+  refresh_ahead_ = gpr_time_from_seconds(
+      GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS + jwt_lifetime_.tv_sec / 4,
+      GPR_TIMESPAN);
 }
 
 grpc_core::UniqueTypeName grpc_service_account_jwt_access_credentials::Type() {
@@ -21,11 +21,16 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <initializer_list>
 #include <string>
+#include <vector>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/status/statusor.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/string_view.h"
@@ -33,12 +38,14 @@
 #include "absl/types/optional.h"
 
 #include <grpc/grpc_security.h>
-#include <grpc/support/sync.h>
 #include <grpc/support/time.h>
 
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/gprpp/unique_type_name.h"
+#include "src/core/lib/promise/activity.h"
 #include "src/core/lib/promise/arena_promise.h"
 #include "src/core/lib/security/credentials/credentials.h"
 #include "src/core/lib/security/credentials/jwt/json_token.h"
@@ -70,6 +77,11 @@ class grpc_service_account_jwt_access_credentials
 
   grpc_core::UniqueTypeName type() const override { return Type(); }
 
+  // Exposed for testing purposes only: the expiration of the JWT cached for
+  // \a audience, if any.
+  absl::optional<gpr_timespec> CachedJwtExpirationForTesting(
+      const std::string& audience);
+
  private:
   int cmp_impl(const grpc_call_credentials* other) const override {
     // TODO(yashykt): Check if we can do something better here
@@ -77,18 +89,52 @@ class grpc_service_account_jwt_access_credentials
         static_cast<const grpc_call_credentials*>(this), other);
   }
 
-  // Have a simple cache for now with just 1 entry. We could have a map based on
-  // the service_url for a more sophisticated one.
-  gpr_mu cache_mu_;
-  struct Cache {
+  // JWTs are cached by audience, since the same credentials are commonly
+  // used to reach many services. The cache is sharded so that calls to
+  // different services don't contend on one mutex, and each shard is
+  // bounded. A JWT that gets close to its expiration keeps being served
+  // while a replacement is signed in the background. When no JWT is cached,
+  // the first call for the audience signs one and the calls that arrive
+  // meanwhile wait for it.
+  struct CacheEntry {
     grpc_core::Slice jwt_value;
-    std::string service_url;
     gpr_timespec jwt_expiration;
+    // Whether a background refresh of this entry is in flight.
+    bool refreshing = false;
   };
-  absl::optional<Cache> cached_;
-
+  // A call waiting for the JWT another call is signing.
+  struct PendingRequest : public grpc_core::RefCounted<PendingRequest> {
+    std::atomic<bool> done{false};
+    grpc_core::Waker waker;
+    grpc_core::ClientMetadataHandle md;
+    absl::StatusOr<grpc_core::ClientMetadataHandle> result;
+  };
+  struct CacheShard {
+    grpc_core::Mutex mu;
+    absl::flat_hash_map<std::string, CacheEntry> entries ABSL_GUARDED_BY(mu);
+    // Audiences a call is signing a JWT for, with the calls waiting for it.
+    absl::flat_hash_map<std::string,
+                        std::vector<grpc_core::RefCountedPtr<PendingRequest>>>
+        signing ABSL_GUARDED_BY(mu);
+  };
+  static constexpr size_t kCacheShards = 16;
+  static constexpr size_t kMaxCacheEntriesPerShard = 16;
+
+  CacheShard& ShardForAudience(const std::string& audience);
+  // Signs a new JWT for \a audience and caches it. Returns nullopt if the
+  // JWT could not be signed.
+  absl::optional<grpc_core::Slice> SignAndCacheJwt(const std::string& audience);
+  // Signs a new JWT for \a audience on behalf of the calls waiting for it, and
+  // completes them.
+  absl::optional<grpc_core::Slice> SignJwtForWaiters(
+      const std::string& audience);
+  void RefreshJwtInBackground(std::string audience);
+
+  CacheShard cache_[kCacheShards];
   grpc_auth_json_key key_;
   gpr_timespec jwt_lifetime_;
+  // Cached JWTs with less than this left before expiration are refreshed.
+  gpr_timespec refresh_ahead_;
 };
 
 // Private constructor for jwt credentials from an already parsed json key.
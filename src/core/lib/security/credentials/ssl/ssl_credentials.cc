@@ -181,8 +181,10 @@ grpc_ssl_server_credentials::~grpc_ssl_server_credentials() {
 }
 grpc_core::RefCountedPtr<grpc_server_security_connector>
 grpc_ssl_server_credentials::create_security_connector(
-    const grpc_core::ChannelArgs& /* args */) {
-  return grpc_ssl_server_security_connector_create(this->Ref());
+    const grpc_core::ChannelArgs& args) {
+  return grpc_ssl_server_security_connector_create(
+      this->Ref(),
+      args.GetBool(GRPC_SSL_SHARE_SESSION_TICKET_KEYS_ARG).value_or(false));
 }
 
 grpc_core::UniqueTypeName grpc_ssl_server_credentials::Type() {
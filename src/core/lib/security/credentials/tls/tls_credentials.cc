@@ -118,9 +118,11 @@ TlsServerCredentials::~TlsServerCredentials() {}
 
 grpc_core::RefCountedPtr<grpc_server_security_connector>
 TlsServerCredentials::create_security_connector(
-    const grpc_core::ChannelArgs& /* args */) {
+    const grpc_core::ChannelArgs& args) {
   return grpc_core::TlsServerSecurityConnector::
-      CreateTlsServerSecurityConnector(this->Ref(), options_);
+      CreateTlsServerSecurityConnector(
+          this->Ref(), options_,
+          args.GetBool(GRPC_SSL_SHARE_SESSION_TICKET_KEYS_ARG).value_or(false));
 }
 
 grpc_core::UniqueTypeName TlsServerCredentials::type() const {
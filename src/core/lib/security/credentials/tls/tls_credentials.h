@@ -58,7 +58,7 @@ class TlsServerCredentials final : public grpc_server_credentials {
   ~TlsServerCredentials() override;
 
   grpc_core::RefCountedPtr<grpc_server_security_connector>
-  create_security_connector(const grpc_core::ChannelArgs& /* args */) override;
+  create_security_connector(const grpc_core::ChannelArgs& args) override;
 
   grpc_core::UniqueTypeName type() const override;
 
@@ -156,6 +156,7 @@ class grpc_ssl_channel_security_connector final
                   const grpc_core::ChannelArgs& /*args*/,
                   grpc_core::RefCountedPtr<grpc_auth_context>* auth_context,
                   grpc_closure* on_peer_checked) override {
+    grpc_ssl_record_handshake_stats(&peer, /*is_server=*/false);
     const char* target_name = overridden_target_name_.empty()
                                   ? target_name_.c_str()
                                   : overridden_target_name_.c_str();
@@ -214,10 +215,12 @@ class grpc_ssl_channel_security_connector final
 class grpc_ssl_server_security_connector
     : public grpc_server_security_connector {
  public:
-  explicit grpc_ssl_server_security_connector(
-      grpc_core::RefCountedPtr<grpc_server_credentials> server_creds)
+  grpc_ssl_server_security_connector(
+      grpc_core::RefCountedPtr<grpc_server_credentials> server_creds,
+      bool share_session_ticket_keys)
       : grpc_server_security_connector(GRPC_SSL_URL_SCHEME,
-                                       std::move(server_creds)) {}
+                                       std::move(server_creds)),
+        share_session_ticket_keys_(share_session_ticket_keys) {}
 
   ~grpc_ssl_server_security_connector() override {
     tsi_ssl_server_handshaker_factory_unref(server_handshaker_factory_);
@@ -263,6 +266,7 @@ class grpc_ssl_server_security_connector
           server_credentials->config().min_tls_version);
       options.max_tls_version = grpc_get_tsi_tls_version(
           server_credentials->config().max_tls_version);
+      options.share_session_ticket_keys = share_session_ticket_keys_;
       const tsi_result result =
           tsi_create_ssl_server_handshaker_factory_with_options(
               &options, &server_handshaker_factory_);
@@ -298,6 +302,7 @@ class grpc_ssl_server_security_connector
                   const grpc_core::ChannelArgs& /*args*/,
                   grpc_core::RefCountedPtr<grpc_auth_context>* auth_context,
                   grpc_closure* on_peer_checked) override {
+    grpc_ssl_record_handshake_stats(&peer, /*is_server=*/true);
     grpc_error_handle error = ssl_check_peer(nullptr, &peer, auth_context);
     tsi_peer_destruct(&peer);
     grpc_core::ExecCtx::Run(DEBUG_LOCATION, on_peer_checked, error);
@@ -376,6 +381,7 @@ class grpc_ssl_server_security_connector
     options.cipher_suites = grpc_get_ssl_cipher_suites();
     options.alpn_protocols = alpn_protocol_strings;
     options.num_alpn_protocols = static_cast<uint16_t>(num_alpn_protocols);
+    options.share_session_ticket_keys = share_session_ticket_keys_;
     tsi_result result = tsi_create_ssl_server_handshaker_factory_with_options(
         &options, &new_handshaker_factory);
     grpc_tsi_ssl_pem_key_cert_pairs_destroy(
@@ -400,6 +406,7 @@ class grpc_ssl_server_security_connector
     server_handshaker_factory_ = new_factory;
   }
 
+  const bool share_session_ticket_keys_;
   grpc_core::Mutex mu_;
   tsi_ssl_server_handshaker_factory* server_handshaker_factory_ = nullptr;
 };
@@ -446,11 +453,12 @@ grpc_ssl_channel_security_connector_create(
 
 grpc_core::RefCountedPtr<grpc_server_security_connector>
 grpc_ssl_server_security_connector_create(
-    grpc_core::RefCountedPtr<grpc_server_credentials> server_credentials) {
+    grpc_core::RefCountedPtr<grpc_server_credentials> server_credentials,
+    bool share_session_ticket_keys) {
   GPR_ASSERT(server_credentials != nullptr);
   grpc_core::RefCountedPtr<grpc_ssl_server_security_connector> c =
       grpc_core::MakeRefCounted<grpc_ssl_server_security_connector>(
-          std::move(server_credentials));
+          std::move(server_credentials), share_session_ticket_keys);
   const grpc_security_status retval = c->InitializeHandshakerFactory();
   if (retval != GRPC_SECURITY_OK) {
     return nullptr;
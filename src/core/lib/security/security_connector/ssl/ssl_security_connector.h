@@ -72,11 +72,14 @@ struct grpc_ssl_server_config {
 // Creates an SSL server_security_connector.
 // - config is the SSL config to be used for the SSL channel establishment.
 // - sc is a pointer on the connector to be created.
+// - share_session_ticket_keys is the value of
+//   GRPC_SSL_SHARE_SESSION_TICKET_KEYS_ARG in the server's args.
 // This function returns GRPC_SECURITY_OK in case of success or a
 // specific error code otherwise.
 //
 grpc_core::RefCountedPtr<grpc_server_security_connector>
 grpc_ssl_server_security_connector_create(
-    grpc_core::RefCountedPtr<grpc_server_credentials> server_credentials);
+    grpc_core::RefCountedPtr<grpc_server_credentials> server_credentials,
+    bool share_session_ticket_keys);
 
 #endif  // GRPC_SRC_CORE_LIB_SECURITY_SECURITY_CONNECTOR_SSL_SSL_SECURITY_CONNECTOR_H
@@ -28,6 +28,7 @@
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_split.h"
+#include "absl/strings/string_view.h"
 
 #include <grpc/grpc.h>
 #include <grpc/support/alloc.h>
@@ -36,6 +37,8 @@
 
 #include "src/core/ext/transport/chttp2/alpn/alpn.h"
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/host_port.h"
@@ -256,6 +259,25 @@ static bool IsSpiffeId(absl::string_view uri) {
   return true;
 }
 
+void grpc_ssl_record_handshake_stats(const tsi_peer* peer, bool is_server) {
+  const tsi_peer_property* prop =
+      tsi_peer_get_property_by_name(peer, TSI_SSL_SESSION_REUSED_PEER_PROPERTY);
+  const bool resumed = prop != nullptr &&
+                       absl::string_view(prop->value.data,
+                                         prop->value.length) == "true";
+  if (is_server) {
+    grpc_core::global_stats().IncrementTlsServerHandshakes();
+    if (resumed) {
+      grpc_core::global_stats().IncrementTlsServerResumedHandshakes();
+    }
+  } else {
+    grpc_core::global_stats().IncrementTlsClientHandshakes();
+    if (resumed) {
+      grpc_core::global_stats().IncrementTlsClientResumedHandshakes();
+    }
+  }
+}
+
 grpc_core::RefCountedPtr<grpc_auth_context> grpc_ssl_peer_to_auth_context(
     const tsi_peer* peer, const char* transport_security_type) {
   size_t i;
@@ -479,7 +501,7 @@ grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
     grpc_ssl_client_certificate_request_type client_certificate_request,
     tsi_tls_version min_tls_version, tsi_tls_version max_tls_version,
     tsi::TlsSessionKeyLoggerCache::TlsSessionKeyLogger* tls_session_key_logger,
-    const char* crl_directory,
+    const char* crl_directory, bool share_session_ticket_keys,
     tsi_ssl_server_handshaker_factory** handshaker_factory) {
   size_t num_alpn_protocols = 0;
   const char** alpn_protocol_strings =
@@ -497,6 +519,7 @@ grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
   options.max_tls_version = max_tls_version;
   options.key_logger = tls_session_key_logger;
   options.crl_directory = crl_directory;
+  options.share_session_ticket_keys = share_session_ticket_keys;
   const tsi_result result =
       tsi_create_ssl_server_handshaker_factory_with_options(&options,
                                                             handshaker_factory);
@@ -93,9 +93,13 @@ grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
     grpc_ssl_client_certificate_request_type client_certificate_request,
     tsi_tls_version min_tls_version, tsi_tls_version max_tls_version,
     tsi::TlsSessionKeyLoggerCache::TlsSessionKeyLogger* tls_session_key_logger,
-    const char* crl_directory,
+    const char* crl_directory, bool share_session_ticket_keys,
     tsi_ssl_server_handshaker_factory** handshaker_factory);
 
+// Counts a completed TLS handshake, and whether it resumed a session, in the
+// global stats. Must be called under an ExecCtx.
+void grpc_ssl_record_handshake_stats(const tsi_peer* peer, bool is_server);
+
 // Free the memory occupied by key cert pairs.
 void grpc_tsi_ssl_pem_key_cert_pairs_destroy(tsi_ssl_pem_key_cert_pair* kp,
                                              size_t num_key_cert_pairs);
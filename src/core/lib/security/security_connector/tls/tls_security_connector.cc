@@ -355,6 +355,7 @@ void TlsChannelSecurityConnector::check_peer(
     tsi_peer peer, grpc_endpoint* /*ep*/, const ChannelArgs& /*args*/,
     RefCountedPtr<grpc_auth_context>* auth_context,
     grpc_closure* on_peer_checked) {
+  grpc_ssl_record_handshake_stats(&peer, /*is_server=*/false);
   const char* target_name = overridden_target_name_.empty()
                                 ? target_name_.c_str()
                                 : overridden_target_name_.c_str();
@@ -557,7 +558,8 @@ TlsChannelSecurityConnector::UpdateHandshakerFactoryLocked() {
 RefCountedPtr<grpc_server_security_connector>
 TlsServerSecurityConnector::CreateTlsServerSecurityConnector(
     RefCountedPtr<grpc_server_credentials> server_creds,
-    RefCountedPtr<grpc_tls_credentials_options> options) {
+    RefCountedPtr<grpc_tls_credentials_options> options,
+    bool share_session_ticket_keys) {
   if (server_creds == nullptr) {
     gpr_log(GPR_ERROR,
             "server_creds is nullptr in "
@@ -570,16 +572,18 @@ TlsServerSecurityConnector::CreateTlsServerSecurityConnector(
             "TlsServerSecurityConnectorCreate()");
     return nullptr;
   }
-  return MakeRefCounted<TlsServerSecurityConnector>(std::move(server_creds),
-                                                    std::move(options));
+  return MakeRefCounted<TlsServerSecurityConnector>(
+      std::move(server_creds), std::move(options), share_session_ticket_keys);
 }
 
 TlsServerSecurityConnector::TlsServerSecurityConnector(
     RefCountedPtr<grpc_server_credentials> server_creds,
-    RefCountedPtr<grpc_tls_credentials_options> options)
+    RefCountedPtr<grpc_tls_credentials_options> options,
+    bool share_session_ticket_keys)
     : grpc_server_security_connector(GRPC_SSL_URL_SCHEME,
                                      std::move(server_creds)),
-      options_(std::move(options)) {
+      options_(std::move(options)),
+      share_session_ticket_keys_(share_session_ticket_keys) {
   const std::string& tls_session_key_log_file_path =
       options_->tls_session_key_log_file_path();
   if (!tls_session_key_log_file_path.empty()) {
@@ -639,6 +643,7 @@ void TlsServerSecurityConnector::check_peer(
     tsi_peer peer, grpc_endpoint* /*ep*/, const ChannelArgs& /*args*/,
     RefCountedPtr<grpc_auth_context>* auth_context,
     grpc_closure* on_peer_checked) {
+  grpc_ssl_record_handshake_stats(&peer, /*is_server=*/true);
   grpc_error_handle error = grpc_ssl_check_alpn(&peer);
   if (!error.ok()) {
     ExecCtx::Run(DEBUG_LOCATION, on_peer_checked, error);
@@ -818,7 +823,7 @@ TlsServerSecurityConnector::UpdateHandshakerFactoryLocked() {
       grpc_get_tsi_tls_version(options_->min_tls_version()),
       grpc_get_tsi_tls_version(options_->max_tls_version()),
       tls_session_key_logger_.get(), options_->crl_directory().c_str(),
-      &server_handshaker_factory_);
+      share_session_ticket_keys_, &server_handshaker_factory_);
   // Free memory.
   grpc_tsi_ssl_pem_key_cert_pairs_destroy(pem_key_cert_pairs,
                                           num_key_cert_pairs);
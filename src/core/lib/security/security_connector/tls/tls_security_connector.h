@@ -180,11 +180,13 @@ class TlsServerSecurityConnector final : public grpc_server_security_connector {
   static RefCountedPtr<grpc_server_security_connector>
   CreateTlsServerSecurityConnector(
       RefCountedPtr<grpc_server_credentials> server_creds,
-      RefCountedPtr<grpc_tls_credentials_options> options);
+      RefCountedPtr<grpc_tls_credentials_options> options,
+      bool share_session_ticket_keys);
 
   TlsServerSecurityConnector(
       RefCountedPtr<grpc_server_credentials> server_creds,
-      RefCountedPtr<grpc_tls_credentials_options> options);
+      RefCountedPtr<grpc_tls_credentials_options> options,
+      bool share_session_ticket_keys);
   ~TlsServerSecurityConnector() override;
 
   void add_handshakers(const ChannelArgs& args,
@@ -269,6 +271,7 @@ class TlsServerSecurityConnector final : public grpc_server_security_connector {
   // would be deadlock errors.
   Mutex verifier_request_map_mu_;
   RefCountedPtr<grpc_tls_credentials_options> options_;
+  const bool share_session_ticket_keys_;
   grpc_tls_certificate_distributor::TlsCertificatesWatcherInterface*
       certificate_watcher_ = nullptr;
   tsi_ssl_server_handshaker_factory* server_handshaker_factory_
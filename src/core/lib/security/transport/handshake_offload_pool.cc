@@ -0,0 +1,112 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/security/transport/handshake_offload_pool.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+namespace grpc_core {
+
+namespace {
+thread_local bool g_is_pool_thread = false;
+}  // namespace
+
+HandshakeOffloadPool* HandshakeOffloadPool::GetForArgs(
+    const ChannelArgs& args) {
+  const int threads =
+      args.GetInt(GRPC_ARG_HANDSHAKE_OFFLOAD_THREADS).value_or(0);
+  if (threads <= 0) return nullptr;
+  // Created by the first caller, never destroyed.
+  static HandshakeOffloadPool* pool = new HandshakeOffloadPool(Options{
+      static_cast<size_t>(threads),
+      static_cast<size_t>(std::max(
+          1, args.GetInt(GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_PENDING)
+                 .value_or(1024))),
+      Duration::Milliseconds(
+          args.GetInt(GRPC_ARG_HANDSHAKE_OFFLOAD_QUEUE_TIMEOUT_MS)
+              .value_or(5000))});
+  return pool;
+}
+
+HandshakeOffloadPool::HandshakeOffloadPool(const Options& options)
+    : options_(options) {
+  threads_.reserve(options_.threads);
+  for (size_t i = 0; i < options_.threads; i++) {
+    threads_.emplace_back("handshake_offload", &ThreadBody, this);
+    threads_.back().Start();
+  }
+}
+
+HandshakeOffloadPool::~HandshakeOffloadPool() {
+  {
+    MutexLock lock(&mu_);
+    shutdown_ = true;
+    cv_.SignalAll();
+  }
+  for (auto& thread : threads_) thread.Join();
+}
+
+bool HandshakeOffloadPool::Run(
+    absl::AnyInvocable<void(absl::Status)> callback) {
+  MutexLock lock(&mu_);
+  if (pending_ >= options_.max_pending) return false;
+  pending_++;
+  queue_.push_back(Work{std::move(callback), Timestamp::Now()});
+  cv_.Signal();
+  return true;
+}
+
+bool HandshakeOffloadPool::IsPoolThread() { return g_is_pool_thread; }
+
+void HandshakeOffloadPool::ThreadBody(void* arg) {
+  g_is_pool_thread = true;
+  static_cast<HandshakeOffloadPool*>(arg)->RunWork();
+}
+
+void HandshakeOffloadPool::RunWork() {
+  while (true) {
+    Work work;
+    {
+      MutexLock lock(&mu_);
+      while (queue_.empty() && !shutdown_) cv_.Wait(&mu_);
+      // Queued work is drained before shutting down.
+      if (queue_.empty()) return;
+      work = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    {
+      ExecCtx exec_ctx;
+      absl::Status status;
+      if (Timestamp::Now() - work.enqueued > options_.queue_timeout) {
+        status = absl::DeadlineExceededError(
+            "Handshake step queued for too long");
+      }
+      work.callback(std::move(status));
+      work.callback = nullptr;
+    }
+    MutexLock lock(&mu_);
+    pending_--;
+  }
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,107 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_LIB_SECURITY_TRANSPORT_HANDSHAKE_OFFLOAD_POOL_H
+#define GRPC_SRC_CORE_LIB_SECURITY_TRANSPORT_HANDSHAKE_OFFLOAD_POOL_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <deque>
+#include <vector>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/functional/any_invocable.h"
+#include "absl/status/status.h"
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/thd.h"
+#include "src/core/lib/gprpp/time.h"
+
+// Channel arg (int, default 0): run the TSI steps of security handshakes,
+// and so their private key operations, on a pool of this many dedicated
+// threads instead of the I/O thread that received the handshake bytes.
+// The pool is shared by the process and sized by the first channel or
+// server that enables it.
+#define GRPC_ARG_HANDSHAKE_OFFLOAD_THREADS \
+  "grpc.experimental.handshake_offload_threads"
+// Channel arg (int, default 1024): with handshake offload, the number of TSI
+// steps that may be queued or running at once. Handshakes that would exceed
+// it fail immediately.
+#define GRPC_ARG_HANDSHAKE_OFFLOAD_MAX_PENDING \
+  "grpc.experimental.handshake_offload_max_pending"
+// Channel arg (int, default 5000): with handshake offload, handshakes fail
+// when one of their TSI steps was queued for longer than this many
+// milliseconds.
+#define GRPC_ARG_HANDSHAKE_OFFLOAD_QUEUE_TIMEOUT_MS \
+  "grpc.experimental.handshake_offload_queue_timeout_ms"
+
+namespace grpc_core {
+
+// Bounded pool of threads running CPU heavy handshake steps.
+class HandshakeOffloadPool {
+ public:
+  struct Options {
+    size_t threads;
+    size_t max_pending;
+    Duration queue_timeout;
+  };
+
+  // Returns the pool of the process if \a args enable it, creating it if
+  // needed, or nullptr.
+  static HandshakeOffloadPool* GetForArgs(const ChannelArgs& args);
+
+  explicit HandshakeOffloadPool(const Options& options);
+  ~HandshakeOffloadPool();
+
+  HandshakeOffloadPool(const HandshakeOffloadPool&) = delete;
+  HandshakeOffloadPool& operator=(const HandshakeOffloadPool&) = delete;
+
+  // Queues \a callback to run on a pool thread, with an ExecCtx. It is
+  // passed a DEADLINE_EXCEEDED status instead of OK if it was queued for too
+  // long. Returns false without running it if too many callbacks are
+  // pending.
+  bool Run(absl::AnyInvocable<void(absl::Status)> callback);
+
+  // Returns true if the current thread belongs to a pool.
+  static bool IsPoolThread();
+
+ private:
+  struct Work {
+    absl::AnyInvocable<void(absl::Status)> callback;
+    Timestamp enqueued;
+  };
+
+  static void ThreadBody(void* arg);
+  void RunWork();
+
+  const Options options_;
+  Mutex mu_;
+  CondVar cv_;
+  std::deque<Work> queue_ ABSL_GUARDED_BY(mu_);
+  // Callbacks queued or running.
+  size_t pending_ ABSL_GUARDED_BY(mu_) = 0;
+  bool shutdown_ ABSL_GUARDED_BY(mu_) = false;
+  std::vector<Thread> threads_;
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SECURITY_TRANSPORT_HANDSHAKE_OFFLOAD_POOL_H
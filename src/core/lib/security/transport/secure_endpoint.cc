@@ -71,10 +71,11 @@ struct secure_endpoint {
                   tsi_zero_copy_grpc_protector* zero_copy_protector,
                   grpc_endpoint* transport, grpc_slice* leftover_slices,
                   const grpc_channel_args* channel_args,
-                  size_t leftover_nslices)
+                  size_t leftover_nslices, bool kernel_writes)
       : wrapped_ep(transport),
         protector(protector),
-        zero_copy_protector(zero_copy_protector) {
+        zero_copy_protector(zero_copy_protector),
+        kernel_writes(kernel_writes) {
     base.vtable = vtable;
     gpr_mu_init(&protector_mu);
     GRPC_CLOSURE_INIT(&on_read, ::on_read, this, grpc_schedule_on_exec_ctx);
@@ -94,11 +95,15 @@ struct secure_endpoint {
     if (zero_copy_protector) {
       read_staging_buffer = grpc_empty_slice();
       write_staging_buffer = grpc_empty_slice();
+    } else if (kernel_writes) {
+      read_staging_buffer = memory_owner.MakePooledSlice(
+          grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
+      write_staging_buffer = grpc_empty_slice();
     } else {
-      read_staging_buffer =
-          memory_owner.MakeSlice(grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
-      write_staging_buffer =
-          memory_owner.MakeSlice(grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
+      read_staging_buffer = memory_owner.MakePooledSlice(
+          grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
+      write_staging_buffer = memory_owner.MakePooledSlice(
+          grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
     }
     has_posted_reclaimer.store(false, std::memory_order_relaxed);
     min_progress_size = 1;
@@ -123,6 +128,8 @@ struct secure_endpoint {
   grpc_endpoint* wrapped_ep;
   struct tsi_frame_protector* protector;
   struct tsi_zero_copy_grpc_protector* zero_copy_protector;
+  // Writes are encrypted by the kernel (kTLS): they go to wrapped_ep as is.
+  const bool kernel_writes;
   gpr_mu protector_mu;
   grpc_core::Mutex read_mu;
   grpc_core::Mutex write_mu;
@@ -229,8 +236,8 @@ static void flush_read_staging_buffer(secure_endpoint* ep, uint8_t** cur,
                                       uint8_t** end)
     ABSL_EXCLUSIVE_LOCKS_REQUIRED(ep->read_mu) {
   grpc_slice_buffer_add_indexed(ep->read_buffer, ep->read_staging_buffer);
-  ep->read_staging_buffer =
-      ep->memory_owner.MakeSlice(grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
+  ep->read_staging_buffer = ep->memory_owner.MakePooledSlice(
+      grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
   *cur = GRPC_SLICE_START_PTR(ep->read_staging_buffer);
   *end = GRPC_SLICE_END_PTR(ep->read_staging_buffer);
 }
@@ -374,8 +381,8 @@ static void flush_write_staging_buffer(secure_endpoint* ep, uint8_t** cur,
                                        uint8_t** end)
     ABSL_EXCLUSIVE_LOCKS_REQUIRED(ep->write_mu) {
   grpc_slice_buffer_add_indexed(&ep->output_buffer, ep->write_staging_buffer);
-  ep->write_staging_buffer =
-      ep->memory_owner.MakeSlice(grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
+  ep->write_staging_buffer = ep->memory_owner.MakePooledSlice(
+      grpc_core::MemoryRequest(STAGING_BUFFER_SIZE));
   *cur = GRPC_SLICE_START_PTR(ep->write_staging_buffer);
   *end = GRPC_SLICE_END_PTR(ep->write_staging_buffer);
   maybe_post_reclaimer(ep);
@@ -387,6 +394,21 @@ static void endpoint_write(grpc_endpoint* secure_ep, grpc_slice_buffer* slices,
   tsi_result result = TSI_OK;
   secure_endpoint* ep = reinterpret_cast<secure_endpoint*>(secure_ep);
 
+  if (ep->kernel_writes) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_trace_secure_endpoint)) {
+      for (i = 0; i < slices->count; i++) {
+        char* data =
+            grpc_dump_slice(slices->slices[i], GPR_DUMP_HEX | GPR_DUMP_ASCII);
+        gpr_log(GPR_INFO, "WRITE %p: %s", ep, data);
+        gpr_free(data);
+      }
+    }
+    // No copy: the slices are handed to the wrapped endpoint, which owns
+    // them until cb runs just as it would ours.
+    grpc_endpoint_write(ep->wrapped_ep, slices, cb, arg, max_frame_size);
+    return;
+  }
+
   {
     grpc_core::MutexLock l(&ep->write_mu);
     uint8_t* cur = GRPC_SLICE_START_PTR(ep->write_staging_buffer);
@@ -559,8 +581,18 @@ grpc_endpoint* grpc_secure_endpoint_create(
     struct tsi_zero_copy_grpc_protector* zero_copy_protector,
     grpc_endpoint* to_wrap, grpc_slice* leftover_slices,
     const grpc_channel_args* channel_args, size_t leftover_nslices) {
-  secure_endpoint* ep =
-      new secure_endpoint(&vtable, protector, zero_copy_protector, to_wrap,
-                          leftover_slices, channel_args, leftover_nslices);
+  secure_endpoint* ep = new secure_endpoint(
+      &vtable, protector, zero_copy_protector, to_wrap, leftover_slices,
+      channel_args, leftover_nslices, /*kernel_writes=*/false);
+  return &ep->base;
+}
+
+grpc_endpoint* grpc_secure_endpoint_create_with_kernel_writes(
+    struct tsi_frame_protector* protector, grpc_endpoint* to_wrap,
+    grpc_slice* leftover_slices, const grpc_channel_args* channel_args,
+    size_t leftover_nslices) {
+  secure_endpoint* ep = new secure_endpoint(
+      &vtable, protector, /*zero_copy_protector=*/nullptr, to_wrap,
+      leftover_slices, channel_args, leftover_nslices, /*kernel_writes=*/true);
   return &ep->base;
 }
@@ -40,4 +40,13 @@ grpc_endpoint* grpc_secure_endpoint_create(
     grpc_endpoint* to_wrap, grpc_slice* leftover_slices,
     const grpc_channel_args* channel_args, size_t leftover_nslices);
 
+// Like grpc_secure_endpoint_create(), for a connection whose writes are
+// encrypted by the kernel (see tsi_ssl_handshaker_result_offload_writes()):
+// protector is only used to unprotect what is read, and the data written is
+// passed to to_wrap as is.
+grpc_endpoint* grpc_secure_endpoint_create_with_kernel_writes(
+    struct tsi_frame_protector* protector, grpc_endpoint* to_wrap,
+    grpc_slice* leftover_slices, const grpc_channel_args* channel_args,
+    size_t leftover_nslices);
+
 #endif  // GRPC_SRC_CORE_LIB_SECURITY_TRANSPORT_SECURE_ENDPOINT_H
@@ -58,6 +58,7 @@
 #include "src/core/lib/iomgr/iomgr_fwd.h"
 #include "src/core/lib/iomgr/tcp_server.h"
 #include "src/core/lib/security/context/security_context.h"
+#include "src/core/lib/security/transport/handshake_offload_pool.h"
 #include "src/core/lib/security/transport/secure_endpoint.h"
 #include "src/core/lib/security/transport/tsi_error.h"
 #include "src/core/lib/slice/slice.h"
@@ -88,6 +89,8 @@ class SecurityHandshaker : public Handshaker {
  private:
   grpc_error_handle DoHandshakerNextLocked(const unsigned char* bytes_received,
                                            size_t bytes_received_size);
+  grpc_error_handle CallHandshakerNextLocked(
+      const unsigned char* bytes_received, size_t bytes_received_size);
 
   grpc_error_handle OnHandshakeNextDoneLocked(
       tsi_result result, const unsigned char* bytes_to_send,
@@ -134,6 +137,8 @@ class SecurityHandshaker : public Handshaker {
   RefCountedPtr<grpc_auth_context> auth_context_;
   tsi_handshaker_result* handshaker_result_ = nullptr;
   size_t max_frame_size_ = 0;
+  const bool kernel_tls_writes_;
+  HandshakeOffloadPool* const offload_pool_;
   std::string tsi_handshake_error_;
 };
 
@@ -146,7 +151,12 @@ SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
       handshake_buffer_(
           static_cast<uint8_t*>(gpr_malloc(handshake_buffer_size_))),
       max_frame_size_(
-          std::max(0, args.GetInt(GRPC_ARG_TSI_MAX_FRAME_SIZE).value_or(0))) {
+          std::max(0, args.GetInt(GRPC_ARG_TSI_MAX_FRAME_SIZE).value_or(0))),
+      // The kernel TLS layer rejects MSG_ZEROCOPY sends.
+      kernel_tls_writes_(
+          args.GetBool(GRPC_ARG_KERNEL_TLS_WRITES).value_or(false) &&
+          !args.GetBool(GRPC_ARG_TCP_TX_ZEROCOPY_ENABLED).value_or(false)),
+      offload_pool_(HandshakeOffloadPool::GetForArgs(args)) {
   grpc_slice_buffer_init(&outgoing_);
   GRPC_CLOSURE_INIT(&on_peer_checked_, &SecurityHandshaker::OnPeerCheckedFn,
                     this, grpc_schedule_on_exec_ctx);
@@ -278,6 +288,18 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error_handle error) {
         result));
     return;
   }
+  // Offload writes to the kernel if asked to. This only pairs with a normal
+  // frame protector, which keeps unprotecting what is read.
+  bool kernel_writes = false;
+  if (kernel_tls_writes_ &&
+      (frame_protector_type == TSI_FRAME_PROTECTOR_NORMAL ||
+       frame_protector_type == TSI_FRAME_PROTECTOR_NORMAL_OR_ZERO_COPY)) {
+    const int fd = grpc_endpoint_get_fd(args_->endpoint);
+    kernel_writes =
+        fd >= 0 &&
+        tsi_handshaker_result_offload_writes(handshaker_result_, fd) == TSI_OK;
+    if (kernel_writes) frame_protector_type = TSI_FRAME_PROTECTOR_NORMAL;
+  }
   tsi_zero_copy_grpc_protector* zero_copy_protector = nullptr;
   tsi_frame_protector* protector = nullptr;
   switch (frame_protector_type) {
@@ -312,7 +334,18 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error_handle error) {
   bool has_frame_protector =
       zero_copy_protector != nullptr || protector != nullptr;
   // If we have a frame protector, create a secure endpoint.
-  if (has_frame_protector) {
+  if (kernel_writes) {
+    if (unused_bytes_size > 0) {
+      grpc_slice slice = grpc_slice_from_copied_buffer(
+          reinterpret_cast<const char*>(unused_bytes), unused_bytes_size);
+      args_->endpoint = grpc_secure_endpoint_create_with_kernel_writes(
+          protector, args_->endpoint, &slice, args_->args.ToC().get(), 1);
+      CSliceUnref(slice);
+    } else {
+      args_->endpoint = grpc_secure_endpoint_create_with_kernel_writes(
+          protector, args_->endpoint, nullptr, args_->args.ToC().get(), 0);
+    }
+  } else if (has_frame_protector) {
     if (unused_bytes_size > 0) {
       grpc_slice slice = grpc_slice_from_copied_buffer(
           reinterpret_cast<const char*>(unused_bytes), unused_bytes_size);
@@ -455,6 +488,40 @@ void SecurityHandshaker::OnHandshakeNextDoneGrpcWrapper(
 
 grpc_error_handle SecurityHandshaker::DoHandshakerNextLocked(
     const unsigned char* bytes_received, size_t bytes_received_size) {
+  if (offload_pool_ == nullptr || HandshakeOffloadPool::IsPoolThread()) {
+    return CallHandshakerNextLocked(bytes_received, bytes_received_size);
+  }
+  // The bytes are in handshake_buffer_, which is left alone until the step
+  // is done. The caller's ref is handed over to the pool callback.
+  bool queued = offload_pool_->Run(
+      [this, bytes_received, bytes_received_size](absl::Status status) {
+        RefCountedPtr<SecurityHandshaker> h(this);
+        MutexLock lock(&mu_);
+        grpc_error_handle error;
+        if (!status.ok()) {
+          error = GRPC_ERROR_CREATE_REFERENCING("Handshake offload failed",
+                                                &status, 1);
+        } else if (is_shutdown_) {
+          error = GRPC_ERROR_CREATE("Handshaker shutdown");
+        } else {
+          error = CallHandshakerNextLocked(bytes_received, bytes_received_size);
+        }
+        if (!error.ok()) {
+          HandshakeFailedLocked(error);
+        } else {
+          h.release();  // Avoid unref
+        }
+      });
+  if (!queued) {
+    return grpc_error_set_int(
+        GRPC_ERROR_CREATE("Too many handshakes pending offload"),
+        StatusIntProperty::kRpcStatus, GRPC_STATUS_RESOURCE_EXHAUSTED);
+  }
+  return absl::OkStatus();
+}
+
+grpc_error_handle SecurityHandshaker::CallHandshakerNextLocked(
+    const unsigned char* bytes_received, size_t bytes_received_size) {
   // Invoke TSI handshaker.
   const unsigned char* bytes_to_send = nullptr;
   size_t bytes_to_send_size = 0;
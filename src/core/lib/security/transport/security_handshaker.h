@@ -30,6 +30,13 @@
 #include "src/core/lib/transport/handshaker.h"
 #include "src/core/tsi/transport_security_interface.h"
 
+// Channel arg (bool, default false): once the handshake is done, have the
+// kernel encrypt the data written on the connection when the TSI
+// implementation and the platform allow it (see
+// tsi_handshaker_result_offload_writes()), falling back to the frame
+// protector otherwise.
+#define GRPC_ARG_KERNEL_TLS_WRITES "grpc.experimental.kernel_tls_writes"
+
 namespace grpc_core {
 
 /// Creates a security handshaker using \a handshaker.
@@ -0,0 +1,100 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/slice/interned_slice_table.h"
+
+#include <utility>
+
+#include "absl/hash/hash.h"
+
+#include <grpc/slice.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/gprpp/no_destruct.h"
+#include "src/core/lib/slice/slice_refcount.h"
+
+namespace grpc_core {
+
+namespace {
+// Memory budget of the process-wide table.
+constexpr size_t kGlobalTableBytes = 1024 * 1024;
+}  // namespace
+
+constexpr size_t InternedSliceTable::kMaxInternedLength;
+constexpr size_t InternedSliceTable::kNumShards;
+
+InternedSliceTable::InternedSliceTable(size_t max_bytes)
+    : max_bytes_per_shard_(max_bytes / kNumShards) {}
+
+InternedSliceTable* InternedSliceTable::Get() {
+  static NoDestruct<InternedSliceTable> table(kGlobalTableBytes);
+  return table.get();
+}
+
+size_t InternedSliceTable::EntrySize(size_t length) {
+  return length + sizeof(grpc_slice_refcount) + sizeof(Entry) +
+         2 * sizeof(absl::string_view);
+}
+
+Slice InternedSliceTable::Intern(absl::string_view bytes) {
+  // Short values are stored inline in the slice, and long ones are not
+  // worth the table space: neither is interned.
+  if (bytes.size() <= GRPC_SLICE_INLINED_SIZE ||
+      bytes.size() > kMaxInternedLength) {
+    return Slice::FromCopiedBuffer(bytes);
+  }
+  Shard& shard = shards_[absl::HashOf(bytes) % kNumShards];
+  MutexLock lock(&shard.mu);
+  auto it = shard.entries.find(bytes);
+  if (it != shard.entries.end()) {
+    global_stats().IncrementInternedSliceHits();
+    it->second.referenced = true;
+    return it->second.slice.Ref();
+  }
+  global_stats().IncrementInternedSliceMisses();
+  Slice slice = Slice::FromCopiedBuffer(bytes);
+  Slice result = slice.Ref();
+  const absl::string_view key = slice.as_string_view();
+  shard.entries.emplace(key, Entry{std::move(slice)});
+  shard.eviction_order.push_back(key);
+  shard.bytes += EntrySize(key.size());
+  total_bytes_.fetch_add(EntrySize(key.size()), std::memory_order_relaxed);
+  while (shard.bytes > max_bytes_per_shard_) EvictOne(&shard);
+  global_stats().IncrementInternedSliceTableSize(
+      total_bytes_.load(std::memory_order_relaxed));
+  return result;
+}
+
+void InternedSliceTable::EvictOne(Shard* shard) {
+  while (true) {
+    const absl::string_view key = shard->eviction_order.front();
+    shard->eviction_order.pop_front();
+    auto it = shard->entries.find(key);
+    if (it->second.referenced) {
+      // Hit since we last got here: give it another round.
+      it->second.referenced = false;
+      shard->eviction_order.push_back(key);
+      continue;
+    }
+    shard->bytes -= EntrySize(key.size());
+    total_bytes_.fetch_sub(EntrySize(key.size()), std::memory_order_relaxed);
+    shard->entries.erase(it);
+    return;
+  }
+}
+
+}  // namespace grpc_core
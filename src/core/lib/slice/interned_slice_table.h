@@ -0,0 +1,94 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GRPC_SRC_CORE_LIB_SLICE_INTERNED_SLICE_TABLE_H
+#define GRPC_SRC_CORE_LIB_SLICE_INTERNED_SLICE_TABLE_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+
+#include <atomic>
+#include <deque>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/slice/slice.h"
+
+namespace grpc_core {
+
+// A bounded table of interned slices.
+// Interning some bytes returns a slice sharing its allocation with every
+// other slice interned with the same bytes while they stay in the table, so
+// values that repeat across calls and connections (such as hot metadata
+// values) are stored once. Two interned slices with equal contents usually
+// point to the same bytes, which makes comparing data pointers a cheap fast
+// path for equality.
+// When the table is over its memory budget, entries that have not been hit
+// since the last time they were considered are evicted; slices handed out
+// stay valid after their entry is evicted.
+class InternedSliceTable {
+ public:
+  // Longest value that is interned; longer ones are just copied.
+  static constexpr size_t kMaxInternedLength = 512;
+
+  explicit InternedSliceTable(size_t max_bytes);
+
+  InternedSliceTable(const InternedSliceTable&) = delete;
+  InternedSliceTable& operator=(const InternedSliceTable&) = delete;
+
+  // The process-wide table.
+  static InternedSliceTable* Get();
+
+  // Returns a slice with the contents of \a bytes.
+  // Must be called with an ExecCtx, for stats.
+  Slice Intern(absl::string_view bytes);
+
+  // Approximate number of bytes used by the table's entries.
+  size_t MemoryUsage() const {
+    return total_bytes_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr size_t kNumShards = 16;
+
+  struct Entry {
+    Slice slice;
+    // Set on every hit, cleared when the entry is passed over for eviction.
+    bool referenced = false;
+  };
+
+  struct Shard {
+    Mutex mu;
+    // Keys point into the interned slices themselves.
+    absl::flat_hash_map<absl::string_view, Entry> entries ABSL_GUARDED_BY(mu);
+    // Keys in the order they are considered for eviction.
+    std::deque<absl::string_view> eviction_order ABSL_GUARDED_BY(mu);
+    size_t bytes ABSL_GUARDED_BY(mu) = 0;
+  };
+
+  static size_t EntrySize(size_t length);
+  void EvictOne(Shard* shard) ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard->mu);
+
+  const size_t max_bytes_per_shard_;
+  std::atomic<size_t> total_bytes_{0};
+  Shard shards_[kNumShards];
+};
+
+}  // namespace grpc_core
+
+#endif  // GRPC_SRC_CORE_LIB_SLICE_INTERNED_SLICE_TABLE_H
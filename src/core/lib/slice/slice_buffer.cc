@@ -22,6 +22,7 @@
 
 #include <string.h>
 
+#include <algorithm>
 #include <utility>
 
 #include <grpc/slice.h>
@@ -33,7 +34,14 @@
 
 namespace grpc_core {
 
+constexpr size_t SliceBuffer::kMaxCoalescedSliceSize;
+constexpr size_t SliceBuffer::kCoalesceBufferSize;
+
 void SliceBuffer::Append(Slice slice) {
+  if (coalesce_ && slice.length() <= kMaxCoalescedSliceSize) {
+    memcpy(AddCoalesced(slice.length()), slice.data(), slice.length());
+    return;
+  }
   grpc_slice_buffer_add(&slice_buffer_, slice.TakeCSlice());
 }
 
@@ -59,6 +67,31 @@ Slice SliceBuffer::RefSlice(size_t index) const {
   return Slice(CSliceRef(slice_buffer_.slices[index]));
 }
 
+uint8_t* SliceBuffer::AddCoalesced(size_t n) {
+  if (slice_buffer_.count != 0) {
+    grpc_slice& back = slice_buffer_.slices[slice_buffer_.count - 1];
+    if (back.refcount == tail_refcount_ && back.refcount != nullptr &&
+        back.data.refcounted.bytes + back.data.refcounted.length == tail_ &&
+        static_cast<size_t>(tail_end_ - tail_) >= n) {
+      back.data.refcounted.length += n;
+      slice_buffer_.length += n;
+      uint8_t* out = tail_;
+      tail_ += n;
+      return out;
+    }
+  }
+  grpc_slice tail = grpc_slice_malloc_large(std::max(n, kCoalesceBufferSize));
+  if (tail_refcount_ != nullptr) tail_refcount_->Unref(DEBUG_LOCATION);
+  tail_refcount_ = tail.refcount;
+  tail_refcount_->Ref(DEBUG_LOCATION);
+  uint8_t* out = tail.data.refcounted.bytes;
+  tail_ = out + n;
+  tail_end_ = out + tail.data.refcounted.length;
+  tail.data.refcounted.length = n;
+  grpc_slice_buffer_add_indexed(&slice_buffer_, tail);
+  return out;
+}
+
 std::string SliceBuffer::JoinIntoString() const {
   std::string result;
   result.reserve(slice_buffer_.length);
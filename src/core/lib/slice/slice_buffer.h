@@ -22,13 +22,16 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "absl/memory/memory.h"
 
 #include <grpc/slice.h>
 #include <grpc/slice_buffer.h>
 
+#include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_refcount.h"
 
 namespace grpc_core {
 
@@ -51,18 +54,29 @@ class SliceBuffer {
   SliceBuffer(const SliceBuffer& other) = delete;
   SliceBuffer(SliceBuffer&& other) noexcept {
     grpc_slice_buffer_init(&slice_buffer_);
-    grpc_slice_buffer_swap(&slice_buffer_, &other.slice_buffer_);
+    Swap(&other);
   }
   /// Upon destruction, the underlying raw slice buffer is cleaned out and all
   /// slices are unreffed.
-  ~SliceBuffer() { grpc_slice_buffer_destroy(&slice_buffer_); }
+  ~SliceBuffer() {
+    grpc_slice_buffer_destroy(&slice_buffer_);
+    if (tail_refcount_ != nullptr) tail_refcount_->Unref(DEBUG_LOCATION);
+  }
 
   SliceBuffer& operator=(const SliceBuffer&) = delete;
   SliceBuffer& operator=(SliceBuffer&& other) noexcept {
-    grpc_slice_buffer_swap(&slice_buffer_, &other.slice_buffer_);
+    Swap(&other);
     return *this;
   }
 
+  /// Switches the SliceBuffer to coalescing mode: from then on, slices of up
+  /// to kMaxCoalescedSliceSize bytes passed to Append(), and bytes added with
+  /// AddTiny(), are copied into spare capacity after the last slice rather
+  /// than each becoming a slice of their own. Buffers built from many small
+  /// pieces (such as encoded headers) then stay a handful of slices long, at
+  /// the cost of copying the small pieces.
+  void EnableCoalescing() { coalesce_ = true; }
+
   /// Appends a new slice into the SliceBuffer and makes an attempt to merge
   /// this slice with the last slice in the SliceBuffer.
   void Append(Slice slice);
@@ -119,9 +133,14 @@ class SliceBuffer {
   /// The total number of bytes held by the SliceBuffer
   size_t Length() const { return slice_buffer_.length; }
 
-  /// Swap with another slice buffer
+  /// Swap with another slice buffer, including whether coalescing is
+  /// enabled (which goes with the coalescing buffer state).
   void Swap(SliceBuffer* other) {
     grpc_slice_buffer_swap(c_slice_buffer(), other->c_slice_buffer());
+    std::swap(tail_refcount_, other->tail_refcount_);
+    std::swap(tail_, other->tail_);
+    std::swap(tail_end_, other->tail_end_);
+    std::swap(coalesce_, other->coalesce_);
   }
 
   /// Concatenate all slices and return the resulting string.
@@ -138,6 +157,7 @@ class SliceBuffer {
 
   /// Add a small amount to the end of the slice buffer.
   uint8_t* AddTiny(size_t n) {
+    if (coalesce_) return AddCoalesced(n);
     return grpc_slice_buffer_tiny_add(&slice_buffer_, n);
   }
 
@@ -152,8 +172,25 @@ class SliceBuffer {
   }
 
  private:
+  /// Largest slice Append() copies in coalescing mode, and the size of the
+  /// buffers it copies into.
+  static constexpr size_t kMaxCoalescedSliceSize = 256;
+  static constexpr size_t kCoalesceBufferSize = 512;
+
+  /// Extends the last slice by \a n bytes if it ends at the start of the
+  /// spare capacity of the coalescing buffer and there is room, otherwise
+  /// starts a new coalescing buffer. Returns where to write the bytes.
+  uint8_t* AddCoalesced(size_t n);
+
   /// The backing raw slice buffer.
   grpc_slice_buffer slice_buffer_;
+  bool coalesce_ = false;
+  /// The current coalescing buffer (of which we hold a ref, so its memory
+  /// cannot be reused while tail_ points into it), and the spare capacity at
+  /// its end that no slice has been handed.
+  grpc_slice_refcount* tail_refcount_ = nullptr;
+  uint8_t* tail_ = nullptr;
+  uint8_t* tail_end_ = nullptr;
 
 // Make failure to destruct show up in ASAN builds.
 #ifndef NDEBUG
@@ -161,6 +198,27 @@ class SliceBuffer {
 #endif
 };
 
+/// Points up to \a max_iovs entries of \a iovs (struct iovec, or anything
+/// with the same iov_base and iov_len members) at the bytes of \a sb,
+/// starting at byte \a byte_idx of slice \a *slice_idx, for a gathering
+/// write. Nothing is copied or allocated. Advances \a *slice_idx past the
+/// slices used, adds the number of bytes covered to \a *length, and returns
+/// the number of entries filled.
+template <typename IoVec>
+size_t SliceBufferToIoVecs(grpc_slice_buffer* sb, size_t* slice_idx,
+                           size_t byte_idx, IoVec* iovs, size_t max_iovs,
+                           size_t* length) {
+  size_t n = 0;
+  for (; *slice_idx != sb->count && n != max_iovs; ++*slice_idx, ++n) {
+    grpc_slice& slice = sb->slices[*slice_idx];
+    iovs[n].iov_base = GRPC_SLICE_START_PTR(slice) + byte_idx;
+    iovs[n].iov_len = GRPC_SLICE_LENGTH(slice) - byte_idx;
+    *length += iovs[n].iov_len;
+    byte_idx = 0;
+  }
+  return n;
+}
+
 }  // namespace grpc_core
 
 // Copy the first n bytes of src into memory pointed to by dst.
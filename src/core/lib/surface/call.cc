@@ -58,6 +58,7 @@
 #include <grpc/support/string_util.h>
 #include <grpc/support/time.h>
 
+#include "src/core/lib/channel/call_attribution.h"
 #include "src/core/lib/channel/call_finalization.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channelz.h"
@@ -348,7 +349,9 @@ void Call::DeleteThis() {
   RefCountedPtr<Channel> channel = std::move(channel_);
   Arena* arena = arena_;
   this->~Call();
-  channel->UpdateCallSizeEstimate(arena->Destroy());
+  size_t final_size = arena->Destroy();
+  global_stats().IncrementCallFinalSize(final_size);
+  channel->UpdateCallSizeEstimate(final_size);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -358,6 +361,9 @@ void Call::DeleteThis() {
 class FilterStackCall final : public Call {
  public:
   ~FilterStackCall() override {
+    if (attribution_ != nullptr) {
+      attribution_->attribution->FinishCall(attribution_);
+    }
     for (int i = 0; i < GRPC_CONTEXT_COUNT; ++i) {
       if (context_[i].destroy) {
         context_[i].destroy(context_[i].value);
@@ -653,6 +659,9 @@ class FilterStackCall final : public Call {
   // For 1, 4: See receiving_initial_metadata_ready() function
   // For 2, 3: See receiving_stream_ready() function
   gpr_atm recv_state_ = 0;
+
+  // Set if the channel attributes call costs (see GRPC_ARG_CALL_ATTRIBUTION).
+  CallAttribution::CallState* attribution_ = nullptr;
 };
 
 grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
@@ -709,14 +718,24 @@ grpc_error_handle FilterStackCall::Create(grpc_call_create_args* args,
     add_init_error(&error, absl_status_to_grpc_error(call->InitParent(
                                parent, args->propagation_mask)));
   }
+  CallAttribution* attribution = channel->call_attribution();
+  if (attribution != nullptr) {
+    call->attribution_ =
+        attribution->StartCall(channel->attributed_filters(), channel_stack,
+                               call->call_stack(), arena);
+    if (call->is_client()) call->attribution_->method = Slice(CSliceRef(path));
+  }
   // initial refcount dropped by grpc_call_unref
   grpc_call_element_args call_args = {
       call->call_stack(), args->server_transport_data,
       call->context_,     path,
       call->start_time_,  call->send_deadline(),
       call->arena(),      &call->call_combiner_};
-  add_init_error(&error, grpc_call_stack_init(channel_stack, 1, DestroyCall,
-                                              call, &call_args));
+  {
+    CallAttribution::CallScope attribution_scope(call->attribution_);
+    add_init_error(&error, grpc_call_stack_init(channel_stack, 1, DestroyCall,
+                                                call, &call_args));
+  }
   // Publish this call to parent only after the call stack has been initialized.
   if (parent != nullptr) {
     call->PublishToParent(parent);
@@ -778,6 +797,11 @@ void FilterStackCall::ReleaseCall(void* call, grpc_error_handle /*error*/) {
 
 void FilterStackCall::DestroyCall(void* call, grpc_error_handle /*error*/) {
   auto* c = static_cast<FilterStackCall*>(call);
+  if (c->attribution_ != nullptr && !c->is_client()) {
+    const Slice* path =
+        c->recv_initial_metadata_.get_pointer(HttpPathMetadata());
+    if (path != nullptr) c->attribution_->method = path->Ref();
+  }
   c->recv_initial_metadata_.Clear();
   c->recv_trailing_metadata_.Clear();
   c->receiving_slice_buffer_.reset();
@@ -796,6 +820,7 @@ void FilterStackCall::DestroyCall(void* call, grpc_error_handle /*error*/) {
   c->status_error_.set(absl::OkStatus());
   c->final_info_.stats.latency =
       gpr_cycle_counter_sub(gpr_get_cycle_counter(), c->start_time_);
+  CallAttribution::CallScope attribution_scope(c->attribution_);
   grpc_call_stack_destroy(c->call_stack(), &c->final_info_,
                           GRPC_CLOSURE_INIT(&c->release_call_, ReleaseCall, c,
                                             grpc_schedule_on_exec_ctx));
@@ -839,6 +864,8 @@ void FilterStackCall::ExecuteBatch(grpc_transport_stream_op_batch* batch,
         static_cast<FilterStackCall*>(batch->handler_private.extra_arg);
     grpc_call_element* elem = call->call_elem(0);
     GRPC_CALL_LOG_OP(GPR_INFO, elem, batch);
+    CallAttribution::CallScope attribution_scope(call->attribution_);
+    CallAttribution::FilterScope filter_attribution_scope(elem);
     elem->filter->start_transport_stream_op_batch(elem, batch);
   };
   batch->handler_private.extra_arg = this;
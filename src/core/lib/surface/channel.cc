@@ -36,6 +36,7 @@
 #include <grpc/support/log.h>
 #include <grpc/support/time.h>
 
+#include "src/core/lib/channel/call_attribution.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/channel/channel_stack_builder_impl.h"
@@ -77,7 +78,12 @@ Channel::Channel(bool is_client, bool is_promising, std::string target,
                      ->memory_quota()
                      ->CreateMemoryOwner(target)),
       target_(std::move(target)),
-      channel_stack_(std::move(channel_stack)) {
+      channel_stack_(std::move(channel_stack)),
+      call_attribution_(channel_args.GetObjectRef<CallAttribution>()) {
+  if (call_attribution_ != nullptr) {
+    attributed_filters_ =
+        call_attribution_->FiltersForStack(channel_stack_.get());
+  }
   // We need to make sure that grpc_shutdown() does not shut things down
   // until after the channel is destroyed.  However, the channel may not
   // actually be destroyed by the time grpc_channel_destroy() returns,
@@ -193,9 +199,15 @@ absl::StatusOr<RefCountedPtr<Channel>> Channel::Create(
   // We only need to do this for clients here. For servers, this will be
   // done in src/core/lib/surface/server.cc.
   if (grpc_channel_stack_type_is_client(channel_stack_type)) {
+    RefCountedPtr<CallAttribution> call_attribution;
+    if (args.GetBool(GRPC_ARG_CALL_ATTRIBUTION).value_or(false)) {
+      call_attribution = MakeRefCounted<CallAttribution>();
+      args = args.SetObject(call_attribution);
+    }
     // Check whether channelz is enabled.
-    if (args.GetBool(GRPC_ARG_ENABLE_CHANNELZ)
-            .value_or(GRPC_ENABLE_CHANNELZ_DEFAULT)) {
+    static constexpr ChannelArgs::Key kEnableChannelz(
+        GRPC_ARG_ENABLE_CHANNELZ);
+    if (args.GetBool(kEnableChannelz).value_or(GRPC_ENABLE_CHANNELZ_DEFAULT)) {
       // Get parameters needed to create the channelz node.
       const size_t channel_tracer_max_memory = std::max(
           0,
@@ -212,6 +224,9 @@ absl::StatusOr<RefCountedPtr<Channel>> Channel::Create(
       channelz_node->AddTraceEvent(
           channelz::ChannelTrace::Severity::Info,
           grpc_slice_from_static_string("Channel created"));
+      if (call_attribution != nullptr) {
+        channelz_node->SetCallAttribution(std::move(call_attribution));
+      }
       // Add channelz node to channel args.
       // We remove the is_internal_channel arg, since we no longer need it.
       args = args.Remove(GRPC_ARG_CHANNELZ_IS_INTERNAL_CHANNEL)
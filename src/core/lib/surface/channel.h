@@ -28,6 +28,7 @@
 #include <map>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/base/thread_annotations.h"
 #include "absl/status/statusor.h"
@@ -40,6 +41,7 @@
 #include <grpc/impl/compression_types.h>
 #include <grpc/slice.h>
 
+#include "src/core/lib/channel/call_attribution.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_fwd.h"
 #include "src/core/lib/channel/channel_stack.h"  // IWYU pragma: keep
@@ -125,6 +127,16 @@ class Channel : public RefCounted<Channel>,
 
   channelz::ChannelNode* channelz_node() const { return channelz_node_.get(); }
 
+  // Null unless call costs are attributed (see GRPC_ARG_CALL_ATTRIBUTION).
+  CallAttribution* call_attribution() const {
+    return call_attribution_.get();
+  }
+  // The totals of each filter of channel_stack(), for call_attribution().
+  const std::vector<CallAttribution::FilterTotals*>& attributed_filters()
+      const {
+    return attributed_filters_;
+  }
+
   size_t CallSizeEstimate() {
     // We round up our current estimate to the NEXT value of kRoundUpSize.
     // This ensures:
@@ -174,6 +186,8 @@ class Channel : public RefCounted<Channel>,
   MemoryAllocator allocator_;
   std::string target_;
   const RefCountedPtr<grpc_channel_stack> channel_stack_;
+  const RefCountedPtr<CallAttribution> call_attribution_;
+  std::vector<CallAttribution::FilterTotals*> attributed_filters_;
 };
 
 }  // namespace grpc_core
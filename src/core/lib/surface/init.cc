@@ -71,7 +71,9 @@ static bool g_shutting_down ABSL_GUARDED_BY(g_init_mu) = false;
 
 static bool maybe_prepend_client_auth_filter(
     grpc_core::ChannelStackBuilder* builder) {
-  if (builder->channel_args().Contains(GRPC_ARG_SECURITY_CONNECTOR)) {
+  static constexpr grpc_core::ChannelArgs::Key kSecurityConnector(
+      GRPC_ARG_SECURITY_CONNECTOR);
+  if (builder->channel_args().Contains(kSecurityConnector)) {
     builder->PrependFilter(&grpc_core::ClientAuthFilter::kFilter);
   }
   return true;
@@ -79,7 +81,9 @@ static bool maybe_prepend_client_auth_filter(
 
 static bool maybe_prepend_server_auth_filter(
     grpc_core::ChannelStackBuilder* builder) {
-  if (builder->channel_args().Contains(GRPC_SERVER_CREDENTIALS_ARG)) {
+  static constexpr grpc_core::ChannelArgs::Key kServerCredentials(
+      GRPC_SERVER_CREDENTIALS_ARG);
+  if (builder->channel_args().Contains(kServerCredentials)) {
     builder->PrependFilter(&grpc_core::ServerAuthFilter::kFilter);
   }
   return true;
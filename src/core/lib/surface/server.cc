@@ -44,6 +44,7 @@
 #include <grpc/support/log.h>
 #include <grpc/support/time.h>
 
+#include "src/core/lib/channel/call_attribution.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_args_preconditioning.h"
 #include "src/core/lib/channel/channel_trace.h"
@@ -670,7 +671,14 @@ RefCountedPtr<channelz::ServerNode> CreateChannelzNode(
 }  // namespace
 
 Server::Server(const ChannelArgs& args)
-    : channel_args_(args), channelz_node_(CreateChannelzNode(args)) {}
+    : channel_args_(args), channelz_node_(CreateChannelzNode(args)) {
+  if (args.GetBool(GRPC_ARG_CALL_ATTRIBUTION).value_or(false)) {
+    call_attribution_ = MakeRefCounted<CallAttribution>();
+    if (channelz_node_ != nullptr) {
+      channelz_node_->SetCallAttribution(call_attribution_);
+    }
+  }
+}
 
 Server::~Server() {
   // Remove the cq pollsets from the config_fetcher.
@@ -737,8 +745,10 @@ grpc_error_handle Server::SetupTransport(
     const ChannelArgs& args,
     const RefCountedPtr<channelz::SocketNode>& socket_node) {
   // Create channel.
-  absl::StatusOr<RefCountedPtr<Channel>> channel =
-      Channel::Create(nullptr, args, GRPC_SERVER_CHANNEL, transport);
+  absl::StatusOr<RefCountedPtr<Channel>> channel = Channel::Create(
+      nullptr,
+      call_attribution_ == nullptr ? args : args.SetObject(call_attribution_),
+      GRPC_SERVER_CHANNEL, transport);
   if (!channel.ok()) {
     return absl_status_to_grpc_error(channel.status());
   }
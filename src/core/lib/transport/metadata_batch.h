@@ -848,6 +848,50 @@ class CopySink {
   Output* dst_;
 };
 
+// Encoder to copy some metadata into a map with a different set of traits.
+// Traits known to both maps are copied as values; encodable traits that the
+// destination does not know are passed on in their wire form (and so parsed
+// again should the destination know them after all); non-encodable traits
+// that the destination does not know are dropped.
+template <typename Output>
+class ConvertSink {
+ public:
+  explicit ConvertSink(Output* dst) : dst_(dst) {}
+
+  template <class T, class V>
+  void Encode(T trait, const V& value) {
+    Convert(trait, value, typename Output::template HasTrait<T>(),
+            std::integral_constant<bool, IsEncodableTrait<T>::value>());
+  }
+
+  void Encode(const Slice& key, const Slice& value) {
+    dst_->Append(key.as_string_view(), value.Ref(),
+                 [](absl::string_view, const Slice&) {});
+  }
+
+ private:
+  template <class T, class V, class Encodable>
+  void Convert(T trait, const V& value, std::true_type, Encodable) {
+    dst_->Set(trait, value);
+  }
+
+  template <class T, class Encodable>
+  void Convert(T trait, const Slice& value, std::true_type, Encodable) {
+    dst_->Set(trait, value.AsOwned());
+  }
+
+  template <class T, class V>
+  void Convert(T, const V& value, std::false_type, std::true_type) {
+    dst_->Append(T::key(), Slice(T::Encode(value)),
+                 [](absl::string_view, const Slice&) {});
+  }
+
+  template <class T, class V>
+  void Convert(T, const V&, std::false_type, std::false_type) {}
+
+  Output* dst_;
+};
+
 // Callable for the ForEach in Encode() -- for each value, call the
 // appropriate encoder method.
 template <typename Encoder>
@@ -1053,6 +1097,10 @@ class MetadataMap {
   MetadataMap(const MetadataMap&) = delete;
   MetadataMap& operator=(const MetadataMap&) = delete;
   MetadataMap(MetadataMap&&) noexcept;
+
+  // std::true_type if Which is one of Traits, std::false_type otherwise.
+  template <typename Which>
+  using HasTrait = absl::disjunction<std::is_same<Which, Traits>...>;
   // We never create MetadataMap directly, instead we create Derived, but we
   // want to be able to move it without redeclaring this.
   // NOLINTNEXTLINE(misc-unconventional-assign-operator)
@@ -1235,6 +1283,16 @@ class MetadataMap {
   void Clear();
   size_t TransportSize() const;
   Derived Copy() const;
+  // Copy into a map with a (possibly) different set of traits - see
+  // metadata_detail::ConvertSink for how traits missing from Output are
+  // handled.
+  template <typename Output>
+  Output CopyAs() const {
+    Output out(unknown_.arena());
+    metadata_detail::ConvertSink<Output> sink(&out);
+    ForEach(&sink);
+    return out;
+  }
   bool empty() const { return table_.empty() && unknown_.empty(); }
   size_t count() const { return table_.count() + unknown_.size(); }
 
@@ -1333,4 +1391,75 @@ struct grpc_metadata_batch : public grpc_metadata_batch_base {
   using grpc_metadata_batch_base::grpc_metadata_batch_base;
 };
 
+namespace grpc_core {
+
+// grpc_metadata_batch can hold any metadata for any direction of a call, and
+// is what transports and filters exchange. The following batches are laid
+// out for one direction only, and so are much smaller: they are meant for
+// metadata that is held onto for a while, with CopyAs() converting to and
+// from grpc_metadata_batch at the edges.
+// Metadata that is valid in another direction is kept as an unknown key/value
+// pair (so survives a round trip through these types), except for
+// non-encodable metadata which is dropped.
+//
+// They are not used for the batches in FilterStackCall or in transports: one
+// call object serves both clients and servers (so send_initial_metadata is
+// client metadata on one side and server metadata on the other), and those
+// batches are handed by pointer to the filter stack as grpc_metadata_batch,
+// so converting there would add a copy to every call instead of saving space.
+
+// Metadata sent by a client at the start of a call.
+struct ClientInitialMetadataBatch
+    : public MetadataMap<
+          ClientInitialMetadataBatch, HttpPathMetadata, HttpAuthorityMetadata,
+          HttpMethodMetadata, HttpSchemeMetadata, ContentTypeMetadata,
+          TeMetadata, GrpcEncodingMetadata, GrpcInternalEncodingRequest,
+          GrpcAcceptEncodingMetadata, GrpcTimeoutMetadata,
+          GrpcPreviousRpcAttemptsMetadata, UserAgentMetadata, HostMetadata,
+          GrpcTraceBinMetadata, GrpcTagsBinMetadata, GrpcLbClientStatsMetadata,
+          LbTokenMetadata, PeerString, WaitForReady> {
+  using MetadataMap<ClientInitialMetadataBatch, HttpPathMetadata,
+                    HttpAuthorityMetadata, HttpMethodMetadata,
+                    HttpSchemeMetadata, ContentTypeMetadata, TeMetadata,
+                    GrpcEncodingMetadata, GrpcInternalEncodingRequest,
+                    GrpcAcceptEncodingMetadata, GrpcTimeoutMetadata,
+                    GrpcPreviousRpcAttemptsMetadata, UserAgentMetadata,
+                    HostMetadata, GrpcTraceBinMetadata, GrpcTagsBinMetadata,
+                    GrpcLbClientStatsMetadata, LbTokenMetadata, PeerString,
+                    WaitForReady>::MetadataMap;
+};
+
+// Metadata sent by a server before its first message.
+struct ServerInitialMetadataBatch
+    : public MetadataMap<ServerInitialMetadataBatch, HttpStatusMetadata,
+                         ContentTypeMetadata, GrpcEncodingMetadata,
+                         GrpcInternalEncodingRequest,
+                         GrpcAcceptEncodingMetadata, LbCostBinMetadata,
+                         PeerString, GrpcTrailersOnly> {
+  using MetadataMap<ServerInitialMetadataBatch, HttpStatusMetadata,
+                    ContentTypeMetadata, GrpcEncodingMetadata,
+                    GrpcInternalEncodingRequest, GrpcAcceptEncodingMetadata,
+                    LbCostBinMetadata, PeerString,
+                    GrpcTrailersOnly>::MetadataMap;
+};
+
+// Metadata sent by a server at the end of a call (including trailers-only
+// responses).
+struct ServerTrailingMetadataBatch
+    : public MetadataMap<
+          ServerTrailingMetadataBatch, HttpStatusMetadata, ContentTypeMetadata,
+          GrpcStatusMetadata, GrpcMessageMetadata, GrpcRetryPushbackMsMetadata,
+          EndpointLoadMetricsBinMetadata, GrpcServerStatsBinMetadata,
+          LbCostBinMetadata, GrpcStreamNetworkState, PeerString,
+          GrpcStatusContext, GrpcStatusFromWire, GrpcTrailersOnly> {
+  using MetadataMap<
+      ServerTrailingMetadataBatch, HttpStatusMetadata, ContentTypeMetadata,
+      GrpcStatusMetadata, GrpcMessageMetadata, GrpcRetryPushbackMsMetadata,
+      EndpointLoadMetricsBinMetadata, GrpcServerStatsBinMetadata,
+      LbCostBinMetadata, GrpcStreamNetworkState, PeerString, GrpcStatusContext,
+      GrpcStatusFromWire, GrpcTrailersOnly>::MetadataMap;
+};
+
+}  // namespace grpc_core
+
 #endif  // GRPC_SRC_CORE_LIB_TRANSPORT_METADATA_BATCH_H
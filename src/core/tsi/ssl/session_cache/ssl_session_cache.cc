@@ -20,6 +20,12 @@
 
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "absl/hash/hash.h"
+
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 
@@ -30,6 +36,13 @@
 
 namespace tsi {
 
+namespace {
+// Caches are only sharded when each shard can hold at least this many
+// sessions, so that small caches keep an exact LRU order.
+constexpr size_t kMinShardCapacity = 64;
+constexpr size_t kMaxShards = 16;
+}  // namespace
+
 /// Node for single cached session.
 class SslSessionLRUCache::Node {
  public:
@@ -43,8 +56,9 @@ class SslSessionLRUCache::Node {
 
   const std::string& key() const { return key_; }
 
-  /// Returns a copy of the node's cache session.
-  SslSessionPtr CopySession() const { return session_->CopySession(); }
+  /// Returns the node's cached session. It stays valid if the node is
+  /// evicted or updated meanwhile.
+  std::shared_ptr<SslCachedSession> session() const { return session_; }
 
   /// Set the \a session (which is moved) for the node.
   void SetSession(SslSessionPtr session) {
@@ -55,17 +69,52 @@ class SslSessionLRUCache::Node {
   friend class SslSessionLRUCache;
 
   std::string key_;
-  std::unique_ptr<SslCachedSession> session_;
+  std::shared_ptr<SslCachedSession> session_;
 
   Node* next_ = nullptr;
   Node* prev_ = nullptr;
 };
 
-SslSessionLRUCache::SslSessionLRUCache(size_t capacity) : capacity_(capacity) {
+SslSessionLRUCache::SslSessionLRUCache(size_t capacity) {
   GPR_ASSERT(capacity > 0);
+  const size_t num_shards =
+      std::max<size_t>(1, std::min(kMaxShards, capacity / kMinShardCapacity));
+  shards_.reserve(num_shards);
+  for (size_t i = 0; i < num_shards; i++) {
+    // Spread the remainder so that shard capacities add up to \a capacity.
+    shards_.push_back(std::make_unique<Shard>(capacity / num_shards +
+                                              (i < capacity % num_shards)));
+  }
+}
+
+SslSessionLRUCache::~SslSessionLRUCache() = default;
+
+size_t SslSessionLRUCache::Size() {
+  size_t size = 0;
+  for (auto& shard : shards_) size += shard->Size();
+  return size;
+}
+
+void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
+  ShardForKey(key).Put(key, std::move(session));
+}
+
+SslSessionPtr SslSessionLRUCache::Get(const char* key) {
+  std::shared_ptr<SslCachedSession> session = ShardForKey(key).Get(key);
+  if (session == nullptr) {
+    return nullptr;
+  }
+  // Copying may deserialize the session: do it outside of the shard lock.
+  return session->CopySession();
 }
 
-SslSessionLRUCache::~SslSessionLRUCache() {
+SslSessionLRUCache::Shard& SslSessionLRUCache::ShardForKey(
+    absl::string_view key) {
+  if (shards_.size() == 1) return *shards_[0];
+  return *shards_[absl::Hash<absl::string_view>()(key) % shards_.size()];
+}
+
+SslSessionLRUCache::Shard::~Shard() {
   Node* node = use_order_list_head_;
   while (node) {
     Node* next = node->next_;
@@ -74,12 +123,7 @@ SslSessionLRUCache::~SslSessionLRUCache() {
   }
 }
 
-size_t SslSessionLRUCache::Size() {
-  grpc_core::MutexLock lock(&lock_);
-  return use_order_list_size_;
-}
-
-SslSessionLRUCache::Node* SslSessionLRUCache::FindLocked(
+SslSessionLRUCache::Node* SslSessionLRUCache::Shard::FindLocked(
     const std::string& key) {
   auto it = entry_by_key_.find(key);
   if (it == entry_by_key_.end()) {
@@ -87,16 +131,22 @@ SslSessionLRUCache::Node* SslSessionLRUCache::FindLocked(
   }
   Node* node = it->second;
   // Move to the beginning.
-  Remove(node);
-  PushFront(node);
-  AssertInvariants();
+  if (node != use_order_list_head_) {
+    Remove(node);
+    PushFront(node);
+    AssertInvariants();
+  }
   return node;
 }
 
-void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
+void SslSessionLRUCache::Shard::Put(const char* key, SslSessionPtr session) {
+  // Sessions are freed once the lock is released.
+  std::unique_ptr<Node> evicted;
+  std::shared_ptr<SslCachedSession> replaced;
   grpc_core::MutexLock lock(&lock_);
   Node* node = FindLocked(key);
   if (node != nullptr) {
+    replaced = node->session();
     node->SetSession(std::move(session));
     return;
   }
@@ -104,28 +154,33 @@ void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
   PushFront(node);
   entry_by_key_.emplace(key, node);
   AssertInvariants();
-  if (use_order_list_size_ > capacity_) {
+  if (Size() > capacity_) {
     GPR_ASSERT(use_order_list_tail_);
     node = use_order_list_tail_;
     Remove(node);
     // Order matters, key is destroyed after deleting node.
     entry_by_key_.erase(node->key());
-    delete node;
+    evicted.reset(node);
     AssertInvariants();
   }
 }
 
-SslSessionPtr SslSessionLRUCache::Get(const char* key) {
+std::shared_ptr<SslCachedSession> SslSessionLRUCache::Shard::Get(
+    const char* key) {
+  // Clients connecting to a server for the first time skip the lock.
+  if (Size() == 0) {
+    return nullptr;
+  }
   grpc_core::MutexLock lock(&lock_);
   // Key is only used for lookups.
   Node* node = FindLocked(key);
   if (node == nullptr) {
     return nullptr;
   }
-  return node->CopySession();
+  return node->session();
 }
 
-void SslSessionLRUCache::Remove(SslSessionLRUCache::Node* node) {
+void SslSessionLRUCache::Shard::Remove(SslSessionLRUCache::Node* node) {
   if (node->prev_ == nullptr) {
     use_order_list_head_ = node->next_;
   } else {
@@ -136,11 +191,11 @@ void SslSessionLRUCache::Remove(SslSessionLRUCache::Node* node) {
   } else {
     node->next_->prev_ = node->prev_;
   }
-  GPR_ASSERT(use_order_list_size_ >= 1);
-  use_order_list_size_--;
+  GPR_ASSERT(Size() >= 1);
+  size_.fetch_sub(1, std::memory_order_relaxed);
 }
 
-void SslSessionLRUCache::PushFront(SslSessionLRUCache::Node* node) {
+void SslSessionLRUCache::Shard::PushFront(SslSessionLRUCache::Node* node) {
   if (use_order_list_head_ == nullptr) {
     use_order_list_head_ = node;
     use_order_list_tail_ = node;
@@ -152,11 +207,11 @@ void SslSessionLRUCache::PushFront(SslSessionLRUCache::Node* node) {
     use_order_list_head_ = node;
     node->prev_ = nullptr;
   }
-  use_order_list_size_++;
+  size_.fetch_add(1, std::memory_order_relaxed);
 }
 
 #ifndef NDEBUG
-void SslSessionLRUCache::AssertInvariants() {
+void SslSessionLRUCache::Shard::AssertInvariants() {
   size_t size = 0;
   Node* prev = nullptr;
   Node* current = use_order_list_head_;
@@ -170,11 +225,11 @@ void SslSessionLRUCache::AssertInvariants() {
     current = current->next_;
   }
   GPR_ASSERT(prev == use_order_list_tail_);
-  GPR_ASSERT(size == use_order_list_size_);
-  GPR_ASSERT(entry_by_key_.size() == use_order_list_size_);
+  GPR_ASSERT(size == Size());
+  GPR_ASSERT(entry_by_key_.size() == Size());
 }
 #else
-void SslSessionLRUCache::AssertInvariants() {}
+void SslSessionLRUCache::Shard::AssertInvariants() {}
 #endif
 
 }  // namespace tsi
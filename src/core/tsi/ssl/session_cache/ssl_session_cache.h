@@ -21,10 +21,19 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <stddef.h>
+
+#include <atomic>
 #include <map>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include <openssl/ssl.h>
 
+#include "absl/base/thread_annotations.h"
+#include "absl/strings/string_view.h"
+
 #include <grpc/impl/grpc_types.h>
 #include <grpc/slice.h>
 #include <grpc/support/sync.h>
@@ -42,6 +51,10 @@
 /// name. Note that servers are required to share session ticket encryption keys
 /// in order for cache to be effective.
 ///
+/// Large caches are split into shards by key, each with its own lock and LRU
+/// order, so that handshakes to different servers do not contend. Eviction is
+/// then only LRU within a shard.
+///
 /// This class is thread safe.
 
 namespace tsi {
@@ -80,18 +93,35 @@ class SslSessionLRUCache
  private:
   class Node;
 
-  Node* FindLocked(const std::string& key);
-  void Remove(Node* node);
-  void PushFront(Node* node);
-  void AssertInvariants();
+  class Shard {
+   public:
+    explicit Shard(size_t capacity) : capacity_(capacity) {}
+    ~Shard();
+
+    size_t Size() { return size_.load(std::memory_order_relaxed); }
+    void Put(const char* key, SslSessionPtr session);
+    std::shared_ptr<SslCachedSession> Get(const char* key);
+
+   private:
+    Node* FindLocked(const std::string& key)
+        ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+    void Remove(Node* node) ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+    void PushFront(Node* node) ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+    void AssertInvariants() ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+    grpc_core::Mutex lock_;
+    const size_t capacity_;
+
+    Node* use_order_list_head_ ABSL_GUARDED_BY(lock_) = nullptr;
+    Node* use_order_list_tail_ ABSL_GUARDED_BY(lock_) = nullptr;
+    // Written under lock_, read without it to skip empty shards.
+    std::atomic<size_t> size_{0};
+    std::map<std::string, Node*> entry_by_key_ ABSL_GUARDED_BY(lock_);
+  };
 
-  grpc_core::Mutex lock_;
-  size_t capacity_;
+  Shard& ShardForKey(absl::string_view key);
 
-  Node* use_order_list_head_ = nullptr;
-  Node* use_order_list_tail_ = nullptr;
-  size_t use_order_list_size_ = 0;
-  std::map<std::string, Node*> entry_by_key_;
+  std::vector<std::unique_ptr<Shard>> shards_;
 };
 
 }  // namespace tsi
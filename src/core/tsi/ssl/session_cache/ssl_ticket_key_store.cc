@@ -0,0 +1,102 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/tsi/ssl/session_cache/ssl_ticket_key_store.h"
+
+#include <string.h>
+
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
+
+#include <grpc/support/log.h>
+
+#include "src/core/lib/gprpp/no_destruct.h"
+
+namespace tsi {
+
+namespace {
+// OpenSSL tickets default to a two hours lifetime: keys are kept for one to
+// two periods.
+constexpr grpc_core::Duration kDefaultRotationPeriod =
+    grpc_core::Duration::Hours(1);
+}  // namespace
+
+constexpr size_t SslTicketKeyStore::kKeyNameSize;
+
+SslTicketKeyStore* SslTicketKeyStore::Get() {
+  static grpc_core::NoDestruct<SslTicketKeyStore> store(kDefaultRotationPeriod);
+  return store.get();
+}
+
+SslTicketKeyStore::SslTicketKeyStore(grpc_core::Duration rotation_period)
+    : rotation_period_(rotation_period),
+      rotated_at_(grpc_core::Timestamp::Now()),
+      current_(NewKey()) {}
+
+SslTicketKeyStore::~SslTicketKeyStore() {
+  OPENSSL_cleanse(&current_, sizeof(current_));
+  if (previous_.has_value()) OPENSSL_cleanse(&*previous_, sizeof(Key));
+}
+
+SslTicketKeyStore::Key SslTicketKeyStore::CurrentKey() {
+  grpc_core::MutexLock lock(&mu_);
+  MaybeRotateLocked();
+  return current_;
+}
+
+bool SslTicketKeyStore::FindKey(const uint8_t* name, Key* key, bool* renew) {
+  grpc_core::MutexLock lock(&mu_);
+  MaybeRotateLocked();
+  if (memcmp(name, current_.name, kKeyNameSize) == 0) {
+    *key = current_;
+    *renew = false;
+    return true;
+  }
+  if (previous_.has_value() &&
+      memcmp(name, previous_->name, kKeyNameSize) == 0) {
+    *key = *previous_;
+    *renew = true;
+    return true;
+  }
+  return false;
+}
+
+void SslTicketKeyStore::MaybeRotateLocked() {
+  const grpc_core::Timestamp now = grpc_core::Timestamp::Now();
+  const grpc_core::Duration age = now - rotated_at_;
+  if (age < rotation_period_) return;
+  if (age < rotation_period_ * 2) {
+    previous_ = current_;
+  } else if (previous_.has_value()) {
+    // Not used for a while: the current key has expired too.
+    OPENSSL_cleanse(&*previous_, sizeof(Key));
+    previous_.reset();
+  }
+  current_ = NewKey();
+  rotated_at_ = now;
+}
+
+SslTicketKeyStore::Key SslTicketKeyStore::NewKey() {
+  Key key;
+  GPR_ASSERT(RAND_bytes(reinterpret_cast<uint8_t*>(&key), sizeof(key)) == 1);
+  return key;
+}
+
+}  // namespace tsi
@@ -0,0 +1,84 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPC_SRC_CORE_TSI_SSL_SESSION_CACHE_SSL_TICKET_KEY_STORE_H
+#define GRPC_SRC_CORE_TSI_SSL_SESSION_CACHE_SSL_TICKET_KEY_STORE_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/types/optional.h"
+
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+
+namespace tsi {
+
+/// Session ticket encryption keys shared by the TLS servers of the process
+/// that are not configured with a key of their own, so that clients can
+/// resume sessions across server credentials (eg. after a certificate reload).
+///
+/// Keys are rotated lazily every rotation period. Tickets encrypted with the
+/// previous key are still accepted for one more period, and then reissued.
+///
+/// This class is thread safe.
+class SslTicketKeyStore {
+ public:
+  static constexpr size_t kKeyNameSize = 16;
+
+  struct Key {
+    uint8_t name[kKeyNameSize];
+    // For HMAC-SHA256 and AES-256-CBC, as used by the ticket key callbacks of
+    // BoringSSL and OpenSSL.
+    uint8_t hmac_key[32];
+    uint8_t aes_key[32];
+  };
+
+  /// Returns the store shared by the process.
+  static SslTicketKeyStore* Get();
+
+  explicit SslTicketKeyStore(grpc_core::Duration rotation_period);
+  ~SslTicketKeyStore();
+
+  // Not copyable nor movable.
+  SslTicketKeyStore(const SslTicketKeyStore&) = delete;
+  SslTicketKeyStore& operator=(const SslTicketKeyStore&) = delete;
+
+  /// Returns the key to encrypt new tickets with.
+  Key CurrentKey();
+  /// Returns the key named \a name to decrypt a ticket with, or false if it
+  /// is unknown or expired. Sets \a renew if the ticket should be reissued.
+  bool FindKey(const uint8_t* name, Key* key, bool* renew);
+
+ private:
+  void MaybeRotateLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_);
+  static Key NewKey();
+
+  const grpc_core::Duration rotation_period_;
+  grpc_core::Mutex mu_;
+  grpc_core::Timestamp rotated_at_ ABSL_GUARDED_BY(mu_);
+  Key current_ ABSL_GUARDED_BY(mu_);
+  absl::optional<Key> previous_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace tsi
+
+#endif  // GRPC_SRC_CORE_TSI_SSL_SESSION_CACHE_SSL_TICKET_KEY_STORE_H
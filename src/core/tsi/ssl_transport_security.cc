@@ -33,35 +33,63 @@
 #include <sys/socket.h>
 #endif
 
+#include "src/core/lib/iomgr/port.h"
+
+#if defined(GRPC_LINUX_KTLS) && defined(OPENSSL_IS_BORINGSSL)
+#include <errno.h>
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#include <openssl/hkdf.h>
+#include <openssl/mem.h>
+#endif
+
+#include <algorithm>
 #include <string>
 
 #include <openssl/bio.h>
 #include <openssl/crypto.h>  // For OPENSSL_free
 #include <openssl/engine.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
 #include <openssl/ssl.h>
 #include <openssl/tls1.h>
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(OPENSSL_IS_BORINGSSL)
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#endif
+
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/string_view.h"
 
 #include <grpc/grpc_security.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
 #include <grpc/support/sync.h>
 #include <grpc/support/thd_id.h>
 
+#include "src/core/lib/experiments/experiments.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/tsi/ssl/key_logging/ssl_key_logging.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
+#include "src/core/tsi/ssl/session_cache/ssl_ticket_key_store.h"
 #include "src/core/tsi/ssl_transport_security_utils.h"
 #include "src/core/tsi/ssl_types.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 
 // --- Constants. ---
 
@@ -139,11 +167,31 @@ struct tsi_ssl_frame_protector {
   size_t buffer_size;
   size_t buffer_offset;
 };
+struct tsi_ssl_zero_copy_grpc_protector {
+  tsi_zero_copy_grpc_protector base;
+  // Protect and unprotect may run concurrently (the secure endpoint reads
+  // and writes under separate locks), but both drive the same SSL object and
+  // BIO pair.
+  gpr_mu mu;
+  SSL* ssl;
+  BIO* network_io;
+  size_t max_protected_frame_size;
+  // Largest plaintext sealed in one record.
+  size_t max_record_size;
+  // Gathers the plaintext of records spanning several slices.
+  unsigned char* record_buffer;
+  // Unused tail of the last slice plaintext was read into.
+  grpc_slice read_slice;
+  // Position in the protected stream: bytes of the current record header
+  // seen so far, then bytes of its body left.
+  unsigned char record_header[5];
+  size_t record_header_size;
+  size_t record_remaining;
+};
 // --- Library Initialization. ---
 
 static gpr_once g_init_openssl_once = GPR_ONCE_INIT;
 static int g_ssl_ctx_ex_factory_index = -1;
-static const unsigned char kSslSessionIdContext[] = {'g', 'r', 'p', 'c'};
 #if !defined(OPENSSL_IS_BORINGSSL) && !defined(OPENSSL_NO_ENGINE)
 static const char kSslEnginePrefix[] = "engine:";
 #endif
@@ -1015,6 +1063,196 @@ static const tsi_frame_protector_vtable frame_protector_vtable = {
     ssl_protector_destroy,
 };
 
+// --- tsi_zero_copy_grpc_protector methods implementation. ---
+
+#define TSI_SSL_RECORD_HEADER_SIZE 5
+
+// Moves all the records SSL wrote to network_io to protected_slices, as one
+// slice.
+static tsi_result ssl_zero_copy_grpc_protector_flush(
+    BIO* network_io, grpc_slice_buffer* protected_slices) {
+  const size_t pending = BIO_pending(network_io);
+  if (pending == 0) return TSI_OK;
+  grpc_slice slice = GRPC_SLICE_MALLOC(pending);
+  size_t offset = 0;
+  while (offset < pending) {
+    // A BIO pair hands out its ring buffer one contiguous part at a time.
+    int read_from_ssl =
+        BIO_read(network_io, GRPC_SLICE_START_PTR(slice) + offset,
+                 static_cast<int>(pending - offset));
+    if (read_from_ssl <= 0) {
+      gpr_log(GPR_ERROR, "Could not read from BIO after SSL_write.");
+      grpc_core::CSliceUnref(slice);
+      return TSI_INTERNAL_ERROR;
+    }
+    offset += static_cast<size_t>(read_from_ssl);
+  }
+  grpc_slice_buffer_add(protected_slices, slice);
+  return TSI_OK;
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_protect_locked(
+    tsi_ssl_zero_copy_grpc_protector* impl,
+    grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  while (unprotected_slices->length > 0) {
+    const size_t record_size =
+        std::min(unprotected_slices->length, impl->max_record_size);
+    grpc_slice* first = grpc_slice_buffer_peek_first(unprotected_slices);
+    const size_t first_size = GRPC_SLICE_LENGTH(*first);
+    tsi_result result;
+    if (first_size >= record_size) {
+      // The plaintext of the record is contiguous: seal it in place.
+      result =
+          grpc_core::DoSslWrite(impl->ssl, GRPC_SLICE_START_PTR(*first),
+                                record_size);
+      if (first_size == record_size) {
+        grpc_slice_buffer_remove_first(unprotected_slices);
+      } else {
+        grpc_slice_buffer_sub_first(unprotected_slices, record_size,
+                                    first_size);
+      }
+    } else {
+      grpc_slice_buffer_move_first_into_buffer(unprotected_slices, record_size,
+                                               impl->record_buffer);
+      result =
+          grpc_core::DoSslWrite(impl->ssl, impl->record_buffer, record_size);
+    }
+    if (result != TSI_OK) return result;
+    result =
+        ssl_zero_copy_grpc_protector_flush(impl->network_io, protected_slices);
+    if (result != TSI_OK) return result;
+  }
+  return TSI_OK;
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_protect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  gpr_mu_lock(&impl->mu);
+  tsi_result result = ssl_zero_copy_grpc_protector_protect_locked(
+      impl, unprotected_slices, protected_slices);
+  gpr_mu_unlock(&impl->mu);
+  return result;
+}
+
+// Follows the record boundaries of the protected bytes fed to SSL.
+static void ssl_zero_copy_grpc_protector_track_records(
+    tsi_ssl_zero_copy_grpc_protector* impl, const unsigned char* bytes,
+    size_t size) {
+  while (size > 0) {
+    if (impl->record_remaining > 0) {
+      const size_t body_size = std::min(size, impl->record_remaining);
+      impl->record_remaining -= body_size;
+      bytes += body_size;
+      size -= body_size;
+      continue;
+    }
+    const size_t header_size = std::min(
+        size, TSI_SSL_RECORD_HEADER_SIZE - impl->record_header_size);
+    memcpy(impl->record_header + impl->record_header_size, bytes,
+           header_size);
+    impl->record_header_size += header_size;
+    bytes += header_size;
+    size -= header_size;
+    if (impl->record_header_size == TSI_SSL_RECORD_HEADER_SIZE) {
+      // The last two bytes of the header are the length of the body.
+      impl->record_remaining =
+          (static_cast<size_t>(impl->record_header[3]) << 8) |
+          impl->record_header[4];
+      impl->record_header_size = 0;
+    }
+  }
+}
+
+// Moves all the plaintext SSL can decrypt to unprotected_slices.
+static tsi_result ssl_zero_copy_grpc_protector_drain(
+    tsi_ssl_zero_copy_grpc_protector* impl,
+    grpc_slice_buffer* unprotected_slices) {
+  while (true) {
+    if (GRPC_SLICE_LENGTH(impl->read_slice) == 0) {
+      grpc_core::CSliceUnref(impl->read_slice);
+      impl->read_slice = GRPC_SLICE_MALLOC(impl->max_record_size);
+    }
+    size_t read_size = GRPC_SLICE_LENGTH(impl->read_slice);
+    tsi_result result = grpc_core::DoSslRead(
+        impl->ssl, GRPC_SLICE_START_PTR(impl->read_slice), &read_size);
+    if (result != TSI_OK || read_size == 0) return result;
+    grpc_slice_buffer_add(unprotected_slices,
+                          grpc_slice_split_head(&impl->read_slice, read_size));
+  }
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_unprotect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices, int* min_progress_size) {
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  gpr_mu_lock(&impl->mu);
+  tsi_result result = TSI_OK;
+  for (size_t i = 0; i < protected_slices->count && result == TSI_OK; i++) {
+    const unsigned char* bytes =
+        GRPC_SLICE_START_PTR(protected_slices->slices[i]);
+    size_t size = GRPC_SLICE_LENGTH(protected_slices->slices[i]);
+    ssl_zero_copy_grpc_protector_track_records(impl, bytes, size);
+    while (size > 0) {
+      // SSL drains network_io down to the last incomplete record whenever it
+      // is read from, so there is always room to write more.
+      int written_into_ssl = BIO_write(
+          impl->network_io, bytes,
+          static_cast<int>(std::min(size, static_cast<size_t>(INT_MAX))));
+      if (written_into_ssl <= 0) {
+        gpr_log(GPR_ERROR, "Sending protected frame to ssl failed with %d",
+                written_into_ssl);
+        result = TSI_INTERNAL_ERROR;
+        break;
+      }
+      bytes += written_into_ssl;
+      size -= static_cast<size_t>(written_into_ssl);
+      result = ssl_zero_copy_grpc_protector_drain(impl, unprotected_slices);
+      if (result != TSI_OK) break;
+    }
+  }
+  grpc_slice_buffer_reset_and_unref(protected_slices);
+  if (min_progress_size != nullptr) {
+    *min_progress_size = static_cast<int>(
+        impl->record_remaining > 0
+            ? impl->record_remaining
+            : TSI_SSL_RECORD_HEADER_SIZE - impl->record_header_size);
+  }
+  gpr_mu_unlock(&impl->mu);
+  return result;
+}
+
+static void ssl_zero_copy_grpc_protector_destroy(
+    tsi_zero_copy_grpc_protector* self) {
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  gpr_free(impl->record_buffer);
+  grpc_core::CSliceUnref(impl->read_slice);
+  if (impl->ssl != nullptr) SSL_free(impl->ssl);
+  if (impl->network_io != nullptr) BIO_free(impl->network_io);
+  gpr_mu_destroy(&impl->mu);
+  gpr_free(self);
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_max_frame_size(
+    tsi_zero_copy_grpc_protector* self, size_t* max_frame_size) {
+  *max_frame_size = reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self)
+                        ->max_protected_frame_size;
+  return TSI_OK;
+}
+
+static const tsi_zero_copy_grpc_protector_vtable
+    zero_copy_grpc_protector_vtable = {
+        ssl_zero_copy_grpc_protector_protect,
+        ssl_zero_copy_grpc_protector_unprotect,
+        ssl_zero_copy_grpc_protector_destroy,
+        ssl_zero_copy_grpc_protector_max_frame_size,
+};
+
 // --- tsi_server_handshaker_factory methods implementation. ---
 
 static void tsi_ssl_handshaker_factory_destroy(
@@ -1152,7 +1390,57 @@ static tsi_result ssl_handshaker_result_extract_peer(
 static tsi_result ssl_handshaker_result_get_frame_protector_type(
     const tsi_handshaker_result* /*self*/,
     tsi_frame_protector_type* frame_protector_type) {
-  *frame_protector_type = TSI_FRAME_PROTECTOR_NORMAL;
+  *frame_protector_type = grpc_core::IsSslZeroCopyProtectorEnabled()
+                              ? TSI_FRAME_PROTECTOR_NORMAL_OR_ZERO_COPY
+                              : TSI_FRAME_PROTECTOR_NORMAL;
+  return TSI_OK;
+}
+
+// Clamps the requested max protected frame size (if any) to the supported
+// range, and returns the size to use.
+static size_t ssl_clamp_max_protected_frame_size(
+    size_t* max_output_protected_frame_size) {
+  if (max_output_protected_frame_size == nullptr) {
+    return TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  }
+  if (*max_output_protected_frame_size >
+      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
+    *max_output_protected_frame_size =
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  } else if (*max_output_protected_frame_size <
+             TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
+    *max_output_protected_frame_size =
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
+  }
+  return *max_output_protected_frame_size;
+}
+
+static tsi_result ssl_handshaker_result_create_zero_copy_grpc_protector(
+    const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
+    tsi_zero_copy_grpc_protector** protector) {
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(
+          const_cast<tsi_handshaker_result*>(self));
+  tsi_ssl_zero_copy_grpc_protector* protector_impl =
+      static_cast<tsi_ssl_zero_copy_grpc_protector*>(
+          gpr_zalloc(sizeof(*protector_impl)));
+  gpr_mu_init(&protector_impl->mu);
+  protector_impl->max_protected_frame_size =
+      ssl_clamp_max_protected_frame_size(max_output_protected_frame_size);
+  // Records are sized like the frame protector's, so that each fits in one
+  // protected frame.
+  protector_impl->max_record_size = protector_impl->max_protected_frame_size -
+                                    TSI_SSL_MAX_PROTECTION_OVERHEAD;
+  protector_impl->record_buffer = static_cast<unsigned char*>(
+      gpr_malloc(protector_impl->max_record_size));
+  protector_impl->read_slice = grpc_empty_slice();
+  // Transfer ownership of ssl and network_io to the protector.
+  protector_impl->ssl = impl->ssl;
+  impl->ssl = nullptr;
+  protector_impl->network_io = impl->network_io;
+  impl->network_io = nullptr;
+  protector_impl->base.vtable = &zero_copy_grpc_protector_vtable;
+  *protector = &protector_impl->base;
   return TSI_OK;
 }
 
@@ -1160,7 +1448,7 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
     const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
     tsi_frame_protector** protector) {
   size_t actual_max_output_protected_frame_size =
-      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+      ssl_clamp_max_protected_frame_size(max_output_protected_frame_size);
   tsi_ssl_handshaker_result* impl =
       reinterpret_cast<tsi_ssl_handshaker_result*>(
           const_cast<tsi_handshaker_result*>(self));
@@ -1168,18 +1456,6 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
       static_cast<tsi_ssl_frame_protector*>(
           gpr_zalloc(sizeof(*protector_impl)));
 
-  if (max_output_protected_frame_size != nullptr) {
-    if (*max_output_protected_frame_size >
-        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
-      *max_output_protected_frame_size =
-          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
-    } else if (*max_output_protected_frame_size <
-               TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
-      *max_output_protected_frame_size =
-          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
-    }
-    actual_max_output_protected_frame_size = *max_output_protected_frame_size;
-  }
   protector_impl->buffer_size =
       actual_max_output_protected_frame_size - TSI_SSL_MAX_PROTECTION_OVERHEAD;
   protector_impl->buffer =
@@ -1220,13 +1496,188 @@ static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
   gpr_free(impl);
 }
 
+// Only writes are offloaded to the kernel: reads keep going through SSL,
+// which handles the post-handshake messages (such as TLS 1.3 session tickets)
+// the kernel would hand back as errors.
+#if defined(GRPC_LINUX_KTLS) && defined(OPENSSL_IS_BORINGSSL)
+
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+
+// Write key material of an AES-GCM connection, split the way the kernel
+// takes it.
+struct ssl_ktls_write_keys {
+  unsigned char key[TLS_CIPHER_AES_GCM_256_KEY_SIZE];
+  size_t key_size;
+  // Implicit part of the nonce.
+  unsigned char salt[TLS_CIPHER_AES_GCM_128_SALT_SIZE];
+  // TLS 1.2: explicit part of the nonce of the next record.
+  // TLS 1.3: rest of the static IV.
+  unsigned char iv[TLS_CIPHER_AES_GCM_128_IV_SIZE];
+};
+
+// Computes HKDF-Expand-Label(secret, label, "", out_size), see RFC 8446
+// section 7.1.
+static bool ssl_ktls_hkdf_expand_label(const EVP_MD* digest,
+                                       bssl::Span<const uint8_t> secret,
+                                       absl::string_view label,
+                                       unsigned char* out, size_t out_size) {
+  static const absl::string_view kLabelPrefix = "tls13 ";
+  std::string info;
+  info.push_back(static_cast<char>(out_size >> 8));
+  info.push_back(static_cast<char>(out_size & 0xff));
+  info.push_back(static_cast<char>(kLabelPrefix.size() + label.size()));
+  absl::StrAppend(&info, kLabelPrefix, label);
+  // Empty context.
+  info.push_back(0);
+  return HKDF_expand(out, out_size, digest, secret.data(), secret.size(),
+                     reinterpret_cast<const uint8_t*>(info.data()),
+                     info.size()) == 1;
+}
+
+static bool ssl_ktls_get_write_keys(SSL* ssl, ssl_ktls_write_keys* keys) {
+  if (SSL_version(ssl) == TLS1_3_VERSION) {
+    bssl::Span<const uint8_t> read_secret;
+    bssl::Span<const uint8_t> write_secret;
+    if (!bssl::SSL_get_traffic_secrets(ssl, &read_secret, &write_secret)) {
+      return false;
+    }
+    const EVP_MD* digest =
+        SSL_CIPHER_get_handshake_digest(SSL_get_current_cipher(ssl));
+    unsigned char iv[sizeof(keys->salt) + sizeof(keys->iv)];
+    bool ok = ssl_ktls_hkdf_expand_label(digest, write_secret, "key",
+                                         keys->key, keys->key_size) &&
+              ssl_ktls_hkdf_expand_label(digest, write_secret, "iv", iv,
+                                         sizeof(iv));
+    memcpy(keys->salt, iv, sizeof(keys->salt));
+    memcpy(keys->iv, iv + sizeof(keys->salt), sizeof(keys->iv));
+    OPENSSL_cleanse(iv, sizeof(iv));
+    return ok;
+  }
+  // The TLS 1.2 key block holds the client and server MAC keys (empty for
+  // AEADs), the client and server keys, then the client and server implicit
+  // nonces, see RFC 5246 section 6.3.
+  unsigned char key_block[2 * (sizeof(keys->key) + sizeof(keys->salt))];
+  const size_t key_block_size = 2 * (keys->key_size + sizeof(keys->salt));
+  if (static_cast<size_t>(SSL_get_key_block_len(ssl)) != key_block_size ||
+      !SSL_generate_key_block(ssl, key_block, key_block_size)) {
+    return false;
+  }
+  const bool is_server = SSL_is_server(ssl);
+  memcpy(keys->key, key_block + (is_server ? keys->key_size : 0),
+         keys->key_size);
+  memcpy(keys->salt,
+         key_block + 2 * keys->key_size + (is_server ? sizeof(keys->salt) : 0),
+         sizeof(keys->salt));
+  OPENSSL_cleanse(key_block, sizeof(key_block));
+  // BoringSSL uses the record sequence number as explicit nonce.
+  const uint64_t sequence = SSL_get_write_sequence(ssl);
+  for (size_t i = 0; i < sizeof(keys->iv); i++) {
+    keys->iv[i] = static_cast<unsigned char>(
+        sequence >> (8 * (sizeof(keys->iv) - 1 - i)));
+  }
+  return true;
+}
+
+template <typename CryptoInfo>
+static bool ssl_ktls_install_write_keys(int fd, uint16_t version,
+                                        uint16_t cipher_type,
+                                        const ssl_ktls_write_keys& keys,
+                                        uint64_t sequence) {
+  CryptoInfo crypto_info;
+  memset(&crypto_info, 0, sizeof(crypto_info));
+  crypto_info.info.version = version;
+  crypto_info.info.cipher_type = cipher_type;
+  GPR_ASSERT(keys.key_size == sizeof(crypto_info.key));
+  memcpy(crypto_info.key, keys.key, sizeof(crypto_info.key));
+  memcpy(crypto_info.salt, keys.salt, sizeof(crypto_info.salt));
+  memcpy(crypto_info.iv, keys.iv, sizeof(crypto_info.iv));
+  for (size_t i = 0; i < sizeof(crypto_info.rec_seq); i++) {
+    crypto_info.rec_seq[i] = static_cast<unsigned char>(
+        sequence >> (8 * (sizeof(crypto_info.rec_seq) - 1 - i)));
+  }
+  bool ok = setsockopt(fd, SOL_TLS, TLS_TX, &crypto_info,
+                       sizeof(crypto_info)) == 0;
+  OPENSSL_cleanse(&crypto_info, sizeof(crypto_info));
+  return ok;
+}
+
+static tsi_result ssl_handshaker_result_offload_writes(
+    const tsi_handshaker_result* self, int fd) {
+  SSL* ssl = reinterpret_cast<const tsi_ssl_handshaker_result*>(self)->ssl;
+  if (ssl == nullptr || fd < 0) return TSI_INVALID_ARGUMENT;
+  uint16_t version;
+  switch (SSL_version(ssl)) {
+    case TLS1_2_VERSION:
+      version = TLS_1_2_VERSION;
+      break;
+    case TLS1_3_VERSION:
+      version = TLS_1_3_VERSION;
+      break;
+    default:
+      return TSI_UNIMPLEMENTED;
+  }
+  ssl_ktls_write_keys keys;
+  uint16_t cipher_type;
+  switch (SSL_CIPHER_get_cipher_nid(SSL_get_current_cipher(ssl))) {
+    case NID_aes_128_gcm:
+      cipher_type = TLS_CIPHER_AES_GCM_128;
+      keys.key_size = TLS_CIPHER_AES_GCM_128_KEY_SIZE;
+      break;
+    case NID_aes_256_gcm:
+      cipher_type = TLS_CIPHER_AES_GCM_256;
+      keys.key_size = TLS_CIPHER_AES_GCM_256_KEY_SIZE;
+      break;
+    default:
+      return TSI_UNIMPLEMENTED;
+  }
+  if (!ssl_ktls_get_write_keys(ssl, &keys)) {
+    OPENSSL_cleanse(&keys, sizeof(keys));
+    return TSI_UNIMPLEMENTED;
+  }
+  // Fails when the kernel was built without the tls module.
+  bool ok = setsockopt(fd, IPPROTO_TCP, TCP_ULP, "tls", sizeof("tls")) == 0;
+  if (ok) {
+    // Records already written by SSL (the end of the handshake) used
+    // sequence numbers up to this one: the kernel picks up from there.
+    const uint64_t sequence = SSL_get_write_sequence(ssl);
+    ok = cipher_type == TLS_CIPHER_AES_GCM_128
+             ? ssl_ktls_install_write_keys<tls12_crypto_info_aes_gcm_128>(
+                   fd, version, cipher_type, keys, sequence)
+             : ssl_ktls_install_write_keys<tls12_crypto_info_aes_gcm_256>(
+                   fd, version, cipher_type, keys, sequence);
+  }
+  OPENSSL_cleanse(&keys, sizeof(keys));
+  if (!ok) {
+    // A socket with the tls module attached but no keys installed still
+    // sends data as is.
+    if (GRPC_TRACE_FLAG_ENABLED(tsi_tracing_enabled)) {
+      gpr_log(GPR_INFO, "kTLS write offload unavailable: %s",
+              strerror(errno));
+    }
+    return TSI_UNIMPLEMENTED;
+  }
+  return TSI_OK;
+}
+
+#endif  // defined(GRPC_LINUX_KTLS) && defined(OPENSSL_IS_BORINGSSL)
+
 static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_extract_peer,
     ssl_handshaker_result_get_frame_protector_type,
-    nullptr,  // create_zero_copy_grpc_protector
+    ssl_handshaker_result_create_zero_copy_grpc_protector,
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
+#if defined(GRPC_LINUX_KTLS) && defined(OPENSSL_IS_BORINGSSL)
+    ssl_handshaker_result_offload_writes,
+#else
+    nullptr,  // offload_writes
+#endif
 };
 
 static tsi_result ssl_handshaker_result_create(
@@ -1751,6 +2202,95 @@ static int ssl_server_handshaker_factory_servername_callback(SSL* ssl,
   return SSL_TLSEXT_ERR_NOACK;
 }
 
+// Picks the key of the process wide tsi::SslTicketKeyStore used to encrypt or
+// decrypt a session ticket and initializes ctx with it. Returns what the
+// ticket key callback should return: 0 for an unknown key, 1 on success, 2
+// when the ticket should be renewed and -1 on error.
+static int ssl_server_ticket_key_init_cipher(uint8_t* key_name, uint8_t* iv,
+                                             EVP_CIPHER_CTX* ctx, int encrypt,
+                                             tsi::SslTicketKeyStore::Key* key) {
+  bool renew = false;
+  if (encrypt) {
+    *key = tsi::SslTicketKeyStore::Get()->CurrentKey();
+    if (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) != 1) {
+      return -1;
+    }
+    memcpy(key_name, key->name, tsi::SslTicketKeyStore::kKeyNameSize);
+    if (!EVP_EncryptInit_ex(ctx, EVP_aes_256_cbc(), nullptr, key->aes_key,
+                            iv)) {
+      return -1;
+    }
+  } else {
+    if (!tsi::SslTicketKeyStore::Get()->FindKey(key_name, key, &renew)) {
+      // Unknown key: fall back to a full handshake.
+      return 0;
+    }
+    if (!EVP_DecryptInit_ex(ctx, EVP_aes_256_cbc(), nullptr, key->aes_key,
+                            iv)) {
+      return -1;
+    }
+  }
+  return renew ? 2 : 1;
+}
+
+// Encrypts and decrypts session tickets with the shared ticket keys.
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(OPENSSL_IS_BORINGSSL)
+static int ssl_server_ticket_key_callback(SSL* /*ssl*/,
+                                          unsigned char* key_name,
+                                          unsigned char* iv,
+                                          EVP_CIPHER_CTX* ctx,
+                                          EVP_MAC_CTX* mac_ctx, int encrypt) {
+  tsi::SslTicketKeyStore::Key key;
+  int result =
+      ssl_server_ticket_key_init_cipher(key_name, iv, ctx, encrypt, &key);
+  if (result > 0) {
+    OSSL_PARAM params[] = {
+        OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST,
+                                         const_cast<char*>("SHA256"), 0),
+        OSSL_PARAM_construct_end()};
+    if (!EVP_MAC_init(mac_ctx, key.hmac_key, sizeof(key.hmac_key), params)) {
+      result = -1;
+    }
+  }
+  OPENSSL_cleanse(&key, sizeof(key));
+  return result;
+}
+#else
+static int ssl_server_ticket_key_callback(SSL* /*ssl*/, uint8_t* key_name,
+                                          uint8_t* iv, EVP_CIPHER_CTX* ctx,
+                                          HMAC_CTX* hmac_ctx, int encrypt) {
+  tsi::SslTicketKeyStore::Key key;
+  int result =
+      ssl_server_ticket_key_init_cipher(key_name, iv, ctx, encrypt, &key);
+  if (result > 0 && !HMAC_Init_ex(hmac_ctx, key.hmac_key,
+                                  sizeof(key.hmac_key), EVP_sha256(),
+                                  nullptr)) {
+    result = -1;
+  }
+  OPENSSL_cleanse(&key, sizeof(key));
+  return result;
+}
+#endif
+
+// Derives the session id context of a server from the way it verifies
+// clients, so that a session established with one verification config is
+// never resumed on a server with another one.
+static bool ssl_server_session_id_context(
+    const tsi_ssl_server_handshaker_options* options,
+    unsigned char sid_ctx[SSL_MAX_SID_CTX_LENGTH], unsigned int* sid_ctx_size) {
+  const char* roots = options->pem_client_root_certs != nullptr
+                          ? options->pem_client_root_certs
+                          : "";
+  const char* crl_directory =
+      options->crl_directory != nullptr ? options->crl_directory : "";
+  std::string config = absl::StrCat(
+      "grpc:", static_cast<int>(options->client_certificate_request), ":",
+      strlen(roots), ":", roots, ":", crl_directory);
+  static_assert(SSL_MAX_SID_CTX_LENGTH >= 32, "SHA-256 does not fit");
+  return EVP_Digest(config.data(), config.size(), sid_ctx, sid_ctx_size,
+                    EVP_sha256(), nullptr) == 1;
+}
+
 #if TSI_OPENSSL_ALPN_SUPPORT
 static int server_handshaker_factory_alpn_callback(
     SSL* /*ssl*/, const unsigned char** out, unsigned char* outlen,
@@ -2062,6 +2602,14 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
     impl->key_logger = options->key_logger->Ref();
   }
 
+  unsigned char sid_ctx[SSL_MAX_SID_CTX_LENGTH];
+  unsigned int sid_ctx_size = 0;
+  if (!ssl_server_session_id_context(options, sid_ctx, &sid_ctx_size)) {
+    gpr_log(GPR_ERROR, "Failed to derive session id context.");
+    tsi_ssl_handshaker_factory_unref(&impl->base);
+    return TSI_INTERNAL_ERROR;
+  }
+
   for (i = 0; i < options->num_key_cert_pairs; i++) {
     do {
 #if OPENSSL_VERSION_NUMBER >= 0x10100000
@@ -2090,8 +2638,7 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
 
       // Allow client cache sessions (it's needed for OpenSSL only).
       int set_sid_ctx_result = SSL_CTX_set_session_id_context(
-          impl->ssl_contexts[i], kSslSessionIdContext,
-          GPR_ARRAY_SIZE(kSslSessionIdContext));
+          impl->ssl_contexts[i], sid_ctx, sid_ctx_size);
       if (set_sid_ctx_result == 0) {
         gpr_log(GPR_ERROR, "Failed to set session id context.");
         result = TSI_INTERNAL_ERROR;
@@ -2107,6 +2654,16 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
           result = TSI_INVALID_ARGUMENT;
           break;
         }
+      } else if (options->share_session_ticket_keys) {
+        // Share rotating keys with the other servers of the process rather
+        // than using keys private to this context.
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L && !defined(OPENSSL_IS_BORINGSSL)
+        SSL_CTX_set_tlsext_ticket_key_evp_cb(impl->ssl_contexts[i],
+                                             ssl_server_ticket_key_callback);
+#else
+        SSL_CTX_set_tlsext_ticket_key_cb(impl->ssl_contexts[i],
+                                         ssl_server_ticket_key_callback);
+#endif
       }
 
       if (options->pem_client_root_certs != nullptr) {
@@ -322,6 +322,12 @@ struct tsi_ssl_server_handshaker_options {
   // checking will fail open and just log. An empty directory will not enable
   // crl checking. Only OpenSSL version > 1.1 is supported for CRL checking
   const char* crl_directory;
+  // share_session_ticket_keys, if true and session_ticket_key is NULL, makes
+  // the server encrypt session tickets with rotating keys shared by all the
+  // servers of the process that set it, so that tickets issued by one server
+  // credential can resume sessions on another one with the same verification
+  // config. If false, each server uses keys private to its SSL context.
+  bool share_session_ticket_keys;
 
   tsi_ssl_server_handshaker_options()
       : pem_key_cert_pairs(nullptr),
@@ -336,7 +342,8 @@ struct tsi_ssl_server_handshaker_options {
         min_tls_version(tsi_tls_version::TSI_TLS1_2),
         max_tls_version(tsi_tls_version::TSI_TLS1_3),
         key_logger(nullptr),
-        crl_directory(nullptr) {}
+        crl_directory(nullptr),
+        share_session_ticket_keys(false) {}
 };
 
 // Creates a server handshaker factory.
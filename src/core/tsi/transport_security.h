@@ -118,6 +118,8 @@ struct tsi_handshaker_result_vtable {
                                  const unsigned char** bytes,
                                  size_t* bytes_size);
   void (*destroy)(tsi_handshaker_result* self);
+  // May be null if the TSI implementation cannot offload writes.
+  tsi_result (*offload_writes)(const tsi_handshaker_result* self, int fd);
 };
 struct tsi_handshaker_result {
   const tsi_handshaker_result_vtable* vtable;
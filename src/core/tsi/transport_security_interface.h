@@ -279,6 +279,18 @@ tsi_result tsi_handshaker_result_get_unused_bytes(
     const tsi_handshaker_result* self, const unsigned char** bytes,
     size_t* bytes_size);
 
+// This method offloads the encryption of the data written on the connection
+// to the kernel (kTLS), given fd, the TCP socket the handshake was done on.
+// It must be called once all the handshake bytes were written to fd, and
+// before creating a frame protector. On success, it returns TSI_OK: the data
+// must then be written to fd unprotected, and the frame protector must only
+// be used to unprotect. Otherwise fd and self are left as they were, and
+// TSI_UNIMPLEMENTED is returned when the TSI implementation, the platform or
+// the negotiated parameters do not support it (for SSL, only AES-GCM TLS 1.2
+// and 1.3 connections on Linux with BoringSSL do).
+tsi_result tsi_handshaker_result_offload_writes(
+    const tsi_handshaker_result* self, int fd);
+
 // This method releases the tsi_handshaker_handshaker object. After this method
 // is called, no other method can be called on the object.
 void tsi_handshaker_result_destroy(tsi_handshaker_result* self);
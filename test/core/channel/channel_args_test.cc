@@ -19,7 +19,10 @@
 #include "src/core/lib/channel/channel_args.h"
 
 #include <string.h>
+#include <string>
 
+#include "absl/hash/hash.h"
+#include "absl/strings/str_cat.h"
 #include "gtest/gtest.h"
 
 #include <grpc/grpc.h>
@@ -106,6 +109,83 @@ TEST(ChannelArgsTest, ObjectApi) {
   EXPECT_EQ(a.GetObject<MyFancyObject>()->n, 42);
 }
 
+TEST(ChannelArgsTest, Hash) {
+  struct MyFancyObject : public RefCounted<MyFancyObject> {
+    explicit MyFancyObject(int n) : n(n) {}
+    static absl::string_view ChannelArgName() {
+      return "grpc.internal.my-fancy-object";
+    }
+    int n;
+    static int ChannelArgsCompare(const MyFancyObject* a,
+                                  const MyFancyObject* b) {
+      return a->n - b->n;
+    }
+  };
+  // Args that compare equal hash equal, regardless of insertion order or of
+  // pointer values being distinct objects.
+  ChannelArgs a = ChannelArgs()
+                      .Set("answer", 42)
+                      .Set("foo", "bar")
+                      .SetObject(MakeRefCounted<MyFancyObject>(1));
+  ChannelArgs b = ChannelArgs()
+                      .SetObject(MakeRefCounted<MyFancyObject>(1))
+                      .Set("foo", "bar")
+                      .Set("answer", 42);
+  ASSERT_EQ(a, b);
+  EXPECT_EQ(absl::HashOf(a), absl::HashOf(b));
+  EXPECT_NE(absl::HashOf(a), absl::HashOf(a.Set("answer", 43)));
+  EXPECT_NE(absl::HashOf(a), absl::HashOf(a.Set("foo", "baz")));
+  EXPECT_NE(absl::HashOf(a), absl::HashOf(a.Remove("foo")));
+}
+
+TEST(ChannelArgsTest, HashFollowsUpdates) {
+  ChannelArgs a = ChannelArgs().Set("answer", 42).Set("foo", "bar");
+  ChannelArgs b = a.Set("answer", 43).Set("baz", 1).Remove("baz");
+  EXPECT_NE(a, b);
+  b = b.Set("answer", 42);
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(absl::HashOf(a), absl::HashOf(b));
+  EXPECT_EQ(absl::HashOf(a.UnionWith(ChannelArgs().Set("x", 1))),
+            absl::HashOf(ChannelArgs().Set("x", 1).UnionWith(a)));
+  EXPECT_EQ(absl::HashOf(ChannelArgs()),
+            absl::HashOf(a.Remove("foo").Remove("answer")));
+}
+
+TEST(ChannelArgsTest, KeyLookups) {
+  static constexpr ChannelArgs::Key kAnswer("answer");
+  static constexpr ChannelArgs::Key kMissing("missing");
+  ChannelArgs args;
+  EXPECT_FALSE(args.Contains(kAnswer));
+  args = args.Set("answer", 42).Set("foo", "bar");
+  EXPECT_EQ(args.GetInt(kAnswer), 42);
+  EXPECT_EQ(args.GetInt("answer"), 42);
+  EXPECT_FALSE(args.Contains(kMissing));
+  EXPECT_EQ(args.GetString(ChannelArgs::Key("foo")), "bar");
+  args = args.Remove("answer");
+  EXPECT_FALSE(args.Contains(kAnswer));
+  EXPECT_EQ(args.GetString("foo"), "bar");
+}
+
+TEST(ChannelArgsTest, KeyLookupsAfterRemovingManyKeys) {
+  // Enough keys to set every bit of the key filter, which Remove() must
+  // rebuild without losing the bits of the keys that remain.
+  ChannelArgs args;
+  for (int i = 0; i < 200; i++) {
+    args = args.Set(absl::StrCat("grpc.key.", i), i);
+  }
+  for (int i = 0; i < 200; i += 2) {
+    args = args.Remove(absl::StrCat("grpc.key.", i));
+  }
+  for (int i = 0; i < 200; i++) {
+    const std::string key = absl::StrCat("grpc.key.", i);
+    if (i % 2 == 0) {
+      EXPECT_FALSE(args.Contains(ChannelArgs::Key(key))) << key;
+    } else {
+      EXPECT_EQ(args.GetInt(ChannelArgs::Key(key)), i) << key;
+    }
+  }
+}
+
 TEST(ChannelArgsTest, ToAndFromC) {
   const grpc_arg_pointer_vtable malloc_vtable = {
       // copy
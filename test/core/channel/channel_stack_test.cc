@@ -21,17 +21,22 @@
 #include <limits.h>
 
 #include <string>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "gtest/gtest.h"
 
 #include <grpc/support/alloc.h>
 
+#include "src/core/lib/channel/call_attribution.h"
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channel_args_preconditioning.h"
 #include "src/core/lib/config/core_configuration.h"
 #include "src/core/lib/gprpp/status_helper.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
 #include "test/core/util/test_config.h"
 
 static grpc_error_handle channel_init_func(grpc_channel_element* elem,
@@ -156,6 +161,135 @@ TEST(ChannelStackTest, CreateChannelStack) {
   grpc_slice_unref(path);
 }
 
+static grpc_error_handle attributed_channel_init_func(
+    grpc_channel_element* /*elem*/, grpc_channel_element_args* /*args*/) {
+  return absl::OkStatus();
+}
+
+static grpc_error_handle attributed_call_init_func(
+    grpc_call_element* /*elem*/, const grpc_call_element_args* /*args*/) {
+  return absl::OkStatus();
+}
+
+static void noop_call_destroy_func(grpc_call_element* /*elem*/,
+                                   const grpc_call_final_info* /*final_info*/,
+                                   grpc_closure* /*ignored*/) {}
+
+// Allocates 100 bytes from the call arena, then passes the op on.
+static void outer_call_func(grpc_call_element* elem,
+                            grpc_transport_stream_op_batch* op) {
+  static_cast<grpc_core::Arena**>(elem->channel_data)[0]->Alloc(100);
+  grpc_call_next_op(elem, op);
+}
+
+// Allocates 200 bytes from the call arena.
+static void inner_call_func(grpc_call_element* elem,
+                            grpc_transport_stream_op_batch* /*op*/) {
+  static_cast<grpc_core::Arena**>(elem->channel_data)[0]->Alloc(200);
+}
+
+TEST(ChannelStackTest, CallAttribution) {
+  const grpc_channel_filter outer_filter = {
+      outer_call_func,
+      nullptr,
+      channel_func,
+      sizeof(int),
+      attributed_call_init_func,
+      grpc_call_stack_ignore_set_pollset_or_pollset_set,
+      noop_call_destroy_func,
+      sizeof(grpc_core::Arena*),
+      attributed_channel_init_func,
+      grpc_channel_stack_no_post_init,
+      channel_destroy_func,
+      grpc_channel_next_get_info,
+      "outer_filter"};
+  const grpc_channel_filter inner_filter = {
+      inner_call_func,
+      nullptr,
+      channel_func,
+      3 * sizeof(int),
+      attributed_call_init_func,
+      grpc_call_stack_ignore_set_pollset_or_pollset_set,
+      noop_call_destroy_func,
+      sizeof(grpc_core::Arena*),
+      attributed_channel_init_func,
+      grpc_channel_stack_no_post_init,
+      channel_destroy_func,
+      grpc_channel_next_get_info,
+      "inner_filter"};
+  const grpc_channel_filter* filters[] = {&outer_filter, &inner_filter};
+  grpc_core::ExecCtx exec_ctx;
+  auto memory_quota = grpc_core::ResourceQuota::Default()->memory_quota();
+  grpc_core::MemoryAllocator memory_allocator =
+      memory_quota->CreateMemoryAllocator("test");
+  grpc_core::Arena* arena = grpc_core::Arena::Create(1024, &memory_allocator);
+  grpc_slice path = grpc_slice_from_static_string("/service/method");
+
+  auto* channel_stack = static_cast<grpc_channel_stack*>(
+      gpr_malloc(grpc_channel_stack_size(filters, 2)));
+  auto channel_args = grpc_core::CoreConfiguration::Get()
+                          .channel_args_preconditioning()
+                          .PreconditionChannelArgs(nullptr);
+  ASSERT_TRUE(GRPC_LOG_IF_ERROR(
+      "grpc_channel_stack_init",
+      grpc_channel_stack_init(1, free_channel, channel_stack, filters, 2,
+                              channel_args, "test", channel_stack)));
+  for (size_t i = 0; i < 2; i++) {
+    *static_cast<grpc_core::Arena**>(
+        grpc_channel_stack_element(channel_stack, i)->channel_data) = arena;
+  }
+
+  auto attribution = grpc_core::MakeRefCounted<grpc_core::CallAttribution>();
+  std::vector<grpc_core::CallAttribution::FilterTotals*> totals =
+      attribution->FiltersForStack(channel_stack);
+  auto* call_stack = static_cast<grpc_call_stack*>(
+      arena->Alloc(channel_stack->call_stack_size));
+  grpc_core::CallAttribution::CallState* call =
+      attribution->StartCall(totals, channel_stack, call_stack, arena);
+  call->method = grpc_core::Slice(grpc_core::CSliceRef(path));
+  const grpc_call_element_args args = {
+      call_stack,                         // call_stack
+      nullptr,                            // server_transport_data
+      nullptr,                            // context
+      path,                               // path
+      gpr_get_cycle_counter(),            // start_time
+      grpc_core::Timestamp::InfFuture(),  // deadline
+      arena,                              // arena
+      nullptr,                            // call_combiner
+  };
+  {
+    grpc_core::CallAttribution::CallScope call_scope(call);
+    ASSERT_TRUE(grpc_call_stack_init(channel_stack, 1, nullptr, nullptr, &args)
+                    .ok());
+    grpc_call_element* elem = grpc_call_stack_element(call_stack, 0);
+    grpc_core::CallAttribution::FilterScope filter_scope(elem);
+    elem->filter->start_transport_stream_op_batch(elem, nullptr);
+  }
+  // Outside of a CallScope nothing is attributed.
+  grpc_call_element* elem = grpc_call_stack_element(call_stack, 0);
+  elem->filter->start_transport_stream_op_batch(elem, nullptr);
+
+  EXPECT_EQ(totals[0]->calls.load(), 1);
+  EXPECT_EQ(totals[0]->arena_bytes.load(),
+            GPR_ROUND_UP_TO_ALIGNMENT_SIZE(sizeof(int)) +
+                GPR_ROUND_UP_TO_ALIGNMENT_SIZE(100));
+  EXPECT_EQ(totals[1]->calls.load(), 1);
+  EXPECT_EQ(totals[1]->arena_bytes.load(),
+            GPR_ROUND_UP_TO_ALIGNMENT_SIZE(3 * sizeof(int)) +
+                GPR_ROUND_UP_TO_ALIGNMENT_SIZE(200));
+  attribution->FinishCall(call);
+  const std::string json = attribution->RenderJson().Dump();
+  EXPECT_NE(json.find("\"filter\":\"outer_filter\""), std::string::npos)
+      << json;
+  EXPECT_NE(json.find("\"method\":\"/service/method\""), std::string::npos)
+      << json;
+
+  grpc_call_stack_destroy(call_stack, nullptr, nullptr);
+  arena->Destroy();
+  GRPC_CHANNEL_STACK_UNREF(channel_stack, "done");
+  grpc_slice_unref(path);
+}
+
 int main(int argc, char** argv) {
   grpc::testing::TestEnvironment env(&argc, argv);
   ::testing::InitGoogleTest(&argc, argv);
@@ -59,6 +59,13 @@ TEST_F(OutlierDetectionConfigParsingTest, ValidConfig) {
       "        \"minimumHosts\":3,\n"
       "        \"requestVolume\":4\n"
       "      },\n"
+      "      \"latencyEjection\":{\n"
+      "        \"percentile\":99,\n"
+      "        \"thresholdFactor\":2500,\n"
+      "        \"enforcementPercentage\":2,\n"
+      "        \"minimumHosts\":3,\n"
+      "        \"requestVolume\":4\n"
+      "      },\n"
       "      \"childPolicy\":[\n"
       "        {\"unknown\":{}},\n"  // Okay, since the next one exists.
       "        {\"grpclb\":{}}\n"
@@ -88,6 +95,11 @@ TEST_F(OutlierDetectionConfigParsingTest, InvalidValues) {
       "        \"threshold\":101,\n"
       "        \"enforcementPercentage\":101\n"
       "      },\n"
+      "      \"latencyEjection\":{\n"
+      "        \"percentile\":0,\n"
+      "        \"thresholdFactor\":1000,\n"
+      "        \"enforcementPercentage\":101\n"
+      "      },\n"
       "      \"childPolicy\":[\n"
       "        {\"unknown\":{}}\n"
       "      ]\n"
@@ -109,6 +121,12 @@ TEST_F(OutlierDetectionConfigParsingTest, InvalidValues) {
                   "error:value must be <= 100; "
                   "field:interval "
                   "error:seconds must be in the range [0, 315576000000]; "
+                  "field:latencyEjection.enforcement_percentage "
+                  "error:value must be <= 100; "
+                  "field:latencyEjection.percentile "
+                  "error:value must be in the range [1, 100]; "
+                  "field:latencyEjection.threshold_factor "
+                  "error:value must be > 1000; "
                   "field:maxEjectionTime "
                   "error:seconds must be in the range [0, 315576000000]; "
                   "field:max_ejection_percent error:value must be <= 100; "
@@ -18,12 +18,18 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <array>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
+#include "absl/time/clock.h"
+#include "absl/time/time.h"
+#include "absl/types/optional.h"
 #include "gtest/gtest.h"
 
 #include <grpc/grpc.h>
@@ -103,6 +109,27 @@ class OutlierDetectionTest : public LoadBalancingPolicyTest {
       return *this;
     }
 
+    ConfigBuilder& SetLatencyPercentile(uint32_t value) {
+      GetLatency()["percentile"] = value;
+      return *this;
+    }
+    ConfigBuilder& SetLatencyThresholdFactor(uint32_t value) {
+      GetLatency()["thresholdFactor"] = value;
+      return *this;
+    }
+    ConfigBuilder& SetLatencyEnforcementPercentage(uint32_t value) {
+      GetLatency()["enforcementPercentage"] = value;
+      return *this;
+    }
+    ConfigBuilder& SetLatencyMinimumHosts(uint32_t value) {
+      GetLatency()["minimumHosts"] = value;
+      return *this;
+    }
+    ConfigBuilder& SetLatencyRequestVolume(uint32_t value) {
+      GetLatency()["requestVolume"] = value;
+      return *this;
+    }
+
     RefCountedPtr<LoadBalancingPolicy::Config> Build() {
       Json config =
           Json::Array{Json::Object{{"outlier_detection_experimental", json_}}};
@@ -121,12 +148,57 @@ class OutlierDetectionTest : public LoadBalancingPolicyTest {
       return *it->second.mutable_object();
     }
 
+    Json::Object& GetLatency() {
+      auto it = json_.emplace("latencyEjection", Json::Object()).first;
+      return *it->second.mutable_object();
+    }
+
     Json::Object json_;
   };
 
   OutlierDetectionTest()
       : lb_policy_(MakeLbPolicy("outlier_detection_experimental")) {}
 
+  // Waits up to timeout for the LB policy to report a new state, sending
+  // a round of calls through picker before each check if picker is
+  // non-null.  Calls to slow_address take slow_call_time, and all other
+  // calls take fast_call_time.  Returns true if an update was reported.
+  bool WaitForStateUpdateWhileSendingCalls(
+      LoadBalancingPolicy::SubchannelPicker* picker, size_t num_addresses,
+      absl::string_view slow_address, absl::Duration slow_call_time,
+      absl::Duration fast_call_time, absl::Duration timeout) {
+    const absl::Time deadline = absl::Now() + timeout;
+    while (helper_->QueueEmpty()) {
+      if (absl::Now() > deadline) return false;
+      if (picker == nullptr) {
+        absl::SleepFor(absl::Milliseconds(10));
+        continue;
+      }
+      std::vector<
+          std::unique_ptr<LoadBalancingPolicy::SubchannelCallTrackerInterface>>
+          subchannel_call_trackers;
+      auto picks = GetCompletePicks(picker, num_addresses, {},
+                                    &subchannel_call_trackers);
+      EXPECT_TRUE(picks.has_value());
+      if (!picks.has_value()) return false;
+      for (size_t i = 0; i < picks->size(); ++i) {
+        auto& tracker = subchannel_call_trackers[i];
+        EXPECT_NE(tracker, nullptr);
+        if (tracker == nullptr) return false;
+        tracker->Start();
+        absl::SleepFor((*picks)[i] == slow_address ? slow_call_time
+                                                   : fast_call_time);
+        FakeMetadata metadata({});
+        FakeBackendMetricAccessor backend_metric_accessor({});
+        LoadBalancingPolicy::SubchannelCallTrackerInterface::FinishArgs args = {
+            (*picks)[i], absl::OkStatus(), &metadata,
+            &backend_metric_accessor};
+        tracker->Finish(args);
+      }
+    }
+    return true;
+  }
+
   OrphanablePtr<LoadBalancingPolicy> lb_policy_;
 };
 
@@ -158,6 +230,66 @@ TEST_F(OutlierDetectionTest, Basic) {
   }
 }
 
+TEST_F(OutlierDetectionTest, LatencyEjection) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  const std::array<absl::string_view, 2> kFastAddresses = {kAddresses[0],
+                                                           kAddresses[1]};
+  const absl::string_view kSlowAddress = kAddresses[2];
+  // Send an update containing three addresses, with latency ejection
+  // enabled.  Calls to the slow address take 20x as long as the others,
+  // so its 90th percentile latency is well above the 4x threshold.  A high
+  // percentile keeps the near-zero latency picks made by the helpers below
+  // from skewing the comparison.
+  absl::Status status = ApplyUpdate(
+      BuildUpdate(kAddresses, ConfigBuilder()
+                                  .SetInterval(Duration::Milliseconds(500))
+                                  .SetBaseEjectionTime(Duration::Seconds(1))
+                                  .SetLatencyPercentile(90)
+                                  .SetLatencyThresholdFactor(4000)
+                                  .SetLatencyEnforcementPercentage(100)
+                                  .SetLatencyMinimumHosts(3)
+                                  .SetLatencyRequestVolume(3)
+                                  .Build()),
+      lb_policy_.get());
+  EXPECT_TRUE(status.ok()) << status;
+  // LB policy should have reported CONNECTING state.
+  ExpectConnectingUpdate();
+  // All subchannels connect.
+  RefCountedPtr<LoadBalancingPolicy::SubchannelPicker> picker;
+  for (size_t i = 0; i < kAddresses.size(); ++i) {
+    auto* subchannel = FindSubchannel(kAddresses[i]);
+    ASSERT_NE(subchannel, nullptr) << "Address: " << kAddresses[i];
+    EXPECT_TRUE(subchannel->ConnectionRequested());
+    subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+    subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+    if (i == 0) {
+      picker = WaitForConnected();
+      ExpectRoundRobinPicks(picker.get(), {kAddresses[0]});
+    } else {
+      picker = WaitForRoundRobinListChange(
+          absl::MakeSpan(kAddresses).subspan(0, i),
+          absl::MakeSpan(kAddresses).subspan(0, i + 1));
+    }
+  }
+  ASSERT_NE(picker, nullptr);
+  // Send calls until the ejection timer sees enough of them to eject the
+  // slow address, at which point the child policy reports a new picker
+  // that only uses the fast addresses.
+  ASSERT_TRUE(WaitForStateUpdateWhileSendingCalls(
+      picker.get(), kAddresses.size(), kSlowAddress, absl::Milliseconds(40),
+      absl::Milliseconds(2), absl::Seconds(10)));
+  picker = WaitForRoundRobinListChange(kAddresses, kFastAddresses);
+  ASSERT_NE(picker, nullptr);
+  // Without any further calls, the slow address is un-ejected once the
+  // base ejection time has passed.
+  ASSERT_TRUE(WaitForStateUpdateWhileSendingCalls(
+      nullptr, 0, kSlowAddress, absl::ZeroDuration(), absl::ZeroDuration(),
+      absl::Seconds(10)));
+  picker = WaitForRoundRobinListChange(kFastAddresses, kAddresses);
+  ASSERT_NE(picker, nullptr);
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
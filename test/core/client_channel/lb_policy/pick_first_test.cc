@@ -16,6 +16,8 @@
 
 #include <stddef.h>
 
+#include <array>
+
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
 #include "gtest/gtest.h"
@@ -70,6 +72,97 @@ TEST_F(PickFirstTest, Basic) {
   }
 }
 
+TEST_F(PickFirstTest, EagerConnectWithStandbyFailover) {
+  constexpr std::array<absl::string_view, 2> kAddresses = {
+      "ipv4:127.0.0.1:443", "ipv4:127.0.0.1:444"};
+  // Send an update containing two addresses, asking for eager connect and
+  // one standby subchannel.
+  auto update = BuildUpdate(kAddresses);
+  update.args = ChannelArgs()
+                    .Set(GRPC_ARG_LB_EAGER_CONNECT, true)
+                    .Set(GRPC_ARG_LB_STANDBY_SUBCHANNELS, 1);
+  const ChannelArgs subchannel_args =
+      update.args.Set(GRPC_ARG_INHIBIT_HEALTH_CHECKING, true);
+  absl::Status status = ApplyUpdate(std::move(update), lb_policy_.get());
+  EXPECT_TRUE(status.ok()) << status;
+  // LB policy should have reported CONNECTING state.
+  ExpectConnectingUpdate();
+  auto* subchannel = FindSubchannel(kAddresses[0], subchannel_args);
+  ASSERT_NE(subchannel, nullptr);
+  auto* subchannel2 = FindSubchannel(kAddresses[1], subchannel_args);
+  ASSERT_NE(subchannel2, nullptr);
+  // Both subchannels are asked to connect right away.
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  EXPECT_TRUE(subchannel2->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel2->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  // The second subchannel connects first, so it gets selected.
+  subchannel2->SetConnectivityState(GRPC_CHANNEL_READY);
+  auto picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  EXPECT_EQ(ExpectPickComplete(picker.get()), kAddresses[1]);
+  // The first subchannel is kept as a standby, so when it connects, the
+  // LB policy does not report anything.
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  ExpectQueueEmpty();
+  // When the selected subchannel disconnects, the LB policy fails over to
+  // the standby instead of going IDLE.
+  subchannel2->SetConnectivityState(GRPC_CHANNEL_IDLE);
+  ExpectReresolutionRequest();
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  ASSERT_NE(picker, nullptr);
+  EXPECT_EQ(ExpectPickComplete(picker.get()), kAddresses[0]);
+  // The previously selected subchannel is reconnected as the new standby.
+  EXPECT_TRUE(subchannel2->ConnectionRequested());
+}
+
+TEST_F(PickFirstTest, StandbyKeptAcrossAddressUpdates) {
+  constexpr std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:443", "ipv4:127.0.0.1:444", "ipv4:127.0.0.1:445"};
+  const ChannelArgs args =
+      ChannelArgs().Set(GRPC_ARG_LB_STANDBY_SUBCHANNELS, 1);
+  const ChannelArgs subchannel_args =
+      args.Set(GRPC_ARG_INHIBIT_HEALTH_CHECKING, true);
+  auto update = BuildUpdate(kAddresses);
+  update.args = args;
+  absl::Status status = ApplyUpdate(std::move(update), lb_policy_.get());
+  EXPECT_TRUE(status.ok()) << status;
+  ExpectConnectingUpdate();
+  auto* subchannel = FindSubchannel(kAddresses[0], subchannel_args);
+  ASSERT_NE(subchannel, nullptr);
+  auto* subchannel2 = FindSubchannel(kAddresses[1], subchannel_args);
+  ASSERT_NE(subchannel2, nullptr);
+  auto* subchannel3 = FindSubchannel(kAddresses[2], subchannel_args);
+  ASSERT_NE(subchannel3, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  auto picker = WaitForConnected();
+  ASSERT_NE(picker, nullptr);
+  EXPECT_EQ(ExpectPickComplete(picker.get()), kAddresses[0]);
+  // The second address is kept connected as a standby.
+  EXPECT_TRUE(subchannel2->ConnectionRequested());
+  EXPECT_FALSE(subchannel3->ConnectionRequested());
+  subchannel2->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  subchannel2->SetConnectivityState(GRPC_CHANNEL_READY);
+  ExpectQueueEmpty();
+  // Reorder the last two addresses.  In address order, the third address
+  // would now be the standby, but the second one is kept instead, since
+  // it is already connected.
+  update = BuildUpdate({kAddresses[0], kAddresses[2], kAddresses[1]});
+  update.args = args;
+  status = ApplyUpdate(std::move(update), lb_policy_.get());
+  EXPECT_TRUE(status.ok()) << status;
+  picker = ExpectState(GRPC_CHANNEL_READY);
+  ASSERT_NE(picker, nullptr);
+  EXPECT_EQ(ExpectPickComplete(picker.get()), kAddresses[0]);
+  EXPECT_FALSE(subchannel3->ConnectionRequested());
+  // The standby is still watched: when it disconnects, it is reconnected.
+  subchannel2->SetConnectivityState(GRPC_CHANNEL_IDLE);
+  EXPECT_TRUE(subchannel2->ConnectionRequested());
+  EXPECT_FALSE(subchannel3->ConnectionRequested());
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
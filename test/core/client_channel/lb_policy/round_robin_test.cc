@@ -17,6 +17,7 @@
 #include <stddef.h>
 
 #include <array>
+#include <utility>
 
 #include "absl/status/status.h"
 #include "absl/strings/string_view.h"
@@ -25,6 +26,7 @@
 
 #include <grpc/grpc.h>
 
+#include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/gprpp/orphanable.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
 #include "src/core/lib/load_balancing/lb_policy.h"
@@ -39,14 +41,17 @@ class RoundRobinTest : public LoadBalancingPolicyTest {
  protected:
   RoundRobinTest() : lb_policy_(MakeLbPolicy("round_robin")) {}
 
-  void ExpectStartup(absl::Span<const absl::string_view> addresses) {
-    EXPECT_EQ(ApplyUpdate(BuildUpdate(addresses), lb_policy_.get()),
+  void ExpectStartup(absl::Span<const absl::string_view> addresses,
+                     const ChannelArgs& args = ChannelArgs()) {
+    LoadBalancingPolicy::UpdateArgs update = BuildUpdate(addresses);
+    update.args = args;
+    EXPECT_EQ(ApplyUpdate(std::move(update), lb_policy_.get()),
               absl::OkStatus());
     // Expect the initial CONNECTNG update with a picker that queues.
     ExpectConnectingUpdate();
     // RR should have created a subchannel for each address.
     for (size_t i = 0; i < addresses.size(); ++i) {
-      auto* subchannel = FindSubchannel(addresses[i]);
+      auto* subchannel = FindSubchannel(addresses[i], args);
       ASSERT_NE(subchannel, nullptr) << "Address: " << addresses[i];
       // RR should ask each subchannel to connect.
       EXPECT_TRUE(subchannel->ConnectionRequested());
@@ -102,6 +107,36 @@ TEST_F(RoundRobinTest, AddressUpdates) {
                               absl::MakeSpan(kAddresses).last(2));
 }
 
+TEST_F(RoundRobinTest, EagerConnectWaitsForNewAddresses) {
+  const std::array<absl::string_view, 3> kAddresses = {
+      "ipv4:127.0.0.1:441", "ipv4:127.0.0.1:442", "ipv4:127.0.0.1:443"};
+  const ChannelArgs args = ChannelArgs().Set(GRPC_ARG_LB_EAGER_CONNECT, true);
+  ExpectStartup(absl::MakeSpan(kAddresses).first(2), args);
+  // Send update to remove address 0 and add address 2.
+  LoadBalancingPolicy::UpdateArgs update =
+      BuildUpdate(absl::MakeSpan(kAddresses).last(2));
+  update.args = args;
+  EXPECT_EQ(ApplyUpdate(std::move(update), lb_policy_.get()),
+            absl::OkStatus());
+  // RR should have created a subchannel for the new address and asked it
+  // to connect.
+  auto* subchannel = FindSubchannel(kAddresses[2], args);
+  ASSERT_NE(subchannel, nullptr);
+  EXPECT_TRUE(subchannel->ConnectionRequested());
+  // Both lists share the connected subchannel for address 1, so it does not
+  // need to reconnect.
+  EXPECT_FALSE(FindSubchannel(kAddresses[1], args)->ConnectionRequested());
+  subchannel->SetConnectivityState(GRPC_CHANNEL_CONNECTING);
+  // The new list already has a READY subchannel for address 1, but with
+  // eager connect, RR keeps using the old list while address 2 is still
+  // connecting.
+  ExpectQueueEmpty();
+  // Once address 2 is connected, RR switches to the new list.
+  subchannel->SetConnectivityState(GRPC_CHANNEL_READY);
+  WaitForRoundRobinListChange(absl::MakeSpan(kAddresses).first(2),
+                              absl::MakeSpan(kAddresses).last(2));
+}
+
 // TODO(roth): Add test cases:
 // - empty address list
 // - subchannels failing connection attempts
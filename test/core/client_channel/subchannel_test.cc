@@ -0,0 +1,217 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/ext/filters/client_channel/subchannel.h"
+
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "absl/status/statusor.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+#include <grpc/support/time.h>
+
+#include "src/core/ext/filters/client_channel/local_subchannel_pool.h"
+#include "src/core/ext/filters/client_channel/subchannel_pool_interface.h"
+#include "src/core/ext/transport/chttp2/client/chttp2_connector.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channel_stack.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/host_port.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/pollset.h"
+#include "src/core/lib/iomgr/pollset_set.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "src/core/lib/transport/transport.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+// A real gRPC server for the subchannel to connect to.
+class ServerThread {
+ public:
+  explicit ServerThread(int port)
+      : address_(JoinHostPort("127.0.0.1", port)) {
+    server_ = grpc_server_create(nullptr, nullptr);
+    grpc_server_credentials* server_creds =
+        grpc_insecure_server_credentials_create();
+    GPR_ASSERT(
+        grpc_server_add_http2_port(server_, address_.c_str(), server_creds));
+    grpc_server_credentials_release(server_creds);
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+    grpc_server_register_completion_queue(server_, cq_, nullptr);
+    grpc_server_start(server_);
+    thread_ = std::thread([this]() {
+      // The completion queue should not return anything other than shutdown.
+      grpc_event ev = grpc_completion_queue_next(
+          cq_, gpr_inf_future(GPR_CLOCK_MONOTONIC), nullptr);
+      GPR_ASSERT(ev.type == GRPC_QUEUE_SHUTDOWN);
+    });
+  }
+
+  ~ServerThread() {
+    grpc_completion_queue* shutdown_cq =
+        grpc_completion_queue_create_for_pluck(nullptr);
+    grpc_server_shutdown_and_notify(server_, shutdown_cq, nullptr);
+    GPR_ASSERT(grpc_completion_queue_pluck(shutdown_cq, nullptr,
+                                           grpc_timeout_seconds_to_deadline(5),
+                                           nullptr)
+                   .type == GRPC_OP_COMPLETE);
+    grpc_completion_queue_destroy(shutdown_cq);
+    grpc_server_destroy(server_);
+    grpc_completion_queue_shutdown(cq_);
+    thread_.join();
+    grpc_completion_queue_destroy(cq_);
+  }
+
+ private:
+  const std::string address_;
+  grpc_server* server_;
+  grpc_completion_queue* cq_;
+  std::thread thread_;
+};
+
+class SubchannelTest : public ::testing::Test {
+ protected:
+  SubchannelTest() : port_(grpc_pick_unused_port_or_die()), server_(port_) {
+    pollset_ = static_cast<grpc_pollset*>(gpr_zalloc(grpc_pollset_size()));
+    grpc_pollset_init(pollset_, &mu_);
+  }
+
+  ~SubchannelTest() override {
+    ExecCtx exec_ctx;
+    if (subchannel_ != nullptr) {
+      grpc_pollset_set_del_pollset(subchannel_->pollset_set(), pollset_);
+      subchannel_.reset();
+    }
+    grpc_closure destroyed;
+    GRPC_CLOSURE_INIT(
+        &destroyed,
+        [](void* arg, grpc_error_handle /*error*/) {
+          grpc_pollset_destroy(static_cast<grpc_pollset*>(arg));
+        },
+        pollset_, grpc_schedule_on_exec_ctx);
+    grpc_pollset_shutdown(pollset_, &destroyed);
+    ExecCtx::Get()->Flush();
+    gpr_free(pollset_);
+  }
+
+  void CreateSubchannel(const ChannelArgs& args) {
+    ExecCtx exec_ctx;
+    absl::StatusOr<grpc_resolved_address> address =
+        StringToSockaddr("127.0.0.1", port_);
+    ASSERT_TRUE(address.ok()) << address.status();
+    subchannel_ = Subchannel::Create(
+        MakeOrphanable<Chttp2Connector>(), *address,
+        CoreConfiguration::Get()
+            .channel_args_preconditioning()
+            .PreconditionChannelArgs(nullptr)
+            .UnionWith(args)
+            .SetObject<SubchannelPoolInterface>(
+                MakeRefCounted<LocalSubchannelPool>()));
+    grpc_pollset_set_add_pollset(subchannel_->pollset_set(), pollset_);
+  }
+
+  // Polls until predicate returns true or the timeout expires.  Returns
+  // whether predicate returned true.
+  template <typename Predicate>
+  bool WaitFor(Predicate predicate, Duration timeout) {
+    const Timestamp deadline = Timestamp::Now() + timeout;
+    while (!predicate()) {
+      if (Timestamp::Now() > deadline) return false;
+      ExecCtx exec_ctx;
+      gpr_mu_lock(mu_);
+      GRPC_LOG_IF_ERROR(
+          "pollset_work",
+          grpc_pollset_work(pollset_, nullptr,
+                            Timestamp::Now() + Duration::Milliseconds(100)));
+      gpr_mu_unlock(mu_);
+    }
+    return true;
+  }
+
+  // Closes the transport of one of the subchannel's connections.
+  void KillConnection(ConnectedSubchannel* connection) {
+    ExecCtx exec_ctx;
+    grpc_transport_op* op = grpc_make_transport_op(nullptr);
+    op->disconnect_with_error = GRPC_ERROR_CREATE("connection killed");
+    grpc_channel_element* elem =
+        grpc_channel_stack_element(connection->channel_stack(), 0);
+    elem->filter->start_transport_op(elem, op);
+  }
+
+  const int port_;
+  ServerThread server_;
+  gpr_mu* mu_;
+  grpc_pollset* pollset_;
+  RefCountedPtr<Subchannel> subchannel_;
+};
+
+TEST_F(SubchannelTest, ReplacesLostConnectionsUpToMinConnections) {
+  CreateSubchannel(ChannelArgs()
+                       .Set(GRPC_ARG_SUBCHANNEL_MIN_CONNECTIONS, 3)
+                       .Set(GRPC_ARG_SUBCHANNEL_MAX_CONNECTIONS, 3));
+  subchannel_->RequestConnection();
+  ASSERT_TRUE(WaitFor(
+      [&]() { return subchannel_->NumConnectionsForTesting() == 3; },
+      Duration::Seconds(10)));
+  // With no calls in flight, connected_subchannel() returns the primary
+  // connection.  Killing it fails over to one of the additional connections,
+  // and a replacement is opened to get back to the minimum.
+  for (int i = 0; i < 3; ++i) {
+    RefCountedPtr<ConnectedSubchannel> connection =
+        subchannel_->connected_subchannel();
+    ASSERT_NE(connection, nullptr);
+    KillConnection(connection.get());
+    EXPECT_TRUE(WaitFor(
+        [&]() {
+          return subchannel_->connected_subchannel() != connection &&
+                 subchannel_->NumConnectionsForTesting() == 3;
+        },
+        Duration::Seconds(10)))
+        << "iteration " << i;
+  }
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
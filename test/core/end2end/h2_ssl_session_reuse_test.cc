@@ -58,7 +58,8 @@ void* tag(intptr_t t) { return reinterpret_cast<void*>(t); }
 
 gpr_timespec five_seconds_time() { return grpc_timeout_seconds_to_deadline(5); }
 
-grpc_server* server_create(grpc_completion_queue* cq, const char* server_addr) {
+grpc_server* server_create(grpc_completion_queue* cq, const char* server_addr,
+                           bool share_session_ticket_keys) {
   grpc_slice ca_slice, cert_slice, key_slice;
   GPR_ASSERT(GRPC_LOG_IF_ERROR("load_file",
                                grpc_load_file(CA_CERT_PATH, 1, &ca_slice)));
@@ -77,7 +78,11 @@ grpc_server* server_create(grpc_completion_queue* cq, const char* server_addr) {
       ca_cert, &pem_cert_key_pair, 1,
       GRPC_SSL_REQUEST_CLIENT_CERTIFICATE_AND_VERIFY, nullptr);
 
-  grpc_server* server = grpc_server_create(nullptr, nullptr);
+  auto server_args = grpc_core::ChannelArgs()
+                         .Set(GRPC_SSL_SHARE_SESSION_TICKET_KEYS_ARG,
+                              share_session_ticket_keys)
+                         .ToC();
+  grpc_server* server = grpc_server_create(server_args.get(), nullptr);
   grpc_server_register_completion_queue(server, cq, nullptr);
   GPR_ASSERT(grpc_server_add_http2_port(server, server_addr, server_creds));
   grpc_server_credentials_release(server_creds);
@@ -253,6 +258,16 @@ void drain_cq(grpc_completion_queue* cq) {
   } while (ev.type != GRPC_QUEUE_SHUTDOWN);
 }
 
+void server_destroy(grpc_completion_queue* cq, grpc_server* server) {
+  grpc_server_shutdown_and_notify(server, cq, tag(1000));
+  grpc_event ev;
+  do {
+    ev = grpc_completion_queue_next(cq, grpc_timeout_seconds_to_deadline(5),
+                                    nullptr);
+  } while (ev.type != GRPC_OP_COMPLETE || ev.tag != tag(1000));
+  grpc_server_destroy(server);
+}
+
 TEST(H2SessionReuseTest, SingleReuse) {
   int port = grpc_pick_unused_port_or_die();
 
@@ -261,7 +276,8 @@ TEST(H2SessionReuseTest, SingleReuse) {
   grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
   grpc_ssl_session_cache* cache = grpc_ssl_session_cache_create_lru(16);
 
-  grpc_server* server = server_create(cq, server_addr.c_str());
+  grpc_server* server = server_create(cq, server_addr.c_str(),
+                                      /*share_session_ticket_keys=*/false);
 
   do_round_trip(cq, server, server_addr.c_str(), cache, false);
   do_round_trip(cq, server, server_addr.c_str(), cache, true);
@@ -273,19 +289,51 @@ TEST(H2SessionReuseTest, SingleReuse) {
                  cq, grpc_timeout_milliseconds_to_deadline(100), nullptr)
                  .type == GRPC_QUEUE_TIMEOUT);
 
-  grpc_server_shutdown_and_notify(server, cq, tag(1000));
-  grpc_event ev;
-  do {
-    ev = grpc_completion_queue_next(cq, grpc_timeout_seconds_to_deadline(5),
-                                    nullptr);
-  } while (ev.type != GRPC_OP_COMPLETE || ev.tag != tag(1000));
-  grpc_server_destroy(server);
+  server_destroy(cq, server);
+
+  grpc_completion_queue_shutdown(cq);
+  drain_cq(cq);
+  grpc_completion_queue_destroy(cq);
+}
+
+// Two servers with their own credentials resume each other's sessions only
+// if both share session ticket keys.
+void check_reuse_across_servers(bool share_session_ticket_keys) {
+  std::string server_addr1 =
+      grpc_core::JoinHostPort("localhost", grpc_pick_unused_port_or_die());
+  std::string server_addr2 =
+      grpc_core::JoinHostPort("localhost", grpc_pick_unused_port_or_die());
+
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_ssl_session_cache* cache = grpc_ssl_session_cache_create_lru(16);
+
+  grpc_server* server1 =
+      server_create(cq, server_addr1.c_str(), share_session_ticket_keys);
+  grpc_server* server2 =
+      server_create(cq, server_addr2.c_str(), share_session_ticket_keys);
+
+  do_round_trip(cq, server1, server_addr1.c_str(), cache, false);
+  do_round_trip(cq, server2, server_addr2.c_str(), cache,
+                share_session_ticket_keys);
+
+  grpc_ssl_session_cache_destroy(cache);
+
+  server_destroy(cq, server1);
+  server_destroy(cq, server2);
 
   grpc_completion_queue_shutdown(cq);
   drain_cq(cq);
   grpc_completion_queue_destroy(cq);
 }
 
+TEST(H2SessionReuseTest, ReuseAcrossServersWithSharedTicketKeys) {
+  check_reuse_across_servers(/*share_session_ticket_keys=*/true);
+}
+
+TEST(H2SessionReuseTest, NoReuseAcrossServersByDefault) {
+  check_reuse_across_servers(/*share_session_ticket_keys=*/false);
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc
@@ -0,0 +1,194 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_filter.h"
+
+#include <memory>
+#include <vector>
+
+#include "absl/types/optional.h"
+#include "absl/types/variant.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/grpc.h>
+#include <grpc/status.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/promise/poll.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "test/core/promise/test_context.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+// Starts at a limit of 2 and recomputes the limit on every call.
+ChannelArgs TestChannelArgs() {
+  return ChannelArgs().Set(GRPC_ARG_ADAPTIVE_CONCURRENCY_CONFIG,
+                           "{\"algorithm\": \"AIMD\", \"initialLimit\": 2, "
+                           "\"minWindow\": \"0s\", \"windowSize\": 1}");
+}
+
+class AdaptiveConcurrencyFilterTest : public ::testing::Test {
+ protected:
+  // A call that has been passed down the filter stack and completes once
+  // its status is set.
+  struct Call {
+    explicit Call(Arena* arena)
+        : initial_metadata(arena), trailing_metadata(arena) {}
+
+    grpc_metadata_batch initial_metadata;
+    grpc_metadata_batch trailing_metadata;
+    bool started = false;
+    bool done = false;
+    ArenaPromise<ServerMetadataHandle> promise;
+  };
+
+  AdaptiveConcurrencyFilterTest()
+      : memory_allocator_(
+            ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator(
+                "test")),
+        arena_(MakeScopedArena(1024, &memory_allocator_)),
+        context_(arena_.get()) {}
+
+  // Creates a server filter, which outlives the calls made through it.
+  AdaptiveConcurrencyFilter* CreateFilter() {
+    auto filter = ServerAdaptiveConcurrencyFilter::Create(
+        TestChannelArgs(), ChannelFilter::Args());
+    GPR_ASSERT(filter.ok());
+    filters_.push_back(
+        std::make_unique<ServerAdaptiveConcurrencyFilter>(std::move(*filter)));
+    return filters_.back().get();
+  }
+
+  // Passes a call through filter.  The call is only admitted to the rest of
+  // the stack if call->started is set.
+  Call* StartCall(AdaptiveConcurrencyFilter* filter) {
+    calls_.push_back(std::make_unique<Call>(arena_.get()));
+    Call* call = calls_.back().get();
+    call->promise = filter->MakeCallPromise(
+        CallArgs{ClientMetadataHandle(&call->initial_metadata,
+                                      Arena::PooledDeleter(nullptr)),
+                 nullptr, nullptr, nullptr},
+        [call](CallArgs) {
+          call->started = true;
+          return ArenaPromise<ServerMetadataHandle>(
+              [call]() -> Poll<ServerMetadataHandle> {
+                if (!call->done) return Pending{};
+                return ServerMetadataHandle(&call->trailing_metadata,
+                                            Arena::PooledDeleter(nullptr));
+              });
+        });
+    return call;
+  }
+
+  // Makes call complete with status the next time it is polled.
+  static void CompleteCall(Call* call, grpc_status_code status) {
+    call->trailing_metadata.Set(GrpcStatusMetadata(), status);
+    call->done = true;
+  }
+
+  // Polls call, returning its status once it has completed.
+  static absl::optional<grpc_status_code> PollCall(Call* call) {
+    auto result = call->promise();
+    auto* md = absl::get_if<ServerMetadataHandle>(&result);
+    if (md == nullptr) return absl::nullopt;
+    return (*md)->get(GrpcStatusMetadata()).value_or(GRPC_STATUS_UNKNOWN);
+  }
+
+  ExecCtx exec_ctx_;
+  MemoryAllocator memory_allocator_;
+  ScopedArenaPtr arena_;
+  TestContext<Arena> context_;
+  std::vector<std::unique_ptr<ServerAdaptiveConcurrencyFilter>> filters_;
+  std::vector<std::unique_ptr<Call>> calls_;
+};
+
+TEST_F(AdaptiveConcurrencyFilterTest, MissingConfigFails) {
+  EXPECT_FALSE(ServerAdaptiveConcurrencyFilter::Create(ChannelArgs(),
+                                                       ChannelFilter::Args())
+                   .ok());
+  EXPECT_FALSE(ClientAdaptiveConcurrencyFilter::Create(ChannelArgs(),
+                                                       ChannelFilter::Args())
+                   .ok());
+}
+
+TEST_F(AdaptiveConcurrencyFilterTest, ShedsCallsAboveLimit) {
+  AdaptiveConcurrencyFilter* filter = CreateFilter();
+  Call* call1 = StartCall(filter);
+  Call* call2 = StartCall(filter);
+  EXPECT_TRUE(call1->started);
+  EXPECT_TRUE(call2->started);
+  EXPECT_EQ(PollCall(call1), absl::nullopt);
+  EXPECT_EQ(filter->limiter()->inflight(), 2);
+  // The third call is rejected without reaching the rest of the stack.
+  Call* call3 = StartCall(filter);
+  EXPECT_FALSE(call3->started);
+  EXPECT_EQ(PollCall(call3), GRPC_STATUS_RESOURCE_EXHAUSTED);
+  // Completing a call frees its slot.
+  CompleteCall(call1, GRPC_STATUS_OK);
+  EXPECT_EQ(PollCall(call1), GRPC_STATUS_OK);
+  EXPECT_EQ(filter->limiter()->inflight(), 1);
+  Call* call4 = StartCall(filter);
+  EXPECT_TRUE(call4->started);
+  // Destroying a call that has not completed (i.e. cancelling it) frees its
+  // slot too.
+  call2->promise = ArenaPromise<ServerMetadataHandle>();
+  call4->promise = ArenaPromise<ServerMetadataHandle>();
+  EXPECT_EQ(filter->limiter()->inflight(), 0);
+}
+
+TEST_F(AdaptiveConcurrencyFilterTest, OverloadedCallsReduceLimit) {
+  AdaptiveConcurrencyFilter* filter = CreateFilter();
+  EXPECT_EQ(filter->limiter()->limit(), 2);
+  Call* call = StartCall(filter);
+  ASSERT_TRUE(call->started);
+  CompleteCall(call, GRPC_STATUS_RESOURCE_EXHAUSTED);
+  EXPECT_EQ(PollCall(call), GRPC_STATUS_RESOURCE_EXHAUSTED);
+  EXPECT_EQ(filter->limiter()->limit(), 1);
+  // Only one call is admitted now.
+  EXPECT_TRUE(StartCall(filter)->started);
+  EXPECT_FALSE(StartCall(filter)->started);
+}
+
+TEST_F(AdaptiveConcurrencyFilterTest, ServerFiltersShareLimiter) {
+  AdaptiveConcurrencyFilter* filter1 = CreateFilter();
+  AdaptiveConcurrencyFilter* filter2 = CreateFilter();
+  EXPECT_EQ(filter1->limiter(), filter2->limiter());
+  EXPECT_TRUE(StartCall(filter1)->started);
+  EXPECT_TRUE(StartCall(filter2)->started);
+  EXPECT_FALSE(StartCall(filter1)->started);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
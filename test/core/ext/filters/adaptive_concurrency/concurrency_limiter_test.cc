@@ -0,0 +1,250 @@
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "src/core/ext/filters/adaptive_concurrency/concurrency_limiter.h"
+
+#include "absl/status/status.h"
+#include "absl/status/statusor.h"
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_filter.h"
+#include "src/core/ext/filters/adaptive_concurrency/adaptive_concurrency_service_config_parser.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/service_config/service_config.h"
+#include "src/core/lib/service_config/service_config_impl.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+// Recomputes the limit on every sample.
+ConcurrencyLimiter::Config EveryCallWindow(
+    ConcurrencyLimiter::Config::Algorithm algorithm) {
+  ConcurrencyLimiter::Config config;
+  config.algorithm = algorithm;
+  config.initial_limit = 10;
+  config.min_limit = 2;
+  config.max_limit = 100;
+  config.min_window = Duration::Zero();
+  config.window_size = 1;
+  return config;
+}
+
+TEST(ConcurrencyLimiterTest, ShedsAboveLimit) {
+  ExecCtx exec_ctx;
+  auto limiter = MakeRefCounted<ConcurrencyLimiter>(
+      EveryCallWindow(ConcurrencyLimiter::Config::Algorithm::kAimd));
+  for (int i = 0; i < 10; ++i) EXPECT_TRUE(limiter->TryAcquire());
+  EXPECT_FALSE(limiter->TryAcquire());
+  EXPECT_EQ(limiter->inflight(), 10);
+  limiter->ReleaseWithoutSample();
+  EXPECT_TRUE(limiter->TryAcquire());
+}
+
+TEST(ConcurrencyLimiterTest, AimdBacksOffOnDrop) {
+  ExecCtx exec_ctx;
+  auto limiter = MakeRefCounted<ConcurrencyLimiter>(
+      EveryCallWindow(ConcurrencyLimiter::Config::Algorithm::kAimd));
+  ASSERT_TRUE(limiter->TryAcquire());
+  limiter->Release(/*rtt_us=*/1000, /*dropped=*/true);
+  EXPECT_EQ(limiter->limit(), 9);
+  // Repeated drops never go below min_limit.
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(limiter->TryAcquire());
+    limiter->Release(1000, true);
+  }
+  EXPECT_EQ(limiter->limit(), 2);
+}
+
+TEST(ConcurrencyLimiterTest, AimdTreatsTimeoutAsDrop) {
+  ExecCtx exec_ctx;
+  auto config = EveryCallWindow(ConcurrencyLimiter::Config::Algorithm::kAimd);
+  config.timeout = Duration::Milliseconds(100);
+  auto limiter = MakeRefCounted<ConcurrencyLimiter>(config);
+  ASSERT_TRUE(limiter->TryAcquire());
+  limiter->Release(/*rtt_us=*/200000, /*dropped=*/false);
+  EXPECT_EQ(limiter->limit(), 9);
+}
+
+TEST(ConcurrencyLimiterTest, AimdGrowsOnlyWhenLimitIsUsed) {
+  ExecCtx exec_ctx;
+  auto limiter = MakeRefCounted<ConcurrencyLimiter>(
+      EveryCallWindow(ConcurrencyLimiter::Config::Algorithm::kAimd));
+  // A single call in flight doesn't use half of the limit.
+  ASSERT_TRUE(limiter->TryAcquire());
+  limiter->Release(1000, false);
+  EXPECT_EQ(limiter->limit(), 10);
+  // Five calls in flight do.
+  for (int i = 0; i < 5; ++i) ASSERT_TRUE(limiter->TryAcquire());
+  limiter->Release(1000, false);
+  EXPECT_EQ(limiter->limit(), 11);
+}
+
+TEST(ConcurrencyLimiterTest, GradientShrinksWhenLatencyInflates) {
+  ExecCtx exec_ctx;
+  auto limiter = MakeRefCounted<ConcurrencyLimiter>(
+      EveryCallWindow(ConcurrencyLimiter::Config::Algorithm::kGradient));
+  // Saturate the limit at a steady latency: the limit grows.
+  for (int i = 0; i < 10; ++i) {
+    while (limiter->TryAcquire()) {
+    }
+    limiter->Release(/*rtt_us=*/1000, /*dropped=*/false);
+  }
+  const uint32_t steady_limit = limiter->limit();
+  EXPECT_GT(steady_limit, 10);
+  // Latency jumps 10x: the limit shrinks.
+  for (int i = 0; i < 20; ++i) {
+    while (limiter->TryAcquire()) {
+    }
+    limiter->Release(/*rtt_us=*/10000, /*dropped=*/false);
+  }
+  EXPECT_LT(limiter->limit(), steady_limit);
+  EXPECT_GE(limiter->limit(), 2);
+}
+
+TEST(ConcurrencyLimiterMapTest, SharesLimiterForSameKeyAndConfig) {
+  ExecCtx exec_ctx;
+  ConcurrencyLimiter::Config config;
+  auto a = ConcurrencyLimiterMap::Get()->GetLimiter("a", config);
+  EXPECT_EQ(a, ConcurrencyLimiterMap::Get()->GetLimiter("a", config));
+  EXPECT_NE(a, ConcurrencyLimiterMap::Get()->GetLimiter("b", config));
+  config.max_limit = 10;
+  EXPECT_NE(a, ConcurrencyLimiterMap::Get()->GetLimiter("a", config));
+}
+
+TEST(ConcurrencyLimiterMapTest, DifferentConfigsDoNotResetEachOther) {
+  ExecCtx exec_ctx;
+  ConcurrencyLimiter::Config config1;
+  ConcurrencyLimiter::Config config2;
+  config2.max_limit = 10;
+  auto limiter1 = ConcurrencyLimiterMap::Get()->GetLimiter("a", config1);
+  ASSERT_TRUE(limiter1->TryAcquire());
+  auto limiter2 = ConcurrencyLimiterMap::Get()->GetLimiter("a", config2);
+  EXPECT_NE(limiter1, limiter2);
+  // Asking for the first config again returns the same limiter, with its
+  // state intact.
+  auto limiter = ConcurrencyLimiterMap::Get()->GetLimiter("a", config1);
+  EXPECT_EQ(limiter, limiter1);
+  EXPECT_EQ(limiter->inflight(), 1);
+  EXPECT_EQ(ConcurrencyLimiterMap::Get()->GetLimiter("a", config2), limiter2);
+  limiter->ReleaseWithoutSample();
+}
+
+TEST(ConcurrencyLimiterMapTest, EvictsUnusedLimiters) {
+  ExecCtx exec_ctx;
+  ConcurrencyLimiter::Config config;
+  auto limiter = ConcurrencyLimiterMap::Get()->GetLimiter("a", config);
+  ASSERT_TRUE(limiter->TryAcquire());
+  // Once nothing uses the limiter, the map forgets it, and the next caller
+  // gets a fresh one.
+  limiter.reset();
+  limiter = ConcurrencyLimiterMap::Get()->GetLimiter("a", config);
+  EXPECT_EQ(limiter->inflight(), 0);
+}
+
+TEST(AdaptiveConcurrencyParserTest, ValidConfig) {
+  const char* test_json =
+      "{\n"
+      "  \"adaptiveConcurrency\": {\n"
+      "    \"algorithm\": \"AIMD\",\n"
+      "    \"initialLimit\": 50,\n"
+      "    \"maxLimit\": 500,\n"
+      "    \"backoffRatio\": 0.75,\n"
+      "    \"timeout\": \"2s\"\n"
+      "  }\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  const auto* parsed_config =
+      static_cast<AdaptiveConcurrencyParsedConfig*>(
+          (*service_config)
+              ->GetGlobalParsedConfig(
+                  AdaptiveConcurrencyServiceConfigParser::ParserIndex()));
+  ASSERT_NE(parsed_config, nullptr);
+  const auto& config = parsed_config->limiter_config();
+  EXPECT_EQ(config.algorithm, ConcurrencyLimiter::Config::Algorithm::kAimd);
+  EXPECT_EQ(config.initial_limit, 50);
+  EXPECT_EQ(config.min_limit, 1);
+  EXPECT_EQ(config.max_limit, 500);
+  EXPECT_EQ(config.backoff_ratio, 0.75);
+  EXPECT_EQ(config.timeout, Duration::Seconds(2));
+}
+
+TEST(AdaptiveConcurrencyParserTest, NotConfigured) {
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), "{}");
+  ASSERT_TRUE(service_config.ok()) << service_config.status();
+  EXPECT_EQ((*service_config)
+                ->GetGlobalParsedConfig(
+                    AdaptiveConcurrencyServiceConfigParser::ParserIndex()),
+            nullptr);
+}
+
+TEST(AdaptiveConcurrencyParserTest, InvalidConfig) {
+  const char* test_json =
+      "{\n"
+      "  \"adaptiveConcurrency\": {\n"
+      "    \"algorithm\": \"VEGAS\",\n"
+      "    \"minLimit\": 10,\n"
+      "    \"initialLimit\": 5,\n"
+      "    \"smoothing\": 2\n"
+      "  }\n"
+      "}";
+  auto service_config = ServiceConfigImpl::Create(ChannelArgs(), test_json);
+  EXPECT_EQ(service_config.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(service_config.status().message(),
+            "errors validating service config: ["
+            "field:adaptiveConcurrency.algorithm "
+            "error:must be one of GRADIENT or AIMD; "
+            "field:adaptiveConcurrency.initialLimit "
+            "error:must be between minLimit and maxLimit; "
+            "field:adaptiveConcurrency.smoothing "
+            "error:must be in the range (0, 1]]")
+      << service_config.status();
+}
+
+TEST(AdaptiveConcurrencyParserTest, ServerConfigFromChannelArgs) {
+  auto config = AdaptiveConcurrencyConfigFromChannelArgs(
+      ChannelArgs().Set(GRPC_ARG_ADAPTIVE_CONCURRENCY_CONFIG,
+                        "{\"algorithm\": \"GRADIENT\", \"maxLimit\": 64}"));
+  ASSERT_TRUE(config.ok()) << config.status();
+  ASSERT_TRUE(config->has_value());
+  EXPECT_EQ((*config)->max_limit, 64);
+  config = AdaptiveConcurrencyConfigFromChannelArgs(ChannelArgs());
+  ASSERT_TRUE(config.ok()) << config.status();
+  EXPECT_FALSE(config->has_value());
+  config = AdaptiveConcurrencyConfigFromChannelArgs(ChannelArgs().Set(
+      GRPC_ARG_ADAPTIVE_CONCURRENCY_CONFIG, "{\"maxLimit\": 0}"));
+  EXPECT_FALSE(config.ok());
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
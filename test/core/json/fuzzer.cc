@@ -22,21 +22,39 @@
 #include "absl/status/statusor.h"
 #include "absl/strings/string_view.h"
 
+#include <grpc/event_engine/memory_allocator.h>
 #include <grpc/support/log.h>
 
 #include "src/core/lib/json/json.h"
+#include "src/core/lib/json/json_view.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
 
 bool squelch = true;
 bool leak_check = true;
 
 extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
-  auto json = grpc_core::Json::Parse(
-      absl::string_view(reinterpret_cast<const char*>(data), size));
+  absl::string_view text(reinterpret_cast<const char*>(data), size);
+  auto json = grpc_core::Json::Parse(text);
   if (json.ok()) {
     auto text2 = json->Dump();
     auto json2 = grpc_core::Json::Parse(text2);
     GPR_ASSERT(json2.ok());
     GPR_ASSERT(*json == *json2);
   }
+  // JsonView must accept and reject exactly what Json does.
+  grpc_core::MemoryAllocator memory_allocator =
+      grpc_core::ResourceQuota::Default()
+          ->memory_quota()
+          ->CreateMemoryAllocator("json_fuzzer");
+  auto arena = grpc_core::MakeScopedArena(1024, &memory_allocator);
+  auto view = grpc_core::JsonView::Parse(text, arena.get());
+  if (json.ok()) {
+    GPR_ASSERT(view.ok());
+    GPR_ASSERT((*view)->ToJson() == *json);
+  } else {
+    GPR_ASSERT(view.status() == json.status());
+  }
   return 0;
 }
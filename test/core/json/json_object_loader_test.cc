@@ -20,18 +20,39 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <grpc/event_engine/memory_allocator.h>
+
 #include "src/core/lib/gprpp/ref_counted.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/json/json_view.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
 
 namespace grpc_core {
 namespace {
 
+// Loads T from a JsonView parsed from json.
+template <typename T>
+absl::StatusOr<T> ParseView(absl::string_view json,
+                            const JsonArgs& args = JsonArgs()) {
+  MemoryAllocator memory_allocator =
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("test");
+  auto arena = MakeScopedArena(1024, &memory_allocator);
+  auto parsed = JsonView::Parse(json, arena.get());
+  if (!parsed.ok()) return parsed.status();
+  return LoadFromJson<T>(**parsed, args);
+}
+
 template <typename T>
 absl::StatusOr<T> Parse(absl::string_view json,
                         const JsonArgs& args = JsonArgs()) {
   auto parsed = Json::Parse(json);
   if (!parsed.ok()) return parsed.status();
-  return LoadFromJson<T>(*parsed, args);
+  auto result = LoadFromJson<T>(*parsed, args);
+  // Loading from a JsonView must report the same errors.
+  EXPECT_EQ(ParseView<T>(json, args).status(), result.status());
+  return result;
 }
 
 //
@@ -1111,6 +1132,79 @@ TEST(JsonObjectLoader, LoadFromJsonWithValidationErrors) {
   }
 }
 
+TEST(JsonObjectLoader, LoadFromJsonView) {
+  struct Inner {
+    std::vector<bool> flags;
+    Json::Object config;
+    Json source;
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+      static const auto* loader = JsonObjectLoader<Inner>()
+                                      .Field("flags", &Inner::flags)
+                                      .OptionalField("config", &Inner::config)
+                                      .Finish();
+      return loader;
+    }
+
+    void JsonPostLoad(const Json& source, const JsonArgs& /*args*/,
+                      ValidationErrors* /*errors*/) {
+      this->source = source;
+    }
+  };
+  struct TestStruct {
+    std::string name;
+    Duration timeout;
+    std::map<std::string, uint32_t> weights;
+    std::vector<Inner> inners;
+    absl::optional<double> ratio;
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+      static const auto* loader =
+          JsonObjectLoader<TestStruct>()
+              .Field("name", &TestStruct::name)
+              .Field("timeout", &TestStruct::timeout)
+              .Field("weights", &TestStruct::weights)
+              .Field("inners", &TestStruct::inners)
+              .OptionalField("ratio", &TestStruct::ratio)
+              .Finish();
+      return loader;
+    }
+  };
+  absl::string_view json_str =
+      "{\"name\": \"a\\u0062c\", \"timeout\": \"1.5s\", "
+      "\"weights\": {\"y\": 2, \"x\": 1}, "
+      "\"inners\": [{\"flags\": [true, false], \"config\": {\"k\": [1]}}], "
+      "\"ratio\": null}";
+  auto test_struct = ParseView<TestStruct>(json_str);
+  ASSERT_TRUE(test_struct.ok()) << test_struct.status();
+  EXPECT_EQ(test_struct->name, "abc");
+  EXPECT_EQ(test_struct->timeout, Duration::Milliseconds(1500));
+  EXPECT_THAT(test_struct->weights,
+              ::testing::ElementsAre(::testing::Pair("x", 1),
+                                     ::testing::Pair("y", 2)));
+  ASSERT_EQ(test_struct->inners.size(), 1u);
+  EXPECT_THAT(test_struct->inners[0].flags,
+              ::testing::ElementsAre(true, false));
+  EXPECT_EQ(Json(test_struct->inners[0].config),
+            Json::Parse("{\"k\": [1]}").value());
+  // JsonPostLoad() gets the object the value was loaded from.
+  EXPECT_EQ(test_struct->inners[0].source,
+            Json::Parse("{\"flags\": [true, false], \"config\": {\"k\": [1]}}")
+                .value());
+  EXPECT_FALSE(test_struct->ratio.has_value());
+  // Errors are reported with the same fields as for Json.
+  test_struct = ParseView<TestStruct>(
+      "{\"name\": 1, \"weights\": {\"x\": -1}, \"inners\": [{}]}");
+  EXPECT_EQ(test_struct.status().code(), absl::StatusCode::kInvalidArgument);
+  EXPECT_EQ(test_struct.status().message(),
+            "errors validating JSON: ["
+            "field:inners[0].flags error:field not present; "
+            "field:name error:is not a string; "
+            "field:timeout error:field not present; "
+            "field:weights[\"x\"] error:failed to parse non-negative number]")
+      << test_struct.status();
+}
+
 TEST(JsonObjectLoader, LoadJsonObjectField) {
   absl::string_view json_str = "{\"int\":1}";
   auto json = Json::Parse(json_str);
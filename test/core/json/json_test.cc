@@ -18,14 +18,21 @@
 
 #include <string.h>
 
+#include <string>
+
 #include "absl/status/status.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <grpc/event_engine/memory_allocator.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/json/json_view.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
 #include "test/core/util/test_config.h"
 
 namespace grpc_core {
@@ -69,6 +76,16 @@ void ValidateValue(const Json& actual, const Json& expected) {
   }
 }
 
+// Parses input with JsonView::Parse(), returning a copy of the result.
+absl::StatusOr<Json> ParseView(absl::string_view input) {
+  MemoryAllocator memory_allocator =
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("test");
+  auto arena = MakeScopedArena(1024, &memory_allocator);
+  auto view = JsonView::Parse(input, arena.get());
+  if (!view.ok()) return view.status();
+  return (*view)->ToJson();
+}
+
 void RunSuccessTest(const char* input, const Json& expected,
                     const char* expected_output) {
   gpr_log(GPR_INFO, "parsing string \"%s\" - should succeed", input);
@@ -77,6 +94,9 @@ void RunSuccessTest(const char* input, const Json& expected,
   ValidateValue(*json, expected);
   std::string output = json->Dump();
   EXPECT_EQ(output, expected_output);
+  auto view_json = ParseView(input);
+  ASSERT_TRUE(view_json.ok()) << view_json.status();
+  ValidateValue(*view_json, expected);
 }
 
 TEST(Json, Whitespace) {
@@ -190,10 +210,12 @@ TEST(Json, Keywords) {
                  "[true,false,null]");
 }
 
-void RunParseFailureTest(const char* input) {
-  gpr_log(GPR_INFO, "parsing string \"%s\" - should fail", input);
+void RunParseFailureTest(absl::string_view input) {
+  gpr_log(GPR_INFO, "parsing string \"%s\" - should fail",
+          std::string(input).c_str());
   auto json = Json::Parse(input);
   EXPECT_FALSE(json.ok());
+  EXPECT_EQ(ParseView(input).status(), json.status());
 }
 
 TEST(Json, InvalidInput) {
@@ -258,7 +280,28 @@ TEST(Json, BadContainers) {
   RunParseFailureTest("{x=0,y}");
 }
 
-TEST(Json, DuplicateObjectKeys) { RunParseFailureTest("{\"x\": 1, \"x\": 1}"); }
+TEST(Json, DuplicateObjectKeys) {
+  RunParseFailureTest("{\"x\": 1, \"x\": 1}");
+  RunParseFailureTest(
+      "{\"x\": 1, \"y\": {\"z\": 1, \"z\": [], \"z\": 3}, \"x\": 2}");
+  // Objects that are still open when parsing fails.
+  RunParseFailureTest("{\"x\": 1, \"y\": [{\"z\": 1, \"z\": 2, ");
+  std::string many_duplicates = "{";
+  for (int i = 0; i < 20; ++i) absl::StrAppend(&many_duplicates, "\"x\":1,");
+  RunParseFailureTest(absl::StrCat(many_duplicates, "\"x\":1}"));
+}
+
+TEST(Json, MaxDepth) {
+  std::string deep = "{\"x\": 1, \"x\": ";
+  for (int i = 0; i < 255; ++i) deep += "[";
+  RunParseFailureTest(deep);
+  // Nesting up to the limit is fine.
+  std::string json;
+  for (int i = 0; i < 255; ++i) json += "[";
+  for (int i = 0; i < 255; ++i) json += "]";
+  EXPECT_TRUE(Json::Parse(json).ok());
+  EXPECT_TRUE(ParseView(json).ok());
+}
 
 TEST(Json, TrailingComma) {
   RunParseFailureTest("{,}");
@@ -310,6 +353,61 @@ TEST(Json, Equality) {
   EXPECT_NE(Json(1), Json());
 }
 
+TEST(JsonView, StringsPointIntoInput) {
+  MemoryAllocator memory_allocator =
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("test");
+  auto arena = MakeScopedArena(1024, &memory_allocator);
+  const std::string input =
+      "{\"plain\": \"abc\", \"esc\\u0061ped\": \"a\\nb\", \"number\": -1.5e3}";
+  auto view = JsonView::Parse(input, arena.get());
+  ASSERT_TRUE(view.ok()) << view.status();
+  auto in_input = [&input](absl::string_view s) {
+    return s.data() >= input.data() && s.data() < input.data() + input.size();
+  };
+  const JsonView* plain = (*view)->Find("plain");
+  ASSERT_NE(plain, nullptr);
+  EXPECT_EQ(plain->type(), Json::Type::STRING);
+  EXPECT_EQ(plain->string_value(), "abc");
+  EXPECT_TRUE(in_input(plain->string_value()));
+  // Strings and keys with escapes are copied into the arena.
+  const JsonView* escaped = (*view)->Find("escaped");
+  ASSERT_NE(escaped, nullptr);
+  EXPECT_EQ(escaped->string_value(), "a\nb");
+  EXPECT_FALSE(in_input(escaped->string_value()));
+  const JsonView* number = (*view)->Find("number");
+  ASSERT_NE(number, nullptr);
+  EXPECT_EQ(number->type(), Json::Type::NUMBER);
+  EXPECT_EQ(number->string_value(), "-1.5e3");
+  EXPECT_TRUE(in_input(number->string_value()));
+}
+
+TEST(JsonView, Accessors) {
+  MemoryAllocator memory_allocator =
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("test");
+  auto arena = MakeScopedArena(1024, &memory_allocator);
+  auto view = JsonView::Parse(
+      "{\"c\": [1, true, null], \"a\": {}, \"b\": false}", arena.get());
+  ASSERT_TRUE(view.ok()) << view.status();
+  ASSERT_EQ((*view)->type(), Json::Type::OBJECT);
+  // Members are sorted by key.
+  auto members = (*view)->object_value();
+  ASSERT_EQ(members.size(), 3u);
+  EXPECT_EQ(members[0].key, "a");
+  EXPECT_EQ(members[0].value.type(), Json::Type::OBJECT);
+  EXPECT_TRUE(members[0].value.object_value().empty());
+  EXPECT_EQ(members[1].key, "b");
+  EXPECT_EQ(members[1].value.type(), Json::Type::JSON_FALSE);
+  EXPECT_EQ(members[2].key, "c");
+  auto elements = members[2].value.array_value();
+  ASSERT_EQ(elements.size(), 3u);
+  EXPECT_EQ(elements[0].string_value(), "1");
+  EXPECT_EQ(elements[1].type(), Json::Type::JSON_TRUE);
+  EXPECT_EQ(elements[2].type(), Json::Type::JSON_NULL);
+  EXPECT_EQ((*view)->Find("c"), &members[2].value);
+  EXPECT_EQ((*view)->Find("d"), nullptr);
+  EXPECT_EQ(elements[0].Find("a"), nullptr);
+}
+
 }  // namespace grpc_core
 
 int main(int argc, char** argv) {
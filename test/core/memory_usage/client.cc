@@ -287,12 +287,20 @@ int main(int argc, char** argv) {
          static_cast<double>(client_calls_inflight.rss -
                              client_benchmark_calls_start.rss) /
              benchmark_iterations * 1024);
+  printf("client call page faults: %f per call\n",
+         static_cast<double>(client_calls_inflight.minor_faults -
+                             client_benchmark_calls_start.minor_faults) /
+             benchmark_iterations);
 
   printf("---------server stats--------\n");
   printf("server call memory usage: %f bytes per call\n",
          static_cast<double>(server_calls_inflight.rss -
                              server_benchmark_calls_start.rss) /
              benchmark_iterations * 1024);
+  printf("server call page faults: %f per call\n",
+         static_cast<double>(server_calls_inflight.minor_faults -
+                             server_benchmark_calls_start.minor_faults) /
+             benchmark_iterations);
 
   return 0;
 }
@@ -36,6 +36,7 @@
 #include <grpc/support/log.h>
 #include <grpc/support/time.h>
 
+#include "src/core/lib/gprpp/env.h"
 #include "src/core/lib/gprpp/host_port.h"
 #include "test/core/util/port.h"
 #include "test/core/util/subprocess.h"
@@ -47,7 +48,8 @@ ABSL_FLAG(std::string, benchmark_names, "call,channel",
 ABSL_FLAG(int, size, 1000, "Number of channels/calls");
 ABSL_FLAG(std::string, scenario_config, "insecure",
           "Possible Values: minstack (Use minimal stack), resource_quota, "
-          "secure (Use SSL credentials on server)");
+          "secure (Use SSL credentials on server), slice_pool (Use pooled "
+          "slice storage, compare with insecure)");
 ABSL_FLAG(bool, memory_profiling, false,
           "Run memory profiling");  // TODO (chennancy) Connect this flag
 
@@ -176,6 +178,8 @@ int main(int argc, char** argv) {
   struct ScenarioArgs {
     std::vector<std::string> client;
     std::vector<std::string> server;
+    // Experiments to enable in both processes.
+    std::string experiments;
   };
   // TODO(chennancy): add in resource quota parameter setting later
   const std::map<std::string /*scenario*/, ScenarioArgs> scenarios = {
@@ -183,12 +187,17 @@ int main(int argc, char** argv) {
       {"resource_quota", {/*client=*/{}, /*server=*/{"--secure"}}},
       {"minstack", {/*client=*/{"--minstack"}, /*server=*/{"--minstack"}}},
       {"insecure", {{}, {}}},
+      {"slice_pool", {/*client=*/{}, /*server=*/{}, "slice_pool"}},
   };
   auto it_scenario = scenarios.find(absl::GetFlag(FLAGS_scenario_config));
   if (it_scenario == scenarios.end()) {
     printf("No scenario matching the name could be found\n");
     return 3;
   }
+  // Subprocesses inherit the environment, and pick experiments up from it.
+  if (!it_scenario->second.experiments.empty()) {
+    grpc_core::SetEnv("GRPC_EXPERIMENTS", it_scenario->second.experiments);
+  }
 
   // Run all benchmarks listed (Multiple benchmarks usually only for default
   // scenario)
@@ -23,8 +23,15 @@
 
 #include <grpc/support/log.h>
 
-long GetMemUsage(absl::optional<int> pid) {
-  // Default is getting memory usage for self (calling process)
+namespace {
+
+struct ProcStat {
+  long rss_kb;
+  long minor_faults;
+};
+
+ProcStat ReadProcStat(absl::optional<int> pid) {
+  // Default is getting stats for self (calling process)
   std::string path = "/proc/self/stat";
   if (pid != absl::nullopt) {
     path = absl::StrCat("/proc/", pid.value(), "/stat");
@@ -53,5 +60,13 @@ long GetMemUsage(absl::optional<int> pid) {
   long page_size_kb = sysconf(_SC_PAGE_SIZE) / 1024;
   resident_set = rss * page_size_kb;
   // Memory in KB
-  return resident_set;
+  return ProcStat{static_cast<long>(resident_set), std::stol(minflt)};
+}
+
+}  // namespace
+
+long GetMemUsage(absl::optional<int> pid) { return ReadProcStat(pid).rss_kb; }
+
+long GetMinorPageFaults(absl::optional<int> pid) {
+  return ReadProcStat(pid).minor_faults;
 }
@@ -23,9 +23,18 @@
 // the pid
 long GetMemUsage(absl::optional<int> pid = absl::nullopt);
 
+// Get the number of minor page faults of either the calling process or another
+// process using the pid. Each one is a page of memory touched for the first
+// time, so the rate at which these grow tracks how much fresh memory is being
+// allocated.
+long GetMinorPageFaults(absl::optional<int> pid = absl::nullopt);
+
 struct MemStats {
-  long rss;  // Resident set size, in kb
-  static MemStats Snapshot() { return MemStats{GetMemUsage()}; }
+  long rss;           // Resident set size, in kb
+  long minor_faults;  // Minor page faults so far
+  static MemStats Snapshot() {
+    return MemStats{GetMemUsage(), GetMinorPageFaults()};
+  }
 };
 
 #endif  // GRPC_TEST_CORE_MEMORY_USAGE_MEMSTATS_H
@@ -16,6 +16,8 @@
 
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "absl/types/optional.h"
 #include "gmock/gmock.h"
@@ -27,6 +29,7 @@
 #include "src/core/lib/promise/promise.h"
 
 using testing::Mock;
+using testing::NiceMock;
 using testing::StrictMock;
 
 namespace grpc_core {
@@ -65,30 +68,41 @@ struct Payload {
 };
 Payload MakePayload(int value) { return {std::make_unique<int>(value)}; }
 
-TEST(MpscTest, NoOp) { MpscReceiver<Payload> receiver(1); }
+template <typename Center>
+class MpscTest : public ::testing::Test {
+ protected:
+  using Receiver = MpscReceiver<Payload, Center>;
+  using Sender = MpscSender<Payload, Center>;
+};
+
+using Centers = ::testing::Types<mpscpipe_detail::Center<Payload>,
+                                 mpscpipe_detail::LockFreeCenter<Payload>>;
+TYPED_TEST_SUITE(MpscTest, Centers);
+
+TYPED_TEST(MpscTest, NoOp) { typename TestFixture::Receiver receiver(1); }
 
-TEST(MpscTest, MakeSender) {
-  MpscReceiver<Payload> receiver(1);
-  MpscSender<Payload> sender = receiver.MakeSender();
+TYPED_TEST(MpscTest, MakeSender) {
+  typename TestFixture::Receiver receiver(1);
+  typename TestFixture::Sender sender = receiver.MakeSender();
 }
 
-TEST(MpscTest, SendOneThingInstantly) {
-  MpscReceiver<Payload> receiver(1);
-  MpscSender<Payload> sender = receiver.MakeSender();
+TYPED_TEST(MpscTest, SendOneThingInstantly) {
+  typename TestFixture::Receiver receiver(1);
+  typename TestFixture::Sender sender = receiver.MakeSender();
   EXPECT_EQ(NowOrNever(sender.Send(MakePayload(1))), true);
 }
 
-TEST(MpscTest, SendOneThingInstantlyAndReceiveInstantly) {
-  MpscReceiver<Payload> receiver(1);
-  MpscSender<Payload> sender = receiver.MakeSender();
+TYPED_TEST(MpscTest, SendOneThingInstantlyAndReceiveInstantly) {
+  typename TestFixture::Receiver receiver(1);
+  typename TestFixture::Sender sender = receiver.MakeSender();
   EXPECT_EQ(NowOrNever(sender.Send(MakePayload(1))), true);
   EXPECT_EQ(NowOrNever(receiver.Next()), MakePayload(1));
 }
 
-TEST(MpscTest, SendingLotsOfThingsGivesPushback) {
+TYPED_TEST(MpscTest, SendingLotsOfThingsGivesPushback) {
   StrictMock<MockActivity> activity1;
-  MpscReceiver<Payload> receiver(1);
-  MpscSender<Payload> sender = receiver.MakeSender();
+  typename TestFixture::Receiver receiver(1);
+  typename TestFixture::Sender sender = receiver.MakeSender();
 
   activity1.Activate();
   EXPECT_EQ(NowOrNever(sender.Send(MakePayload(1))), true);
@@ -96,11 +110,11 @@ TEST(MpscTest, SendingLotsOfThingsGivesPushback) {
   activity1.Deactivate();
 }
 
-TEST(MpscTest, ReceivingAfterBlockageWakesUp) {
+TYPED_TEST(MpscTest, ReceivingAfterBlockageWakesUp) {
   StrictMock<MockActivity> activity1;
   StrictMock<MockActivity> activity2;
-  MpscReceiver<Payload> receiver(1);
-  MpscSender<Payload> sender = receiver.MakeSender();
+  typename TestFixture::Receiver receiver(1);
+  typename TestFixture::Sender sender = receiver.MakeSender();
 
   activity1.Activate();
   EXPECT_EQ(NowOrNever(sender.Send(MakePayload(1))), true);
@@ -127,9 +141,9 @@ TEST(MpscTest, ReceivingAfterBlockageWakesUp) {
   activity2.Deactivate();
 }
 
-TEST(MpscTest, BigBufferAllowsBurst) {
-  MpscReceiver<Payload> receiver(50);
-  MpscSender<Payload> sender = receiver.MakeSender();
+TYPED_TEST(MpscTest, BigBufferAllowsBurst) {
+  typename TestFixture::Receiver receiver(50);
+  typename TestFixture::Sender sender = receiver.MakeSender();
 
   for (int i = 0; i < 25; i++) {
     EXPECT_EQ(NowOrNever(sender.Send(MakePayload(i))), true);
@@ -139,13 +153,80 @@ TEST(MpscTest, BigBufferAllowsBurst) {
   }
 }
 
-TEST(MpscTest, ClosureIsVisibleToSenders) {
-  auto receiver = std::make_unique<MpscReceiver<Payload>>(1);
-  MpscSender<Payload> sender = receiver->MakeSender();
+TYPED_TEST(MpscTest, ClosureIsVisibleToSenders) {
+  auto receiver = std::make_unique<typename TestFixture::Receiver>(1);
+  typename TestFixture::Sender sender = receiver->MakeSender();
   receiver.reset();
   EXPECT_EQ(NowOrNever(sender.Send(MakePayload(1))), false);
 }
 
+TYPED_TEST(MpscTest, NextBatchReturnsAllPendingItems) {
+  StrictMock<MockActivity> activity;
+  typename TestFixture::Receiver receiver(20);
+  typename TestFixture::Sender sender = receiver.MakeSender();
+
+  activity.Activate();
+  auto batch = receiver.NextBatch();
+  EXPECT_EQ(batch(), Poll<std::vector<Payload>>(Pending{}));
+  EXPECT_CALL(activity, WakeupRequested());
+  for (int i = 0; i < 5; i++) {
+    EXPECT_EQ(NowOrNever(sender.Send(MakePayload(i))), true);
+  }
+  Mock::VerifyAndClearExpectations(&activity);
+  auto items = NowOrNever(std::move(batch));
+  ASSERT_TRUE(items.has_value());
+  ASSERT_EQ(items->size(), 5);
+  for (int i = 0; i < 5; i++) {
+    EXPECT_EQ((*items)[i], MakePayload(i));
+  }
+  activity.Deactivate();
+}
+
+TYPED_TEST(MpscTest, NextBatchReturnsWhatNextLeftBehind) {
+  typename TestFixture::Receiver receiver(20);
+  typename TestFixture::Sender sender = receiver.MakeSender();
+
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(NowOrNever(sender.Send(MakePayload(i))), true);
+  }
+  EXPECT_EQ(NowOrNever(receiver.Next()), MakePayload(0));
+  auto items = NowOrNever(receiver.NextBatch());
+  ASSERT_TRUE(items.has_value());
+  ASSERT_EQ(items->size(), 2);
+  EXPECT_EQ((*items)[0], MakePayload(1));
+  EXPECT_EQ((*items)[1], MakePayload(2));
+}
+
+TYPED_TEST(MpscTest, ConcurrentSendersKeepTheirOrder) {
+  constexpr int kSenders = 8;
+  constexpr int kItemsPerSender = 1000;
+  NiceMock<MockActivity> activity;
+  typename TestFixture::Receiver receiver(2 * kSenders * kItemsPerSender);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kSenders; i++) {
+    threads.emplace_back([i, sender = receiver.MakeSender()]() mutable {
+      for (int j = 0; j < kItemsPerSender; j++) {
+        EXPECT_EQ(NowOrNever(sender.Send(MakePayload(i * kItemsPerSender + j))),
+                  true);
+      }
+    });
+  }
+  activity.Activate();
+  std::vector<int> next(kSenders, 0);
+  int received = 0;
+  while (received < kSenders * kItemsPerSender) {
+    auto items = NowOrNever(receiver.NextBatch());
+    if (!items.has_value()) continue;
+    for (const Payload& item : *items) {
+      const int sender = *item.x / kItemsPerSender;
+      EXPECT_EQ(*item.x % kItemsPerSender, next[sender]++);
+      received++;
+    }
+  }
+  activity.Deactivate();
+  for (auto& thread : threads) thread.join();
+}
+
 }  // namespace
 }  // namespace grpc_core
 
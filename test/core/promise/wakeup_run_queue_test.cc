@@ -0,0 +1,146 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/promise/wakeup_run_queue.h"
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "src/core/lib/experiments/config.h"
+
+namespace grpc_core {
+namespace {
+
+const char kKind = 0;
+const char kOtherKind = 0;
+
+// Records its runs and schedules into a shared log, and optionally does
+// something more when run.
+class TestNode : public WakeupRunQueue::Node {
+ public:
+  TestNode(int id, std::vector<int>* log)
+      : WakeupRunQueue::Node(
+            [](WakeupRunQueue::Node* node) {
+              auto* self = static_cast<TestNode*>(node);
+              self->log_->push_back(self->id_);
+              if (self->on_run_ != nullptr) self->on_run_();
+            },
+            [](WakeupRunQueue::Node* node) {
+              auto* self = static_cast<TestNode*>(node);
+              self->log_->push_back(-self->id_);
+            }),
+        id_(id),
+        log_(log) {}
+
+  void set_on_run(std::function<void()> on_run) {
+    on_run_ = std::move(on_run);
+  }
+
+ private:
+  const int id_;
+  std::vector<int>* const log_;
+  std::function<void()> on_run_;
+};
+
+TEST(WakeupRunQueueTest, NotQueuedWithoutRunQueue) {
+  std::vector<int> log;
+  TestNode node(1, &log);
+  EXPECT_FALSE(WakeupRunQueue::Push(&kKind, &node));
+  EXPECT_TRUE(log.empty());
+}
+
+TEST(WakeupRunQueueTest, NotQueuedForOtherKind) {
+  std::vector<int> log;
+  TestNode node(1, &log);
+  {
+    WakeupRunQueue run_queue(&kKind);
+    EXPECT_FALSE(WakeupRunQueue::Push(&kOtherKind, &node));
+    // An inner queue of another kind doesn't change that.
+    WakeupRunQueue inner_run_queue(&kOtherKind);
+    EXPECT_FALSE(WakeupRunQueue::Push(&kOtherKind, &node));
+  }
+  EXPECT_TRUE(log.empty());
+}
+
+TEST(WakeupRunQueueTest, RunsInOrderWhenOutermostQueueCloses) {
+  std::vector<int> log;
+  TestNode node1(1, &log);
+  TestNode node2(2, &log);
+  TestNode node3(3, &log);
+  {
+    WakeupRunQueue run_queue(&kKind);
+    {
+      WakeupRunQueue inner_run_queue(&kKind);
+      EXPECT_TRUE(WakeupRunQueue::Push(&kKind, &node1));
+      EXPECT_TRUE(WakeupRunQueue::Push(&kKind, &node2));
+    }
+    EXPECT_TRUE(WakeupRunQueue::Push(&kKind, &node3));
+    EXPECT_TRUE(log.empty());
+  }
+  EXPECT_EQ(log, std::vector<int>({1, 2, 3}));
+  // The queue is closed again.
+  EXPECT_FALSE(WakeupRunQueue::Push(&kKind, &node1));
+}
+
+TEST(WakeupRunQueueTest, RunsWakeupsQueuedWhileDraining) {
+  std::vector<int> log;
+  TestNode node1(1, &log);
+  TestNode node2(2, &log);
+  TestNode node3(3, &log);
+  node1.set_on_run([&node3]() {
+    EXPECT_TRUE(WakeupRunQueue::Push(&kKind, &node3));
+  });
+  {
+    WakeupRunQueue run_queue(&kKind);
+    EXPECT_TRUE(WakeupRunQueue::Push(&kKind, &node1));
+    EXPECT_TRUE(WakeupRunQueue::Push(&kKind, &node2));
+  }
+  EXPECT_EQ(log, std::vector<int>({1, 2, 3}));
+}
+
+TEST(WakeupRunQueueTest, HandsBackWakeupsBeyondOnePass) {
+  std::vector<int> log;
+  TestNode node1(1, &log);
+  TestNode node2(2, &log);
+  // Two activities that keep waking each other up.
+  node1.set_on_run([&node2]() {
+    EXPECT_TRUE(WakeupRunQueue::Push(&kKind, &node2));
+  });
+  node2.set_on_run([&node1]() {
+    EXPECT_TRUE(WakeupRunQueue::Push(&kKind, &node1));
+  });
+  {
+    WakeupRunQueue run_queue(&kKind);
+    EXPECT_TRUE(WakeupRunQueue::Push(&kKind, &node1));
+  }
+  std::vector<int> expected;
+  for (size_t i = 0; i < WakeupRunQueue::kMaxWakeupsPerPass; ++i) {
+    expected.push_back(i % 2 == 0 ? 1 : 2);
+  }
+  // The pending wakeup goes back to its scheduler.
+  expected.push_back(WakeupRunQueue::kMaxWakeupsPerPass % 2 == 0 ? -1 : -2);
+  EXPECT_EQ(log, expected);
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_core::ForceEnableExperiment("wakeup_run_queue", true);
+  return RUN_ALL_TESTS();
+}
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <memory>
 #include <random>
 #include <thread>
 #include <vector>
@@ -169,6 +170,99 @@ TEST(MemoryQuotaTest, NoBunchingIfIdle) {
   EXPECT_GE(count_reclaimers_called.load(std::memory_order_relaxed), 8000);
 }
 
+//
+// BasicMemoryQuotaTest
+//
+
+TEST(BasicMemoryQuotaTest, CpuCacheRefill) {
+  ExecCtx exec_ctx;
+  auto memory_quota = std::make_shared<BasicMemoryQuota>("foo");
+  const intptr_t initial = memory_quota->FreeBytesForTesting();
+  EXPECT_EQ(memory_quota->CpuCachedBytesForTesting(), 0);
+  // The first take misses the cache, and takes a refill for it on top.
+  memory_quota->Take(/*allocator=*/nullptr, 1024);
+  const intptr_t cached = memory_quota->CpuCachedBytesForTesting();
+  EXPECT_GT(cached, 0);
+  EXPECT_EQ(memory_quota->FreeBytesForTesting() + cached, initial - 1024);
+  // The next one is served by the cache alone.
+  memory_quota->Take(/*allocator=*/nullptr, 1024);
+  EXPECT_EQ(memory_quota->FreeBytesForTesting(), initial - 1024 - cached);
+  EXPECT_EQ(memory_quota->CpuCachedBytesForTesting(), cached - 1024);
+  // Returns go back to the cache...
+  memory_quota->Return(2048);
+  EXPECT_EQ(memory_quota->FreeBytesForTesting(), initial - 1024 - cached);
+  EXPECT_EQ(memory_quota->CpuCachedBytesForTesting(), cached + 1024);
+  // ... which spills to free_bytes_ rather than growing without bound.
+  for (int i = 0; i < 100; i++) {
+    memory_quota->Take(/*allocator=*/nullptr, 64 * 1024);
+  }
+  for (int i = 0; i < 100; i++) {
+    memory_quota->Return(64 * 1024);
+  }
+  EXPECT_LE(memory_quota->CpuCachedBytesForTesting(), 256 * 1024);
+  EXPECT_EQ(memory_quota->FreeBytesForTesting() +
+                memory_quota->CpuCachedBytesForTesting(),
+            initial);
+}
+
+TEST(BasicMemoryQuotaTest, CpuCachesDrainedNearLimit) {
+  ExecCtx exec_ctx;
+  auto memory_quota = std::make_shared<BasicMemoryQuota>("foo");
+  const intptr_t kQuotaSize = 1024 * 1024 * 1024;
+  const intptr_t kChunk = 128 * 1024;
+  memory_quota->SetSize(kQuotaSize);
+  EXPECT_EQ(memory_quota->FreeBytesForTesting(), kQuotaSize);
+  // Far from the limit, takes are batched through the cache.
+  memory_quota->Take(/*allocator=*/nullptr, kChunk);
+  EXPECT_GT(memory_quota->CpuCachedBytesForTesting(), 0);
+  // Once free memory drops below half the quota, everything is handed back
+  // to free_bytes_ and accounting is exact.
+  intptr_t used = kChunk;
+  while (used < kQuotaSize * 3 / 4) {
+    memory_quota->Take(/*allocator=*/nullptr, kChunk);
+    used += kChunk;
+  }
+  EXPECT_EQ(memory_quota->CpuCachedBytesForTesting(), 0);
+  EXPECT_EQ(memory_quota->FreeBytesForTesting(), kQuotaSize - used);
+  // Returns stay exact too, until we're back above the floor.
+  memory_quota->Return(kChunk);
+  used -= kChunk;
+  EXPECT_EQ(memory_quota->CpuCachedBytesForTesting(), 0);
+  EXPECT_EQ(memory_quota->FreeBytesForTesting(), kQuotaSize - used);
+  while (used > 0) {
+    memory_quota->Return(kChunk);
+    used -= kChunk;
+  }
+  EXPECT_EQ(memory_quota->FreeBytesForTesting() +
+                memory_quota->CpuCachedBytesForTesting(),
+            kQuotaSize);
+  // Shrinking the quota drains the caches.
+  memory_quota->SetSize(kQuotaSize / 2);
+  EXPECT_EQ(memory_quota->CpuCachedBytesForTesting(), 0);
+  EXPECT_EQ(memory_quota->FreeBytesForTesting(), kQuotaSize / 2);
+}
+
+TEST(BasicMemoryQuotaTest, ReclaimerDrainsCpuCaches) {
+  ExecCtx exec_ctx;
+  auto memory_quota = std::make_shared<BasicMemoryQuota>("foo");
+  const intptr_t kQuotaSize = 1024 * 1024 * 1024;
+  memory_quota->SetSize(kQuotaSize);
+  memory_quota->Start();
+  memory_quota->Take(/*allocator=*/nullptr, 1024);
+  const intptr_t cached = memory_quota->CpuCachedBytesForTesting();
+  ASSERT_GT(cached, 1024);
+  // Push free_bytes_ just below zero, with the cache still holding more than
+  // the overcommit: the reclaimer must count the cached bytes as free.
+  memory_quota->Take(
+      /*allocator=*/nullptr,
+      static_cast<size_t>(memory_quota->FreeBytesForTesting() + 1024));
+  EXPECT_EQ(memory_quota->FreeBytesForTesting(), -1024);
+  exec_ctx.Flush();
+  EXPECT_EQ(memory_quota->CpuCachedBytesForTesting(), 0);
+  EXPECT_EQ(memory_quota->FreeBytesForTesting(), cached - 1024);
+  memory_quota->Stop();
+}
+
 }  // namespace testing
 
 namespace memory_quota_detail {
@@ -0,0 +1,112 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/resource_quota/slice_pool.h"
+
+#include <stdlib.h>
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <grpc/support/log.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+
+namespace grpc_core {
+namespace testing {
+
+TEST(SlicePoolTest, SizeClasses) {
+  EXPECT_EQ(SlicePool::SizeClassFor(0), 0);
+  EXPECT_EQ(SlicePool::SizeClassFor(1), 0);
+  EXPECT_EQ(SlicePool::SizeClassFor(256), 0);
+  EXPECT_EQ(SlicePool::SizeClassFor(257), 1);
+  EXPECT_EQ(SlicePool::SizeClassFor(8192), 5);
+  EXPECT_EQ(SlicePool::SizeClassFor(64 * 1024), SlicePool::kNumSizeClasses - 1);
+  EXPECT_EQ(SlicePool::SizeClassFor(64 * 1024 + 1), SlicePool::kNumSizeClasses);
+  EXPECT_EQ(SlicePool::BlockSize(0), SlicePool::kHeaderSize + 256);
+}
+
+TEST(SlicePoolTest, ReusesBlocks) {
+  ExecCtx exec_ctx;
+  SlicePool pool;
+  EXPECT_EQ(pool.Pop(3), nullptr);
+  void* block = malloc(SlicePool::BlockSize(3));
+  ASSERT_TRUE(pool.Push(block, 3));
+  // Blocks of other size classes are not handed out.
+  EXPECT_EQ(pool.Pop(2), nullptr);
+  EXPECT_EQ(pool.Pop(3), block);
+  EXPECT_EQ(pool.Pop(3), nullptr);
+  free(block);
+}
+
+TEST(SlicePoolTest, BoundedAndTrimmed) {
+  ExecCtx exec_ctx;
+  SlicePool pool;
+  const size_t size_class = SlicePool::kNumSizeClasses - 1;
+  size_t pooled = 0;
+  while (true) {
+    void* block = malloc(SlicePool::BlockSize(size_class));
+    if (!pool.Push(block, size_class)) {
+      free(block);
+      break;
+    }
+    ++pooled;
+    ASSERT_LT(pooled, 1000u) << "pool is unbounded";
+  }
+  EXPECT_EQ(pool.Trim(), pooled * SlicePool::BlockSize(size_class));
+  EXPECT_EQ(pool.Pop(size_class), nullptr);
+  EXPECT_EQ(pool.Trim(), 0);
+}
+
+TEST(SlicePoolTest, ManyThreads) {
+  SlicePool pool;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; i++) {
+    threads.emplace_back([&pool, i]() {
+      ExecCtx exec_ctx;
+      const size_t size_class = i % SlicePool::kNumSizeClasses;
+      std::vector<void*> blocks;
+      for (int j = 0; j < 10000; j++) {
+        for (int k = 0; k < 4; k++) {
+          void* block = pool.Pop(size_class);
+          if (block == nullptr) {
+            block = malloc(SlicePool::BlockSize(size_class));
+          }
+          blocks.push_back(block);
+        }
+        for (void* block : blocks) {
+          if (!pool.Push(block, size_class)) free(block);
+        }
+        blocks.clear();
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+// Hook needed to run ExecCtx outside of iomgr.
+void grpc_set_default_iomgr_platform() {}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  gpr_log_verbosity_init();
+  gpr_time_init();
+  return RUN_ALL_TESTS();
+}
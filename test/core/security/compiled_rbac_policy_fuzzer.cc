@@ -0,0 +1,291 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Checks that CompiledRbacPolicy makes the same decisions as evaluating a
+// PolicyAuthorizationMatcher for each policy.
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/status/statusor.h"
+#include "absl/strings/str_cat.h"
+#include "absl/types/optional.h"
+
+#include <grpc/grpc_security_constants.h>
+
+#include "src/core/lib/matchers/matchers.h"
+#include "src/core/lib/security/authorization/compiled_rbac_policy.h"
+#include "src/core/lib/security/authorization/evaluate_args.h"
+#include "src/core/lib/security/authorization/matchers.h"
+#include "src/core/lib/security/authorization/rbac_policy.h"
+#include "src/libfuzzer/libfuzzer_macro.h"
+#include "test/core/security/compiled_rbac_policy_fuzzer.pb.h"
+#include "test/core/util/evaluate_args_test_util.h"
+
+bool squelch = true;
+bool leak_check = true;
+
+namespace grpc_core {
+namespace {
+
+using compiled_rbac_policy_fuzzer::Msg;
+
+// Maps arbitrary bytes onto a header name the metadata batch stores as is.
+std::string HeaderName(const std::string& name) {
+  std::string out = "x-";
+  for (char c : name) {
+    if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')) out.push_back(c);
+  }
+  return out;
+}
+
+std::string Ipv4Address(const std::string& bytes) {
+  uint8_t octets[4] = {0, 0, 0, 0};
+  for (size_t i = 0; i < bytes.size() && i < 4; i++) {
+    octets[i] = static_cast<uint8_t>(bytes[i]);
+  }
+  return absl::StrCat(octets[0], ".", octets[1], ".", octets[2], ".",
+                      octets[3]);
+}
+
+Rbac::CidrRange MakeCidrRange(
+    const compiled_rbac_policy_fuzzer::CidrRange& range) {
+  return Rbac::CidrRange(Ipv4Address(range.address()),
+                         range.prefix_len() % 33);
+}
+
+absl::optional<StringMatcher> MakeStringMatcher(
+    const compiled_rbac_policy_fuzzer::StringMatcher& matcher) {
+  auto result = StringMatcher::Create(
+      static_cast<StringMatcher::Type>(matcher.type() % 5), matcher.value(),
+      !matcher.ignore_case());
+  if (!result.ok()) return absl::nullopt;
+  return std::move(*result);
+}
+
+absl::optional<HeaderMatcher> MakeHeaderMatcher(
+    const compiled_rbac_policy_fuzzer::HeaderMatcher& matcher) {
+  absl::StatusOr<HeaderMatcher> result;
+  std::string name = HeaderName(matcher.name());
+  switch (matcher.match_case()) {
+    case compiled_rbac_policy_fuzzer::HeaderMatcher::kRangeMatch:
+      result = HeaderMatcher::Create(
+          name, HeaderMatcher::Type::kRange, "",
+          matcher.range_match().start(), matcher.range_match().end(),
+          /*present_match=*/false, matcher.invert());
+      break;
+    case compiled_rbac_policy_fuzzer::HeaderMatcher::kPresentMatch:
+      result = HeaderMatcher::Create(name, HeaderMatcher::Type::kPresent, "",
+                                     0, 0, matcher.present_match(),
+                                     matcher.invert());
+      break;
+    default: {
+      const auto& string_match = matcher.string_match();
+      result = HeaderMatcher::Create(
+          name, static_cast<HeaderMatcher::Type>(string_match.type() % 5),
+          string_match.value(), 0, 0, false, matcher.invert());
+    }
+  }
+  if (!result.ok()) return absl::nullopt;
+  return std::move(*result);
+}
+
+// Matchers that fail to build are replaced by "any", the same way in each
+// copy of the config.
+Rbac::Permission MakePermission(
+    const compiled_rbac_policy_fuzzer::Permission& permission) {
+  using compiled_rbac_policy_fuzzer::Permission;
+  auto make_set = [](const Permission::Set& set) {
+    std::vector<std::unique_ptr<Rbac::Permission>> rules;
+    for (const auto& rule : set.rules()) {
+      rules.push_back(
+          std::make_unique<Rbac::Permission>(MakePermission(rule)));
+    }
+    return rules;
+  };
+  switch (permission.rule_case()) {
+    case Permission::kAndRules:
+      return Rbac::Permission::MakeAndPermission(
+          make_set(permission.and_rules()));
+    case Permission::kOrRules:
+      return Rbac::Permission::MakeOrPermission(
+          make_set(permission.or_rules()));
+    case Permission::kNotRule:
+      return Rbac::Permission::MakeNotPermission(
+          MakePermission(permission.not_rule()));
+    case Permission::kHeader: {
+      auto matcher = MakeHeaderMatcher(permission.header());
+      if (!matcher.has_value()) break;
+      return Rbac::Permission::MakeHeaderPermission(std::move(*matcher));
+    }
+    case Permission::kUrlPath: {
+      auto matcher = MakeStringMatcher(permission.url_path());
+      if (!matcher.has_value()) break;
+      return Rbac::Permission::MakePathPermission(std::move(*matcher));
+    }
+    case Permission::kDestinationIp:
+      return Rbac::Permission::MakeDestIpPermission(
+          MakeCidrRange(permission.destination_ip()));
+    case Permission::kDestinationPort:
+      return Rbac::Permission::MakeDestPortPermission(
+          permission.destination_port() % 65536);
+    case Permission::kMetadataInvert:
+      return Rbac::Permission::MakeMetadataPermission(
+          permission.metadata_invert());
+    case Permission::kRequestedServerName: {
+      auto matcher = MakeStringMatcher(permission.requested_server_name());
+      if (!matcher.has_value()) break;
+      return Rbac::Permission::MakeReqServerNamePermission(
+          std::move(*matcher));
+    }
+    default:
+      break;
+  }
+  return Rbac::Permission::MakeAnyPermission();
+}
+
+Rbac::Principal MakePrincipal(
+    const compiled_rbac_policy_fuzzer::Principal& principal) {
+  using compiled_rbac_policy_fuzzer::Principal;
+  auto make_set = [](const Principal::Set& set) {
+    std::vector<std::unique_ptr<Rbac::Principal>> ids;
+    for (const auto& id : set.ids()) {
+      ids.push_back(std::make_unique<Rbac::Principal>(MakePrincipal(id)));
+    }
+    return ids;
+  };
+  switch (principal.identifier_case()) {
+    case Principal::kAndIds:
+      return Rbac::Principal::MakeAndPrincipal(make_set(principal.and_ids()));
+    case Principal::kOrIds:
+      return Rbac::Principal::MakeOrPrincipal(make_set(principal.or_ids()));
+    case Principal::kNotId:
+      return Rbac::Principal::MakeNotPrincipal(
+          MakePrincipal(principal.not_id()));
+    case Principal::kAuthenticated: {
+      if (!principal.authenticated().has_principal_name()) {
+        return Rbac::Principal::MakeAuthenticatedPrincipal(absl::nullopt);
+      }
+      auto matcher =
+          MakeStringMatcher(principal.authenticated().principal_name());
+      if (!matcher.has_value()) break;
+      return Rbac::Principal::MakeAuthenticatedPrincipal(std::move(*matcher));
+    }
+    case Principal::kSourceIp:
+      return Rbac::Principal::MakeSourceIpPrincipal(
+          MakeCidrRange(principal.source_ip()));
+    case Principal::kDirectRemoteIp:
+      return Rbac::Principal::MakeDirectRemoteIpPrincipal(
+          MakeCidrRange(principal.direct_remote_ip()));
+    case Principal::kRemoteIp:
+      return Rbac::Principal::MakeRemoteIpPrincipal(
+          MakeCidrRange(principal.remote_ip()));
+    case Principal::kHeader: {
+      auto matcher = MakeHeaderMatcher(principal.header());
+      if (!matcher.has_value()) break;
+      return Rbac::Principal::MakeHeaderPrincipal(std::move(*matcher));
+    }
+    case Principal::kUrlPath: {
+      auto matcher = MakeStringMatcher(principal.url_path());
+      if (!matcher.has_value()) break;
+      return Rbac::Principal::MakePathPrincipal(std::move(*matcher));
+    }
+    case Principal::kMetadataInvert:
+      return Rbac::Principal::MakeMetadataPrincipal(
+          principal.metadata_invert());
+    default:
+      break;
+  }
+  return Rbac::Principal::MakeAnyPrincipal();
+}
+
+Rbac MakeRbac(const Msg& msg) {
+  std::map<std::string, Rbac::Policy> policies;
+  for (const auto& policy : msg.policies()) {
+    policies[policy.name()] =
+        Rbac::Policy(MakePermission(policy.permissions()),
+                     MakePrincipal(policy.principals()));
+  }
+  return Rbac(Rbac::Action::kAllow, std::move(policies));
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+DEFINE_PROTO_FUZZER(const compiled_rbac_policy_fuzzer::Msg& msg) {
+  using grpc_core::EvaluateArgs;
+  using grpc_core::EvaluateArgsTestUtil;
+  using grpc_core::PolicyAuthorizationMatcher;
+  // Evaluated one by one, like GrpcAuthorizationEngine does without the
+  // experiment.
+  std::vector<
+      std::pair<std::string, std::unique_ptr<PolicyAuthorizationMatcher>>>
+      matchers;
+  for (auto& p : grpc_core::MakeRbac(msg).policies) {
+    matchers.emplace_back(
+        p.first,
+        std::make_unique<PolicyAuthorizationMatcher>(std::move(p.second)));
+  }
+  grpc_core::CompiledRbacPolicy compiled(grpc_core::MakeRbac(msg));
+  if (compiled.num_policies() != matchers.size()) abort();
+  for (const auto& request : msg.requests()) {
+    EvaluateArgsTestUtil util;
+    util.AddPairToMetadata(":path", request.path().c_str());
+    util.AddPairToMetadata(":authority", request.authority().c_str());
+    // Keeps the sanitized header names alive for the metadata batch.
+    std::vector<std::string> names;
+    names.reserve(request.headers_size());
+    for (const auto& header : request.headers()) {
+      names.push_back(grpc_core::HeaderName(header.name()));
+      util.AddPairToMetadata(names.back().c_str(), header.value().c_str());
+    }
+    util.SetLocalEndpoint(absl::StrCat(
+        "ipv4:", grpc_core::Ipv4Address(request.local_address()), ":",
+        request.local_port() % 65536));
+    util.SetPeerEndpoint(absl::StrCat(
+        "ipv4:", grpc_core::Ipv4Address(request.peer_address()), ":0"));
+    if (!request.transport_security_type().empty()) {
+      util.AddPropertyToAuthContext(
+          GRPC_TRANSPORT_SECURITY_TYPE_PROPERTY_NAME,
+          request.transport_security_type().c_str());
+    }
+    for (const auto& san : request.uri_sans()) {
+      util.AddPropertyToAuthContext(GRPC_PEER_URI_PROPERTY_NAME, san.c_str());
+    }
+    for (const auto& san : request.dns_sans()) {
+      util.AddPropertyToAuthContext(GRPC_PEER_DNS_PROPERTY_NAME, san.c_str());
+    }
+    if (!request.subject().empty()) {
+      util.AddPropertyToAuthContext(GRPC_X509_SUBJECT_PROPERTY_NAME,
+                                    request.subject().c_str());
+    }
+    EvaluateArgs args = util.MakeEvaluateArgs();
+    const std::string* expected = nullptr;
+    for (const auto& matcher : matchers) {
+      if (matcher.second->Matches(args)) {
+        expected = &matcher.first;
+        break;
+      }
+    }
+    const std::string* actual = compiled.FindMatchingPolicy(args);
+    if ((expected == nullptr) != (actual == nullptr)) abort();
+    if (expected != nullptr && *expected != *actual) abort();
+  }
+}
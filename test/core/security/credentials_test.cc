@@ -23,6 +23,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <atomic>
 #include <string>
 
 #include <gmock/gmock.h>
@@ -72,6 +73,8 @@
 #include "src/core/lib/uri/uri_parser.h"
 #include "test/core/util/test_config.h"
 
+extern gpr_timespec (*gpr_now_impl)(gpr_clock_type clock_type);
+
 namespace grpc_core {
 
 using internal::grpc_flush_cached_google_default_credentials;
@@ -525,6 +528,9 @@ class RequestMetadataState : public RefCounted<RequestMetadataState> {
         arena_.get(), &pollent_);
   }
 
+  // Whether the request metadata has been checked.
+  bool completed() const { return completed_; }
+
  private:
   // No-op security connector, exists only to inject url_scheme.
   class BogusSecurityConnector : public grpc_channel_security_connector {
@@ -577,6 +583,7 @@ class RequestMetadataState : public RefCounted<RequestMetadataState> {
     gpr_log(GPR_INFO, "expected metadata: %s", expected_.c_str());
     gpr_log(GPR_INFO, "actual metadata: %s", md_.DebugString().c_str());
     GPR_ASSERT(md_.DebugString() == expected_);
+    completed_ = true;
   }
 
   grpc_error_handle expected_error_;
@@ -588,6 +595,7 @@ class RequestMetadataState : public RefCounted<RequestMetadataState> {
   grpc_call_credentials::GetRequestMetadataArgs get_request_metadata_args_;
   grpc_polling_entity pollent_;
   ActivityPtr activity_;
+  bool completed_ = false;
 };
 
 TEST(CredentialsTest, TestGoogleIamCreds) {
@@ -1496,12 +1504,21 @@ TEST(CredentialsTest, TestJwtCredsSuccess) {
   ExecCtx::Get()->Flush();
 
   // Third request: Different service url so jwt_encode_and_sign should be
-  // called again (no caching).
+  // called again.
   state = RequestMetadataState::NewInstance(absl::OkStatus(), emd);
   grpc_jwt_encode_and_sign_set_override(encode_and_sign_jwt_success);
   state->RunRequestMetadataTest(creds, kTestUrlScheme, kTestOtherAuthority,
                                 kTestOtherPath);
   ExecCtx::Get()->Flush();
+
+  // Fourth request: back to the first service url, whose token is still
+  // cached alongside the second one.
+  state = RequestMetadataState::NewInstance(absl::OkStatus(), emd);
+  grpc_jwt_encode_and_sign_set_override(
+      encode_and_sign_jwt_should_not_be_called);
+  state->RunRequestMetadataTest(creds, kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  ExecCtx::Get()->Flush();
   GPR_ASSERT(strncmp(expected_creds_debug_string_prefix,
                      creds->debug_string().c_str(),
                      strlen(expected_creds_debug_string_prefix)) == 0);
@@ -1511,6 +1528,126 @@ TEST(CredentialsTest, TestJwtCredsSuccess) {
   grpc_jwt_encode_and_sign_set_override(nullptr);
 }
 
+std::atomic<int> g_jwt_sign_count{0};
+
+char* encode_and_sign_jwt_counting(const grpc_auth_json_key* json_key,
+                                   const char* audience,
+                                   gpr_timespec token_lifetime,
+                                   const char* scope) {
+  g_jwt_sign_count.fetch_add(1);
+  return encode_and_sign_jwt_success(json_key, audience, token_lifetime,
+                                     scope);
+}
+
+gpr_timespec (*g_original_now_impl)(gpr_clock_type) = nullptr;
+std::atomic<int64_t> g_realtime_offset_secs{0};
+
+gpr_timespec now_with_realtime_offset(gpr_clock_type clock_type) {
+  gpr_timespec now = g_original_now_impl(clock_type);
+  if (clock_type == GPR_CLOCK_REALTIME) {
+    now.tv_sec += g_realtime_offset_secs.load();
+  }
+  return now;
+}
+
+TEST(CredentialsTest, TestJwtCredsRefreshAheadOfExpiry) {
+  char* json_key_string = test_json_key_str();
+  ExecCtx exec_ctx;
+  std::string emd = absl::StrCat("authorization: Bearer ", test_signed_jwt);
+  grpc_call_credentials* creds =
+      grpc_service_account_jwt_access_credentials_create(
+          json_key_string, grpc_max_auth_token_lifetime(), nullptr);
+  g_original_now_impl = gpr_now_impl;
+  gpr_now_impl = now_with_realtime_offset;
+  g_realtime_offset_secs.store(0);
+  g_jwt_sign_count.store(0);
+  grpc_jwt_encode_and_sign_set_override(encode_and_sign_jwt_counting);
+
+  auto state = RequestMetadataState::NewInstance(absl::OkStatus(), emd);
+  state->RunRequestMetadataTest(creds, kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  ExecCtx::Get()->Flush();
+  EXPECT_EQ(g_jwt_sign_count.load(), 1);
+  absl::optional<gpr_timespec> expiration =
+      creds_as_jwt(creds)->CachedJwtExpirationForTesting(
+          test_service_url_no_service_name);
+  ASSERT_TRUE(expiration.has_value());
+
+  // With 10 minutes left, the cached token is still served but a new one is
+  // signed in the background.
+  const int64_t lifetime_secs = grpc_max_auth_token_lifetime().tv_sec;
+  g_realtime_offset_secs.store(lifetime_secs - 600);
+  state = RequestMetadataState::NewInstance(absl::OkStatus(), emd);
+  state->RunRequestMetadataTest(creds, kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  ExecCtx::Get()->Flush();
+  gpr_timespec deadline = grpc_timeout_seconds_to_deadline(10);
+  while (gpr_time_cmp(*creds_as_jwt(creds)->CachedJwtExpirationForTesting(
+                          test_service_url_no_service_name),
+                      *expiration) <= 0) {
+    ASSERT_LT(gpr_time_cmp(gpr_now(GPR_CLOCK_MONOTONIC), deadline), 0);
+    gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(10));
+  }
+  EXPECT_EQ(g_jwt_sign_count.load(), 2);
+
+  // Past the original expiration, the refreshed token is served.
+  g_realtime_offset_secs.store(lifetime_secs + 60);
+  state = RequestMetadataState::NewInstance(absl::OkStatus(), emd);
+  grpc_jwt_encode_and_sign_set_override(
+      encode_and_sign_jwt_should_not_be_called);
+  state->RunRequestMetadataTest(creds, kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  ExecCtx::Get()->Flush();
+
+  gpr_now_impl = g_original_now_impl;
+  creds->Unref();
+  gpr_free(json_key_string);
+  grpc_jwt_encode_and_sign_set_override(nullptr);
+}
+
+grpc_call_credentials* g_concurrent_creds = nullptr;
+RefCountedPtr<RequestMetadataState> g_concurrent_state;
+
+// Starts another request for the same audience while the JWT is signed.
+char* encode_and_sign_jwt_with_concurrent_request(
+    const grpc_auth_json_key* json_key, const char* audience,
+    gpr_timespec token_lifetime, const char* scope) {
+  g_jwt_sign_count.fetch_add(1);
+  if (g_concurrent_state != nullptr) {
+    g_concurrent_state->RunRequestMetadataTest(
+        g_concurrent_creds, kTestUrlScheme, kTestAuthority, kTestPath);
+  }
+  return encode_and_sign_jwt_success(json_key, audience, token_lifetime,
+                                     scope);
+}
+
+TEST(CredentialsTest, TestJwtCredsCoalescesConcurrentSigning) {
+  char* json_key_string = test_json_key_str();
+  ExecCtx exec_ctx;
+  std::string emd = absl::StrCat("authorization: Bearer ", test_signed_jwt);
+  grpc_call_credentials* creds =
+      grpc_service_account_jwt_access_credentials_create(
+          json_key_string, grpc_max_auth_token_lifetime(), nullptr);
+  g_jwt_sign_count.store(0);
+  grpc_jwt_encode_and_sign_set_override(
+      encode_and_sign_jwt_with_concurrent_request);
+  g_concurrent_creds = creds;
+  g_concurrent_state = RequestMetadataState::NewInstance(absl::OkStatus(), emd);
+  auto state = RequestMetadataState::NewInstance(absl::OkStatus(), emd);
+  state->RunRequestMetadataTest(creds, kTestUrlScheme, kTestAuthority,
+                                kTestPath);
+  ExecCtx::Get()->Flush();
+  // The second request waited for the JWT signed for the first one.
+  EXPECT_EQ(g_jwt_sign_count.load(), 1);
+  EXPECT_TRUE(state->completed());
+  EXPECT_TRUE(g_concurrent_state->completed());
+  g_concurrent_state.reset();
+  g_concurrent_creds = nullptr;
+  creds->Unref();
+  gpr_free(json_key_string);
+  grpc_jwt_encode_and_sign_set_override(nullptr);
+}
+
 TEST(CredentialsTest, TestJwtCredsSigningFailure) {
   const char expected_creds_debug_string_prefix[] =
       "JWTAccessCredentials{ExpirationTime:";
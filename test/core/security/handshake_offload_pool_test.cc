@@ -0,0 +1,97 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/lib/security/transport/handshake_offload_pool.h"
+
+#include <atomic>
+
+#include <gtest/gtest.h>
+
+#include "absl/status/status.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/notification.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+TEST(HandshakeOffloadPoolTest, DisabledByDefault) {
+  EXPECT_EQ(HandshakeOffloadPool::GetForArgs(ChannelArgs()), nullptr);
+}
+
+TEST(HandshakeOffloadPoolTest, RunsOnPoolThreads) {
+  HandshakeOffloadPool pool({4, 100, Duration::Seconds(10)});
+  std::atomic<int> ran{0};
+  Notification done;
+  for (int i = 0; i < 100; i++) {
+    ASSERT_TRUE(pool.Run([&](absl::Status status) {
+      EXPECT_TRUE(status.ok());
+      EXPECT_TRUE(HandshakeOffloadPool::IsPoolThread());
+      EXPECT_NE(ExecCtx::Get(), nullptr);
+      if (++ran == 100) done.Notify();
+    }));
+  }
+  EXPECT_FALSE(HandshakeOffloadPool::IsPoolThread());
+  done.WaitForNotification();
+}
+
+TEST(HandshakeOffloadPoolTest, RejectsPastMaxPending) {
+  HandshakeOffloadPool pool({1, 2, Duration::Seconds(10)});
+  Notification release;
+  Notification done;
+  ASSERT_TRUE(
+      pool.Run([&](absl::Status) { release.WaitForNotification(); }));
+  ASSERT_TRUE(pool.Run([&](absl::Status) { done.Notify(); }));
+  EXPECT_FALSE(pool.Run([](absl::Status) { FAIL(); }));
+  release.Notify();
+  done.WaitForNotification();
+}
+
+TEST(HandshakeOffloadPoolTest, FailsWorkQueuedPastTimeout) {
+  HandshakeOffloadPool pool({1, 10, Duration::Milliseconds(100)});
+  Notification release;
+  Notification done;
+  ASSERT_TRUE(
+      pool.Run([&](absl::Status) { release.WaitForNotification(); }));
+  ASSERT_TRUE(pool.Run([&](absl::Status status) {
+    EXPECT_EQ(status.code(), absl::StatusCode::kDeadlineExceeded);
+    done.Notify();
+  }));
+  gpr_sleep_until(grpc_timeout_milliseconds_to_deadline(500));
+  release.Notify();
+  done.WaitForNotification();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
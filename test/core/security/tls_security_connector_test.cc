@@ -888,7 +888,8 @@ TEST_F(TlsSecurityConnectorTest,
 TEST_F(TlsSecurityConnectorTest,
        CreateServerSecurityConnectorFailNoCredentials) {
   auto connector = TlsServerSecurityConnector::CreateTlsServerSecurityConnector(
-      nullptr, MakeRefCounted<grpc_tls_credentials_options>());
+      nullptr, MakeRefCounted<grpc_tls_credentials_options>(),
+      /*share_session_ticket_keys=*/false);
   EXPECT_EQ(connector, nullptr);
 }
 
@@ -898,7 +899,7 @@ TEST_F(TlsSecurityConnectorTest, CreateServerSecurityConnectorFailNoOptions) {
   RefCountedPtr<TlsServerCredentials> credential =
       MakeRefCounted<TlsServerCredentials>(options);
   auto connector = TlsServerSecurityConnector::CreateTlsServerSecurityConnector(
-      credential, nullptr);
+      credential, nullptr, /*share_session_ticket_keys=*/false);
   EXPECT_EQ(connector, nullptr);
 }
 
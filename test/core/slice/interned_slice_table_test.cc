@@ -0,0 +1,94 @@
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "src/core/lib/slice/interned_slice_table.h"
+
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "gtest/gtest.h"
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice.h"
+
+namespace grpc_core {
+namespace {
+
+TEST(InternedSliceTableTest, EqualValuesShareStorage) {
+  ExecCtx exec_ctx;
+  InternedSliceTable table(1024 * 1024);
+  const std::string value = "application/grpc+proto; charset=utf-8";
+  Slice a = table.Intern(value);
+  Slice b = table.Intern(std::string(value));
+  EXPECT_EQ(a.as_string_view(), value);
+  EXPECT_EQ(a.data(), b.data());
+  Slice c = table.Intern("application/grpc+json; charset=utf-8");
+  EXPECT_NE(a.data(), c.data());
+  EXPECT_GT(table.MemoryUsage(), 2 * value.size());
+}
+
+TEST(InternedSliceTableTest, ShortAndLongValuesAreCopied) {
+  ExecCtx exec_ctx;
+  InternedSliceTable table(1024 * 1024);
+  Slice a = table.Intern("gzip");
+  Slice b = table.Intern("gzip");
+  EXPECT_EQ(a.as_string_view(), "gzip");
+  EXPECT_NE(a.data(), b.data());
+  const std::string long_value(InternedSliceTable::kMaxInternedLength + 1,
+                               'x');
+  Slice c = table.Intern(long_value);
+  Slice d = table.Intern(long_value);
+  EXPECT_EQ(c.as_string_view(), long_value);
+  EXPECT_NE(c.data(), d.data());
+  EXPECT_EQ(table.MemoryUsage(), 0);
+}
+
+TEST(InternedSliceTableTest, StaysWithinBudget) {
+  ExecCtx exec_ctx;
+  constexpr size_t kBudget = 64 * 1024;
+  InternedSliceTable table(kBudget);
+  std::vector<Slice> slices;
+  for (int i = 0; i < 10000; i++) {
+    std::string value = absl::StrCat("some-fairly-long-header-value-", i);
+    slices.push_back(table.Intern(value));
+    EXPECT_LE(table.MemoryUsage(), kBudget);
+  }
+  // Slices handed out stay valid after their entries are evicted.
+  for (int i = 0; i < 10000; i++) {
+    EXPECT_EQ(slices[i].as_string_view(),
+              absl::StrCat("some-fairly-long-header-value-", i));
+  }
+}
+
+TEST(InternedSliceTableTest, HitValuesSurviveEviction) {
+  ExecCtx exec_ctx;
+  InternedSliceTable table(64 * 1024);
+  const std::string hot = "hot-header-value-that-repeats-a-lot";
+  Slice first = table.Intern(hot);
+  for (int i = 0; i < 10000; i++) {
+    table.Intern(absl::StrCat("cold-header-value-number-", i));
+    if (i % 16 == 0) {
+      EXPECT_EQ(table.Intern(hot).data(), first.data());
+    }
+  }
+}
+
+}  // namespace
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -18,6 +18,7 @@
 
 #include <string.h>
 
+#include <string>
 #include <utility>
 
 #include "gtest/gtest.h"
@@ -78,6 +79,83 @@ TEST(SliceBufferTest, SliceRefTest) {
   sb.Clear();
 }
 
+TEST(SliceBufferTest, CoalescesSmallSlices) {
+  SliceBuffer sb;
+  sb.EnableCoalescing();
+  for (int i = 0; i < 10; i++) {
+    sb.Append(MakeSlice(10));
+    memset(sb.AddTiny(2), 'b', 2);
+  }
+  ASSERT_EQ(sb.Count(), 1);
+  ASSERT_EQ(sb.Length(), 120);
+  // Large slices are still appended by reference.
+  Slice large = MakeSlice(1000);
+  const uint8_t* large_data = large.data();
+  sb.Append(std::move(large));
+  ASSERT_EQ(sb.Count(), 2);
+  ASSERT_EQ(sb[1].data(), large_data);
+  sb.Append(MakeSlice(10));
+  ASSERT_EQ(sb.Count(), 3);
+  std::string expected;
+  for (int i = 0; i < 10; i++) expected += "aaaaaaaaaabb";
+  expected += std::string(1010, 'a');
+  ASSERT_EQ(sb.JoinIntoString(), expected);
+}
+
+TEST(SliceBufferTest, CoalescingDoesNotOverwriteTrimmedBytes) {
+  SliceBuffer sb;
+  sb.EnableCoalescing();
+  sb.Append(MakeSlice(20));
+  SliceBuffer trimmed;
+  sb.MoveLastNBytesIntoSliceBuffer(10, trimmed);
+  sb.Append(MakeSlice(5));
+  memset(sb.AddTiny(5), 'b', 5);
+  ASSERT_EQ(sb.JoinIntoString(), std::string(15, 'a') + "bbbbb");
+  ASSERT_EQ(trimmed.JoinIntoString(), std::string(10, 'a'));
+}
+
+TEST(SliceBufferTest, CoalescingMovesWithContents) {
+  SliceBuffer sb;
+  sb.EnableCoalescing();
+  sb.Append(MakeSlice(10));
+  SliceBuffer moved(std::move(sb));
+  moved.Append(MakeSlice(10));
+  ASSERT_EQ(moved.Count(), 1);
+  ASSERT_EQ(moved.JoinIntoString(), std::string(20, 'a'));
+  // The moved-from buffer no longer coalesces.
+  sb.Append(MakeSlice(10));
+  sb.Append(MakeSlice(10));
+  ASSERT_EQ(sb.Count(), 2);
+}
+
+TEST(SliceBufferTest, IoVecs) {
+  struct IoVec {
+    void* iov_base;
+    size_t iov_len;
+  };
+  SliceBuffer sb;
+  sb.Append(MakeSlice(10));
+  sb.Append(MakeSlice(20));
+  sb.Append(MakeSlice(30));
+  IoVec iovs[2];
+  size_t slice_idx = 0;
+  size_t length = 0;
+  ASSERT_EQ(grpc_core::SliceBufferToIoVecs(sb.c_slice_buffer(), &slice_idx, 5,
+                                           iovs, 2, &length),
+            2);
+  EXPECT_EQ(slice_idx, 2);
+  EXPECT_EQ(length, 25);
+  EXPECT_EQ(iovs[0].iov_base, sb[0].data() + 5);
+  EXPECT_EQ(iovs[0].iov_len, 5);
+  EXPECT_EQ(iovs[1].iov_base, sb[1].data());
+  EXPECT_EQ(iovs[1].iov_len, 20);
+  ASSERT_EQ(grpc_core::SliceBufferToIoVecs(sb.c_slice_buffer(), &slice_idx, 0,
+                                           iovs, 2, &length),
+            1);
+  EXPECT_EQ(slice_idx, 3);
+  EXPECT_EQ(length, 55);
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
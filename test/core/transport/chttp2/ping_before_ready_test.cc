@@ -0,0 +1,249 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Tests for GRPC_ARG_HTTP2_PING_BEFORE_READY, which makes the chttp2
+// connector wait for the ack of a PING sent after the server's SETTINGS
+// frame before reporting the connection as established.
+
+#include <limits.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gprpp/host_port.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/iomgr/closure.h"
+#include "src/core/lib/iomgr/endpoint.h"
+#include "src/core/lib/iomgr/error.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/iomgr_fwd.h"
+#include "src/core/lib/iomgr/tcp_server.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+#include "test/core/util/test_tcp_server.h"
+
+namespace grpc_core {
+namespace test {
+namespace {
+
+// An empty HTTP/2 SETTINGS frame.
+constexpr char kSettingsFrame[] = "\x00\x00\x00\x04\x00\x00\x00\x00\x00";
+
+// A real gRPC server, whose transport acks PINGs.
+class ServerThread {
+ public:
+  ServerThread()
+      : address_(JoinHostPort("localhost", grpc_pick_unused_port_or_die())) {
+    server_ = grpc_server_create(nullptr, nullptr);
+    grpc_server_credentials* server_creds =
+        grpc_insecure_server_credentials_create();
+    GPR_ASSERT(
+        grpc_server_add_http2_port(server_, address_.c_str(), server_creds));
+    grpc_server_credentials_release(server_creds);
+    cq_ = grpc_completion_queue_create_for_next(nullptr);
+    grpc_server_register_completion_queue(server_, cq_, nullptr);
+    grpc_server_start(server_);
+    thread_ = std::thread([this]() {
+      // The completion queue should not return anything other than shutdown.
+      grpc_event ev = grpc_completion_queue_next(
+          cq_, gpr_inf_future(GPR_CLOCK_MONOTONIC), nullptr);
+      GPR_ASSERT(ev.type == GRPC_QUEUE_SHUTDOWN);
+    });
+  }
+
+  ~ServerThread() {
+    grpc_completion_queue* shutdown_cq =
+        grpc_completion_queue_create_for_pluck(nullptr);
+    grpc_server_shutdown_and_notify(server_, shutdown_cq, nullptr);
+    GPR_ASSERT(grpc_completion_queue_pluck(shutdown_cq, nullptr,
+                                           grpc_timeout_seconds_to_deadline(5),
+                                           nullptr)
+                   .type == GRPC_OP_COMPLETE);
+    grpc_completion_queue_destroy(shutdown_cq);
+    grpc_server_destroy(server_);
+    grpc_completion_queue_shutdown(cq_);
+    thread_.join();
+    grpc_completion_queue_destroy(cq_);
+  }
+
+  const std::string& address() const { return address_; }
+
+ private:
+  const std::string address_;
+  grpc_server* server_;
+  grpc_completion_queue* cq_;
+  std::thread thread_;
+};
+
+// A fake HTTP/2 server that sends a SETTINGS frame on each connection and
+// then ignores everything the client sends, so it never acks a PING.
+class NoPingAckServer {
+ public:
+  NoPingAckServer()
+      : port_(grpc_pick_unused_port_or_die()),
+        address_(JoinHostPort("localhost", port_)) {
+    test_tcp_server_init(&server_, OnConnect, this);
+    test_tcp_server_start(&server_, port_);
+    thread_ = std::thread([this]() {
+      while (!shutdown_.load()) test_tcp_server_poll(&server_, 100);
+    });
+  }
+
+  ~NoPingAckServer() {
+    shutdown_.store(true);
+    thread_.join();
+    {
+      ExecCtx exec_ctx;
+      for (auto& connection : connections_) {
+        grpc_endpoint_destroy(connection->endpoint);
+        grpc_slice_buffer_destroy(&connection->write_buffer);
+      }
+    }
+    test_tcp_server_destroy(&server_);
+  }
+
+  const std::string& address() const { return address_; }
+
+ private:
+  struct Connection {
+    grpc_endpoint* endpoint;
+    grpc_slice_buffer write_buffer;
+    grpc_closure on_write;
+  };
+
+  static void OnConnect(void* arg, grpc_endpoint* endpoint,
+                        grpc_pollset* /*accepting_pollset*/,
+                        grpc_tcp_server_acceptor* acceptor) {
+    gpr_free(acceptor);
+    auto* self = static_cast<NoPingAckServer*>(arg);
+    grpc_endpoint_add_to_pollset(endpoint, self->server_.pollset[0]);
+    self->connections_.push_back(std::make_unique<Connection>());
+    Connection* connection = self->connections_.back().get();
+    connection->endpoint = endpoint;
+    grpc_slice_buffer_init(&connection->write_buffer);
+    grpc_slice_buffer_add(
+        &connection->write_buffer,
+        grpc_slice_from_static_buffer(kSettingsFrame,
+                                      sizeof(kSettingsFrame) - 1));
+    GRPC_CLOSURE_INIT(
+        &connection->on_write,
+        [](void* /*arg*/, grpc_error_handle error) {
+          GPR_ASSERT(error.ok());
+        },
+        nullptr, grpc_schedule_on_exec_ctx);
+    grpc_endpoint_write(endpoint, &connection->write_buffer,
+                        &connection->on_write, nullptr,
+                        /*max_frame_size=*/INT_MAX);
+  }
+
+  const int port_;
+  const std::string address_;
+  test_tcp_server server_;
+  std::atomic<bool> shutdown_{false};
+  std::thread thread_;
+  // Only accessed from thread_ while it is running.
+  std::vector<std::unique_ptr<Connection>> connections_;
+};
+
+grpc_channel* CreateChannel(const std::string& address,
+                            bool ping_before_ready) {
+  auto args = ChannelArgs()
+                  .Set(GRPC_ARG_HTTP2_PING_BEFORE_READY, ping_before_ready)
+                  .ToC();
+  grpc_channel_credentials* creds = grpc_insecure_credentials_create();
+  grpc_channel* channel =
+      grpc_channel_create(address.c_str(), creds, args.get());
+  grpc_channel_credentials_release(creds);
+  return channel;
+}
+
+// Asks channel to connect and waits until it is READY or the timeout
+// expires.  Returns whether the channel became READY.
+bool WaitForReady(grpc_channel* channel, Duration timeout) {
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  const gpr_timespec deadline =
+      grpc_timeout_milliseconds_to_deadline(timeout.millis());
+  grpc_connectivity_state state =
+      grpc_channel_check_connectivity_state(channel, /*try_to_connect=*/1);
+  while (state != GRPC_CHANNEL_READY) {
+    grpc_channel_watch_connectivity_state(channel, state, deadline, cq,
+                                          nullptr);
+    grpc_event ev = grpc_completion_queue_next(
+        cq, gpr_inf_future(GPR_CLOCK_MONOTONIC), nullptr);
+    GPR_ASSERT(ev.type == GRPC_OP_COMPLETE);
+    // The deadline expired without a state change.
+    if (!ev.success) break;
+    state = grpc_channel_check_connectivity_state(channel, 1);
+  }
+  grpc_completion_queue_shutdown(cq);
+  while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_MONOTONIC),
+                                    nullptr)
+             .type != GRPC_QUEUE_SHUTDOWN) {
+  }
+  grpc_completion_queue_destroy(cq);
+  return state == GRPC_CHANNEL_READY;
+}
+
+TEST(PingBeforeReady, ReadyOnceServerAcksPing) {
+  ServerThread server;
+  grpc_channel* channel =
+      CreateChannel(server.address(), /*ping_before_ready=*/true);
+  EXPECT_TRUE(WaitForReady(channel, Duration::Seconds(10)));
+  grpc_channel_destroy(channel);
+}
+
+TEST(PingBeforeReady, NotReadyUntilServerAcksPing) {
+  NoPingAckServer server;
+  // Without the arg, the server's SETTINGS frame is enough for the channel
+  // to become READY.
+  grpc_channel* channel =
+      CreateChannel(server.address(), /*ping_before_ready=*/false);
+  EXPECT_TRUE(WaitForReady(channel, Duration::Seconds(10)));
+  grpc_channel_destroy(channel);
+  // With the arg, the channel waits for the PING ack, which never comes.
+  channel = CreateChannel(server.address(), /*ping_before_ready=*/true);
+  EXPECT_FALSE(WaitForReady(channel, Duration::Seconds(2)));
+  grpc_channel_destroy(channel);
+}
+
+}  // namespace
+}  // namespace test
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  int result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
@@ -141,6 +141,41 @@ TEST_F(MetadataMapTest, NonEncodableTrait) {
   EXPECT_EQ(map.DebugString(), "GrpcStreamNetworkState: not sent on wire");
 }
 
+TEST_F(MetadataMapTest, DirectionalBatchesAreSmaller) {
+  EXPECT_LT(sizeof(ClientInitialMetadataBatch), sizeof(grpc_metadata_batch));
+  EXPECT_LT(sizeof(ServerInitialMetadataBatch), sizeof(grpc_metadata_batch));
+  EXPECT_LT(sizeof(ServerTrailingMetadataBatch), sizeof(grpc_metadata_batch));
+}
+
+TEST_F(MetadataMapTest, CopyAsRoundTrip) {
+  auto arena = MakeScopedArena(1024, &memory_allocator_);
+  grpc_metadata_batch map(arena.get());
+  map.Set(HttpPathMetadata(), Slice::FromCopiedString("/foo/bar"));
+  map.Set(WaitForReady(), WaitForReady::ValueType{true, false});
+  // Valid in the other direction: carried as an unknown key/value pair.
+  map.Set(GrpcMessageMetadata(), Slice::FromCopiedString("hello"));
+  // Non-encodable, and valid in the other direction: dropped.
+  map.Set(GrpcStatusFromWire(), true);
+  map.Append("x-custom", Slice::FromCopiedString("abc"),
+             [](absl::string_view, const Slice&) { abort(); });
+  auto initial = map.CopyAs<ClientInitialMetadataBatch>();
+  EXPECT_EQ(initial.get_pointer(HttpPathMetadata())->as_string_view(),
+            "/foo/bar");
+  EXPECT_TRUE(initial.get(WaitForReady())->value);
+  std::string buffer;
+  EXPECT_EQ(initial.GetStringValue("grpc-message", &buffer), "hello");
+  EXPECT_EQ(initial.GetStringValue("x-custom", &buffer), "abc");
+  auto back = initial.CopyAs<grpc_metadata_batch>();
+  EXPECT_EQ(back.get_pointer(HttpPathMetadata())->as_string_view(),
+            "/foo/bar");
+  EXPECT_TRUE(back.get(WaitForReady())->value);
+  ASSERT_NE(back.get_pointer(GrpcMessageMetadata()), nullptr);
+  EXPECT_EQ(back.get_pointer(GrpcMessageMetadata())->as_string_view(),
+            "hello");
+  EXPECT_EQ(back.get(GrpcStatusFromWire()), absl::nullopt);
+  EXPECT_EQ(back.GetStringValue("x-custom", &buffer), "abc");
+}
+
 TEST(DebugStringBuilderTest, AddOne) {
   metadata_detail::DebugStringBuilder b;
   b.Add("a", "b");
@@ -18,6 +18,8 @@
 
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 
+#include <string.h>
+
 #include <string>
 #include <unordered_set>
 
@@ -27,6 +29,8 @@
 #include <grpc/support/log.h>
 
 #include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/tsi/ssl/session_cache/ssl_ticket_key_store.h"
 #include "test/core/util/test_config.h"
 
 namespace grpc_core {
@@ -143,6 +147,72 @@ TEST(SslSessionCacheTest, LruCache) {
   EXPECT_EQ(tracker.AliveCount(), 0);
 }
 
+TEST(SslSessionCacheTest, ShardedLruCache) {
+  SessionTracker tracker;
+  {
+    RefCountedPtr<tsi::SslSessionLRUCache> cache =
+        tsi::SslSessionLRUCache::Create(1000);
+    for (long id = 0; id < 2000; id++) {
+      std::string domain = std::to_string(id) + ".random.domain";
+      cache->Put(domain.c_str(), tracker.NewSession(id));
+      // Shards evict on their own, the cache never grows past its capacity.
+      ASSERT_LE(cache->Size(), 1000);
+    }
+    EXPECT_GT(cache->Size(), 900);
+    EXPECT_EQ(tracker.AliveCount(), cache->Size());
+    size_t found = 0;
+    for (long id = 0; id < 2000; id++) {
+      std::string domain = std::to_string(id) + ".random.domain";
+      if (cache->Get(domain.c_str()) != nullptr) found++;
+    }
+    EXPECT_EQ(found, cache->Size());
+    // The most recent sessions are in the cache, whatever their shard.
+    for (long id = 1990; id < 2000; id++) {
+      std::string domain = std::to_string(id) + ".random.domain";
+      EXPECT_TRUE(cache->Get(domain.c_str()));
+    }
+    EXPECT_FALSE(cache->Get("unknown.random.domain"));
+  }
+  EXPECT_EQ(tracker.AliveCount(), 0);
+}
+
+class FakeTimeSource : public Timestamp::ScopedSource {
+ public:
+  Timestamp Now() override { return now_; }
+  void Advance(Duration duration) { now_ += duration; }
+
+ private:
+  Timestamp now_ = Timestamp::FromMillisecondsAfterProcessEpoch(1000);
+};
+
+TEST(SslTicketKeyStoreTest, RotatesKeys) {
+  FakeTimeSource time_source;
+  tsi::SslTicketKeyStore store(Duration::Hours(1));
+  tsi::SslTicketKeyStore::Key first = store.CurrentKey();
+  tsi::SslTicketKeyStore::Key key;
+  bool renew = true;
+  ASSERT_TRUE(store.FindKey(first.name, &key, &renew));
+  EXPECT_FALSE(renew);
+  EXPECT_EQ(memcmp(&key, &first, sizeof(key)), 0);
+  // After one period, tickets from the first key are accepted and renewed.
+  time_source.Advance(Duration::Minutes(90));
+  tsi::SslTicketKeyStore::Key second = store.CurrentKey();
+  EXPECT_NE(memcmp(first.name, second.name, sizeof(first.name)), 0);
+  ASSERT_TRUE(store.FindKey(first.name, &key, &renew));
+  EXPECT_TRUE(renew);
+  EXPECT_EQ(memcmp(&key, &first, sizeof(key)), 0);
+  ASSERT_TRUE(store.FindKey(second.name, &key, &renew));
+  EXPECT_FALSE(renew);
+  // After another one, they are not.
+  time_source.Advance(Duration::Hours(1));
+  EXPECT_FALSE(store.FindKey(first.name, &key, &renew));
+  ASSERT_TRUE(store.FindKey(second.name, &key, &renew));
+  EXPECT_TRUE(renew);
+  // Keys unused for two periods all expire.
+  time_source.Advance(Duration::Hours(2));
+  EXPECT_FALSE(store.FindKey(second.name, &key, &renew));
+}
+
 }  // namespace
 }  // namespace grpc_core
 
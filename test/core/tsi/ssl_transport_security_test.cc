@@ -22,12 +22,25 @@
 #include <stdio.h>
 #include <string.h>
 
+#ifdef GPR_LINUX
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <string>
+#include <thread>
+
 #include <gtest/gtest.h>
 #include <openssl/crypto.h>
 #include <openssl/err.h>
 #include <openssl/pem.h>
 
 #include <grpc/grpc.h>
+#include <grpc/slice.h>
+#include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
@@ -37,6 +50,7 @@
 #include "src/core/lib/iomgr/load_file.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "test/core/tsi/transport_security_test_lib.h"
 #include "test/core/util/build.h"
@@ -102,6 +116,7 @@ typedef struct ssl_tsi_test_fixture {
   bool session_reused;
   const char* session_ticket_key;
   size_t session_ticket_key_size;
+  bool share_session_ticket_keys;
   size_t network_bio_buf_size;
   size_t ssl_bio_buf_size;
   tsi_ssl_server_handshaker_factory* server_handshaker_factory;
@@ -170,6 +185,8 @@ static void ssl_test_setup_handshakers(tsi_test_fixture* fixture) {
   }
   server_options.session_ticket_key = ssl_fixture->session_ticket_key;
   server_options.session_ticket_key_size = ssl_fixture->session_ticket_key_size;
+  server_options.share_session_ticket_keys =
+      ssl_fixture->share_session_ticket_keys;
   server_options.min_tls_version = test_tls_version;
   server_options.max_tls_version = test_tls_version;
   ASSERT_EQ(tsi_create_ssl_server_handshaker_factory_with_options(
@@ -519,6 +536,7 @@ static tsi_test_fixture* ssl_tsi_test_fixture_create() {
   ssl_fixture->session_reused = false;
   ssl_fixture->session_ticket_key = nullptr;
   ssl_fixture->session_ticket_key_size = 0;
+  ssl_fixture->share_session_ticket_keys = false;
   ssl_fixture->force_client_auth = false;
   ssl_fixture->network_bio_buf_size = 0;
   ssl_fixture->ssl_bio_buf_size = 0;
@@ -793,6 +811,38 @@ void ssl_tsi_test_do_handshake_session_cache() {
   tsi_ssl_session_cache_unref(session_cache);
 }
 
+void ssl_tsi_test_do_handshake_session_resumption_verification_config() {
+  gpr_log(GPR_INFO,
+          "ssl_tsi_test_do_handshake_session_resumption_verification_config");
+  tsi_ssl_session_cache* session_cache = tsi_ssl_session_cache_create_lru(16);
+  // Each handshake gets its own server handshaker factory. They all share the
+  // ticket keys of the process, so tickets can only be rejected because of
+  // the client verification config of the server.
+  auto do_handshake = [&session_cache](bool force_client_auth,
+                                       bool session_reused) {
+    tsi_test_fixture* fixture = ssl_tsi_test_fixture_create();
+    ssl_tsi_test_fixture* ssl_fixture =
+        reinterpret_cast<ssl_tsi_test_fixture*>(fixture);
+    ssl_fixture->server_name_indication =
+        const_cast<char*>("waterzooi.test.google.be");
+    ssl_fixture->share_session_ticket_keys = true;
+    ssl_fixture->force_client_auth = force_client_auth;
+    tsi_ssl_session_cache_ref(session_cache);
+    ssl_fixture->session_cache = session_cache;
+    ssl_fixture->session_reused = session_reused;
+    tsi_test_do_round_trip(&ssl_fixture->base);
+    tsi_test_fixture_destroy(fixture);
+  };
+  do_handshake(/*force_client_auth=*/false, /*session_reused=*/false);
+  do_handshake(/*force_client_auth=*/false, /*session_reused=*/true);
+  // A session established without verifying the client must not be resumed
+  // by a server requiring client certificates, and vice versa.
+  do_handshake(/*force_client_auth=*/true, /*session_reused=*/false);
+  do_handshake(/*force_client_auth=*/true, /*session_reused=*/true);
+  do_handshake(/*force_client_auth=*/false, /*session_reused=*/false);
+  tsi_ssl_session_cache_unref(session_cache);
+}
+
 static const tsi_ssl_handshaker_factory_vtable* original_vtable;
 static bool handshaker_factory_destructor_called;
 
@@ -1089,6 +1139,228 @@ void ssl_tsi_test_do_handshake_with_custom_bio_pair() {
   tsi_test_fixture_destroy(fixture);
 }
 
+static std::string slice_buffer_to_string(const grpc_slice_buffer& buffer) {
+  std::string result;
+  for (size_t i = 0; i < buffer.count; i++) {
+    result.append(
+        reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(buffer.slices[i])),
+        GRPC_SLICE_LENGTH(buffer.slices[i]));
+  }
+  return result;
+}
+
+// Round trips plaintext in slices smaller and larger than a record through
+// zero-copy protectors, with the protected bytes delivered in small pieces.
+void ssl_tsi_test_zero_copy_round_trip() {
+  gpr_log(GPR_INFO, "ssl_tsi_test_zero_copy_round_trip");
+  tsi_test_fixture* fixture = ssl_tsi_test_fixture_create();
+  tsi_test_do_handshake(fixture);
+  tsi_zero_copy_grpc_protector* client_protector = nullptr;
+  tsi_zero_copy_grpc_protector* server_protector = nullptr;
+  ASSERT_EQ(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                fixture->client_result, nullptr, &client_protector),
+            TSI_OK);
+  ASSERT_EQ(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                fixture->server_result, nullptr, &server_protector),
+            TSI_OK);
+  std::string message;
+  grpc_slice_buffer unprotected;
+  grpc_slice_buffer_init(&unprotected);
+  for (size_t size : {1, 100, 4096, 20000, 3, 70000}) {
+    std::string piece(size, static_cast<char>('a' + size % 26));
+    message += piece;
+    grpc_slice_buffer_add(&unprotected, grpc_slice_from_copied_buffer(
+                                            piece.data(), piece.size()));
+  }
+  grpc_slice_buffer protected_slices;
+  grpc_slice_buffer_init(&protected_slices);
+  ASSERT_EQ(tsi_zero_copy_grpc_protector_protect(
+                client_protector, &unprotected, &protected_slices),
+            TSI_OK);
+  EXPECT_EQ(unprotected.length, 0u);
+  grpc_slice_buffer piece;
+  grpc_slice_buffer_init(&piece);
+  grpc_slice_buffer received;
+  grpc_slice_buffer_init(&received);
+  int min_progress_size = 0;
+  while (protected_slices.length > 0) {
+    grpc_slice_buffer_move_first(
+        &protected_slices, std::min<size_t>(777, protected_slices.length),
+        &piece);
+    ASSERT_EQ(tsi_zero_copy_grpc_protector_unprotect(
+                  server_protector, &piece, &received, &min_progress_size),
+              TSI_OK);
+    EXPECT_EQ(piece.length, 0u);
+    EXPECT_GT(min_progress_size, 0);
+  }
+  // All records are complete: the next read needs a record header.
+  EXPECT_EQ(min_progress_size, 5);
+  EXPECT_EQ(slice_buffer_to_string(received), message);
+  grpc_slice_buffer_destroy(&unprotected);
+  grpc_slice_buffer_destroy(&protected_slices);
+  grpc_slice_buffer_destroy(&piece);
+  grpc_slice_buffer_destroy(&received);
+  tsi_zero_copy_grpc_protector_destroy(client_protector);
+  tsi_zero_copy_grpc_protector_destroy(server_protector);
+  tsi_test_fixture_destroy(fixture);
+}
+
+// Protects on one thread while unprotecting on another with the same
+// zero-copy protector, as the secure endpoint does for concurrent reads and
+// writes.
+void ssl_tsi_test_zero_copy_concurrent_protect_unprotect() {
+  gpr_log(GPR_INFO, "ssl_tsi_test_zero_copy_concurrent_protect_unprotect");
+  tsi_test_fixture* fixture = ssl_tsi_test_fixture_create();
+  tsi_test_do_handshake(fixture);
+  tsi_zero_copy_grpc_protector* client_protector = nullptr;
+  tsi_zero_copy_grpc_protector* server_protector = nullptr;
+  ASSERT_EQ(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                fixture->client_result, nullptr, &client_protector),
+            TSI_OK);
+  ASSERT_EQ(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                fixture->server_result, nullptr, &server_protector),
+            TSI_OK);
+  constexpr int kMessages = 200;
+  const std::string client_message(3000, 'c');
+  const std::string server_message(3000, 's');
+  // What the client will read, protected up front by the server.
+  grpc_slice_buffer from_server;
+  grpc_slice_buffer_init(&from_server);
+  for (int i = 0; i < kMessages; i++) {
+    grpc_slice_buffer unprotected;
+    grpc_slice_buffer_init(&unprotected);
+    grpc_slice_buffer_add(&unprotected,
+                          grpc_slice_from_copied_buffer(
+                              server_message.data(), server_message.size()));
+    ASSERT_EQ(tsi_zero_copy_grpc_protector_protect(
+                  server_protector, &unprotected, &from_server),
+              TSI_OK);
+    grpc_slice_buffer_destroy(&unprotected);
+  }
+  grpc_slice_buffer to_server;
+  grpc_slice_buffer_init(&to_server);
+  std::thread writer([&]() {
+    for (int i = 0; i < kMessages; i++) {
+      grpc_slice_buffer unprotected;
+      grpc_slice_buffer_init(&unprotected);
+      grpc_slice_buffer_add(&unprotected,
+                            grpc_slice_from_copied_buffer(
+                                client_message.data(), client_message.size()));
+      EXPECT_EQ(tsi_zero_copy_grpc_protector_protect(
+                    client_protector, &unprotected, &to_server),
+                TSI_OK);
+      grpc_slice_buffer_destroy(&unprotected);
+    }
+  });
+  grpc_slice_buffer client_received;
+  grpc_slice_buffer_init(&client_received);
+  std::thread reader([&]() {
+    grpc_slice_buffer piece;
+    grpc_slice_buffer_init(&piece);
+    while (from_server.length > 0) {
+      grpc_slice_buffer_move_first(
+          &from_server, std::min<size_t>(777, from_server.length), &piece);
+      EXPECT_EQ(tsi_zero_copy_grpc_protector_unprotect(
+                    client_protector, &piece, &client_received, nullptr),
+                TSI_OK);
+    }
+    grpc_slice_buffer_destroy(&piece);
+  });
+  writer.join();
+  reader.join();
+  grpc_slice_buffer server_received;
+  grpc_slice_buffer_init(&server_received);
+  ASSERT_EQ(tsi_zero_copy_grpc_protector_unprotect(
+                server_protector, &to_server, &server_received, nullptr),
+            TSI_OK);
+  std::string expected_by_server;
+  std::string expected_by_client;
+  for (int i = 0; i < kMessages; i++) {
+    expected_by_server += client_message;
+    expected_by_client += server_message;
+  }
+  EXPECT_EQ(slice_buffer_to_string(server_received), expected_by_server);
+  EXPECT_EQ(slice_buffer_to_string(client_received), expected_by_client);
+  grpc_slice_buffer_destroy(&from_server);
+  grpc_slice_buffer_destroy(&to_server);
+  grpc_slice_buffer_destroy(&client_received);
+  grpc_slice_buffer_destroy(&server_received);
+  tsi_zero_copy_grpc_protector_destroy(client_protector);
+  tsi_zero_copy_grpc_protector_destroy(server_protector);
+  tsi_test_fixture_destroy(fixture);
+}
+
+#ifdef GPR_LINUX
+// Writes through the kernel on a loopback connection after offloading the
+// client's writes, and checks the server unprotects what it reads.
+void ssl_tsi_test_offload_writes() {
+  gpr_log(GPR_INFO, "ssl_tsi_test_offload_writes");
+  tsi_test_fixture* fixture = ssl_tsi_test_fixture_create();
+  tsi_test_do_handshake(fixture);
+  int listener = socket(AF_INET, SOCK_STREAM, 0);
+  ASSERT_GE(listener, 0);
+  sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t addr_len = sizeof(addr);
+  ASSERT_EQ(bind(listener, reinterpret_cast<sockaddr*>(&addr), addr_len), 0);
+  ASSERT_EQ(listen(listener, 1), 0);
+  ASSERT_EQ(getsockname(listener, reinterpret_cast<sockaddr*>(&addr),
+                        &addr_len),
+            0);
+  int client_fd = socket(AF_INET, SOCK_STREAM, 0);
+  ASSERT_GE(client_fd, 0);
+  ASSERT_EQ(
+      connect(client_fd, reinterpret_cast<sockaddr*>(&addr), addr_len), 0);
+  int server_fd = accept(listener, nullptr, nullptr);
+  ASSERT_GE(server_fd, 0);
+  tsi_result result =
+      tsi_handshaker_result_offload_writes(fixture->client_result, client_fd);
+  if (result == TSI_UNIMPLEMENTED) {
+    gpr_log(GPR_INFO, "kTLS is not available, skipping");
+  } else {
+    ASSERT_EQ(result, TSI_OK);
+    const std::string message = "encrypted by the kernel";
+    ASSERT_EQ(send(client_fd, message.data(), message.size(), 0),
+              static_cast<ssize_t>(message.size()));
+    tsi_frame_protector* protector = nullptr;
+    ASSERT_EQ(tsi_handshaker_result_create_frame_protector(
+                  fixture->server_result, nullptr, &protector),
+              TSI_OK);
+    std::string received;
+    unsigned char protected_bytes[1024];
+    unsigned char unprotected_bytes[1024];
+    while (received.size() < message.size()) {
+      ssize_t read_size =
+          recv(server_fd, protected_bytes, sizeof(protected_bytes), 0);
+      ASSERT_GT(read_size, 0);
+      const unsigned char* cur = protected_bytes;
+      size_t remaining = static_cast<size_t>(read_size);
+      while (remaining > 0) {
+        size_t processed_size = remaining;
+        size_t unprotected_size = sizeof(unprotected_bytes);
+        ASSERT_EQ(
+            tsi_frame_protector_unprotect(protector, cur, &processed_size,
+                                          unprotected_bytes,
+                                          &unprotected_size),
+            TSI_OK);
+        received.append(reinterpret_cast<char*>(unprotected_bytes),
+                        unprotected_size);
+        cur += processed_size;
+        remaining -= processed_size;
+      }
+    }
+    EXPECT_EQ(received, message);
+    tsi_frame_protector_destroy(protector);
+  }
+  close(server_fd);
+  close(client_fd);
+  close(listener);
+  tsi_test_fixture_destroy(fixture);
+}
+#endif  // GPR_LINUX
+
 TEST(SslTransportSecurityTest, MainTest) {
   grpc_init();
   const size_t number_tls_versions = 2;
@@ -1117,6 +1389,7 @@ TEST(SslTransportSecurityTest, MainTest) {
     ssl_tsi_test_do_handshake_alpn_server_no_client();
     ssl_tsi_test_do_handshake_alpn_client_server_ok();
     ssl_tsi_test_do_handshake_session_cache();
+    ssl_tsi_test_do_handshake_session_resumption_verification_config();
     ssl_tsi_test_do_round_trip_for_all_configs();
     ssl_tsi_test_do_round_trip_with_error_on_stack();
     ssl_tsi_test_do_round_trip_odd_buffer_size();
@@ -1125,6 +1398,11 @@ TEST(SslTransportSecurityTest, MainTest) {
     ssl_tsi_test_extract_x509_subject_names();
     ssl_tsi_test_extract_cert_chain();
     ssl_tsi_test_do_handshake_with_custom_bio_pair();
+    ssl_tsi_test_zero_copy_round_trip();
+    ssl_tsi_test_zero_copy_concurrent_protect_unprotect();
+#ifdef GPR_LINUX
+    ssl_tsi_test_offload_writes();
+#endif
   }
   grpc_shutdown();
 }
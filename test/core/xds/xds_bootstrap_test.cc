@@ -134,6 +134,7 @@ TEST(XdsBootstrapTest, Basic) {
       "    \"ignore\": \"whee\""
       "  },"
       "  \"server_listener_resource_name_template\": \"example/resource\","
+      "  \"resource_snapshot_path\": \"/var/run/xds_snapshot\","
       "  \"ignore\": {}"
       "}";
   auto bootstrap_or = GrpcXdsBootstrap::Create(json_str);
@@ -192,6 +193,7 @@ TEST(XdsBootstrapTest, Basic) {
                           ::testing::Property(&Json::string_value, "1")))));
   EXPECT_EQ(bootstrap->server_listener_resource_name_template(),
             "example/resource");
+  EXPECT_EQ(bootstrap->resource_snapshot_path(), "/var/run/xds_snapshot");
   UnsetEnv("GRPC_EXPERIMENTAL_XDS_FEDERATION");
 }
 
@@ -213,6 +215,7 @@ TEST(XdsBootstrapTest, ValidWithoutNode) {
   EXPECT_EQ(server->server_uri(), "fake:///lb");
   EXPECT_EQ(server->channel_creds_type(), "fake");
   EXPECT_EQ(bootstrap->node(), nullptr);
+  EXPECT_EQ(bootstrap->resource_snapshot_path(), "");
 }
 
 TEST(XdsBootstrapTest, InsecureCreds) {
@@ -235,6 +238,24 @@ TEST(XdsBootstrapTest, InsecureCreds) {
   EXPECT_EQ(bootstrap->node(), nullptr);
 }
 
+TEST(XdsBootstrapTest, ServerFeatures) {
+  const char* json_str =
+      "{"
+      "  \"xds_servers\": ["
+      "    {"
+      "      \"server_uri\": \"fake:///lb\","
+      "      \"channel_creds\": [{\"type\": \"fake\"}],"
+      "      \"server_features\": [\"xds_v3\", \"delta_xds\"]"
+      "    }"
+      "  ]"
+      "}";
+  auto bootstrap_or = GrpcXdsBootstrap::Create(json_str);
+  ASSERT_TRUE(bootstrap_or.ok()) << bootstrap_or.status();
+  auto bootstrap = std::move(*bootstrap_or);
+  EXPECT_TRUE(bootstrap->server().UseDeltaXds());
+  EXPECT_FALSE(bootstrap->server().IgnoreResourceDeletion());
+}
+
 TEST(XdsBootstrapTest, GoogleDefaultCreds) {
   // Generate call creds file needed by GoogleDefaultCreds.
   const char token_str[] =
@@ -319,7 +340,8 @@ TEST(XdsBootstrapTest, TopFieldsWrongTypes) {
       "  \"xds_servers\":1,"
       "  \"node\":1,"
       "  \"server_listener_resource_name_template\":1,"
-      "  \"certificate_providers\":1"
+      "  \"certificate_providers\":1,"
+      "  \"resource_snapshot_path\":1"
       "}";
   auto bootstrap = GrpcXdsBootstrap::Create(json_str);
   EXPECT_EQ(
@@ -327,6 +349,7 @@ TEST(XdsBootstrapTest, TopFieldsWrongTypes) {
       "errors validating JSON: ["
       "field:certificate_providers error:is not an object; "
       "field:node error:is not an object; "
+      "field:resource_snapshot_path error:is not a string; "
       "field:server_listener_resource_name_template error:is not a string; "
       "field:xds_servers error:is not an array]")
       << bootstrap.status();
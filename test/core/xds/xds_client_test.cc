@@ -21,17 +21,21 @@
 #include "src/core/ext/xds/xds_client.h"
 
 #include <stdint.h>
+#include <stdio.h>
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 
 #include <google/protobuf/any.pb.h>
 #include <google/protobuf/struct.pb.h>
 
 #include "absl/strings/str_cat.h"
+#include "absl/time/clock.h"
 #include "absl/time/time.h"
 #include "absl/types/optional.h"
 #include "absl/types/variant.h"
@@ -40,12 +44,15 @@
 #include "upb/def.h"
 
 #include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpcpp/impl/codegen/config_protobuf.h>
 
 #include "src/core/ext/xds/xds_bootstrap.h"
+#include "src/core/ext/xds/xds_resource_snapshot.h"
 #include "src/core/ext/xds/xds_resource_type_impl.h"
 #include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gpr/tmpfile.h"
 #include "src/core/lib/gprpp/debug_location.h"
 #include "src/core/lib/gprpp/env.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -62,6 +69,8 @@
 // IWYU pragma: no_include <google/protobuf/unknown_field_set.h>
 // IWYU pragma: no_include <google/protobuf/util/json_util.h>
 
+using envoy::service::discovery::v3::DeltaDiscoveryRequest;
+using envoy::service::discovery::v3::DeltaDiscoveryResponse;
 using envoy::service::discovery::v3::DiscoveryRequest;
 using envoy::service::discovery::v3::DiscoveryResponse;
 
@@ -120,10 +129,12 @@ class XdsClientTest : public ::testing::Test {
       bool IgnoreResourceDeletion() const override {
         return ignore_resource_deletion_;
       }
+      bool UseDeltaXds() const override { return use_delta_xds_; }
       bool Equals(const XdsServer& other) const override {
         const auto& o = static_cast<const FakeXdsServer&>(other);
         return server_uri_ == o.server_uri_ &&
-               ignore_resource_deletion_ == o.ignore_resource_deletion_;
+               ignore_resource_deletion_ == o.ignore_resource_deletion_ &&
+               use_delta_xds_ == o.use_delta_xds_;
       }
 
       void set_server_uri(std::string server_uri) {
@@ -132,10 +143,14 @@ class XdsClientTest : public ::testing::Test {
       void set_ignore_resource_deletion(bool ignore_resource_deletion) {
         ignore_resource_deletion_ = ignore_resource_deletion;
       }
+      void set_use_delta_xds(bool use_delta_xds) {
+        use_delta_xds_ = use_delta_xds;
+      }
 
      private:
       std::string server_uri_ = "default_xds_server";
       bool ignore_resource_deletion_ = false;
+      bool use_delta_xds_ = false;
     };
 
     class FakeAuthority : public Authority {
@@ -169,11 +184,20 @@ class XdsClientTest : public ::testing::Test {
         server_.set_ignore_resource_deletion(ignore_resource_deletion);
         return *this;
       }
+      Builder& set_use_delta_xds(bool use_delta_xds) {
+        server_.set_use_delta_xds(use_delta_xds);
+        return *this;
+      }
+      Builder& set_resource_snapshot_path(std::string resource_snapshot_path) {
+        resource_snapshot_path_ = std::move(resource_snapshot_path);
+        return *this;
+      }
       std::unique_ptr<XdsBootstrap> Build() {
         auto bootstrap = std::make_unique<FakeXdsBootstrap>();
         bootstrap->server_ = std::move(server_);
         bootstrap->node_ = std::move(node_);
         bootstrap->authorities_ = std::move(authorities_);
+        bootstrap->resource_snapshot_path_ = std::move(resource_snapshot_path_);
         return bootstrap;
       }
 
@@ -181,6 +205,7 @@ class XdsClientTest : public ::testing::Test {
       FakeXdsServer server_;
       absl::optional<FakeNode> node_;
       std::map<std::string, FakeAuthority> authorities_;
+      std::string resource_snapshot_path_;
     };
 
     std::string ToString() const override { return "<fake>"; }
@@ -206,11 +231,15 @@ class XdsClientTest : public ::testing::Test {
       }
       return nullptr;
     }
+    const std::string& resource_snapshot_path() const override {
+      return resource_snapshot_path_;
+    }
 
    private:
     FakeXdsServer server_;
     absl::optional<FakeNode> node_;
     std::map<std::string, FakeAuthority> authorities_;
+    std::string resource_snapshot_path_;
   };
 
   // A template for a test xDS resource type with an associated watcher impl.
@@ -347,6 +376,7 @@ class XdsClientTest : public ::testing::Test {
     XdsResourceType::DecodeResult Decode(
         const XdsResourceType::DecodeContext& /*context*/,
         absl::string_view serialized_resource) const override {
+      num_decodes_.fetch_add(1, std::memory_order_relaxed);
       auto json = Json::Parse(serialized_resource);
       XdsResourceType::DecodeResult result;
       if (!json.ok()) {
@@ -372,6 +402,11 @@ class XdsClientTest : public ::testing::Test {
     }
     void InitUpbSymtab(XdsClient*, upb_DefPool* /*symtab*/) const override {}
 
+    // Number of resources decoded so far, across all tests.
+    size_t num_decodes() const {
+      return num_decodes_.load(std::memory_order_relaxed);
+    }
+
     static google::protobuf::Any EncodeAsAny(const ResourceStruct& resource) {
       google::protobuf::Any any;
       any.set_type_url(
@@ -379,6 +414,9 @@ class XdsClientTest : public ::testing::Test {
       any.set_value(resource.AsJsonString());
       return any;
     }
+
+   private:
+    mutable std::atomic<size_t> num_decodes_{0};
   };
 
   // A fake "Foo" xDS resource type.
@@ -553,6 +591,53 @@ class XdsClientTest : public ::testing::Test {
     DiscoveryResponse response_;
   };
 
+  // A helper class to build and serialize a DeltaDiscoveryResponse.
+  class DeltaResponseBuilder {
+   public:
+    explicit DeltaResponseBuilder(absl::string_view type_url) {
+      response_.set_type_url(absl::StrCat("type.googleapis.com/", type_url));
+    }
+
+    DeltaResponseBuilder& set_nonce(absl::string_view nonce) {
+      response_.set_nonce(std::string(nonce));
+      return *this;
+    }
+
+    DeltaResponseBuilder& AddFooResource(const XdsFooResource& resource,
+                                         absl::string_view version) {
+      auto* res = response_.add_resources();
+      res->set_name(resource.name);
+      res->set_version(std::string(version));
+      *res->mutable_resource() = XdsFooResourceType::EncodeAsAny(resource);
+      return *this;
+    }
+
+    DeltaResponseBuilder& AddInvalidResource(absl::string_view type_url,
+                                             absl::string_view name,
+                                             absl::string_view value) {
+      auto* res = response_.add_resources();
+      res->set_name(std::string(name));
+      res->mutable_resource()->set_type_url(
+          absl::StrCat("type.googleapis.com/", type_url));
+      res->mutable_resource()->set_value(std::string(value));
+      return *this;
+    }
+
+    DeltaResponseBuilder& AddRemovedResource(absl::string_view name) {
+      response_.add_removed_resources(std::string(name));
+      return *this;
+    }
+
+    std::string Serialize() {
+      std::string serialized_response;
+      EXPECT_TRUE(response_.SerializeToString(&serialized_response));
+      return serialized_response;
+    }
+
+   private:
+    DeltaDiscoveryResponse response_;
+  };
+
   class ScopedExperimentalEnvVar {
    public:
     explicit ScopedExperimentalEnvVar(const char* env_var) : env_var_(env_var) {
@@ -621,6 +706,30 @@ class XdsClientTest : public ::testing::Test {
         xds_client_.get(), resource_name, watcher, delay_unsubscription);
   }
 
+  // Returns a path for a resource snapshot file that does not yet exist.
+  static std::string MakeSnapshotPath() {
+    char* name;
+    FILE* file = gpr_tmpfile("xds_client_test", &name);
+    GPR_ASSERT(file != nullptr);
+    fclose(file);
+    remove(name);
+    std::string path = name;
+    gpr_free(name);
+    return path;
+  }
+
+  // Waits for the XdsClient to write a resource snapshot to \a path, which
+  // happens asynchronously when the XdsClient is shut down.
+  static bool WaitForSnapshotFile(const std::string& path,
+                                  absl::Duration timeout = absl::Seconds(5)) {
+    const absl::Time deadline = absl::Now() + timeout;
+    while (!XdsResourceSnapshot::Load(path).ok()) {
+      if (absl::Now() > deadline) return false;
+      absl::SleepFor(absl::Milliseconds(10));
+    }
+    return true;
+  }
+
   RefCountedPtr<FakeXdsTransportFactory::FakeStreamingCall> WaitForAdsStream(
       const XdsBootstrap::XdsServer& server,
       absl::Duration timeout = absl::Seconds(5)) {
@@ -644,17 +753,27 @@ class XdsClientTest : public ::testing::Test {
     return WaitForAdsStream(xds_client_->bootstrap().server(), timeout);
   }
 
+  RefCountedPtr<FakeXdsTransportFactory::FakeStreamingCall>
+  WaitForDeltaAdsStream(absl::Duration timeout = absl::Seconds(5)) {
+    return transport_factory_->WaitForStream(
+        xds_client_->bootstrap().server(),
+        FakeXdsTransportFactory::kDeltaAdsMethod,
+        timeout * grpc_test_slowdown_factor());
+  }
+
   // Gets the latest request sent to the fake xDS server.
-  absl::optional<DiscoveryRequest> WaitForRequest(
+  template <typename Request = DiscoveryRequest>
+  absl::optional<Request> WaitForRequest(
       FakeXdsTransportFactory::FakeStreamingCall* stream,
       absl::Duration timeout = absl::Seconds(3),
       SourceLocation location = SourceLocation()) {
     auto message =
         stream->WaitForMessageFromClient(timeout * grpc_test_slowdown_factor());
     if (!message.has_value()) return absl::nullopt;
-    DiscoveryRequest request;
+    Request request;
     bool success = request.ParseFromString(*message);
-    EXPECT_TRUE(success) << "Failed to deserialize DiscoveryRequest at "
+    EXPECT_TRUE(success) << "Failed to deserialize "
+                         << request.GetDescriptor()->name() << " at "
                          << location.file() << ":" << location.line();
     if (!success) return absl::nullopt;
     return std::move(request);
@@ -688,9 +807,47 @@ class XdsClientTest : public ::testing::Test {
         << location.file() << ":" << location.line();
   }
 
+  // Helper function to check the fields of a DeltaDiscoveryRequest.
+  void CheckDeltaRequest(
+      const DeltaDiscoveryRequest& request, absl::string_view type_url,
+      absl::string_view response_nonce, absl::Status error_detail,
+      std::set<absl::string_view> resource_names_subscribe,
+      std::set<absl::string_view> resource_names_unsubscribe,
+      std::map<std::string, std::string> initial_resource_versions = {},
+      SourceLocation location = SourceLocation()) {
+    EXPECT_EQ(request.type_url(),
+              absl::StrCat("type.googleapis.com/", type_url))
+        << location.file() << ":" << location.line();
+    EXPECT_EQ(request.response_nonce(), response_nonce)
+        << location.file() << ":" << location.line();
+    if (error_detail.ok()) {
+      EXPECT_FALSE(request.has_error_detail())
+          << location.file() << ":" << location.line();
+    } else {
+      EXPECT_EQ(request.error_detail().code(),
+                static_cast<int>(error_detail.code()))
+          << location.file() << ":" << location.line();
+      EXPECT_EQ(request.error_detail().message(), error_detail.message())
+          << location.file() << ":" << location.line();
+    }
+    EXPECT_THAT(request.resource_names_subscribe(),
+                ::testing::UnorderedElementsAreArray(resource_names_subscribe))
+        << location.file() << ":" << location.line();
+    EXPECT_THAT(
+        request.resource_names_unsubscribe(),
+        ::testing::UnorderedElementsAreArray(resource_names_unsubscribe))
+        << location.file() << ":" << location.line();
+    std::map<std::string, std::string> actual_initial_resource_versions(
+        request.initial_resource_versions().begin(),
+        request.initial_resource_versions().end());
+    EXPECT_EQ(actual_initial_resource_versions, initial_resource_versions)
+        << location.file() << ":" << location.line();
+  }
+
   // Helper function to check the contents of the node message in a
   // request against the client's node info.
-  void CheckRequestNode(const DiscoveryRequest& request,
+  template <typename Request>
+  void CheckRequestNode(const Request& request,
                         SourceLocation location = SourceLocation()) {
     // These fields come from the bootstrap config.
     EXPECT_EQ(request.node().id(), xds_client_->bootstrap().node()->id())
@@ -1088,6 +1245,271 @@ TEST_F(XdsClientTest, UpdateContainsOnlyChangedResource) {
   EXPECT_TRUE(stream->Orphaned());
 }
 
+TEST_F(XdsClientTest, UnchangedResourceNotDecodedAgain) {
+  InitXdsClient();
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  // XdsClient should have created an ADS stream.
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  // XdsClient should have sent a subscription request on the ADS stream.
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"", /*response_nonce=*/"",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // Start a watch for "foo2".
+  auto watcher2 = StartFooWatch("foo2");
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"", /*response_nonce=*/"",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1", "foo2"});
+  // Send a response with both resources, one of them in a Resource
+  // wrapper.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6))
+          .AddFooResource(XdsFooResource("foo2", 7),
+                          /*in_resource_wrapper=*/true)
+          .Serialize());
+  // XdsClient should have delivered the response to the watchers.
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 6);
+  resource = watcher2->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 7);
+  // XdsClient should have sent an ACK message to the xDS server.
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"1", /*response_nonce=*/"A",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1", "foo2"});
+  // Server resends both resources unchanged in a new version.
+  const size_t num_decodes = XdsFooResourceType::Get()->num_decodes();
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("2")
+          .set_nonce("B")
+          .AddFooResource(XdsFooResource("foo1", 6))
+          .AddFooResource(XdsFooResource("foo2", 7),
+                          /*in_resource_wrapper=*/true)
+          .Serialize());
+  // XdsClient should ACK the new version without decoding the resources
+  // or notifying the watchers.
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"2", /*response_nonce=*/"B",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1", "foo2"});
+  EXPECT_EQ(XdsFooResourceType::Get()->num_decodes(), num_decodes);
+  EXPECT_FALSE(watcher->HasEvent());
+  EXPECT_FALSE(watcher2->HasEvent());
+  // Server changes "foo1" only.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("3")
+          .set_nonce("C")
+          .AddFooResource(XdsFooResource("foo1", 8))
+          .AddFooResource(XdsFooResource("foo2", 7),
+                          /*in_resource_wrapper=*/true)
+          .Serialize());
+  resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 8);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"3", /*response_nonce=*/"C",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1", "foo2"});
+  EXPECT_EQ(XdsFooResourceType::Get()->num_decodes(), num_decodes + 1);
+  EXPECT_FALSE(watcher2->HasEvent());
+  // Server reverts "foo1" to a previously seen value, which must be
+  // decoded and delivered again.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("4")
+          .set_nonce("D")
+          .AddFooResource(XdsFooResource("foo1", 6))
+          .AddFooResource(XdsFooResource("foo2", 7),
+                          /*in_resource_wrapper=*/true)
+          .Serialize());
+  resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 6);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"4", /*response_nonce=*/"D",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1", "foo2"});
+  EXPECT_EQ(XdsFooResourceType::Get()->num_decodes(), num_decodes + 2);
+  EXPECT_FALSE(watcher2->HasEvent());
+  // Cancel watch for "foo1".
+  CancelFooWatch(watcher.get(), "foo1");
+  // XdsClient should send an unsubscription request.
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"4", /*response_nonce=*/"D",
+               /*error_detail=*/absl::OkStatus(), /*resource_names=*/{"foo2"});
+  // Now cancel watch for "foo2".
+  CancelFooWatch(watcher2.get(), "foo2");
+  EXPECT_TRUE(stream->Orphaned());
+}
+
+// Resource snapshots are not supported on Windows.
+#ifndef GPR_WINDOWS
+TEST_F(XdsClientTest, ResourceSnapshot) {
+  const std::string snapshot_path = MakeSnapshotPath();
+  InitXdsClient(
+      FakeXdsBootstrap::Builder().set_resource_snapshot_path(snapshot_path));
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  // XdsClient should have created an ADS stream.
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  // XdsClient should have sent a subscription request on the ADS stream.
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Send a response.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("1")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6))
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 6);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"1", /*response_nonce=*/"A",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // Shut down the XdsClient while the resource is still cached, which
+  // writes the snapshot if the delayed write has not already happened.
+  stream.reset();
+  xds_client_.reset();
+  ASSERT_TRUE(WaitForSnapshotFile(snapshot_path));
+  // A new XdsClient delivers the resource from the snapshot without
+  // waiting for the server.
+  InitXdsClient(
+      FakeXdsBootstrap::Builder().set_resource_snapshot_path(snapshot_path));
+  watcher = StartFooWatch("foo1");
+  resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->name, "foo1");
+  EXPECT_EQ(resource->value, 6);
+  // The resource is still requested from the server.
+  stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"", /*response_nonce=*/"",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // The server's version replaces the one from the snapshot.
+  stream->SendMessageToClient(
+      ResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_version_info("2")
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 7))
+          .Serialize());
+  resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 7);
+  request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"2", /*response_nonce=*/"A",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->Orphaned());
+  remove(snapshot_path.c_str());
+}
+
+TEST_F(XdsClientTest, ResourceFromSnapshotDoesNotExistUponTimeout) {
+  const std::string snapshot_path = MakeSnapshotPath();
+  XdsResourceSnapshot::Builder snapshot("xds_client_test");
+  snapshot.Add(XdsFooResourceType::Get()->type_url(), "foo1",
+               "default_xds_server", "1",
+               XdsFooResourceType::EncodeAsAny(XdsFooResource("foo1", 6))
+                   .value());
+  ASSERT_TRUE(snapshot.WriteToFile(snapshot_path).ok());
+  InitXdsClient(
+      FakeXdsBootstrap::Builder().set_resource_snapshot_path(snapshot_path),
+      Duration::Seconds(1));
+  // Start a watch for "foo1".  The resource is delivered from the
+  // snapshot.
+  auto watcher = StartFooWatch("foo1");
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 6);
+  auto stream = WaitForAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+               /*version_info=*/"", /*response_nonce=*/"",
+               /*error_detail=*/absl::OkStatus(),
+               /*resource_names=*/{"foo1"});
+  // The server does not send the resource, so it is dropped once the
+  // request times out.
+  EXPECT_TRUE(watcher->WaitForDoesNotExist(absl::Seconds(5)));
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->Orphaned());
+  remove(snapshot_path.c_str());
+}
+
+TEST_F(XdsClientTest, ResourceSnapshotFromOtherControlPlaneIgnored) {
+  const std::string serialized_resource =
+      XdsFooResourceType::EncodeAsAny(XdsFooResource("foo1", 6)).value();
+  // One snapshot was written by a client with a different node ID, and the
+  // other holds a resource sent by a different xDS server.
+  XdsResourceSnapshot::Builder other_node("other_node");
+  other_node.Add(XdsFooResourceType::Get()->type_url(), "foo1",
+                 "default_xds_server", "1", serialized_resource);
+  XdsResourceSnapshot::Builder other_server("xds_client_test");
+  other_server.Add(XdsFooResourceType::Get()->type_url(), "foo1",
+                   "other_xds_server", "1", serialized_resource);
+  for (XdsResourceSnapshot::Builder* snapshot : {&other_node, &other_server}) {
+    const std::string snapshot_path = MakeSnapshotPath();
+    ASSERT_TRUE(snapshot->WriteToFile(snapshot_path).ok());
+    InitXdsClient(
+        FakeXdsBootstrap::Builder().set_resource_snapshot_path(snapshot_path));
+    // Start a watch for "foo1".
+    auto watcher = StartFooWatch("foo1");
+    auto stream = WaitForAdsStream();
+    ASSERT_TRUE(stream != nullptr);
+    auto request = WaitForRequest(stream.get());
+    ASSERT_TRUE(request.has_value());
+    CheckRequest(*request, XdsFooResourceType::Get()->type_url(),
+                 /*version_info=*/"", /*response_nonce=*/"",
+                 /*error_detail=*/absl::OkStatus(),
+                 /*resource_names=*/{"foo1"});
+    // The resource is not delivered from the snapshot.
+    EXPECT_FALSE(watcher->HasEvent());
+    CancelFooWatch(watcher.get(), "foo1");
+    EXPECT_TRUE(stream->Orphaned());
+    stream.reset();
+    xds_client_.reset();
+    remove(snapshot_path.c_str());
+  }
+}
+#endif  // GPR_WINDOWS
+
 TEST_F(XdsClientTest, ResourceValidationFailure) {
   InitXdsClient();
   // Start a watch for "foo1".
@@ -2682,6 +3104,341 @@ TEST_F(XdsClientTest, FederationChannelFailureReportedToWatchers) {
   EXPECT_TRUE(stream2->Orphaned());
 }
 
+TEST_F(XdsClientTest, DeltaBasicWatch) {
+  InitXdsClient(FakeXdsBootstrap::Builder().set_use_delta_xds(true));
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  // Watcher should initially not see any resource reported.
+  EXPECT_FALSE(watcher->HasEvent());
+  // XdsClient should have created a delta ADS stream.
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  // XdsClient should have sent a subscription request on the stream.
+  auto request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{"foo1"},
+                    /*resource_names_unsubscribe=*/{});
+  CheckRequestNode(*request);  // Should be present on the first request.
+  // Send a response.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "1")
+          .Serialize());
+  // XdsClient should have delivered the response to the watcher.
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->name, "foo1");
+  EXPECT_EQ(resource->value, 6);
+  // XdsClient should have sent an ACK, which does not change the
+  // subscription.
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"A", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{},
+                    /*resource_names_unsubscribe=*/{});
+  EXPECT_FALSE(request->has_node());
+  // Start a watch for "foo2".  Only the new resource is subscribed to.
+  auto watcher2 = StartFooWatch("foo2");
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"A", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{"foo2"},
+                    /*resource_names_unsubscribe=*/{});
+  // Server sends an update for "foo1" only, which does not affect "foo2".
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("B")
+          .AddFooResource(XdsFooResource("foo1", 9), "2")
+          .Serialize());
+  resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->name, "foo1");
+  EXPECT_EQ(resource->value, 9);
+  EXPECT_FALSE(watcher2->HasEvent());
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"B", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{},
+                    /*resource_names_unsubscribe=*/{});
+  // Server says "foo2" does not exist.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("C")
+          .AddRemovedResource("foo2")
+          .Serialize());
+  EXPECT_TRUE(watcher2->WaitForDoesNotExist(absl::Seconds(1)));
+  EXPECT_FALSE(watcher->HasEvent());
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"C", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{},
+                    /*resource_names_unsubscribe=*/{});
+  // Cancel the watch for "foo2".  Only that resource is unsubscribed from.
+  CancelFooWatch(watcher2.get(), "foo2");
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"C", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{},
+                    /*resource_names_unsubscribe=*/{"foo2"});
+  // Cancel watch.
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->Orphaned());
+}
+
+TEST_F(XdsClientTest, DeltaResourceRemoval) {
+  InitXdsClient(FakeXdsBootstrap::Builder().set_use_delta_xds(true));
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{"foo1"},
+                    /*resource_names_unsubscribe=*/{});
+  // Server sends the resource.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "1")
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 6);
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Server sends an empty response.  Unlike in SotW, a resource missing
+  // from a response is not deleted.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("B")
+          .Serialize());
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"B", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{},
+                    /*resource_names_unsubscribe=*/{});
+  EXPECT_FALSE(watcher->HasEvent());
+  // Server removes the resource.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("C")
+          .AddRemovedResource("foo1")
+          .Serialize());
+  EXPECT_TRUE(watcher->WaitForDoesNotExist(absl::Seconds(1)));
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"C", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{},
+                    /*resource_names_unsubscribe=*/{});
+  // A new watcher for the resource sees that it does not exist.
+  auto watcher2 = StartFooWatch("foo1");
+  EXPECT_TRUE(watcher2->WaitForDoesNotExist(absl::Seconds(1)));
+  // Server sends the resource again.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("D")
+          .AddFooResource(XdsFooResource("foo1", 7), "2")
+          .Serialize());
+  resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 7);
+  resource = watcher2->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 7);
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"D", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{},
+                    /*resource_names_unsubscribe=*/{});
+  // Cancel watch.
+  CancelFooWatch(watcher.get(), "foo1");
+  CancelFooWatch(watcher2.get(), "foo1");
+  EXPECT_TRUE(stream->Orphaned());
+}
+
+TEST_F(XdsClientTest, DeltaResourceRemovalIgnoredWhenConfigured) {
+  InitXdsClient(FakeXdsBootstrap::Builder()
+                    .set_use_delta_xds(true)
+                    .set_ignore_resource_deletion(true));
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Server sends the resource.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "1")
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 6);
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Server removes the resource.  The removal is ignored, so the watcher
+  // sees no event.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("B")
+          .AddRemovedResource("foo1")
+          .Serialize());
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"B", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{},
+                    /*resource_names_unsubscribe=*/{});
+  EXPECT_TRUE(watcher->ExpectNoEvent(absl::Seconds(1)));
+  // A new watcher for the resource immediately receives the cached
+  // resource.
+  auto watcher2 = StartFooWatch("foo1");
+  resource = watcher2->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 6);
+  // Server sends the same resource with a new version.  The watchers see
+  // no event, but the client tracks the new version.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("C")
+          .AddFooResource(XdsFooResource("foo1", 6), "2")
+          .Serialize());
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"C", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{},
+                    /*resource_names_unsubscribe=*/{});
+  EXPECT_FALSE(watcher->HasEvent());
+  EXPECT_FALSE(watcher2->HasEvent());
+  // Stream fails because of transport disconnection.
+  stream->MaybeSendStatusToClient(absl::UnavailableError("connection failed"));
+  // XdsClient resubscribes with the version of the resource it still has.
+  stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{"foo1"},
+                    /*resource_names_unsubscribe=*/{},
+                    /*initial_resource_versions=*/{{"foo1", "2"}});
+  EXPECT_FALSE(watcher->HasEvent());
+  // Cancel watches.
+  CancelFooWatch(watcher.get(), "foo1");
+  CancelFooWatch(watcher2.get(), "foo1");
+  EXPECT_TRUE(stream->Orphaned());
+}
+
+TEST_F(XdsClientTest, DeltaResourceValidationFailure) {
+  InitXdsClient(FakeXdsBootstrap::Builder().set_use_delta_xds(true));
+  // Start a watch for "foo1".
+  auto watcher = StartFooWatch("foo1");
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Send a response containing an invalid resource.
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("A")
+          .AddInvalidResource(XdsFooResourceType::Get()->type_url(), "foo1",
+                              "{\"name\":\"foo1\",\"value\":[]}")
+          .Serialize());
+  // XdsClient should deliver an error to the watcher.
+  auto error = watcher->WaitForNextError();
+  ASSERT_TRUE(error.has_value());
+  EXPECT_EQ(error->code(), absl::StatusCode::kUnavailable);
+  // XdsClient should NACK the update.
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(
+      *request, XdsFooResourceType::Get()->type_url(),
+      /*response_nonce=*/"A",
+      // error_detail=
+      absl::InvalidArgumentError(
+          "xDS response validation errors: ["
+          "resource index 0: foo1: INVALID_ARGUMENT: errors validating JSON: "
+          "[field:value error:is not a number]]"),
+      /*resource_names_subscribe=*/{}, /*resource_names_unsubscribe=*/{});
+  // Cancel watch.
+  CancelFooWatch(watcher.get(), "foo1");
+  EXPECT_TRUE(stream->Orphaned());
+}
+
+TEST_F(XdsClientTest, DeltaResumeAfterStreamRestart) {
+  // Lower resources-does-not-exist timeout, to make sure that we're not
+  // triggering that here.
+  InitXdsClient(FakeXdsBootstrap::Builder().set_use_delta_xds(true),
+                Duration::Seconds(3));
+  // Start watches for "foo1" and "foo2".
+  auto watcher = StartFooWatch("foo1");
+  auto watcher2 = StartFooWatch("foo2");
+  auto stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  auto request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{"foo1"},
+                    /*resource_names_unsubscribe=*/{});
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{"foo2"},
+                    /*resource_names_unsubscribe=*/{});
+  // Server sends only "foo1".
+  stream->SendMessageToClient(
+      DeltaResponseBuilder(XdsFooResourceType::Get()->type_url())
+          .set_nonce("A")
+          .AddFooResource(XdsFooResource("foo1", 6), "1")
+          .Serialize());
+  auto resource = watcher->WaitForNextResource();
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->value, 6);
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  // Stream fails because of transport disconnection.
+  stream->MaybeSendStatusToClient(absl::UnavailableError("connection failed"));
+  // XdsClient creates a new stream.
+  stream = WaitForDeltaAdsStream();
+  ASSERT_TRUE(stream != nullptr);
+  // XdsClient resubscribes to both resources, telling the server which
+  // version of "foo1" it already has.
+  request = WaitForRequest<DeltaDiscoveryRequest>(stream.get());
+  ASSERT_TRUE(request.has_value());
+  CheckDeltaRequest(*request, XdsFooResourceType::Get()->type_url(),
+                    /*response_nonce=*/"", /*error_detail=*/absl::OkStatus(),
+                    /*resource_names_subscribe=*/{"foo1", "foo2"},
+                    /*resource_names_unsubscribe=*/{},
+                    /*initial_resource_versions=*/{{"foo1", "1"}});
+  CheckRequestNode(*request);  // Should be present on the first request.
+  // Server does not resend "foo1", since the client has its current
+  // version, and does not send "foo2".  The watcher for "foo1" sees no
+  // event, while "foo2" eventually times out.
+  EXPECT_TRUE(watcher2->WaitForDoesNotExist(absl::Seconds(4)));
+  EXPECT_FALSE(watcher->HasEvent());
+  // Cancel watches.
+  CancelFooWatch(watcher.get(), "foo1");
+  CancelFooWatch(watcher2.get(), "foo2");
+  EXPECT_TRUE(stream->Orphaned());
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
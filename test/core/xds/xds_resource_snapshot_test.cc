@@ -0,0 +1,170 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/ext/xds/xds_resource_snapshot.h"
+
+#include <stdio.h>
+
+#include <string>
+
+#include "absl/status/status.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/gpr/tmpfile.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+class XdsResourceSnapshotTest : public ::testing::Test {
+ protected:
+  XdsResourceSnapshotTest() {
+    char* name;
+    FILE* file = gpr_tmpfile("xds_resource_snapshot_test", &name);
+    GPR_ASSERT(file != nullptr);
+    fclose(file);
+    path_ = name;
+    gpr_free(name);
+  }
+
+  ~XdsResourceSnapshotTest() override { remove(path_.c_str()); }
+
+  void WriteRawFile(const std::string& contents) {
+    FILE* file = fopen(path_.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(fwrite(contents.data(), 1, contents.size(), file),
+              contents.size());
+    fclose(file);
+  }
+
+  std::string ReadRawFile() {
+    std::string contents;
+    FILE* file = fopen(path_.c_str(), "rb");
+    GPR_ASSERT(file != nullptr);
+    char buf[256];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), file)) > 0) contents.append(buf, n);
+    fclose(file);
+    return contents;
+  }
+
+  std::string path_;
+};
+
+TEST_F(XdsResourceSnapshotTest, RoundTrip) {
+  XdsResourceSnapshot::Builder builder("node1");
+  builder.Add("type.googleapis.com/envoy.config.cluster.v3.Cluster",
+              "cluster1", "server1", "1", "cluster1 bytes");
+  // Resource names may be shared across types, and serialized resources
+  // may contain NUL bytes.
+  builder.Add("type.googleapis.com/envoy.config.listener.v3.Listener",
+              "cluster1", "server2", "", std::string("a\0b", 3));
+  ASSERT_TRUE(builder.WriteToFile(path_).ok());
+  auto snapshot = XdsResourceSnapshot::Load(path_);
+  ASSERT_TRUE(snapshot.ok()) << snapshot.status();
+  EXPECT_EQ((*snapshot)->node_id(), "node1");
+  EXPECT_FALSE((*snapshot)->empty());
+  EXPECT_FALSE(
+      (*snapshot)
+          ->Extract("type.googleapis.com/envoy.config.cluster.v3.Cluster",
+                    "cluster2")
+          .has_value());
+  auto resource = (*snapshot)->Extract(
+      "type.googleapis.com/envoy.config.cluster.v3.Cluster", "cluster1");
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->server_uri, "server1");
+  EXPECT_EQ(resource->version, "1");
+  EXPECT_EQ(resource->serialized_resource, "cluster1 bytes");
+  // Each resource can be extracted only once.
+  EXPECT_FALSE(
+      (*snapshot)
+          ->Extract("type.googleapis.com/envoy.config.cluster.v3.Cluster",
+                    "cluster1")
+          .has_value());
+  resource = (*snapshot)->Extract(
+      "type.googleapis.com/envoy.config.listener.v3.Listener", "cluster1");
+  ASSERT_TRUE(resource.has_value());
+  EXPECT_EQ(resource->server_uri, "server2");
+  EXPECT_EQ(resource->version, "");
+  EXPECT_EQ(resource->serialized_resource, std::string("a\0b", 3));
+  EXPECT_TRUE((*snapshot)->empty());
+}
+
+TEST_F(XdsResourceSnapshotTest, EmptySnapshot) {
+  XdsResourceSnapshot::Builder builder("");
+  ASSERT_TRUE(builder.WriteToFile(path_).ok());
+  auto snapshot = XdsResourceSnapshot::Load(path_);
+  ASSERT_TRUE(snapshot.ok()) << snapshot.status();
+  EXPECT_EQ((*snapshot)->node_id(), "");
+  EXPECT_TRUE((*snapshot)->empty());
+}
+
+TEST_F(XdsResourceSnapshotTest, MissingFile) {
+  remove(path_.c_str());
+  auto snapshot = XdsResourceSnapshot::Load(path_);
+  EXPECT_EQ(snapshot.status().code(), absl::StatusCode::kNotFound)
+      << snapshot.status();
+}
+
+TEST_F(XdsResourceSnapshotTest, EmptyFile) {
+  WriteRawFile("");
+  auto snapshot = XdsResourceSnapshot::Load(path_);
+  EXPECT_EQ(snapshot.status().code(), absl::StatusCode::kInvalidArgument)
+      << snapshot.status();
+  EXPECT_THAT(std::string(snapshot.status().message()),
+              ::testing::HasSubstr("empty"));
+}
+
+TEST_F(XdsResourceSnapshotTest, NotASnapshot) {
+  WriteRawFile("{\"xds_servers\": []}");
+  auto snapshot = XdsResourceSnapshot::Load(path_);
+  EXPECT_EQ(snapshot.status().code(), absl::StatusCode::kInvalidArgument)
+      << snapshot.status();
+}
+
+TEST_F(XdsResourceSnapshotTest, TruncatedSnapshot) {
+  XdsResourceSnapshot::Builder builder("node");
+  builder.Add("type", "name", "server", "1", "resource");
+  ASSERT_TRUE(builder.WriteToFile(path_).ok());
+  std::string contents = ReadRawFile();
+  for (size_t size : {contents.size() - 4, contents.size() - 12}) {
+    WriteRawFile(contents.substr(0, size));
+    auto snapshot = XdsResourceSnapshot::Load(path_);
+    EXPECT_EQ(snapshot.status().code(), absl::StatusCode::kInvalidArgument)
+        << size << ": " << snapshot.status();
+  }
+  WriteRawFile(contents + "xxxx");
+  auto snapshot = XdsResourceSnapshot::Load(path_);
+  EXPECT_EQ(snapshot.status().code(), absl::StatusCode::kInvalidArgument)
+      << snapshot.status();
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  return RUN_ALL_TESTS();
+}
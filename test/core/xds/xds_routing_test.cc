@@ -0,0 +1,205 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include "src/core/ext/xds/xds_routing.h"
+
+#include <stdlib.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+#include "absl/types/optional.h"
+#include "gtest/gtest.h"
+
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/grpc.h>
+
+#include "src/core/ext/xds/xds_route_config.h"
+#include "src/core/lib/matchers/matchers.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+using Matchers = XdsRouteConfigResource::Route::Matchers;
+
+class VirtualHostList : public XdsRouting::VirtualHostListIterator {
+ public:
+  explicit VirtualHostList(std::vector<std::vector<std::string>> domains)
+      : domains_(std::move(domains)) {}
+
+  size_t Size() const override { return domains_.size(); }
+
+  const std::vector<std::string>& GetDomainsForVirtualHost(
+      size_t index) const override {
+    return domains_[index];
+  }
+
+ private:
+  std::vector<std::vector<std::string>> domains_;
+};
+
+class RouteList : public XdsRouting::RouteListIterator {
+ public:
+  size_t Size() const override { return matchers_.size(); }
+
+  const Matchers& GetMatchersForRoute(size_t index) const override {
+    return matchers_[index];
+  }
+
+  void Add(StringMatcher::Type type, absl::string_view path,
+           bool case_sensitive = true,
+           std::vector<HeaderMatcher> header_matchers = {}) {
+    Matchers matchers;
+    matchers.path_matcher =
+        StringMatcher::Create(type, path, case_sensitive).value();
+    matchers.header_matchers = std::move(header_matchers);
+    matchers_.push_back(std::move(matchers));
+  }
+
+  // Pads the list up to the size at which routes are indexed, with routes
+  // no test request matches.
+  void Pad() {
+    while (matchers_.size() < 64) {
+      Add(StringMatcher::Type::kExact,
+          absl::StrCat("/padding.Service/Method", matchers_.size()));
+    }
+  }
+
+ private:
+  std::vector<Matchers> matchers_;
+};
+
+TEST(VirtualHostIndexTest, SameSearchOrderAsScan) {
+  VirtualHostList vhosts({
+      {"*"},
+      {"foo.*", "*.example.com"},
+      {"*.bar.example.com", "foo.bar.*"},
+      {"exact.example.com"},
+      {"EXACT.example.com", "*.com"},
+      {"*.bar.example.com"},
+  });
+  XdsRouting::VirtualHostIndex index(vhosts);
+  for (const char* domain :
+       {"exact.example.com", "Exact.Example.COM", "a.bar.example.com",
+        "bar.example.com", ".bar.example.com", "x.example.com", "foo.bar.net",
+        "foo.net", "foo.", "foo", "other.com", "com", "unrelated.org", ""}) {
+    EXPECT_EQ(index.Find(domain),
+              XdsRouting::FindVirtualHostForDomain(vhosts, domain))
+        << domain;
+  }
+  EXPECT_EQ(index.Find("Exact.Example.COM"), 3);
+  EXPECT_EQ(index.Find("a.bar.example.com"), 2);
+  EXPECT_EQ(index.Find("foo.bar.net"), 2);
+  EXPECT_EQ(index.Find("foo.net"), 1);
+  // The asterisk must match at least one character.
+  EXPECT_EQ(index.Find(".bar.example.com"), 1);
+  EXPECT_EQ(index.Find("foo."), 0);
+  EXPECT_EQ(index.Find("unrelated.org"), 0);
+}
+
+TEST(VirtualHostIndexTest, NoMatch) {
+  VirtualHostList vhosts({{"foo.example.com"}, {"*.bar.com"}});
+  XdsRouting::VirtualHostIndex index(vhosts);
+  EXPECT_EQ(index.Find("bar.com"), absl::nullopt);
+}
+
+class RouteIndexTest : public ::testing::Test {
+ protected:
+  absl::optional<size_t> GetRoute(const RouteList& routes,
+                                  const XdsRouting::RouteIndex& index,
+                                  absl::string_view path) {
+    auto expected = XdsRouting::GetRouteForRequest(routes, path, &metadata_);
+    auto route = index.GetRouteForRequest(routes, path, &metadata_);
+    EXPECT_EQ(route, expected) << path;
+    return route;
+  }
+
+  MemoryAllocator memory_allocator_ = MemoryAllocator(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("test"));
+  ScopedArenaPtr arena_ = MakeScopedArena(1024, &memory_allocator_);
+  grpc_metadata_batch metadata_{arena_.get()};
+};
+
+TEST_F(RouteIndexTest, FirstMatchWins) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kPrefix, "/pkg.Service/",
+             /*case_sensitive=*/true,
+             {HeaderMatcher::Create("x-tenant", HeaderMatcher::Type::kExact,
+                                    "blue")
+                  .value()});
+  routes.Add(StringMatcher::Type::kExact, "/pkg.Service/Get");
+  routes.Add(StringMatcher::Type::kSafeRegex, "/pkg\\.Service/(Get|Put)");
+  routes.Add(StringMatcher::Type::kPrefix, "/PKG.", /*case_sensitive=*/false);
+  routes.Add(StringMatcher::Type::kExact, "/other.Service/Get",
+             /*case_sensitive=*/false);
+  routes.Add(StringMatcher::Type::kSuffix, "/Delete");
+  routes.Pad();
+  routes.Add(StringMatcher::Type::kPrefix, "");
+  XdsRouting::RouteIndex index(routes);
+  EXPECT_EQ(GetRoute(routes, index, "/pkg.Service/Get"), 1);
+  EXPECT_EQ(GetRoute(routes, index, "/pkg.Service/Put"), 2);
+  EXPECT_EQ(GetRoute(routes, index, "/pkg.Service/List"), 3);
+  EXPECT_EQ(GetRoute(routes, index, "/Other.service/get"), 4);
+  EXPECT_EQ(GetRoute(routes, index, "/unknown.Service/Delete"), 5);
+  EXPECT_EQ(GetRoute(routes, index, "/unknown.Service/Get"), 64);
+  metadata_.Append("x-tenant", Slice::FromStaticString("blue"),
+                   [](absl::string_view, const Slice&) { abort(); });
+  EXPECT_EQ(GetRoute(routes, index, "/pkg.Service/Get"), 0);
+  EXPECT_EQ(GetRoute(routes, index, "/pkg.Service/List"), 0);
+}
+
+TEST_F(RouteIndexTest, NoMatch) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kExact, "/pkg.Service/Get");
+  routes.Pad();
+  XdsRouting::RouteIndex index(routes);
+  EXPECT_EQ(GetRoute(routes, index, "/pkg.Service/Gets"), absl::nullopt);
+  EXPECT_EQ(GetRoute(routes, index, "/pkg.Service/"), absl::nullopt);
+  EXPECT_EQ(GetRoute(routes, index, ""), absl::nullopt);
+}
+
+TEST_F(RouteIndexTest, ShortListIsScanned) {
+  RouteList routes;
+  routes.Add(StringMatcher::Type::kPrefix, "/pkg.");
+  routes.Add(StringMatcher::Type::kExact, "/pkg.Service/Get");
+  XdsRouting::RouteIndex index(routes);
+  EXPECT_EQ(GetRoute(routes, index, "/pkg.Service/Get"), 0);
+  EXPECT_EQ(GetRoute(routes, index, "/other.Service/Get"), absl::nullopt);
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc::testing::TestEnvironment env(&argc, argv);
+  grpc_init();
+  auto result = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return result;
+}
@@ -1208,6 +1208,44 @@ TEST_F(PickFirstTest, LocalSubchannelPool) {
   EXPECT_EQ(2UL, servers_[0]->service_.clients().size());
 }
 
+TEST_F(PickFirstTest, MultipleConnectionsPerSubchannel) {
+  // Start one server.
+  const int kNumServers = 1;
+  StartServers(kNumServers);
+  // Create a channel whose subchannel keeps three connections open.
+  const size_t kNumConnections = 3;
+  ChannelArguments args;
+  args.SetInt(GRPC_ARG_SUBCHANNEL_MIN_CONNECTIONS, kNumConnections);
+  auto response_generator = BuildResolverResponseGenerator();
+  auto channel = BuildChannel("pick_first", response_generator, args);
+  auto stub = BuildStub(channel);
+  response_generator.SetNextResolution(GetServersPorts());
+  WaitForServer(DEBUG_LOCATION, stub, 0);
+  // The additional connections are opened in the background. Send batches
+  // of concurrent slow RPCs, which are spread across the connections with
+  // the fewest active calls, until the server has seen all of them.
+  const absl::Time deadline =
+      absl::Now() + absl::Seconds(10) * grpc_test_slowdown_factor();
+  while (servers_[0]->service_.clients().size() < kNumConnections &&
+         absl::Now() < deadline) {
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < kNumConnections; ++i) {
+      threads.emplace_back([&]() {
+        EchoRequest request;
+        request.mutable_param()->set_server_sleep_us(100000);
+        EchoResponse response;
+        Status status = SendRpc(stub, &response, /*timeout_ms=*/2000,
+                                /*wait_for_ready=*/false, &request);
+        EXPECT_TRUE(status.ok()) << status.error_message();
+      });
+    }
+    for (auto& thread : threads) thread.join();
+  }
+  // All RPCs went through the same subchannel, but over three connections
+  // from different client ports.
+  EXPECT_EQ(kNumConnections, servers_[0]->service_.clients().size());
+}
+
 TEST_F(PickFirstTest, ManyUpdates) {
   const int kNumUpdates = 1000;
   const int kNumServers = 3;
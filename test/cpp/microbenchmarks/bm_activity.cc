@@ -0,0 +1,107 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark activities that repeatedly wake each other up, as the party of
+// activities making up a call does.
+// This is a stand-in for the promise based call path, which has no
+// benchmark harness in this tree: bare activities exchange values over
+// MpscReceivers, with the ExecCtx wakeup scheduler that call activities use.
+
+#include <benchmark/benchmark.h>
+
+#include "absl/status/status.h"
+
+#include <grpc/support/log.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/exec_ctx_wakeup_scheduler.h"
+#include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/mpsc.h"
+#include "src/core/lib/promise/seq.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// Two activities pass a counter back and forth until it reaches
+// state.range(0).
+void BM_ActivityPingPong(benchmark::State& state) {
+  const int rounds = state.range(0);
+  for (auto _ : state) {
+    ExecCtx exec_ctx;
+    MpscReceiver<int> ping(1);
+    MpscReceiver<int> pong(1);
+    MpscSender<int> ping_sender = ping.MakeSender();
+    MpscSender<int> pong_sender = pong.MakeSender();
+    bool done = false;
+    auto ponger = MakeActivity(
+        Loop([&ping, &pong_sender]() {
+          return Seq(
+              ping.Next(),
+              [&pong_sender](int value) { return pong_sender.Send(value + 1); },
+              [](bool) -> LoopCtl<absl::Status> { return Continue(); });
+        }),
+        ExecCtxWakeupScheduler(), [](absl::Status) {});
+    int last = 0;
+    auto pinger = MakeActivity(
+        Seq(ping_sender.Send(0),
+            [&pong, &ping_sender, &last, rounds](bool) {
+              return Loop([&pong, &ping_sender, &last, rounds]() {
+                return Seq(
+                    pong.Next(),
+                    [&ping_sender, &last](int value) {
+                      last = value;
+                      return ping_sender.Send(value + 1);
+                    },
+                    [&last, rounds](bool) -> LoopCtl<absl::Status> {
+                      if (last >= rounds) return absl::OkStatus();
+                      return Continue();
+                    });
+              });
+            }),
+        ExecCtxWakeupScheduler(), [&done](absl::Status status) {
+          GPR_ASSERT(status.ok());
+          done = true;
+        });
+    exec_ctx.Flush();
+    GPR_ASSERT(done);
+  }
+  state.SetItemsProcessed(state.iterations() * rounds);
+}
+BENCHMARK(BM_ActivityPingPong)->Range(1, 1024);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
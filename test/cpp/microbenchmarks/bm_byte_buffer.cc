@@ -18,6 +18,8 @@
 
 // This benchmark exists to show that byte-buffer copy is size-independent
 
+#include <string.h>
+
 #include <memory>
 
 #include <benchmark/benchmark.h>
@@ -28,6 +30,8 @@
 #include <grpcpp/impl/grpc_library.h>
 #include <grpcpp/support/byte_buffer.h>
 
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/slice/slice_buffer.h"
 #include "test/core/util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
 #include "test/cpp/util/test_config.h"
@@ -108,6 +112,43 @@ static void BM_ByteBufferReader_Peek(benchmark::State& state) {
 }
 BENCHMARK(BM_ByteBufferReader_Peek)->Ranges({{64 * 1024, 1024 * 1024}});
 
+// Builds a header-block-like slice buffer out of many small slices, and
+// points an iovec array at it for writing. Arg 0 selects coalescing mode.
+static void BM_SliceBuffer_AppendSmall(benchmark::State& state) {
+  const bool coalesce = state.range(0) != 0;
+  const size_t slice_size = state.range(1);
+  constexpr int kNumSlices = 32;
+  struct IoVec {
+    void* iov_base;
+    size_t iov_len;
+  };
+  IoVec iovs[2 * kNumSlices];
+  grpc_core::Slice slice(grpc_slice_malloc_large(slice_size));
+  memset(slice.c_slice().data.refcounted.bytes, 'a', slice_size);
+  size_t iov_size = 0;
+  for (auto _ : state) {
+    grpc_core::SliceBuffer sb;
+    if (coalesce) sb.EnableCoalescing();
+    for (int i = 0; i < kNumSlices; i++) {
+      memset(sb.AddTiny(2), 0, 2);
+      sb.Append(slice.Ref());
+    }
+    size_t slice_idx = 0;
+    size_t length = 0;
+    iov_size = grpc_core::SliceBufferToIoVecs(
+        sb.c_slice_buffer(), &slice_idx, 0, iovs, 2 * kNumSlices, &length);
+    benchmark::DoNotOptimize(iovs);
+  }
+  state.counters["write_iov_size"] = iov_size;
+}
+BENCHMARK(BM_SliceBuffer_AppendSmall)
+    ->Args({0, 8})
+    ->Args({1, 8})
+    ->Args({0, 32})
+    ->Args({1, 32})
+    ->Args({0, 128})
+    ->Args({1, 128});
+
 }  // namespace testing
 }  // namespace grpc
 
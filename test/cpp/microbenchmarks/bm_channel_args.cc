@@ -20,6 +20,8 @@
 #include <benchmark/benchmark.h>
 
 #include "absl/container/btree_map.h"
+#include "absl/hash/hash.h"
+#include "absl/strings/str_cat.h"
 
 #include <grpcpp/support/channel_arguments.h>
 
@@ -82,6 +84,70 @@ void BM_ChannelArgsAsKeyIntoBTree(benchmark::State& state) {
 }
 BENCHMARK(BM_ChannelArgsAsKeyIntoBTree);
 
+// Args resembling those of a channel after preconditioning.
+grpc_core::ChannelArgs MakeTypicalArgs(int n) {
+  grpc_core::ChannelArgs args;
+  for (int i = 0; i < n; i++) {
+    args = args.Set(absl::StrCat("grpc.some_channel_arg_", i), i);
+  }
+  return args.Set(GRPC_ARG_KEEPALIVE_TIME_MS, 60000)
+      .Set(GRPC_ARG_PRIMARY_USER_AGENT_STRING, "bm_channel_args");
+}
+
+void BM_ChannelArgsEqual(benchmark::State& state) {
+  // Equal args built separately, so the trees are not shared.
+  const auto a = MakeTypicalArgs(state.range(0));
+  const auto b = MakeTypicalArgs(state.range(0));
+  for (auto s : state) {
+    benchmark::DoNotOptimize(a == b);
+  }
+}
+BENCHMARK(BM_ChannelArgsEqual)->Arg(4)->Arg(32);
+
+void BM_ChannelArgsNotEqual(benchmark::State& state) {
+  const auto a = MakeTypicalArgs(state.range(0));
+  const auto b = a.Set(GRPC_ARG_KEEPALIVE_TIME_MS, 30000);
+  for (auto s : state) {
+    benchmark::DoNotOptimize(a == b);
+  }
+}
+BENCHMARK(BM_ChannelArgsNotEqual)->Arg(4)->Arg(32);
+
+void BM_ChannelArgsHash(benchmark::State& state) {
+  const auto a = MakeTypicalArgs(state.range(0));
+  for (auto s : state) {
+    benchmark::DoNotOptimize(absl::HashOf(a));
+  }
+}
+BENCHMARK(BM_ChannelArgsHash)->Arg(4)->Arg(32);
+
+void BM_ChannelArgsGetInt(benchmark::State& state) {
+  const auto a = MakeTypicalArgs(state.range(0));
+  for (auto s : state) {
+    benchmark::DoNotOptimize(a.GetInt(GRPC_ARG_KEEPALIVE_TIME_MS));
+  }
+}
+BENCHMARK(BM_ChannelArgsGetInt)->Arg(4)->Arg(32);
+
+void BM_ChannelArgsGetIntWithKey(benchmark::State& state) {
+  static constexpr grpc_core::ChannelArgs::Key kKeepaliveTime(
+      GRPC_ARG_KEEPALIVE_TIME_MS);
+  const auto a = MakeTypicalArgs(state.range(0));
+  for (auto s : state) {
+    benchmark::DoNotOptimize(a.GetInt(kKeepaliveTime));
+  }
+}
+BENCHMARK(BM_ChannelArgsGetIntWithKey)->Arg(4)->Arg(32);
+
+// Most args that are read are not set, and their defaults apply.
+void BM_ChannelArgsGetUnset(benchmark::State& state) {
+  const auto a = MakeTypicalArgs(state.range(0));
+  for (auto s : state) {
+    benchmark::DoNotOptimize(a.GetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS));
+  }
+}
+BENCHMARK(BM_ChannelArgsGetUnset)->Arg(4)->Arg(32);
+
 // Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
 // and others do not. This allows us to support both modes.
 namespace benchmark {
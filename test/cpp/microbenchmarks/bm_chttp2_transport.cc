@@ -45,6 +45,12 @@
 // Helper classes
 //
 
+// Writes seen by PhonyEndpoints, and the slices in them: slices per write is
+// the iovec count a real endpoint would send with (see the
+// tcp_write_iov_size histogram).
+static size_t g_phony_writes;
+static size_t g_phony_write_slices;
+
 class PhonyEndpoint : public grpc_endpoint {
  public:
   PhonyEndpoint() {
@@ -98,8 +104,10 @@ class PhonyEndpoint : public grpc_endpoint {
     static_cast<PhonyEndpoint*>(ep)->QueueRead(slices, cb);
   }
 
-  static void write(grpc_endpoint* /*ep*/, grpc_slice_buffer* /*slices*/,
+  static void write(grpc_endpoint* /*ep*/, grpc_slice_buffer* slices,
                     grpc_closure* cb, void* /*arg*/, int /*max_frame_size*/) {
+    ++g_phony_writes;
+    g_phony_write_slices += slices->count;
     grpc_core::ExecCtx::Run(DEBUG_LOCATION, cb, absl::OkStatus());
   }
 
@@ -361,9 +369,15 @@ static void BM_StreamCreateSendInitialMetadataDestroy(benchmark::State& state) {
     s->Op(&op);
     s->DestroyThen(start.get());
   });
+  g_phony_writes = 0;
+  g_phony_write_slices = 0;
   grpc_core::ExecCtx::Run(DEBUG_LOCATION, start.get(), absl::OkStatus());
   f.FlushExecCtx();
   gpr_event_wait(&bm_done, gpr_inf_future(GPR_CLOCK_REALTIME));
+  if (g_phony_writes > 0) {
+    state.counters["write_iov_size"] =
+        static_cast<double>(g_phony_write_slices) / g_phony_writes;
+  }
 }
 BENCHMARK_TEMPLATE(BM_StreamCreateSendInitialMetadataDestroy,
                    RepresentativeClientInitialMetadata);
@@ -0,0 +1,153 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark the latency of unary calls on an established TLS connection
+// while the server handshakes a storm of new connections, with and without
+// the handshake offload pool.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpcpp/channel.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include "src/core/lib/security/transport/handshake_offload_pool.h"
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/end2end/data/ssl_test_data.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+constexpr int kStormConnections = 10000;
+constexpr int kStormThreads = 16;
+
+class EchoServer final : public EchoTestService::Service {
+  Status Echo(ServerContext* /*context*/, const EchoRequest* request,
+              EchoResponse* response) override {
+    response->set_message(request->message());
+    return Status::OK;
+  }
+};
+
+static std::shared_ptr<Channel> CreateTlsChannel(const std::string& address,
+                                                 bool own_connection) {
+  SslCredentialsOptions options;
+  options.pem_root_certs = test_root_cert;
+  ChannelArguments args;
+  args.SetSslTargetNameOverride("foo.test.google.fr");
+  // Channels share connections to the same address unless told otherwise.
+  if (own_connection) args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+  return CreateCustomChannel(address, SslCredentials(options), args);
+}
+
+// state.range(0) is the number of handshake offload threads, 0 to handshake
+// on the I/O threads.
+static void BM_EstablishedLatencyDuringHandshakeStorm(benchmark::State& state) {
+  EchoServer service;
+  const std::string address =
+      absl::StrCat("localhost:", grpc_pick_unused_port_or_die());
+  SslServerCredentialsOptions server_options;
+  server_options.pem_key_cert_pairs.push_back(
+      {test_server1_key, test_server1_cert});
+  ServerBuilder builder;
+  builder.AddListeningPort(address, SslServerCredentials(server_options));
+  builder.AddChannelArgument(GRPC_ARG_HANDSHAKE_OFFLOAD_THREADS,
+                             static_cast<int>(state.range(0)));
+  builder.RegisterService(&service);
+  std::unique_ptr<Server> server = builder.BuildAndStart();
+  auto stub = EchoTestService::NewStub(CreateTlsChannel(address, false));
+  EchoRequest request;
+  request.set_message("ping");
+  EchoResponse response;
+  {
+    // Establish the connection before the storm.
+    ClientContext context;
+    GPR_ASSERT(stub->Echo(&context, request, &response).ok());
+  }
+  std::atomic<int> started{0};
+  std::atomic<int> connected{0};
+  std::atomic<bool> stop{false};
+  std::vector<std::thread> storm;
+  for (int i = 0; i < kStormThreads; i++) {
+    storm.emplace_back([&]() {
+      while (!stop.load(std::memory_order_relaxed) &&
+             started.fetch_add(1) < kStormConnections) {
+        auto channel = CreateTlsChannel(address, true);
+        if (channel->WaitForConnected(grpc_timeout_seconds_to_deadline(10))) {
+          connected.fetch_add(1);
+        }
+      }
+    });
+  }
+  std::vector<double> latencies_us;
+  for (auto _ : state) {
+    ClientContext context;
+    auto start = std::chrono::steady_clock::now();
+    GPR_ASSERT(stub->Echo(&context, request, &response).ok());
+    latencies_us.push_back(std::chrono::duration<double, std::micro>(
+                               std::chrono::steady_clock::now() - start)
+                               .count());
+  }
+  const int handshakes_during_run = connected.load();
+  stop.store(true);
+  for (auto& thread : storm) thread.join();
+  std::sort(latencies_us.begin(), latencies_us.end());
+  state.counters["p50_us"] = latencies_us[latencies_us.size() / 2];
+  state.counters["p99_us"] = latencies_us[latencies_us.size() * 99 / 100];
+  state.counters["handshakes"] = handshakes_during_run;
+  server->Shutdown(grpc_timeout_milliseconds_to_deadline(0));
+}
+BENCHMARK(BM_EstablishedLatencyDuringHandshakeStorm)
+    ->Arg(0)
+    ->Arg(4)
+    ->UseRealTime();
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,221 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark parsing of large JSON documents, such as service configs with
+// many method configs and RLS or xDS configs with long strings.
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_join.h"
+
+#include <grpc/event_engine/memory_allocator.h>
+
+#include "src/core/lib/gprpp/time.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/json/json_args.h"
+#include "src/core/lib/json/json_object_loader.h"
+#include "src/core/lib/json/json_view.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// A service config with one method config per service.
+std::string MakeServiceConfig(int num_services) {
+  std::vector<std::string> method_configs;
+  for (int i = 0; i < num_services; ++i) {
+    method_configs.push_back(absl::StrCat(
+        "{\"name\": [{\"service\": \"example.package.v1.Service", i,
+        "\", \"method\": \"Method\"}], \"waitForReady\": true, "
+        "\"timeout\": \"1.5s\", \"maxRequestMessageBytes\": 4194304, "
+        "\"retryPolicy\": {\"maxAttempts\": 3, \"initialBackoff\": \"0.1s\", "
+        "\"maxBackoff\": \"10s\", \"backoffMultiplier\": 2, "
+        "\"retryableStatusCodes\": [\"UNAVAILABLE\", \"ABORTED\"]}}"));
+  }
+  return absl::StrCat(
+      "{\"loadBalancingConfig\": [{\"round_robin\": {}}], "
+      "\"methodConfig\": [",
+      absl::StrJoin(method_configs, ", "), "]}");
+}
+
+void BM_JsonParseServiceConfig(benchmark::State& state) {
+  const std::string json = MakeServiceConfig(state.range(0));
+  for (auto _ : state) {
+    auto parsed = Json::Parse(json);
+    GPR_ASSERT(parsed.ok());
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_JsonParseServiceConfig)->Range(1, 4096);
+
+void BM_JsonViewParseServiceConfig(benchmark::State& state) {
+  const std::string json = MakeServiceConfig(state.range(0));
+  MemoryAllocator memory_allocator =
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("bm");
+  for (auto _ : state) {
+    auto arena = MakeScopedArena(1024, &memory_allocator);
+    auto parsed = JsonView::Parse(json, arena.get());
+    GPR_ASSERT(parsed.ok());
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_JsonViewParseServiceConfig)->Range(1, 4096);
+
+// The parts of a method config that the benchmarks load.
+struct MethodConfig {
+  struct Name {
+    std::string service;
+    std::string method;
+
+    static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+      static const auto* loader = JsonObjectLoader<Name>()
+                                      .OptionalField("service", &Name::service)
+                                      .OptionalField("method", &Name::method)
+                                      .Finish();
+      return loader;
+    }
+  };
+
+  std::vector<Name> names;
+  bool wait_for_ready = false;
+  Duration timeout;
+  uint32_t max_request_message_bytes = 0;
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<MethodConfig>()
+            .Field("name", &MethodConfig::names)
+            .OptionalField("waitForReady", &MethodConfig::wait_for_ready)
+            .OptionalField("timeout", &MethodConfig::timeout)
+            .OptionalField("maxRequestMessageBytes",
+                           &MethodConfig::max_request_message_bytes)
+            .Finish();
+    return loader;
+  }
+};
+
+struct ServiceConfig {
+  std::vector<MethodConfig> method_configs;
+
+  static const JsonLoaderInterface* JsonLoader(const JsonArgs&) {
+    static const auto* loader =
+        JsonObjectLoader<ServiceConfig>()
+            .OptionalField("methodConfig", &ServiceConfig::method_configs)
+            .Finish();
+    return loader;
+  }
+};
+
+// Parses a service config and loads it into C++ objects, as the channel
+// does when it gets a new config.
+void BM_JsonLoadServiceConfig(benchmark::State& state) {
+  const std::string json = MakeServiceConfig(state.range(0));
+  for (auto _ : state) {
+    auto parsed = Json::Parse(json);
+    GPR_ASSERT(parsed.ok());
+    auto config = LoadFromJson<ServiceConfig>(*parsed);
+    GPR_ASSERT(config.ok());
+    benchmark::DoNotOptimize(config);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_JsonLoadServiceConfig)->Range(1, 4096);
+
+void BM_JsonViewLoadServiceConfig(benchmark::State& state) {
+  const std::string json = MakeServiceConfig(state.range(0));
+  MemoryAllocator memory_allocator =
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("bm");
+  for (auto _ : state) {
+    auto arena = MakeScopedArena(1024, &memory_allocator);
+    auto parsed = JsonView::Parse(json, arena.get());
+    GPR_ASSERT(parsed.ok());
+    auto config = LoadFromJson<ServiceConfig>(**parsed);
+    GPR_ASSERT(config.ok());
+    benchmark::DoNotOptimize(config);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_JsonViewLoadServiceConfig)->Range(1, 4096);
+
+// A config dominated by long string values (e.g. embedded certificates and
+// typed configs).
+std::string MakeLongStringsConfig(int string_size) {
+  std::vector<std::string> entries;
+  for (int i = 0; i < 256; ++i) {
+    entries.push_back(absl::StrCat("\"key", i, "\": \"",
+                                   std::string(string_size, 'a' + i % 26),
+                                   "\""));
+  }
+  return absl::StrCat("{", absl::StrJoin(entries, ","), "}");
+}
+
+void BM_JsonParseLongStrings(benchmark::State& state) {
+  const std::string json = MakeLongStringsConfig(state.range(0));
+  for (auto _ : state) {
+    auto parsed = Json::Parse(json);
+    GPR_ASSERT(parsed.ok());
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_JsonParseLongStrings)->Range(16, 16384);
+
+void BM_JsonViewParseLongStrings(benchmark::State& state) {
+  const std::string json = MakeLongStringsConfig(state.range(0));
+  MemoryAllocator memory_allocator =
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("bm");
+  for (auto _ : state) {
+    auto arena = MakeScopedArena(1024, &memory_allocator);
+    auto parsed = JsonView::Parse(json, arena.get());
+    GPR_ASSERT(parsed.ok());
+    benchmark::DoNotOptimize(parsed);
+  }
+  state.SetBytesProcessed(state.iterations() * json.size());
+}
+BENCHMARK(BM_JsonViewParseLongStrings)->Range(16, 16384);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
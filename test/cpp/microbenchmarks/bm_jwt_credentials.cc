@@ -0,0 +1,165 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark the per-call cost of service account JWT credentials when calls
+// alternate between several services.
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <openssl/bio.h>
+#include <openssl/bn.h>
+#include <openssl/pem.h>
+#include <openssl/rsa.h>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/grpc_security.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/gprpp/crash.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/json/json.h"
+#include "src/core/lib/promise/context.h"
+#include "src/core/lib/promise/promise.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/security/context/security_context.h"
+#include "src/core/lib/security/credentials/jwt/jwt_credentials.h"
+#include "src/core/lib/security/security_connector/security_connector.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+// Only there to provide the url scheme of the service url.
+class FakeSecurityConnector : public grpc_channel_security_connector {
+ public:
+  FakeSecurityConnector()
+      : grpc_channel_security_connector("https", nullptr, nullptr) {}
+
+  void check_peer(tsi_peer, grpc_endpoint*, const ChannelArgs&,
+                  RefCountedPtr<grpc_auth_context>*, grpc_closure*) override {
+    Crash("unreachable");
+  }
+
+  void cancel_check_peer(grpc_closure*, grpc_error_handle) override {
+    Crash("unreachable");
+  }
+
+  int cmp(const grpc_security_connector*) const override {
+    GPR_UNREACHABLE_CODE(return 0);
+  }
+
+  ArenaPromise<absl::Status> CheckCallHost(absl::string_view,
+                                           grpc_auth_context*) override {
+    GPR_UNREACHABLE_CODE(
+        return Immediate(absl::PermissionDeniedError("should never happen")));
+  }
+
+  void add_handshakers(const ChannelArgs&, grpc_pollset_set*,
+                       HandshakeManager*) override {
+    Crash("unreachable");
+  }
+};
+
+// A service account key with a freshly generated private key.
+std::string MakeJsonKey() {
+  BIGNUM* e = BN_new();
+  GPR_ASSERT(BN_set_word(e, RSA_F4));
+  RSA* rsa = RSA_new();
+  GPR_ASSERT(RSA_generate_key_ex(rsa, 2048, e, nullptr));
+  BIO* bio = BIO_new(BIO_s_mem());
+  GPR_ASSERT(PEM_write_bio_RSAPrivateKey(bio, rsa, nullptr, nullptr, 0, nullptr,
+                                         nullptr));
+  char* pem_data;
+  long pem_size = BIO_get_mem_data(bio, &pem_data);
+  std::string pem(pem_data, pem_size);
+  BIO_free(bio);
+  RSA_free(rsa);
+  BN_free(e);
+  return Json(Json::Object{
+                  {"type", "service_account"},
+                  {"private_key", pem},
+                  {"private_key_id", "0123456789abcdef"},
+                  {"client_id", "bm.apps.googleusercontent.com"},
+                  {"client_email", "bm@developer.gserviceaccount.com"},
+              })
+      .Dump();
+}
+
+// state.range(0) services are called in turn, so that consecutive calls
+// never share an audience.
+void BM_JwtCredsGetRequestMetadata(benchmark::State& state) {
+  ExecCtx exec_ctx;
+  RefCountedPtr<grpc_call_credentials> creds(
+      grpc_service_account_jwt_access_credentials_create(
+          MakeJsonKey().c_str(), grpc_max_auth_token_lifetime(), nullptr));
+  GPR_ASSERT(creds != nullptr);
+  MemoryAllocator memory_allocator = MemoryAllocator(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("bm"));
+  grpc_call_credentials::GetRequestMetadataArgs args;
+  args.security_connector = MakeRefCounted<FakeSecurityConnector>();
+  std::vector<std::string> authorities;
+  for (int i = 0; i < state.range(0); i++) {
+    authorities.push_back(absl::StrCat("service", i, ".example.com"));
+  }
+  size_t next = 0;
+  for (auto _ : state) {
+    auto arena = MakeScopedArena(1024, &memory_allocator);
+    promise_detail::Context<Arena> arena_context(arena.get());
+    grpc_metadata_batch md(arena.get());
+    md.Set(HttpAuthorityMetadata(),
+           Slice::FromCopiedString(authorities[next++ % authorities.size()]));
+    md.Set(HttpPathMetadata(), Slice::FromStaticString("/Service/Method"));
+    auto promise = creds->GetRequestMetadata(
+        ClientMetadataHandle(&md, Arena::PooledDeleter(nullptr)), &args);
+    auto result = promise();
+    auto* metadata =
+        absl::get_if<absl::StatusOr<ClientMetadataHandle>>(&result);
+    GPR_ASSERT(metadata != nullptr && metadata->ok());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_JwtCredsGetRequestMetadata)->Arg(1)->Arg(2)->Arg(16)->Arg(64);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
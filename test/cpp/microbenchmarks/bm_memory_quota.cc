@@ -0,0 +1,103 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark allocation and release of memory from a single memory quota
+// shared by many threads, as done by all the connections and calls of a
+// busy server.
+
+#include <stddef.h>
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/event_engine/memory_request.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using grpc_event_engine::experimental::MemoryAllocator;
+using grpc_event_engine::experimental::MemoryRequest;
+
+MemoryQuota* GetMemoryQuota() {
+  static MemoryQuota* quota = new MemoryQuota("bm_memory_quota");
+  return quota;
+}
+
+// Each thread owns one long lived allocator (e.g. a connection's) and
+// repeatedly reserves and releases state.range(0) bytes from it, which
+// periodically replenishes from and donates back to the shared quota.
+void BM_MemoryQuotaReserveRelease(benchmark::State& state) {
+  const size_t size = state.range(0);
+  ExecCtx exec_ctx;
+  MemoryAllocator allocator =
+      GetMemoryQuota()->CreateMemoryAllocator("allocator");
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(allocator.Reserve(MemoryRequest(size)));
+    allocator.Release(size);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MemoryQuotaReserveRelease)
+    ->RangeMultiplier(8)
+    ->Range(1024, 1024 * 1024)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+// Each iteration creates a short lived allocator (e.g. a call's), makes one
+// allocation from it and destroys it again, so every iteration takes from
+// and returns to the shared quota.
+void BM_MemoryQuotaAllocatorChurn(benchmark::State& state) {
+  const size_t size = state.range(0);
+  ExecCtx exec_ctx;
+  for (auto _ : state) {
+    MemoryAllocator allocator =
+        GetMemoryQuota()->CreateMemoryAllocator("allocator");
+    benchmark::DoNotOptimize(allocator.Reserve(MemoryRequest(size)));
+    allocator.Release(size);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MemoryQuotaAllocatorChurn)
+    ->RangeMultiplier(8)
+    ->Range(1024, 64 * 1024)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,133 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark many producer threads sending into one mpsc pipe, comparing the
+// mutex protected and lock-free centers.
+
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/status/status.h"
+
+#include <grpc/support/log.h>
+
+#include "src/core/lib/gprpp/notification.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/promise/activity.h"
+#include "src/core/lib/promise/exec_ctx_wakeup_scheduler.h"
+#include "src/core/lib/promise/loop.h"
+#include "src/core/lib/promise/mpsc.h"
+#include "src/core/lib/promise/seq.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int kItemsPerProducer = 1000;
+constexpr size_t kQueueSize = 64;
+
+// state.range(0) threads each run an activity sending kItemsPerProducer
+// items to one receiving activity.
+template <typename Center>
+void BM_MpscManyProducers(benchmark::State& state) {
+  const int producers = state.range(0);
+  const int total = producers * kItemsPerProducer;
+  for (auto _ : state) {
+    MpscReceiver<int, Center> receiver(kQueueSize);
+    std::vector<MpscSender<int, Center>> senders;
+    for (int i = 0; i < producers; i++) {
+      senders.push_back(receiver.MakeSender());
+    }
+    Notification done;
+    int received = 0;
+    ActivityPtr consumer;
+    {
+      ExecCtx exec_ctx;
+      consumer = MakeActivity(
+          Loop([&receiver, &received, total]() {
+            return Seq(receiver.Next(),
+                       [&received, total](int) -> LoopCtl<absl::Status> {
+                         if (++received == total) return absl::OkStatus();
+                         return Continue();
+                       });
+          }),
+          ExecCtxWakeupScheduler(), [&done](absl::Status status) {
+            GPR_ASSERT(status.ok());
+            done.Notify();
+          });
+    }
+    // Producer activities must outlive their threads: they are woken up by
+    // whichever thread runs the consumer.
+    std::vector<ActivityPtr> producer_activities(producers);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < producers; i++) {
+      threads.emplace_back([&senders, &producer_activities, i]() {
+        ExecCtx exec_ctx;
+        MpscSender<int, Center>* sender = &senders[i];
+        producer_activities[i] = MakeActivity(
+            Loop([sender, sent = 0]() mutable {
+              return Seq(sender->Send(sent),
+                         [&sent](bool ok) -> LoopCtl<absl::Status> {
+                           GPR_ASSERT(ok);
+                           if (++sent == kItemsPerProducer) {
+                             return absl::OkStatus();
+                           }
+                           return Continue();
+                         });
+            }),
+            ExecCtxWakeupScheduler(), [](absl::Status status) {
+              GPR_ASSERT(status.ok());
+            });
+      });
+    }
+    done.WaitForNotification();
+    for (auto& thread : threads) thread.join();
+    GPR_ASSERT(received == total);
+  }
+  state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK_TEMPLATE(BM_MpscManyProducers, mpscpipe_detail::Center<int>)
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MpscManyProducers, mpscpipe_detail::LockFreeCenter<int>)
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,154 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark subchannel creation through the global subchannel pool, as done
+// by many channels (e.g. one per tenant) to an overlapping set of backends.
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpc/grpc.h>
+
+#include "src/core/ext/filters/client_channel/connector.h"
+#include "src/core/ext/filters/client_channel/global_subchannel_pool.h"
+#include "src/core/ext/filters/client_channel/subchannel.h"
+#include "src/core/lib/address_utils/parse_address.h"
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/config/core_configuration.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/resolved_address.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+constexpr int kChannels = 10000;
+constexpr int kBackends = 1000;
+// Channels are created with this many distinct sets of args, so each
+// backend ends up with this many subchannels shared by its channels.
+constexpr int kArgVariants = 4;
+
+class NoOpConnector : public SubchannelConnector {
+ public:
+  void Connect(const Args& /*args*/, Result* /*result*/,
+               grpc_closure* /*notify*/) override {}
+  void Shutdown(grpc_error_handle /*error*/) override {}
+};
+
+struct Fixture {
+  Fixture() {
+    ChannelArgs base =
+        CoreConfiguration::Get()
+            .channel_args_preconditioning()
+            .PreconditionChannelArgs(nullptr)
+            .Set(GRPC_ARG_ENABLE_CHANNELZ, false)
+            .Set(GRPC_ARG_PRIMARY_USER_AGENT_STRING, "bm_subchannel_pool")
+            .Set(GRPC_ARG_KEEPALIVE_TIME_MS, 60000)
+            .SetObject(GlobalSubchannelPool::instance());
+    for (int i = 0; i < kArgVariants; ++i) {
+      args.push_back(base.Set(GRPC_ARG_DEFAULT_AUTHORITY,
+                              absl::StrCat("tenant", i, ".example.com")));
+    }
+    for (int i = 0; i < kBackends; ++i) {
+      addresses.push_back(*StringToSockaddr(
+          absl::StrCat("10.0.", i / 256, ".", i % 256), 443));
+    }
+  }
+
+  std::vector<ChannelArgs> args;
+  std::vector<grpc_resolved_address> addresses;
+};
+
+const Fixture& GetFixture() {
+  static const Fixture* fixture = new Fixture();
+  return *fixture;
+}
+
+// Each benchmark thread creates its share of kChannels channels' subchannels
+// (one backend per channel), then releases them all, which unregisters them
+// from the pool again.
+void BM_GlobalSubchannelPoolCreateChannels(benchmark::State& state) {
+  const Fixture& fixture = GetFixture();
+  const int first = kChannels * state.thread_index() / state.threads();
+  const int last = kChannels * (state.thread_index() + 1) / state.threads();
+  std::vector<RefCountedPtr<Subchannel>> subchannels;
+  subchannels.reserve(last - first);
+  for (auto _ : state) {
+    ExecCtx exec_ctx;
+    for (int channel = first; channel < last; ++channel) {
+      subchannels.push_back(Subchannel::Create(
+          MakeOrphanable<NoOpConnector>(),
+          fixture.addresses[channel % kBackends],
+          fixture.args[channel / kBackends % kArgVariants]));
+    }
+    subchannels.clear();
+  }
+  state.SetItemsProcessed(state.iterations() * (last - first));
+}
+BENCHMARK(BM_GlobalSubchannelPoolCreateChannels)
+    ->ThreadRange(1, 16)
+    ->UseRealTime();
+
+// Lookups of subchannels that are already registered, which is what
+// resolver updates to existing channels mostly do.
+void BM_GlobalSubchannelPoolFind(benchmark::State& state) {
+  const Fixture& fixture = GetFixture();
+  ExecCtx exec_ctx;
+  std::vector<RefCountedPtr<Subchannel>> subchannels;
+  std::vector<SubchannelKey> keys;
+  for (int channel = 0; channel < kBackends * kArgVariants; ++channel) {
+    const ChannelArgs& args = fixture.args[channel / kBackends];
+    const grpc_resolved_address& address =
+        fixture.addresses[channel % kBackends];
+    subchannels.push_back(
+        Subchannel::Create(MakeOrphanable<NoOpConnector>(), address, args));
+    keys.emplace_back(address, args);
+  }
+  auto pool = GlobalSubchannelPool::instance();
+  size_t n = state.thread_index();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(pool->FindSubchannel(keys[n++ % keys.size()]));
+  }
+  subchannels.clear();
+}
+BENCHMARK(BM_GlobalSubchannelPoolFind)->ThreadRange(1, 16)->UseRealTime();
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,168 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark XdsClient processing of large CDS responses, replaying a
+// response whose resources are all unchanged versus one whose resources
+// all changed since the previous response.
+
+#include <stddef.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/status/status.h"
+#include "absl/strings/str_cat.h"
+#include "absl/time/time.h"
+
+#include <grpc/support/log.h>
+
+#include "src/core/ext/xds/xds_bootstrap_grpc.h"
+#include "src/core/ext/xds/xds_client.h"
+#include "src/core/ext/xds/xds_cluster.h"
+#include "src/core/lib/event_engine/default_event_engine.h"
+#include "src/core/lib/gprpp/orphanable.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/proto/grpc/testing/xds/v3/cluster.pb.h"
+#include "src/proto/grpc/testing/xds/v3/discovery.pb.h"
+#include "test/core/util/test_config.h"
+#include "test/core/xds/xds_transport_fake.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using ::envoy::config::cluster::v3::Cluster;
+using ::envoy::service::discovery::v3::DiscoveryResponse;
+
+constexpr char kBootstrap[] =
+    "{\n"
+    "  \"xds_servers\": [{\n"
+    "    \"server_uri\": \"xds.example.com:443\",\n"
+    "    \"channel_creds\": [{\"type\": \"insecure\"}]\n"
+    "  }],\n"
+    "  \"node\": {\"id\": \"bm_xds_client\"}\n"
+    "}";
+
+class ClusterWatcher : public XdsClusterResourceType::WatcherInterface {
+ public:
+  void OnResourceChanged(XdsClusterResource /*cluster_data*/) override {}
+  void OnError(absl::Status /*status*/) override {}
+  void OnResourceDoesNotExist() override {}
+};
+
+std::string ClusterName(size_t i) { return absl::StrCat("cluster_", i); }
+
+// A CDS response with num_clusters EDS clusters.  The EDS service names
+// depend on \a generation, so that the resources of responses of
+// different generations all differ.
+std::string MakeCdsResponse(size_t num_clusters, size_t generation) {
+  DiscoveryResponse response;
+  response.set_version_info(absl::StrCat(generation));
+  response.set_nonce(absl::StrCat(generation));
+  response.set_type_url("type.googleapis.com/envoy.config.cluster.v3.Cluster");
+  for (size_t i = 0; i < num_clusters; ++i) {
+    Cluster cluster;
+    cluster.set_name(ClusterName(i));
+    cluster.set_type(Cluster::EDS);
+    auto* eds_cluster_config = cluster.mutable_eds_cluster_config();
+    eds_cluster_config->mutable_eds_config()->mutable_self();
+    eds_cluster_config->set_service_name(
+        absl::StrCat("eds_service_", i, "_", generation));
+    response.add_resources()->PackFrom(cluster);
+  }
+  return response.SerializeAsString();
+}
+
+// Reads the client's requests, so that it can send the next one.
+void DrainRequests(FakeXdsTransportFactory::FakeStreamingCall* stream) {
+  while (stream->HaveMessageFromClient()) {
+    stream->WaitForMessageFromClient(absl::ZeroDuration());
+  }
+}
+
+template <bool kChanged>
+void BM_ProcessCdsResponse(benchmark::State& state) {
+  const size_t num_clusters = state.range(0);
+  auto bootstrap = GrpcXdsBootstrap::Create(kBootstrap);
+  GPR_ASSERT(bootstrap.ok());
+  auto transport_factory = MakeOrphanable<FakeXdsTransportFactory>();
+  RefCountedPtr<FakeXdsTransportFactory> transport_factory_ref =
+      transport_factory->Ref();
+  auto xds_client = MakeRefCounted<XdsClient>(
+      std::move(*bootstrap), std::move(transport_factory),
+      grpc_event_engine::experimental::GetDefaultEventEngine(), "bm", "1");
+  std::vector<RefCountedPtr<ClusterWatcher>> watchers;
+  for (size_t i = 0; i < num_clusters; ++i) {
+    watchers.push_back(MakeRefCounted<ClusterWatcher>());
+    XdsClusterResourceType::StartWatch(xds_client.get(), ClusterName(i),
+                                       watchers.back());
+  }
+  auto stream = transport_factory_ref->WaitForStream(
+      xds_client->bootstrap().server(), FakeXdsTransportFactory::kAdsMethod,
+      absl::Seconds(5));
+  GPR_ASSERT(stream != nullptr);
+  // Replay the responses, alternating between two generations if the
+  // resources should change.
+  const std::string responses[] = {MakeCdsResponse(num_clusters, 0),
+                                   MakeCdsResponse(num_clusters, 1)};
+  stream->SendMessageToClient(responses[0]);
+  DrainRequests(stream.get());
+  size_t next = 1;
+  for (auto _ : state) {
+    stream->SendMessageToClient(responses[kChanged ? next++ % 2 : 0]);
+    DrainRequests(stream.get());
+  }
+  state.SetItemsProcessed(state.iterations() * num_clusters);
+  for (size_t i = 0; i < num_clusters; ++i) {
+    XdsClusterResourceType::CancelWatch(xds_client.get(), ClusterName(i),
+                                        watchers[i].get());
+  }
+  DrainRequests(stream.get());
+}
+BENCHMARK_TEMPLATE(BM_ProcessCdsResponse, false)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000);
+BENCHMARK_TEMPLATE(BM_ProcessCdsResponse, true)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
@@ -0,0 +1,230 @@
+//
+//
+// Copyright 2023 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+// Benchmark xDS virtual host and route selection over large synthetic route
+// configs, scanning the lists versus using the indexes.
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpc/event_engine/memory_allocator.h>
+#include <grpc/support/log.h>
+
+#include "src/core/ext/xds/xds_route_config.h"
+#include "src/core/ext/xds/xds_routing.h"
+#include "src/core/lib/matchers/matchers.h"
+#include "src/core/lib/resource_quota/arena.h"
+#include "src/core/lib/resource_quota/memory_quota.h"
+#include "src/core/lib/resource_quota/resource_quota.h"
+#include "src/core/lib/slice/slice.h"
+#include "src/core/lib/transport/metadata_batch.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc_core {
+namespace {
+
+using Matchers = XdsRouteConfigResource::Route::Matchers;
+
+class RouteList : public XdsRouting::RouteListIterator {
+ public:
+  // Mostly exact routes, as generated for gRPC services, with some prefix
+  // routes that also match a header and some regex routes, followed by a
+  // default route.
+  explicit RouteList(size_t num_routes) {
+    for (size_t i = 0; i + 1 < num_routes; ++i) {
+      Matchers matchers;
+      switch (i % 10) {
+        case 7:
+          matchers.path_matcher =
+              StringMatcher::Create(StringMatcher::Type::kPrefix,
+                                    absl::StrCat("/pkg.Tenant", i, "/"))
+                  .value();
+          matchers.header_matchers.push_back(
+              HeaderMatcher::Create("x-tenant", HeaderMatcher::Type::kExact,
+                                    absl::StrCat("t", i))
+                  .value());
+          break;
+        case 9:
+          matchers.path_matcher =
+              StringMatcher::Create(StringMatcher::Type::kSafeRegex,
+                                    absl::StrCat("/pkg\\.Regex", i, "/.*"))
+                  .value();
+          break;
+        default:
+          matchers.path_matcher =
+              StringMatcher::Create(StringMatcher::Type::kExact, Path(i))
+                  .value();
+      }
+      matchers_.push_back(std::move(matchers));
+    }
+    Matchers default_route;
+    default_route.path_matcher =
+        StringMatcher::Create(StringMatcher::Type::kPrefix, "").value();
+    matchers_.push_back(std::move(default_route));
+  }
+
+  // Path of a request that matches route \a i.
+  static std::string Path(size_t i) {
+    switch (i % 10) {
+      case 7:
+        return absl::StrCat("/pkg.Tenant", i, "/Method");
+      case 9:
+        return absl::StrCat("/pkg.Regex", i, "/Method");
+      default:
+        return absl::StrCat("/pkg.Service", i / 10, "/Method", i % 10);
+    }
+  }
+
+  size_t Size() const override { return matchers_.size(); }
+
+  const Matchers& GetMatchersForRoute(size_t index) const override {
+    return matchers_[index];
+  }
+
+ private:
+  std::vector<Matchers> matchers_;
+};
+
+class VirtualHostList : public XdsRouting::VirtualHostListIterator {
+ public:
+  // Each virtual host has an exact and a wildcard domain, followed by a
+  // catch-all virtual host.
+  explicit VirtualHostList(size_t num_vhosts) {
+    for (size_t i = 0; i + 1 < num_vhosts; ++i) {
+      domains_.push_back({absl::StrCat("svc", i, ".example.com"),
+                          absl::StrCat("*.svc", i, ".example.com")});
+    }
+    domains_.push_back({"*"});
+  }
+
+  size_t Size() const override { return domains_.size(); }
+
+  const std::vector<std::string>& GetDomainsForVirtualHost(
+      size_t index) const override {
+    return domains_[index];
+  }
+
+ private:
+  std::vector<std::vector<std::string>> domains_;
+};
+
+// Requests are spread over the whole route list, including requests that
+// fall through to the default route.
+std::vector<std::string> MakePaths(size_t num_routes) {
+  std::vector<std::string> paths;
+  for (size_t i = 0; i < 64; ++i) {
+    paths.push_back(i % 8 == 0 ? "/unknown.Service/Method"
+                               : RouteList::Path(i * num_routes / 64));
+  }
+  return paths;
+}
+
+std::vector<std::string> MakeAuthorities(size_t num_vhosts) {
+  std::vector<std::string> authorities;
+  for (size_t i = 0; i < 64; ++i) {
+    const size_t vhost = i * num_vhosts / 64;
+    authorities.push_back(
+        i % 8 == 0   ? "unknown.example.org"
+        : i % 2 == 0 ? absl::StrCat("svc", vhost, ".example.com")
+                     : absl::StrCat("api.svc", vhost, ".example.com"));
+  }
+  return authorities;
+}
+
+template <bool kIndexed>
+void BM_GetRouteForRequest(benchmark::State& state) {
+  RouteList routes(state.range(0));
+  XdsRouting::RouteIndex index(routes);
+  std::vector<std::string> paths = MakePaths(routes.Size());
+  MemoryAllocator memory_allocator = MemoryAllocator(
+      ResourceQuota::Default()->memory_quota()->CreateMemoryAllocator("bm"));
+  auto arena = MakeScopedArena(1024, &memory_allocator);
+  grpc_metadata_batch md(arena.get());
+  md.Append("x-tenant", Slice::FromStaticString("t7"),
+            [](absl::string_view, const Slice&) { abort(); });
+  size_t next = 0;
+  for (auto _ : state) {
+    const std::string& path = paths[next++ % paths.size()];
+    auto route = kIndexed ? index.GetRouteForRequest(routes, path, &md)
+                          : XdsRouting::GetRouteForRequest(routes, path, &md);
+    GPR_ASSERT(route.has_value());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_GetRouteForRequest, false)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000);
+BENCHMARK_TEMPLATE(BM_GetRouteForRequest, true)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000);
+
+template <bool kIndexed>
+void BM_FindVirtualHostForDomain(benchmark::State& state) {
+  VirtualHostList vhosts(state.range(0));
+  XdsRouting::VirtualHostIndex index(vhosts);
+  std::vector<std::string> authorities = MakeAuthorities(vhosts.Size());
+  size_t next = 0;
+  for (auto _ : state) {
+    const std::string& authority = authorities[next++ % authorities.size()];
+    auto vhost = kIndexed
+                     ? index.Find(authority)
+                     : XdsRouting::FindVirtualHostForDomain(vhosts, authority);
+    GPR_ASSERT(vhost.has_value());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_FindVirtualHostForDomain, false)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000);
+BENCHMARK_TEMPLATE(BM_FindVirtualHostForDomain, true)
+    ->Arg(10)
+    ->Arg(100)
+    ->Arg(1000);
+
+}  // namespace
+}  // namespace grpc_core
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(&argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
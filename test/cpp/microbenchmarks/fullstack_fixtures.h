@@ -71,10 +71,14 @@ class BaseFixture {
 class FullstackFixture : public BaseFixture {
  public:
   FullstackFixture(Service* service, const FixtureConfiguration& config,
-                   const std::string& address) {
+                   const std::string& address,
+                   std::shared_ptr<ServerCredentials> server_creds =
+                       InsecureServerCredentials(),
+                   std::shared_ptr<ChannelCredentials> channel_creds =
+                       InsecureChannelCredentials()) {
     ServerBuilder b;
     if (address.length() > 0) {
-      b.AddListeningPort(address, InsecureServerCredentials());
+      b.AddListeningPort(address, std::move(server_creds));
     }
     cq_ = b.AddCompletionQueue(true);
     b.RegisterService(service);
@@ -83,8 +87,8 @@ class FullstackFixture : public BaseFixture {
     ChannelArguments args;
     config.ApplyCommonChannelArguments(&args);
     if (address.length() > 0) {
-      channel_ = grpc::CreateCustomChannel(address,
-                                           InsecureChannelCredentials(), args);
+      channel_ =
+          grpc::CreateCustomChannel(address, std::move(channel_creds), args);
     } else {
       channel_ = server_->InProcessChannel(args);
     }